@@ -3,13 +3,17 @@ import random
 import enum
 import socket
 
-CURRENT_REQUEST_VERSION = 1
+CURRENT_REQUEST_VERSION = 2
 MAX_REQUEST_DATA_SIZE = 32
-MAX_PACKET_SIZE = 48
+MAX_BATCH_DATA_SIZE = 1024
+MAX_BATCH_ENTRIES = (MAX_BATCH_DATA_SIZE - 4) // 8
+MAX_PACKET_SIZE = 16 + MAX_BATCH_DATA_SIZE
 
 class RequestType(enum.IntEnum):
     ReadMemory = 1,
-    WriteMemory = 2
+    WriteMemory = 2,
+    BatchReadMemory = 3,
+    BatchWriteMemory = 4
 
 CITRA_PORT = 45987
 
@@ -90,6 +94,66 @@ class Citra:
                 return False
         return True
 
+    def batch_read_memory(self, reads):
+        """
+        Reads several scattered addresses with a single request.
+
+        `reads` is a list of (address, size) tuples. Returns a list of bytes
+        objects in the same order, or None on failure. The total size of all
+        reads must fit in one reply (MAX_BATCH_DATA_SIZE bytes).
+
+        >>> c.batch_read_memory([(0x100000, 4), (0x100004, 4)])
+        [b'\\x07\\x00\\x00\\xeb', b'\\xcc\\x00\\x00\\xea']
+        """
+        assert len(reads) <= MAX_BATCH_ENTRIES
+        assert sum(size for _, size in reads) <= MAX_BATCH_DATA_SIZE
+
+        request_data = struct.pack("I", len(reads))
+        for address, size in reads:
+            request_data += struct.pack("II", address, size)
+        request, request_id = self._generate_header(RequestType.BatchReadMemory, len(request_data))
+        self.socket.sendto(request + request_data, (self.address, CITRA_PORT))
+
+        raw_reply = self.socket.recv(MAX_PACKET_SIZE)
+        reply_data = self._read_and_validate_header(raw_reply, request_id, RequestType.BatchReadMemory)
+        if not reply_data:
+            return None
+
+        results = []
+        offset = 0
+        for _, size in reads:
+            results.append(reply_data[offset:offset + size])
+            offset += size
+        return results
+
+    def batch_write_memory(self, writes):
+        """
+        Writes several scattered addresses with a single request.
+
+        `writes` is a list of (address, contents) tuples. Returns True on
+        success. The whole batch must fit in one request packet.
+
+        >>> c.batch_write_memory([(0x100000, b"\\xff\\xff\\xff\\xff")])
+        True
+        >>> c.read_memory(0x100000, 4)
+        b'\\xff\\xff\\xff\\xff'
+        >>> c.batch_write_memory([(0x100000, b"\\x07\\x00\\x00\\xeb")])
+        True
+        """
+        assert len(writes) <= MAX_BATCH_ENTRIES
+
+        request_data = struct.pack("I", len(writes))
+        for address, contents in writes:
+            request_data += struct.pack("II", address, len(contents))
+            request_data += contents
+        assert len(request_data) <= MAX_BATCH_DATA_SIZE
+        request, request_id = self._generate_header(RequestType.BatchWriteMemory, len(request_data))
+        self.socket.sendto(request + request_data, (self.address, CITRA_PORT))
+
+        raw_reply = self.socket.recv(MAX_PACKET_SIZE)
+        reply_data = self._read_and_validate_header(raw_reply, request_id, RequestType.BatchWriteMemory)
+        return reply_data is not None
+
 if "__main__" == __name__:
     import doctest
     doctest.testmod(extraglobs={'c': Citra()})
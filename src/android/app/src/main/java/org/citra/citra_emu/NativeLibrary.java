@@ -198,6 +198,25 @@ public final class NativeLibrary {
      **/
     public static native double[] GetPerfStats();
 
+    /**
+     * Returns the direct buffer shared with the native side, used to exchange frequently updated
+     * state (on-screen stick axes, performance stats) without a JNI transition per update.
+     * The layout must be kept in sync with InputManager::SharedStateBuffer in input_manager.h;
+     * the buffer must be read and written in native byte order.
+     **/
+    public static native java.nio.ByteBuffer GetStateBuffer();
+
+    // Field offsets into the buffer returned by GetStateBuffer()
+    public static final int STATE_BUFFER_INPUT_GENERATION = 0;
+    public static final int STATE_BUFFER_CIRCLE_PAD_X = 4;
+    public static final int STATE_BUFFER_CIRCLE_PAD_Y = 8;
+    public static final int STATE_BUFFER_C_STICK_X = 12;
+    public static final int STATE_BUFFER_C_STICK_Y = 16;
+    public static final int STATE_BUFFER_SYSTEM_FPS = 24;
+    public static final int STATE_BUFFER_GAME_FPS = 32;
+    public static final int STATE_BUFFER_FRAMETIME = 40;
+    public static final int STATE_BUFFER_EMULATION_SPEED = 48;
+
     /**
      * Notifies the core emulation that the orientation has changed.
      */
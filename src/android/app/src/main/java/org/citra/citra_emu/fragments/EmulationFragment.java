@@ -31,6 +31,9 @@ import org.citra.citra_emu.utils.DirectoryStateReceiver;
 import org.citra.citra_emu.utils.EmulationMenuSettings;
 import org.citra.citra_emu.utils.Log;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
 public final class EmulationFragment extends Fragment implements SurfaceHolder.Callback, Choreographer.FrameCallback {
     private static final String KEY_GAMEPATH = "gamepath";
 
@@ -188,17 +191,19 @@ public final class EmulationFragment extends Fragment implements SurfaceHolder.C
 
     public void updateShowFpsOverlay() {
         if (EmulationMenuSettings.getShowFps()) {
-            final int SYSTEM_FPS = 0;
-            final int FPS = 1;
-            final int FRAMETIME = 2;
-            final int SPEED = 3;
+            final ByteBuffer stateBuffer =
+                    NativeLibrary.GetStateBuffer().order(ByteOrder.nativeOrder());
 
             perfStatsUpdater = () ->
             {
-                final double[] perfStats = NativeLibrary.GetPerfStats();
-                if (perfStats[FPS] > 0) {
-                    mPerfStats.setText(String.format("FPS: %d Speed: %d%%", (int) (perfStats[FPS] + 0.5),
-                            (int) (perfStats[SPEED] * 100.0 + 0.5)));
+                // The stats are published into the shared state buffer by the native side,
+                // so polling them does not cross the JNI boundary
+                final double fps = stateBuffer.getDouble(NativeLibrary.STATE_BUFFER_GAME_FPS);
+                final double speed =
+                        stateBuffer.getDouble(NativeLibrary.STATE_BUFFER_EMULATION_SPEED);
+                if (fps > 0) {
+                    mPerfStats.setText(String.format("FPS: %d Speed: %d%%", (int) (fps + 0.5),
+                            (int) (speed * 100.0 + 0.5)));
                 }
 
                 perfStatsUpdateHandler.postDelayed(perfStatsUpdater, 3000);
@@ -31,6 +31,8 @@ import org.citra.citra_emu.NativeLibrary.ButtonType;
 import org.citra.citra_emu.R;
 import org.citra.citra_emu.utils.EmulationMenuSettings;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.HashSet;
 import java.util.Set;
 
@@ -50,6 +52,11 @@ public final class InputOverlay extends SurfaceView implements OnTouchListener {
 
     private SharedPreferences mPreferences;
 
+    // State buffer shared with native, used to publish the stick axes without a JNI
+    // transition per touch event.
+    private final ByteBuffer mStateBuffer =
+            NativeLibrary.GetStateBuffer().order(ByteOrder.nativeOrder());
+
     // Stores the ID of the pointer that interacted with the 3DS touchscreen.
     private int mTouchscreenPointerId = -1;
 
@@ -367,8 +374,14 @@ public final class InputOverlay extends SurfaceView implements OnTouchListener {
                 continue;
             }
             int axisID = joystick.getJoystickId();
-            NativeLibrary
-                    .onGamePadMoveEvent(NativeLibrary.TouchScreenDevice, axisID, joystick.getXAxis(), joystick.getYAxis());
+            // Publish the axes to the shared state buffer; native folds them in once per frame
+            int base = axisID == ButtonType.STICK_C
+                    ? NativeLibrary.STATE_BUFFER_C_STICK_X
+                    : NativeLibrary.STATE_BUFFER_CIRCLE_PAD_X;
+            mStateBuffer.putFloat(base, joystick.getXAxis());
+            mStateBuffer.putFloat(base + 4, joystick.getYAxis());
+            mStateBuffer.putInt(NativeLibrary.STATE_BUFFER_INPUT_GENERATION,
+                    mStateBuffer.getInt(NativeLibrary.STATE_BUFFER_INPUT_GENERATION) + 1);
             shouldUpdateView = true;
         }
 
@@ -91,12 +91,22 @@ udp_pad_index=
 # 0: Interpreter (slow), 1 (default): JIT (fast)
 use_cpu_jit =
 
+# Whether to map guest memory into a host virtual address arena so the JIT can access it directly
+# 0: Software page table, 1 (default): Fastmem arena where supported
+use_fastmem =
+
 # Change the Clock Frequency of the emulated 3DS CPU.
 # Underclocking can increase the performance of the game at the risk of freezing.
 # Overclocking may fix lag that happens on console, but also comes with the risk of freezing.
 # Range is any positive integer (but we suspect 25 - 400 is a good idea) Default is 100
 cpu_clock_percentage =
 
+# Whether to make the emulated filesystem as slow as a real 3DS SD card or NAND chip.
+# Disabling removes the modeled delays, which speeds up loading in many games but can break
+# timing-sensitive ones.
+# 0: Off, 1 (default): On
+emulate_fs_timings =
+
 [Renderer]
 # Whether to render using OpenGL
 # 1: OpenGL-ES (default), 2: Vulkan
@@ -122,6 +132,10 @@ shaders_accurate_mul =
 # 0: Interpreter (slow), 1 (default): JIT (fast)
 use_shader_jit =
 
+# Clip and rasterize triangles on a worker thread when the software renderer is in use
+# 0 (default): Off, 1: On
+async_software_rendering =
+
 # Forces VSync on the display thread. Usually doesn't impact performance, but on some drivers it can
 # so only turn this off if you notice a speed difference.
 # 0: Off, 1 (default): On
@@ -136,6 +150,11 @@ use_disk_shader_cache =
 # factor for the 3DS resolution
 resolution_factor =
 
+# Automatically lower the resolution scale when the host cannot sustain full speed, and raise
+# it again when there is headroom, up to the configured resolution_factor
+# 0: Off (default), 1: On
+dynamic_resolution =
+
 # Whether to enable V-Sync (caps the framerate at 60FPS) or not.
 # 0 (default): Off, 1: On
 vsync_enabled =
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cmath>
 #include <list>
 #include <mutex>
@@ -23,6 +24,9 @@ static std::shared_ptr<ButtonFactory> button;
 static std::shared_ptr<AnalogFactory> analog;
 static std::shared_ptr<NDKMotionFactory> motion;
 
+static SharedStateBuffer shared_state{};
+static u32 last_input_generation;
+
 // Button Handler
 class KeyButton final : public Input::ButtonDevice {
 public:
@@ -311,6 +315,34 @@ NDKMotionFactory* NDKMotionHandler() {
     return motion.get();
 }
 
+SharedStateBuffer* GetSharedStateBuffer() {
+    return &shared_state;
+}
+
+void ApplySharedInputState() {
+    const u32 generation = shared_state.input_generation;
+    if (generation == last_input_generation) {
+        return;
+    }
+    last_input_generation = generation;
+
+    const auto move_joystick = [](int analog_id, float x, float y) {
+        // Same clamping as onGamePadMoveEvent: the frontend sends an inverted y axis, and the
+        // input must stay within the unit circle
+        x = std::clamp(x, -1.f, 1.f);
+        y = std::clamp(-y, -1.f, 1.f);
+        float r = x * x + y * y;
+        if (r > 1.0f) {
+            r = std::sqrt(r);
+            x /= r;
+            y /= r;
+        }
+        analog->MoveJoystick(analog_id, x, y);
+    };
+    move_joystick(N3DS_CIRCLEPAD, shared_state.circle_pad_x, shared_state.circle_pad_y);
+    move_joystick(N3DS_STICK_C, shared_state.c_stick_x, shared_state.c_stick_y);
+}
+
 void Init() {
     button = std::make_shared<ButtonFactory>();
     analog = std::make_shared<AnalogFactory>();
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <string>
+#include "common/common_types.h"
 #include "core/frontend/input.h"
 #include "jni/ndk_motion.h"
 
@@ -117,6 +118,34 @@ private:
     std::shared_ptr<AnalogList> analog_list;
 };
 
+/**
+ * State block shared with the Java frontend through a direct ByteBuffer, so the hot
+ * per-touch-event and per-poll paths do not pay a JNI transition each.
+ *
+ * The frontend writes the on-screen stick axes and then bumps input_generation; the native side
+ * folds them into the analog devices once per presented frame. Going the other way, the native
+ * side periodically publishes the performance stats, which the frontend reads directly.
+ * The field offsets are mirrored as constants in NativeLibrary.java and must stay in sync.
+ */
+struct SharedStateBuffer {
+    volatile u32 input_generation; ///< Bumped by the frontend after it updates the axes below
+    float circle_pad_x;
+    float circle_pad_y;
+    float c_stick_x;
+    float c_stick_y;
+    u32 padding; ///< Keeps the stats below 8-byte aligned
+    double system_fps;
+    double game_fps;
+    double frametime;
+    double emulation_speed;
+};
+
+/// Gets the state block shared with the Java frontend.
+SharedStateBuffer* GetSharedStateBuffer();
+
+/// Applies any stick state the frontend has published since the last call.
+void ApplySharedInputState();
+
 /// Initializes and registers all built-in input device factories.
 void Init();
 
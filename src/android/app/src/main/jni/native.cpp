@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <chrono>
 #include <thread>
 
 #include <android/api-level.h>
@@ -119,6 +120,29 @@ static void LoadDiskCacheProgress(VideoCore::LoadCallbackStage stage, int progre
 
 static Camera::NDK::Factory* g_ndk_factory{};
 
+// Mirrors the perf stats into the state block shared with the frontend, so the frontend overlay
+// can read them without a JNI transition per poll
+static void PublishPerfStats() {
+    constexpr std::chrono::milliseconds publish_interval{500};
+    static std::chrono::steady_clock::time_point last_publish;
+    const auto now = std::chrono::steady_clock::now();
+    if (now - last_publish < publish_interval) {
+        return;
+    }
+    last_publish = now;
+
+    auto& core = Core::System::GetInstance();
+    if (!core.IsPoweredOn()) {
+        return;
+    }
+    const auto results = core.GetAndResetPerfStats();
+    auto* shared_state = InputManager::GetSharedStateBuffer();
+    shared_state->system_fps = results.system_fps;
+    shared_state->game_fps = results.game_fps;
+    shared_state->frametime = results.frametime;
+    shared_state->emulation_speed = results.emulation_speed;
+}
+
 static void TryShutdown() {
     if (!window) {
         return;
@@ -288,6 +312,8 @@ void Java_org_citra_citra_1emu_NativeLibrary_DoFrame(JNIEnv* env, [[maybe_unused
     if (stop_run || pause_emulation) {
         return;
     }
+    InputManager::ApplySharedInputState();
+    PublishPerfStats();
     window->TryPresenting();
 }
 
@@ -571,6 +597,12 @@ jdoubleArray Java_org_citra_citra_1emu_NativeLibrary_GetPerfStats(JNIEnv* env,
     return j_stats;
 }
 
+jobject Java_org_citra_citra_1emu_NativeLibrary_GetStateBuffer(JNIEnv* env,
+                                                               [[maybe_unused]] jclass clazz) {
+    return env->NewDirectByteBuffer(InputManager::GetSharedStateBuffer(),
+                                    sizeof(InputManager::SharedStateBuffer));
+}
+
 void Java_org_citra_citra_1emu_utils_DirectoryInitialization_SetSysDirectory(
     JNIEnv* env, [[maybe_unused]] jclass clazz, jstring j_path) {
     std::string_view path = env->GetStringUTFChars(j_path, 0);
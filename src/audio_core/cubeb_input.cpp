@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
 #include <utility>
 #include <vector>
 #include <cubeb/cubeb.h>
@@ -9,17 +10,17 @@
 #include "audio_core/input.h"
 #include "audio_core/sink.h"
 #include "common/logging/log.h"
-#include "common/threadsafe_queue.h"
+#include "common/ring_buffer.h"
 
 namespace AudioCore {
 
-using SampleQueue = Common::SPSCQueue<Samples>;
-
 struct CubebInput::Impl {
     cubeb* ctx = nullptr;
     cubeb_stream* stream = nullptr;
 
-    std::unique_ptr<SampleQueue> sample_queue{};
+    /// Lock-free ring shared between the capture callback and the emulation thread. Sized to
+    /// hold one second of 16-bit samples at the 16kHz rates the MIC service uses.
+    Common::RingBuffer<u8, 0x8000> sample_ring{};
     u8 sample_size_in_bytes = 0;
 
     static long DataCallback(cubeb_stream* stream, void* user_data, const void* input_buffer,
@@ -33,7 +34,6 @@ CubebInput::CubebInput(std::string device_id)
         LOG_ERROR(Audio, "cubeb_init failed! Mic will not work properly");
         return;
     }
-    impl->sample_queue = std::make_unique<SampleQueue>();
 }
 
 CubebInput::~CubebInput() {
@@ -126,11 +126,10 @@ void CubebInput::AdjustSampleRate(u32 sample_rate) {
 }
 
 Samples CubebInput::Read() {
-    Samples samples{};
-    Samples queue;
-    while (impl->sample_queue->Pop(queue)) {
-        samples.insert(samples.end(), queue.begin(), queue.end());
-    }
+    // Drain everything the capture callback has accumulated since the last poll in one batch.
+    Samples samples(impl->sample_ring.Size());
+    const std::size_t popped = impl->sample_ring.Pop(samples.data(), samples.size());
+    samples.resize(popped);
     return samples;
 }
 
@@ -145,21 +144,29 @@ long CubebInput::Impl::DataCallback(cubeb_stream* stream, void* user_data, const
         return static_cast<u8>(static_cast<u16>(sample) >> 8);
     };
 
-    std::vector<u8> samples{};
-    samples.reserve(num_frames * impl->sample_size_in_bytes);
+    // This runs on the realtime capture thread; convert through a small stack buffer and push
+    // into the lock-free ring without allocating. If the emulation thread falls behind the ring
+    // simply drops the oldest chunk's worth of new samples.
     if (impl->sample_size_in_bytes == 1) {
         // If the sample format is 8bit, then resample back to 8bit before passing back to core
-        for (std::size_t i = 0; i < static_cast<std::size_t>(num_frames); i++) {
-            s16 data;
-            std::memcpy(&data, static_cast<const u8*>(input_buffer) + i * 2, 2);
-            samples.push_back(resample_s16_s8(data));
+        std::array<u8, 512> converted;
+        std::size_t frames_remaining = static_cast<std::size_t>(num_frames);
+        const u8* data = static_cast<const u8*>(input_buffer);
+        while (frames_remaining > 0) {
+            const std::size_t chunk = std::min(frames_remaining, converted.size());
+            for (std::size_t i = 0; i < chunk; i++) {
+                s16 sample;
+                std::memcpy(&sample, data + i * 2, 2);
+                converted[i] = resample_s16_s8(sample);
+            }
+            impl->sample_ring.Push(converted.data(), chunk);
+            data += chunk * 2;
+            frames_remaining -= chunk;
         }
     } else {
         // Otherwise copy all of the samples to the buffer (which will be treated as s16 by core)
-        const u8* data = reinterpret_cast<const u8*>(input_buffer);
-        samples.insert(samples.begin(), data, data + num_frames * impl->sample_size_in_bytes);
+        impl->sample_ring.Push(input_buffer, num_frames * impl->sample_size_in_bytes);
     }
-    impl->sample_queue->Push(samples);
 
     // returning less than num_frames here signals cubeb to stop sampling
     return num_frames;
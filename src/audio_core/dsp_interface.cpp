@@ -7,6 +7,7 @@
 #include "audio_core/sink.h"
 #include "audio_core/sink_details.h"
 #include "common/assert.h"
+#include "common/perf_counters.h"
 #include "common/settings.h"
 #include "core/core.h"
 #include "core/dumping/backend.h"
@@ -17,6 +18,14 @@ DspInterface::DspInterface() = default;
 DspInterface::~DspInterface() = default;
 
 void DspInterface::SetSink(AudioCore::SinkType sink_type, std::string_view audio_device) {
+    if (sink && sink_type == current_sink_type && audio_device == current_sink_device) {
+        // Reopening an audio device is disruptive and slow; skip it when nothing changed.
+        // Settings::Apply calls this unconditionally whenever any setting is modified.
+        return;
+    }
+    current_sink_type = sink_type;
+    current_sink_device = std::string{audio_device};
+
     // Dispose of the current sink first to avoid contention.
     sink.reset();
 
@@ -66,9 +75,8 @@ void DspInterface::OutputSample(std::array<s16, 2> sample) {
 void DspInterface::OutputCallback(s16* buffer, std::size_t num_frames) {
     std::size_t frames_written;
     if (perform_time_stretching) {
-        const std::vector<s16> in{fifo.Pop()};
-        const std::size_t num_in{in.size() / 2};
-        frames_written = time_stretcher.Process(in.data(), num_in, buffer, num_frames);
+        const std::size_t num_in = fifo.Pop(stretcher_input.data());
+        frames_written = time_stretcher.Process(stretcher_input.data(), num_in, buffer, num_frames);
     } else if (flushing_time_stretcher) {
         time_stretcher.Flush();
         frames_written = time_stretcher.Process(nullptr, 0, buffer, num_frames);
@@ -82,14 +90,22 @@ void DspInterface::OutputCallback(s16* buffer, std::size_t num_frames) {
         std::memcpy(&last_frame[0], buffer + 2 * (frames_written - 1), 2 * sizeof(s16));
     }
 
+    if (frames_written < num_frames) {
+        // The sink asked for more samples than were queued; the remainder is padded with
+        // the held frame below, which the player hears as a glitch
+        Common::PerfCounters::Add(Common::PerfCounters::Counter::AudioUnderruns);
+    }
+
     // Hold last emitted frame; this prevents popping.
     for (std::size_t i = frames_written; i < num_frames; i++) {
         std::memcpy(buffer + 2 * i, &last_frame[0], 2 * sizeof(s16));
     }
 
     // Implementation of the hardware volume slider
-    // A cubic curve is used to approximate a linear change in human-perceived loudness
-    const float linear_volume = std::clamp(Settings::Volume(), 0.0f, 1.0f);
+    // A cubic curve is used to approximate a linear change in human-perceived loudness.
+    // This callback runs on the audio backend thread, so read the volume from the immutable
+    // per-frame settings snapshot instead of racing the live values.
+    const float linear_volume = std::clamp(Settings::GetFrameSettings()->volume, 0.0f, 1.0f);
     if (linear_volume != 1.0) {
         const float volume_scale_factor = linear_volume * linear_volume * linear_volume;
         for (std::size_t i = 0; i < num_frames; i++) {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 #include <boost/serialization/access.hpp>
 #include "audio_core/audio_types.h"
@@ -109,12 +110,21 @@ private:
     void FlushResidualStretcherAudio();
     void OutputCallback(s16* buffer, std::size_t num_frames);
 
+    /// Number of stereo frames the output fifo can hold
+    static constexpr std::size_t fifo_slots = 0x2000;
+
     std::atomic<bool> perform_time_stretching = false;
     std::atomic<bool> flushing_time_stretcher = false;
-    Common::RingBuffer<s16, 0x2000, 2> fifo;
+    Common::RingBuffer<s16, fifo_slots, 2> fifo;
+    /// Scratch buffer the fifo is drained into before stretching. A member rather than a local
+    /// so the realtime audio callback performs no allocations.
+    std::array<s16, fifo_slots * 2> stretcher_input;
     std::array<s16, 2> last_frame{};
     TimeStretcher time_stretcher;
     std::unique_ptr<Sink> sink;
+    /// Sink parameters currently in use, so SetSink can skip a needless device reopen.
+    SinkType current_sink_type{};
+    std::string current_sink_device;
 
     template <class Archive>
     void serialize(Archive& ar, const unsigned int) {}
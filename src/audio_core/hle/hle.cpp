@@ -2,6 +2,8 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <future>
+#include <utility>
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/shared_ptr.hpp>
@@ -30,6 +32,7 @@
 #include "common/common_types.h"
 #include "common/hash.h"
 #include "common/logging/log.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 
@@ -78,13 +81,15 @@ private:
     void ResetPipes();
     void WriteU16(DspPipe pipe_number, u16 value);
     void AudioPipeWriteStructAddresses();
+    void FinishPendingDecode();
 
     std::size_t CurrentRegionIndex() const;
     HLE::SharedMemory& ReadRegion();
     HLE::SharedMemory& WriteRegion();
 
-    StereoFrame16 GenerateCurrentFrame();
-    bool Tick();
+    void FinishPendingFrame();
+    void QueueFrameGeneration();
+    void GenerateFrameAsync();
     void AudioTickCallback(s64 cycles_late);
 
     DspState dsp_state = DspState::Off;
@@ -105,11 +110,37 @@ private:
     Core::TimingEventType* tick_event{};
 
     std::unique_ptr<HLE::DecoderBase> decoder{};
+    /// Decode requests run on this worker so a slow AAC decode overlaps the audio frame instead
+    /// of stalling the thread that wrote the pipe. The result is committed to the binary pipe on
+    /// the next audio tick, or earlier if the application demands it. Declared after the decoder
+    /// so in-flight work is joined before the decoder is destroyed.
+    std::future<std::optional<HLE::BinaryMessage>> pending_decode{};
+    Common::ThreadWorker decode_worker{1, "DspDecoder"};
+
+    /// One audio frame generated ahead of time on the frame worker. The inputs are snapshotted
+    /// on the emulation thread when the frame is queued, and the outputs are committed to the
+    /// shared memory region on the next audio tick, so frame generation overlaps CPU emulation
+    /// with one frame of lookahead.
+    struct PendingFrame {
+        HLE::IntermediateMixSamples read_samples;
+        std::size_t write_region_index;
+        std::array<HLE::SourceStatus::Status, HLE::num_sources> source_statuses;
+        HLE::DspStatus dsp_status;
+        HLE::IntermediateMixSamples write_samples;
+        StereoFrame16 frame;
+    };
+    std::unique_ptr<PendingFrame> frame_in_flight{};
+    std::future<void> pending_frame{};
+    Common::ThreadWorker frame_worker{1, "DspHleFrame"};
 
     std::weak_ptr<DSP_DSP> dsp_dsp{};
 
     template <class Archive>
     void serialize(Archive& ar, const unsigned int) {
+        // Commit any in-flight decode so the serialized pipe data is complete.
+        FinishPendingDecode();
+        // Join the in-flight audio frame so the sources, mixers and memory region are settled.
+        FinishPendingFrame();
         ar& dsp_state;
         ar& pipe_data;
         ar& dsp_memory.raw_memory;
@@ -206,6 +237,11 @@ std::vector<u8> DspHle::Impl::PipeRead(DspPipe pipe_number, u32 length) {
         return {};
     }
 
+    if (pipe_number == DspPipe::Binary) {
+        // The application is demanding the decode result; wait for it if still in flight.
+        FinishPendingDecode();
+    }
+
     std::vector<u8>& data = pipe_data[pipe_index];
 
     if (length > data.size()) {
@@ -219,6 +255,12 @@ std::vector<u8> DspHle::Impl::PipeRead(DspPipe pipe_number, u32 length) {
     if (length == 0)
         return {};
 
+    // Reads almost always drain the pipe completely, so hand the storage over instead of
+    // copying it and shifting the remainder to the front.
+    if (length == data.size()) {
+        return std::exchange(data, {});
+    }
+
     std::vector<u8> ret(data.begin(), data.begin() + length);
     data.erase(data.begin(), data.begin() + length);
     return ret;
@@ -291,7 +333,6 @@ void DspHle::Impl::PipeWrite(DspPipe pipe_number, const std::vector<u8>& buffer)
         return;
     }
     case DspPipe::Binary: {
-        // TODO(B3N30): Make this async, and signal the interrupt
         HLE::BinaryMessage request{};
         if (sizeof(request) != buffer.size()) {
             LOG_CRITICAL(Audio_DSP, "got binary pipe with wrong size {}", buffer.size());
@@ -304,12 +345,12 @@ void DspHle::Impl::PipeWrite(DspPipe pipe_number, const std::vector<u8>& buffer)
             UNIMPLEMENTED();
             return;
         }
-        std::optional<HLE::BinaryMessage> response = decoder->ProcessRequest(request);
-        if (response) {
-            const HLE::BinaryMessage& value = *response;
-            pipe_data[static_cast<u32>(pipe_number)].resize(sizeof(value));
-            std::memcpy(pipe_data[static_cast<u32>(pipe_number)].data(), &value, sizeof(value));
-        }
+        // The decoder handles requests in order; commit the previous one before queueing.
+        FinishPendingDecode();
+        std::packaged_task<std::optional<HLE::BinaryMessage>()> decode_task(
+            [this, request] { return decoder->ProcessRequest(request); });
+        pending_decode = decode_task.get_future();
+        decode_worker.QueueWork(std::move(decode_task));
         break;
     }
     default:
@@ -404,57 +445,115 @@ HLE::SharedMemory& DspHle::Impl::WriteRegion() {
     return CurrentRegionIndex() != 0 ? dsp_memory.region_0 : dsp_memory.region_1;
 }
 
-StereoFrame16 DspHle::Impl::GenerateCurrentFrame() {
+void DspHle::Impl::FinishPendingFrame() {
+    if (!pending_frame.valid()) {
+        return;
+    }
+    pending_frame.get();
+
+    PendingFrame& pending = *frame_in_flight;
+    HLE::SharedMemory& write =
+        pending.write_region_index == 0 ? dsp_memory.region_0 : dsp_memory.region_1;
+
+    for (std::size_t i = 0; i < HLE::num_sources; i++) {
+        write.source_statuses.status[i] = pending.source_statuses[i];
+    }
+    write.dsp_status = pending.dsp_status;
+    write.intermediate_mix_samples = pending.write_samples;
+
+    // Write the generated output frame to the shared memory region
+    for (std::size_t samplei = 0; samplei < pending.frame.size(); samplei++) {
+        for (std::size_t channeli = 0; channeli < pending.frame[0].size(); channeli++) {
+            write.final_samples.pcm16[samplei][channeli] = s16_le(pending.frame[samplei][channeli]);
+        }
+    }
+
+    parent.OutputFrame(std::move(pending.frame));
+}
+
+void DspHle::Impl::QueueFrameGeneration() {
+    // TODO: Check dsp::DSP semaphore (which indicates emulated application has finished writing to
+    // shared memory region)
     HLE::SharedMemory& read = ReadRegion();
-    HLE::SharedMemory& write = WriteRegion();
+
+    if (!frame_in_flight) {
+        frame_in_flight = std::make_unique<PendingFrame>();
+    }
+
+    // Configuration parsing consumes the dirty flags in the shared memory region, so it stays on
+    // the emulation thread where the application can observe them cleared; only frame generation
+    // and mixing move to the worker.
+    for (std::size_t i = 0; i < HLE::num_sources; i++) {
+        sources[i].ParseConfig(read.source_configurations.config[i],
+                               read.adpcm_coefficients.coeff[i]);
+    }
+    mixers.ParseConfig(read.dsp_configuration);
+
+    frame_in_flight->read_samples = read.intermediate_mix_samples;
+    frame_in_flight->write_region_index = CurrentRegionIndex() == 0 ? 1 : 0;
+
+    std::packaged_task<void()> frame_task([this] { GenerateFrameAsync(); });
+    pending_frame = frame_task.get_future();
+    frame_worker.QueueWork(std::move(frame_task));
+}
+
+void DspHle::Impl::GenerateFrameAsync() {
+    PendingFrame& pending = *frame_in_flight;
 
     std::array<QuadFrame32, 3> intermediate_mixes = {};
 
     // Generate intermediate mixes
     for (std::size_t i = 0; i < HLE::num_sources; i++) {
-        write.source_statuses.status[i] =
-            sources[i].Tick(read.source_configurations.config[i], read.adpcm_coefficients.coeff[i]);
+        pending.source_statuses[i] = sources[i].TickFrame();
         for (std::size_t mix = 0; mix < 3; mix++) {
             sources[i].MixInto(intermediate_mixes[mix], mix);
         }
     }
 
     // Generate final mix
-    write.dsp_status = mixers.Tick(read.dsp_configuration, read.intermediate_mix_samples,
-                                   write.intermediate_mix_samples, intermediate_mixes);
+    pending.dsp_status =
+        mixers.TickFrame(pending.read_samples, pending.write_samples, intermediate_mixes);
 
-    StereoFrame16 output_frame = mixers.GetOutput();
+    pending.frame = mixers.GetOutput();
+}
 
-    // Write current output frame to the shared memory region
-    for (std::size_t samplei = 0; samplei < output_frame.size(); samplei++) {
-        for (std::size_t channeli = 0; channeli < output_frame[0].size(); channeli++) {
-            write.final_samples.pcm16[samplei][channeli] = s16_le(output_frame[samplei][channeli]);
-        }
+void DspHle::Impl::FinishPendingDecode() {
+    if (!pending_decode.valid()) {
+        return;
+    }
+    const std::optional<HLE::BinaryMessage> response = pending_decode.get();
+    if (response) {
+        const HLE::BinaryMessage& value = *response;
+        auto& data = pipe_data[static_cast<u32>(DspPipe::Binary)];
+        data.resize(sizeof(value));
+        std::memcpy(data.data(), &value, sizeof(value));
     }
-
-    return output_frame;
 }
 
-bool DspHle::Impl::Tick() {
-    StereoFrame16 current_frame = {};
-
-    // TODO: Check dsp::DSP semaphore (which indicates emulated application has finished writing to
-    // shared memory region)
-    current_frame = GenerateCurrentFrame();
-
-    parent.OutputFrame(std::move(current_frame));
+void DspHle::Impl::AudioTickCallback(s64 cycles_late) {
+    // Commit last frame's decode result before the binary pipe interrupt is raised below.
+    // Decodes normally complete well within one audio frame, so this only blocks when the
+    // decoder genuinely cannot keep up.
+    FinishPendingDecode();
 
-    return GetDspState() == DspState::On;
-}
+    // Commit the audio frame generated during the previous tick to the shared memory region
+    // and the sink. Generation runs one frame ahead on the frame worker, so this only blocks
+    // when the worker cannot produce a frame within one frame's worth of walltime.
+    FinishPendingFrame();
 
-void DspHle::Impl::AudioTickCallback(s64 cycles_late) {
-    if (Tick()) {
+    if (GetDspState() == DspState::On) {
         // TODO(merry): Signal all the other interrupts as appropriate.
         if (auto service = dsp_dsp.lock()) {
             service->SignalInterrupt(InterruptType::Pipe, DspPipe::Audio);
-            // HACK(merry): Added to prevent regressions. Will remove soon.
-            service->SignalInterrupt(InterruptType::Pipe, DspPipe::Binary);
+            // Only wake binary pipe waiters when there is actually a decode result to
+            // consume; decode results are committed above, so an empty pipe stays empty
+            // until the next request.
+            if (!pipe_data[static_cast<u32>(DspPipe::Binary)].empty()) {
+                service->SignalInterrupt(InterruptType::Pipe, DspPipe::Binary);
+            }
         }
+
+        QueueFrameGeneration();
     }
 
     // Reschedule recurrent event
@@ -5,9 +5,16 @@
 #include <algorithm>
 #include <cstddef>
 #include "audio_core/hle/mixers.h"
+#include "common/arch.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
 
+#if CITRA_ARCH(x86_64)
+#include <emmintrin.h>
+#elif CITRA_ARCH(arm64)
+#include <arm_neon.h>
+#endif
+
 namespace AudioCore::HLE {
 
 void Mixers::Reset() {
@@ -20,6 +27,12 @@ DspStatus Mixers::Tick(DspConfiguration& config, const IntermediateMixSamples& r
                        const std::array<QuadFrame32, 3>& input) {
     ParseConfig(config);
 
+    return TickFrame(read_samples, write_samples, input);
+}
+
+DspStatus Mixers::TickFrame(const IntermediateMixSamples& read_samples,
+                            IntermediateMixSamples& write_samples,
+                            const std::array<QuadFrame32, 3>& input) {
     AuxReturn(read_samples);
     AuxSend(write_samples, input);
 
@@ -84,6 +97,85 @@ void Mixers::ParseConfig(DspConfiguration& config) {
     config.dirty_raw = 0;
 }
 
+#if CITRA_ARCH(x86_64)
+
+// Downmixes two quadraphonic samples per iteration. Packing the downmixed words saturates
+// exactly like ClampToS16 and the saturated word add matches AddAndClampToS16.
+static void DownmixMono(float gain, const QuadFrame32& samples, StereoFrame16& frame) {
+    const __m128 gain4 = _mm_set1_ps(gain);
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (std::size_t i = 0; i < samples_per_frame; i += 2) {
+        const __m128 a = _mm_mul_ps(
+            _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(samples[i].data()))),
+            gain4);
+        const __m128 b = _mm_mul_ps(
+            _mm_cvtepi32_ps(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples[i + 1].data()))),
+            gain4);
+        const __m128 lo = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m128 hi = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m128 pairs = _mm_add_ps(lo, hi);
+        const __m128 swapped = _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m128i mono = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(pairs, swapped), half));
+        const __m128i packed = _mm_packs_epi32(mono, mono);
+        __m128i* const out = reinterpret_cast<__m128i*>(frame[i].data());
+        _mm_storel_epi64(out, _mm_adds_epi16(_mm_loadl_epi64(out), packed));
+    }
+}
+
+static void DownmixStereo(float gain, const QuadFrame32& samples, StereoFrame16& frame) {
+    const __m128 gain4 = _mm_set1_ps(gain);
+    for (std::size_t i = 0; i < samples_per_frame; i += 2) {
+        const __m128 a = _mm_mul_ps(
+            _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(samples[i].data()))),
+            gain4);
+        const __m128 b = _mm_mul_ps(
+            _mm_cvtepi32_ps(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples[i + 1].data()))),
+            gain4);
+        const __m128 lo = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m128 hi = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m128i lr = _mm_cvttps_epi32(_mm_add_ps(lo, hi));
+        const __m128i packed = _mm_packs_epi32(lr, lr);
+        __m128i* const out = reinterpret_cast<__m128i*>(frame[i].data());
+        _mm_storel_epi64(out, _mm_adds_epi16(_mm_loadl_epi64(out), packed));
+    }
+}
+
+#elif CITRA_ARCH(arm64)
+
+// Downmixes two quadraphonic samples per iteration. The saturating narrow matches ClampToS16
+// and the saturated halfword add matches AddAndClampToS16.
+static void DownmixMono(float gain, const QuadFrame32& samples, StereoFrame16& frame) {
+    const float32x4_t gain4 = vdupq_n_f32(gain);
+    for (std::size_t i = 0; i < samples_per_frame; i += 2) {
+        const float32x4_t a = vmulq_f32(vcvtq_f32_s32(vld1q_s32(samples[i].data())), gain4);
+        const float32x4_t b = vmulq_f32(vcvtq_f32_s32(vld1q_s32(samples[i + 1].data())), gain4);
+        const float32x2_t pairs_a = vadd_f32(vget_low_f32(a), vget_high_f32(a));
+        const float32x2_t pairs_b = vadd_f32(vget_low_f32(b), vget_high_f32(b));
+        const float32x2_t mono = vmul_n_f32(vpadd_f32(pairs_a, pairs_b), 0.5f);
+        const int32x2_t mono_i = vcvt_s32_f32(mono);
+        const int32x4_t quad = vcombine_s32(vdup_lane_s32(mono_i, 0), vdup_lane_s32(mono_i, 1));
+        const int16x4_t packed = vqmovn_s32(quad);
+        vst1_s16(frame[i].data(), vqadd_s16(vld1_s16(frame[i].data()), packed));
+    }
+}
+
+static void DownmixStereo(float gain, const QuadFrame32& samples, StereoFrame16& frame) {
+    const float32x4_t gain4 = vdupq_n_f32(gain);
+    for (std::size_t i = 0; i < samples_per_frame; i += 2) {
+        const float32x4_t a = vmulq_f32(vcvtq_f32_s32(vld1q_s32(samples[i].data())), gain4);
+        const float32x4_t b = vmulq_f32(vcvtq_f32_s32(vld1q_s32(samples[i + 1].data())), gain4);
+        const float32x2_t lr_a = vadd_f32(vget_low_f32(a), vget_high_f32(a));
+        const float32x2_t lr_b = vadd_f32(vget_low_f32(b), vget_high_f32(b));
+        const int32x4_t lr = vcombine_s32(vcvt_s32_f32(lr_a), vcvt_s32_f32(lr_b));
+        const int16x4_t packed = vqmovn_s32(lr);
+        vst1_s16(frame[i].data(), vqadd_s16(vld1_s16(frame[i].data()), packed));
+    }
+}
+
+#else
+
 static s16 ClampToS16(s32 value) {
     return static_cast<s16>(std::clamp(value, -32768, 32767));
 }
@@ -94,22 +186,41 @@ static std::array<s16, 2> AddAndClampToS16(const std::array<s16, 2>& a,
             ClampToS16(static_cast<s32>(a[1]) + static_cast<s32>(b[1]))};
 }
 
+static void DownmixMono(float gain, const QuadFrame32& samples, StereoFrame16& frame) {
+    std::transform(frame.begin(), frame.end(), samples.begin(), frame.begin(),
+                   [gain](const std::array<s16, 2>& accumulator,
+                          const std::array<s32, 4>& sample) -> std::array<s16, 2> {
+                       // Downmix to mono
+                       s16 mono = ClampToS16(static_cast<s32>((gain * sample[0] + gain * sample[1] +
+                                                               gain * sample[2] +
+                                                               gain * sample[3]) /
+                                                              2));
+                       // Mix into current frame
+                       return AddAndClampToS16(accumulator, {mono, mono});
+                   });
+}
+
+static void DownmixStereo(float gain, const QuadFrame32& samples, StereoFrame16& frame) {
+    std::transform(frame.begin(), frame.end(), samples.begin(), frame.begin(),
+                   [gain](const std::array<s16, 2>& accumulator,
+                          const std::array<s32, 4>& sample) -> std::array<s16, 2> {
+                       // Downmix to stereo
+                       s16 left = ClampToS16(static_cast<s32>(gain * sample[0] + gain * sample[2]));
+                       s16 right =
+                           ClampToS16(static_cast<s32>(gain * sample[1] + gain * sample[3]));
+                       // Mix into current frame
+                       return AddAndClampToS16(accumulator, {left, right});
+                   });
+}
+
+#endif
+
 void Mixers::DownmixAndMixIntoCurrentFrame(float gain, const QuadFrame32& samples) {
     // TODO(merry): Limiter. (Currently we're performing final mixing assuming a disabled limiter.)
 
     switch (state.output_format) {
     case OutputFormat::Mono:
-        std::transform(
-            current_frame.begin(), current_frame.end(), samples.begin(), current_frame.begin(),
-            [gain](const std::array<s16, 2>& accumulator,
-                   const std::array<s32, 4>& sample) -> std::array<s16, 2> {
-                // Downmix to mono
-                s16 mono = ClampToS16(static_cast<s32>(
-                    (gain * sample[0] + gain * sample[1] + gain * sample[2] + gain * sample[3]) /
-                    2));
-                // Mix into current frame
-                return AddAndClampToS16(accumulator, {mono, mono});
-            });
+        DownmixMono(gain, samples, current_frame);
         return;
 
     case OutputFormat::Surround:
@@ -117,16 +228,7 @@ void Mixers::DownmixAndMixIntoCurrentFrame(float gain, const QuadFrame32& sample
         // fallthrough
 
     case OutputFormat::Stereo:
-        std::transform(
-            current_frame.begin(), current_frame.end(), samples.begin(), current_frame.begin(),
-            [gain](const std::array<s16, 2>& accumulator,
-                   const std::array<s32, 4>& sample) -> std::array<s16, 2> {
-                // Downmix to stereo
-                s16 left = ClampToS16(static_cast<s32>(gain * sample[0] + gain * sample[2]));
-                s16 right = ClampToS16(static_cast<s32>(gain * sample[1] + gain * sample[3]));
-                // Mix into current frame
-                return AddAndClampToS16(accumulator, {left, right});
-            });
+        DownmixStereo(gain, samples, current_frame);
         return;
     }
 
@@ -22,6 +22,16 @@ public:
     DspStatus Tick(DspConfiguration& config, const IntermediateMixSamples& read_samples,
                    IntermediateMixSamples& write_samples, const std::array<QuadFrame32, 3>& input);
 
+    /// Updates internal state from the configuration and consumes its dirty flags. This is the
+    /// first half of Tick(), split out so mixing can run on another thread while the
+    /// configuration is parsed on the thread that owns the shared memory region.
+    void ParseConfig(DspConfiguration& config);
+
+    /// Mixes this frame from previously parsed state. The second half of Tick().
+    DspStatus TickFrame(const IntermediateMixSamples& read_samples,
+                        IntermediateMixSamples& write_samples,
+                        const std::array<QuadFrame32, 3>& input);
+
     StereoFrame16 GetOutput() const {
         return current_frame;
     }
@@ -42,8 +52,6 @@ private:
 
     } state;
 
-    /// INTERNAL: Update our internal state based on the current config.
-    void ParseConfig(DspConfiguration& config);
     /// INTERNAL: Read samples from shared memory that have been modified by the ARM11.
     void AuxReturn(const IntermediateMixSamples& read_samples);
     /// INTERNAL: Write samples to shared memory for the ARM11 to modify.
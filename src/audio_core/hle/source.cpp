@@ -8,16 +8,27 @@
 #include "audio_core/hle/common.h"
 #include "audio_core/hle/source.h"
 #include "audio_core/interpolate.h"
+#include "common/arch.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "core/memory.h"
 
+#if CITRA_ARCH(x86_64)
+#include <emmintrin.h>
+#elif CITRA_ARCH(arm64)
+#include <arm_neon.h>
+#endif
+
 namespace AudioCore::HLE {
 
 SourceStatus::Status Source::Tick(SourceConfiguration::Configuration& config,
                                   const s16_le (&adpcm_coeffs)[16]) {
     ParseConfig(config, adpcm_coeffs);
 
+    return TickFrame();
+}
+
+SourceStatus::Status Source::TickFrame() {
     if (state.enabled) {
         GenerateFrame();
     }
@@ -29,14 +40,34 @@ void Source::MixInto(QuadFrame32& dest, std::size_t intermediate_mix_id) const {
     if (!state.enabled)
         return;
 
+    // Conversion from stereo (current_frame) to quadraphonic (dest) occurs here.
     const std::array<float, 4>& gains = state.gain.at(intermediate_mix_id);
+#if CITRA_ARCH(x86_64)
+    const __m128 gain = _mm_loadu_ps(gains.data());
+    for (std::size_t samplei = 0; samplei < samples_per_frame; samplei++) {
+        const __m128 frame = _mm_setr_ps(current_frame[samplei][0], current_frame[samplei][1],
+                                         current_frame[samplei][0], current_frame[samplei][1]);
+        const __m128i mixed = _mm_cvttps_epi32(_mm_mul_ps(gain, frame));
+        __m128i* const out = reinterpret_cast<__m128i*>(dest[samplei].data());
+        _mm_storeu_si128(out, _mm_add_epi32(_mm_loadu_si128(out), mixed));
+    }
+#elif CITRA_ARCH(arm64)
+    const float32x4_t gain = vld1q_f32(gains.data());
+    for (std::size_t samplei = 0; samplei < samples_per_frame; samplei++) {
+        const float32x2_t stereo = {static_cast<float>(current_frame[samplei][0]),
+                                    static_cast<float>(current_frame[samplei][1])};
+        const float32x4_t frame = vcombine_f32(stereo, stereo);
+        const int32x4_t mixed = vcvtq_s32_f32(vmulq_f32(gain, frame));
+        vst1q_s32(dest[samplei].data(), vaddq_s32(vld1q_s32(dest[samplei].data()), mixed));
+    }
+#else
     for (std::size_t samplei = 0; samplei < samples_per_frame; samplei++) {
-        // Conversion from stereo (current_frame) to quadraphonic (dest) occurs here.
         dest[samplei][0] += static_cast<s32>(gains[0] * current_frame[samplei][0]);
         dest[samplei][1] += static_cast<s32>(gains[1] * current_frame[samplei][1]);
         dest[samplei][2] += static_cast<s32>(gains[2] * current_frame[samplei][0]);
         dest[samplei][3] += static_cast<s32>(gains[3] * current_frame[samplei][1]);
     }
+#endif
 }
 
 void Source::Reset() {
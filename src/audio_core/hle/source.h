@@ -56,6 +56,20 @@ public:
     SourceStatus::Status Tick(SourceConfiguration::Configuration& config,
                               const s16_le (&adpcm_coeffs)[16]);
 
+    /**
+     * Updates internal state from the configuration and consumes its dirty flags. This is the
+     * first half of Tick(), split out so frame generation can run on another thread while the
+     * configuration is parsed on the thread that owns the shared memory region.
+     */
+    void ParseConfig(SourceConfiguration::Configuration& config, const s16_le (&adpcm_coeffs)[16]);
+
+    /**
+     * Generates this frame's audio output from previously parsed state. The second half of
+     * Tick().
+     * @return The current status of this Source.
+     */
+    SourceStatus::Status TickFrame();
+
     /**
      * Mix this source's output into dest, using the gains for the `intermediate_mix_id`-th
      * intermediate mixer.
@@ -185,8 +199,6 @@ private:
 
     // Internal functions
 
-    /// INTERNAL: Update our internal state based on the current config.
-    void ParseConfig(SourceConfiguration::Configuration& config, const s16_le (&adpcm_coeffs)[16]);
     /// INTERNAL: Generate the current audio output for this frame based on our internal state.
     void GenerateFrame();
     /// INTERNAL: Dequeues a buffer and does preprocessing on it (decoding, resampling). Puts it
@@ -4,6 +4,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 #include "audio_core/input_details.h"
@@ -88,6 +90,14 @@ const InputDetails& GetInputDetails(InputType input_type) {
 
     return *iter;
 }
+
+/// Cached results of list_devices. Microphone enumeration hits the same slow backend probes
+/// as the sinks, so every input backend is probed at most once per process, on the first
+/// request for its device list.
+std::mutex input_device_list_mutex;
+std::array<std::optional<std::vector<std::string>>,
+           static_cast<std::size_t>(InputType::NumInputTypes)>
+    input_device_list_cache;
 } // Anonymous namespace
 
 std::string_view GetInputName(InputType input_type) {
@@ -98,7 +108,13 @@ std::string_view GetInputName(InputType input_type) {
 }
 
 std::vector<std::string> GetDeviceListForInput(InputType input_type) {
-    return GetInputDetails(input_type).list_devices();
+    const auto& details = GetInputDetails(input_type);
+    std::lock_guard lock(input_device_list_mutex);
+    auto& cached_list = input_device_list_cache[static_cast<std::size_t>(details.type)];
+    if (!cached_list) {
+        cached_list = details.list_devices();
+    }
+    return *cached_list;
 }
 
 std::unique_ptr<Input> CreateInputFromID(InputType input_type, std::string_view device_id) {
@@ -29,18 +29,35 @@ static void StepOverSamples(State& state, StereoBuffer16& input, float rate, Ste
     u64 fposition = state.fposition;
     std::size_t inputi = 0;
 
-    while (outputi < output.size()) {
-        inputi = static_cast<std::size_t>(fposition / scale_factor);
-
-        if (inputi + 2 >= input.size()) {
-            inputi = input.size() - 2;
-            break;
+    if (step_size == scale_factor && fposition == 0) {
+        // Fast path: at unity rate with no fractional offset every step reads the next input
+        // sample with a zero fraction, so both interpolation modes degenerate to a copy.
+        const std::size_t max_outputs = input.size() - 2;
+        std::size_t produced = 0;
+        while (outputi < output.size() && produced < max_outputs) {
+            output[outputi++] = input[produced++];
+        }
+        if (outputi < output.size()) {
+            // Input exhausted; mirror the clamp in the generic loop below.
+            inputi = max_outputs;
+        } else {
+            inputi = produced > 0 ? produced - 1 : 0;
         }
+        fposition = produced * scale_factor;
+    } else {
+        while (outputi < output.size()) {
+            inputi = static_cast<std::size_t>(fposition / scale_factor);
 
-        u64 fraction = fposition & scale_mask;
-        output[outputi++] = fn(fraction, input[inputi], input[inputi + 1], input[inputi + 2]);
+            if (inputi + 2 >= input.size()) {
+                inputi = input.size() - 2;
+                break;
+            }
 
-        fposition += step_size;
+            u64 fraction = fposition & scale_mask;
+            output[outputi++] = fn(fraction, input[inputi], input[inputi + 1], input[inputi + 2]);
+
+            fposition += step_size;
+        }
     }
 
     state.xn2 = input[inputi];
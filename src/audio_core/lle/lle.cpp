@@ -131,6 +131,10 @@ struct DspLle::Impl final {
         StopTeakraThread();
     }
 
+    // The Teak execution core (and therefore any recompiler for it) lives in the teakra
+    // library; this class only drives its pipe/semaphore interface and slice scheduling.
+    // Until teakra grows a JIT, the multithread option below is the available mitigation,
+    // moving interpretation off the CPU thread.
     Teakra::Teakra teakra;
     u16 pipe_base_waddr = 0;
 
@@ -4,6 +4,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 #include "audio_core/null_sink.h"
@@ -81,6 +83,14 @@ const SinkDetails& GetSinkDetails(SinkType sink_type) {
 
     return *iter;
 }
+
+/// Cached results of list_devices. Enumerating devices can take hundreds of milliseconds on
+/// some backends (e.g. cubeb on WASAPI), so every backend is probed at most once per process,
+/// on the first request for its device list.
+std::mutex sink_device_list_mutex;
+std::array<std::optional<std::vector<std::string>>,
+           static_cast<std::size_t>(SinkType::NumSinkTypes)>
+    sink_device_list_cache;
 } // Anonymous namespace
 
 std::string_view GetSinkName(SinkType sink_type) {
@@ -91,7 +101,13 @@ std::string_view GetSinkName(SinkType sink_type) {
 }
 
 std::vector<std::string> GetDeviceListForSink(SinkType sink_type) {
-    return GetSinkDetails(sink_type).list_devices();
+    const auto& details = GetSinkDetails(sink_type);
+    std::lock_guard lock(sink_device_list_mutex);
+    auto& cached_list = sink_device_list_cache[static_cast<std::size_t>(details.type)];
+    if (!cached_list) {
+        cached_list = details.list_devices();
+    }
+    return *cached_list;
 }
 
 std::unique_ptr<Sink> CreateSinkFromID(SinkType sink_type, std::string_view device_id) {
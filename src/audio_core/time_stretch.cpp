@@ -35,7 +35,9 @@ std::size_t TimeStretcher::Process(const s16* in, std::size_t num_in, s16* out,
 
     const double max_latency = 0.25; // seconds
     const double max_backlog = sample_rate * max_latency;
-    const double backlog_fullness = sound_touch->numSamples() / max_backlog;
+    const std::size_t backlog_frames =
+        bypass_active ? bypass_queue.size() / 2 : sound_touch->numSamples();
+    const double backlog_fullness = backlog_frames / max_backlog;
     if (backlog_fullness > 4.0) {
         // Too many samples in backlog: Don't push anymore on
         num_in = 0;
@@ -57,20 +59,75 @@ std::size_t TimeStretcher::Process(const s16* in, std::size_t num_in, s16* out,
     // Place a lower limit of 5% speed. When a game boots up, there will be
     // many silence samples. These do not need to be timestretched.
     stretch_ratio = std::max(stretch_ratio, 0.05);
-    sound_touch->setTempo(stretch_ratio);
 
-    LOG_TRACE(Audio, "{:5}/{:5} ratio:{:0.6f} backlog:{:0.6f}", num_in, num_out, stretch_ratio,
-              backlog_fullness);
+    UpdateBypassState(num_out);
+
+    LOG_TRACE(Audio, "{:5}/{:5} ratio:{:0.6f} backlog:{:0.6f} bypass:{}", num_in, num_out,
+              stretch_ratio, backlog_fullness, bypass_active);
+
+    if (bypass_active) {
+        // Emulation is running at (effectively) full speed: hand the samples through untouched
+        // instead of paying for SoundTouch's resampling at a tempo of 1.0.
+        bypass_queue.insert(bypass_queue.end(), in, in + num_in * 2);
+        const std::size_t frames_out = std::min(num_out, bypass_queue.size() / 2);
+        std::copy(bypass_queue.begin(), bypass_queue.begin() + frames_out * 2, out);
+        bypass_queue.erase(bypass_queue.begin(), bypass_queue.begin() + frames_out * 2);
+        return frames_out;
+    }
 
+    sound_touch->setTempo(stretch_ratio);
     sound_touch->putSamples(in, static_cast<u32>(num_in));
     return sound_touch->receiveSamples(out, static_cast<u32>(num_out));
 }
 
+void TimeStretcher::UpdateBypassState(std::size_t num_out) {
+    // The band is asymmetric so minor ratio jitter around 1.0 does not flip the path every few
+    // callbacks; the low-pass filtered ratio must drift well away from 1.0 to re-engage
+    // SoundTouch.
+    constexpr double enter_threshold = 0.005;
+    constexpr double exit_threshold = 0.020;
+    const double deviation = std::abs(stretch_ratio - 1.0);
+
+    if (bypass_active) {
+        if (deviation > exit_threshold) {
+            // Hand the buffered samples back to SoundTouch so none are lost.
+            sound_touch->setTempo(stretch_ratio);
+            sound_touch->putSamples(bypass_queue.data(),
+                                    static_cast<u32>(bypass_queue.size() / 2));
+            bypass_queue.clear();
+            bypass_active = false;
+        }
+        return;
+    }
+
+    if (deviation < enter_threshold) {
+        // Drain what SoundTouch still holds before switching over, so the transition is
+        // seamless. flush() pushes out the tail of its internal input buffer.
+        sound_touch->flush();
+        u32 received = 0;
+        do {
+            const std::size_t old_size = bypass_queue.size();
+            bypass_queue.resize(old_size + num_out * 2);
+            received = sound_touch->receiveSamples(bypass_queue.data() + old_size,
+                                                   static_cast<u32>(num_out));
+            bypass_queue.resize(old_size + received * 2);
+        } while (received > 0);
+        sound_touch->clear();
+        bypass_active = true;
+    }
+}
+
 void TimeStretcher::Clear() {
     sound_touch->clear();
+    bypass_queue.clear();
+    bypass_active = false;
 }
 
 void TimeStretcher::Flush() {
+    if (bypass_active) {
+        // The bypass queue holds raw samples; there is nothing buffered inside SoundTouch.
+        return;
+    }
     sound_touch->flush();
 }
 
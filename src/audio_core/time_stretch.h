@@ -7,6 +7,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <vector>
 #include "common/common_types.h"
 
 namespace soundtouch {
@@ -34,9 +35,15 @@ public:
     void Flush();
 
 private:
+    /// Enables or disables the passthrough path depending on the smoothed stretch ratio.
+    void UpdateBypassState(std::size_t num_out);
+
     unsigned int sample_rate;
     std::unique_ptr<soundtouch::SoundTouch> sound_touch;
     double stretch_ratio = 1.0;
+    /// Buffered interleaved samples while the stretcher is bypassed.
+    std::vector<s16> bypass_queue;
+    bool bypass_active = false;
 };
 
 } // namespace AudioCore
@@ -2,11 +2,17 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <regex>
 #include <string>
 #include <thread>
+#include <vector>
 
 // This needs to be included before getopt.h because the latter #defines symbols used by it
 #include "common/microprofile.h"
@@ -22,6 +28,7 @@
 #include "common/logging/backend.h"
 #include "common/logging/filter.h"
 #include "common/logging/log.h"
+#include "common/perf_counters.h"
 #include "common/scm_rev.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
@@ -36,6 +43,7 @@
 #include "core/hle/service/cfg/cfg.h"
 #include "core/loader/loader.h"
 #include "core/movie.h"
+#include "core/perf_stats.h"
 #include "input_common/main.h"
 #include "network/network.h"
 #include "video_core/renderer_base.h"
@@ -46,11 +54,16 @@
 #ifndef _MSC_VER
 #include <unistd.h>
 #endif
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/wait.h>
+#endif
 
 #ifdef _WIN32
 // windows.h needs to be included before shellapi.h
 #include <windows.h>
 
+#include <psapi.h>
 #include <shellapi.h>
 
 extern "C" {
@@ -69,6 +82,15 @@ static void PrintHelp(const char* argv0) {
                  "-r, --movie-record=[file]  Record a movie (game inputs) to the given file\n"
                  "-a, --movie-record-author=AUTHOR Sets the author of the movie to be recorded\n"
                  "-p, --movie-play=[file]    Playback the movie (game inputs) from the given file\n"
+                 "    --movie-verify=[file]  Replay the movie as fast as possible on the software\n"
+                 "                           renderer and exit 0 only if it runs to completion\n"
+                 "    --verify-movies=[dir]  Verify every .ctm movie in dir against the ROM,\n"
+                 "                           replaying them in parallel child processes\n"
+                 "-j, --verify-jobs=NUMBER   Maximum concurrent replays for --verify-movies\n"
+                 "    --benchmark=NUMBER     Run NUMBER frames as fast as possible on the\n"
+                 "                           software renderer with a null audio sink, print a\n"
+                 "                           JSON performance report on stdout and exit\n"
+                 "    --benchmark-state=SLOT Load the given savestate slot before benchmarking\n"
                  "-d, --dump-video=[file]    Dumps audio and video to the given video file\n"
                  "-f, --fullscreen     Start in fullscreen mode\n"
                  "-h, --help           Display this help and exit\n"
@@ -174,6 +196,149 @@ static void OnStatusMessageReceived(const Network::StatusMessageEntry& msg) {
         std::cout << std::endl << "* " << message << std::endl << std::endl;
 }
 
+/// Decodes the implementation-defined std::system status into the child's exit code.
+static int ExitCodeFromSystemStatus(int status) {
+#ifdef _WIN32
+    return status;
+#else
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#endif
+}
+
+/**
+ * Replays every .ctm movie in `movie_dir` against `rom_path`, running up to `jobs` replays
+ * concurrently. Each replay runs in its own citra process via --movie-verify, so the emulator
+ * cores stay fully isolated and a desync or crash in one replay cannot disturb the others.
+ * @return 0 if every movie verified successfully
+ */
+static int RunMovieBatchVerification(const std::string& binary_path, const std::string& rom_path,
+                                     const std::string& movie_dir, std::size_t jobs) {
+    std::vector<std::string> movies;
+    FileUtil::ForeachDirectoryEntry(
+        nullptr, movie_dir,
+        [&movies](u64*, const std::string& directory, const std::string& virtual_name) {
+            if (virtual_name.ends_with(".ctm")) {
+                movies.push_back(directory + DIR_SEP + virtual_name);
+            }
+            return true;
+        });
+    if (movies.empty()) {
+        std::cout << "No .ctm movies found in " << movie_dir << std::endl;
+        return 1;
+    }
+    std::sort(movies.begin(), movies.end());
+
+    std::atomic<std::size_t> next_movie{0};
+    std::mutex result_mutex;
+    std::vector<std::string> failed;
+
+    const auto worker = [&] {
+        while (true) {
+            const std::size_t index = next_movie.fetch_add(1);
+            if (index >= movies.size()) {
+                return;
+            }
+            const std::string& movie = movies[index];
+            const std::string command =
+                fmt::format("\"{}\" --movie-verify=\"{}\" \"{}\"", binary_path, movie, rom_path);
+            const int exit_code = ExitCodeFromSystemStatus(std::system(command.c_str()));
+
+            std::lock_guard lock{result_mutex};
+            if (exit_code == 0) {
+                std::cout << "PASS " << movie << std::endl;
+            } else {
+                std::cout << "FAIL " << movie << " (exit code " << exit_code << ")" << std::endl;
+                failed.push_back(movie);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    const std::size_t num_workers = std::min(jobs, movies.size());
+    workers.reserve(num_workers);
+    for (std::size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    std::cout << failed.size() << " of " << movies.size() << " movies failed verification"
+              << std::endl;
+    return failed.empty() ? 0 : 1;
+}
+
+/// Returns the peak resident set size of this process in bytes, or 0 if it cannot be queried
+static std::size_t GetPeakResidentSetSize() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    // ru_maxrss is in bytes on macOS, in kilobytes everywhere else
+    return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+/**
+ * Prints the --benchmark report as a single JSON document on stdout. The report contains the
+ * frame-time percentiles over the measured frames, the hot-path counter totals and the peak
+ * resident set size, which is everything the performance CI archives per run.
+ */
+static void PrintBenchmarkReport(Core::System& system) {
+    std::vector<double> frame_times = system.perf_stats->GetFrameTimeHistory();
+    std::sort(frame_times.begin(), frame_times.end());
+
+    const auto percentile = [&frame_times](double fraction) {
+        if (frame_times.empty()) {
+            return 0.0;
+        }
+        const auto index = static_cast<std::size_t>(fraction * (frame_times.size() - 1));
+        return frame_times[index];
+    };
+    const double mean =
+        frame_times.empty()
+            ? 0.0
+            : std::accumulate(frame_times.begin(), frame_times.end(), 0.0) / frame_times.size();
+
+    std::string counters;
+    const auto counter_totals = Common::PerfCounters::GetTotals();
+    for (std::size_t i = 0; i < Common::PerfCounters::NumCounters; i++) {
+        counters += fmt::format("{}\n    \"{}\": {}", i == 0 ? "" : ",",
+                                Common::PerfCounters::CounterNames[i], counter_totals[i]);
+    }
+
+    std::cout << fmt::format("{{\n"
+                             "  \"frames\": {},\n"
+                             "  \"frametime_ms\": {{\n"
+                             "    \"mean\": {:.4f},\n"
+                             "    \"p50\": {:.4f},\n"
+                             "    \"p90\": {:.4f},\n"
+                             "    \"p95\": {:.4f},\n"
+                             "    \"p99\": {:.4f},\n"
+                             "    \"max\": {:.4f}\n"
+                             "  }},\n"
+                             "  \"counters\": {{{}\n"
+                             "  }},\n"
+                             "  \"peak_rss_bytes\": {}\n"
+                             "}}",
+                             frame_times.size(), mean, percentile(0.50), percentile(0.90),
+                             percentile(0.95), percentile(0.99),
+                             frame_times.empty() ? 0.0 : frame_times.back(), counters,
+                             GetPeakResidentSetSize())
+              << std::endl;
+}
+
 static void InitializeLogging() {
     Log::Filter log_filter(Log::Level::Debug);
     log_filter.ParseFilterString(Settings::values.log_filter.GetValue());
@@ -199,6 +364,11 @@ int main(int argc, char** argv) {
     std::string movie_record;
     std::string movie_record_author;
     std::string movie_play;
+    std::string movie_verify;
+    std::string verify_movies_dir;
+    std::size_t verify_jobs = std::max<std::size_t>(1, std::thread::hardware_concurrency() / 2);
+    u64 benchmark_frames = 0;
+    u32 benchmark_state_slot = 0;
     std::string dump_video;
 
     InitializeLogging();
@@ -229,6 +399,11 @@ int main(int argc, char** argv) {
         {"movie-record", required_argument, 0, 'r'},
         {"movie-record-author", required_argument, 0, 'a'},
         {"movie-play", required_argument, 0, 'p'},
+        {"movie-verify", required_argument, 0, 'V'},
+        {"verify-movies", required_argument, 0, 'D'},
+        {"verify-jobs", required_argument, 0, 'j'},
+        {"benchmark", required_argument, 0, 'B'},
+        {"benchmark-state", required_argument, 0, 'S'},
         {"dump-video", required_argument, 0, 'd'},
         {"fullscreen", no_argument, 0, 'f'},
         {"help", no_argument, 0, 'h'},
@@ -237,7 +412,7 @@ int main(int argc, char** argv) {
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "g:i:m:r:p:fhv", long_options, &option_index);
+        int arg = getopt_long(argc, argv, "g:i:m:r:p:j:fhv", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
             case 'g':
@@ -303,6 +478,42 @@ int main(int argc, char** argv) {
             case 'p':
                 movie_play = optarg;
                 break;
+            case 'V':
+                movie_verify = optarg;
+                break;
+            case 'D':
+                verify_movies_dir = optarg;
+                break;
+            case 'j':
+                errno = 0;
+                verify_jobs = strtoul(optarg, &endarg, 0);
+                if (endarg == optarg || verify_jobs == 0)
+                    errno = EINVAL;
+                if (errno != 0) {
+                    perror("--verify-jobs");
+                    exit(1);
+                }
+                break;
+            case 'B':
+                errno = 0;
+                benchmark_frames = strtoull(optarg, &endarg, 0);
+                if (endarg == optarg || benchmark_frames == 0)
+                    errno = EINVAL;
+                if (errno != 0) {
+                    perror("--benchmark");
+                    exit(1);
+                }
+                break;
+            case 'S':
+                errno = 0;
+                benchmark_state_slot = strtoul(optarg, &endarg, 0);
+                if (endarg == optarg || benchmark_state_slot == 0)
+                    errno = EINVAL;
+                if (errno != 0) {
+                    perror("--benchmark-state");
+                    exit(1);
+                }
+                break;
             case 'd':
                 dump_video = optarg;
                 break;
@@ -344,6 +555,44 @@ int main(int argc, char** argv) {
         return -1;
     }
 
+    if (!movie_verify.empty() && (!movie_record.empty() || !movie_play.empty())) {
+        LOG_CRITICAL(Frontend, "Cannot combine --movie-verify with other movie options");
+        return -1;
+    }
+
+    if (benchmark_frames != 0 && (!movie_verify.empty() || !verify_movies_dir.empty())) {
+        LOG_CRITICAL(Frontend, "Cannot combine --benchmark with movie verification");
+        return -1;
+    }
+
+    if (!verify_movies_dir.empty()) {
+        return RunMovieBatchVerification(argv[0], filepath, verify_movies_dir, verify_jobs);
+    }
+
+    if (!movie_verify.empty()) {
+        if (Core::Movie::GetInstance().ValidateMovie(movie_verify) ==
+            Core::Movie::ValidationResult::Invalid) {
+            LOG_CRITICAL(Movie, "Movie file '{}' is invalid", movie_verify);
+            return 2;
+        }
+        // Replay as fast as possible on the software renderer. The verification farm sets a
+        // dummy SDL video driver, so no window appears.
+        Settings::values.graphics_api = Settings::GraphicsAPI::Software;
+        Settings::values.frame_limit = 0;
+        Settings::values.enable_audio_stretching = false;
+        movie_play = movie_verify;
+    }
+
+    if (benchmark_frames != 0) {
+        // Benchmark numbers must be comparable across hosts without a display server and must
+        // not pace against real devices, so run on the software renderer (which works with a
+        // dummy SDL video driver), discard audio and uncap the frame limiter.
+        Settings::values.graphics_api = Settings::GraphicsAPI::Software;
+        Settings::values.output_type = AudioCore::SinkType::Null;
+        Settings::values.frame_limit = 0;
+        Settings::values.enable_audio_stretching = false;
+    }
+
     if (!movie_record.empty()) {
         Core::Movie::GetInstance().PrepareForRecording();
     }
@@ -438,11 +687,18 @@ int main(int argc, char** argv) {
         }
     }
 
+    std::atomic_bool movie_finished{false};
     if (!movie_play.empty()) {
         auto metadata = Core::Movie::GetInstance().GetMovieMetadata(movie_play);
         LOG_INFO(Movie, "Author: {}", metadata.author);
         LOG_INFO(Movie, "Rerecord count: {}", metadata.rerecord_count);
         LOG_INFO(Movie, "Input count: {}", metadata.input_count);
+        if (!movie_verify.empty()) {
+            Core::Movie::GetInstance().SetPlaybackCompletionCallback([&movie_finished] {
+                movie_finished = true;
+                Core::System::GetInstance().RequestShutdown();
+            });
+        }
         Core::Movie::GetInstance().StartPlayback(movie_play);
     }
     if (!movie_record.empty()) {
@@ -472,6 +728,21 @@ int main(int argc, char** argv) {
         // if the secondary window isn't created, it shouldn't affect the main loop
         return secondary_window ? secondary_window->IsOpen() : true;
     };
+    // While verifying a movie, save a rotating savestate checkpoint every minute of input so a
+    // desync can be bisected without replaying from the start
+    constexpr u64 CHECKPOINT_INTERVAL_FRAMES = 3600;
+    constexpr u32 CHECKPOINT_SLOTS = 10;
+    u64 next_checkpoint = CHECKPOINT_INTERVAL_FRAMES;
+    u32 checkpoint_slot = 1;
+
+    if (benchmark_state_slot != 0) {
+        // Handled at the top of the next RunLoop iteration, before any frame is emulated
+        system.SendSignal(Core::System::Signal::Load, benchmark_state_slot);
+    }
+    const std::size_t benchmark_start_frame =
+        benchmark_frames != 0 ? system.perf_stats->GetRecordedFrameCount() : 0;
+    bool benchmark_complete = false;
+
     while (emu_window->IsOpen() && secondary_is_open()) {
         const auto result = system.RunLoop();
 
@@ -485,6 +756,20 @@ int main(int argc, char** argv) {
             LOG_ERROR(Frontend, "Error in main run loop: {}", result, system.GetStatusDetails());
             break;
         }
+
+        if (!movie_verify.empty() &&
+            Core::Movie::GetInstance().GetCurrentInputIndex() >= next_checkpoint) {
+            system.SendSignal(Core::System::Signal::Save, checkpoint_slot);
+            checkpoint_slot = checkpoint_slot % CHECKPOINT_SLOTS + 1;
+            next_checkpoint += CHECKPOINT_INTERVAL_FRAMES;
+        }
+
+        if (benchmark_frames != 0 && !benchmark_complete &&
+            system.perf_stats->GetRecordedFrameCount() - benchmark_start_frame >=
+                benchmark_frames) {
+            benchmark_complete = true;
+            emu_window->RequestClose();
+        }
     }
     emu_window->RequestClose();
     if (secondary_window) {
@@ -498,11 +783,30 @@ int main(int argc, char** argv) {
         system.VideoDumper().StopDumping();
     }
 
+    // Gather the report while the performance history is still alive; Shutdown() frees it
+    if (benchmark_frames != 0) {
+        PrintBenchmarkReport(system);
+    }
+
     Network::Shutdown();
     InputCommon::Shutdown();
 
     system.Shutdown();
 
-    detached_tasks.WaitForAllTasks();
+    // Give pending telemetry submissions a bounded window; the payloads are spooled to disk and
+    // retried next session, so exiting must not wait on a slow network
+    detached_tasks.WaitForAllTasks(std::chrono::seconds{3});
+
+    if (!movie_verify.empty()) {
+        if (!movie_finished) {
+            LOG_CRITICAL(Movie, "Replay of '{}' ended before the movie finished", movie_verify);
+            return 1;
+        }
+        LOG_INFO(Movie, "Replay of '{}' verified", movie_verify);
+    }
+    if (benchmark_frames != 0 && !benchmark_complete) {
+        LOG_CRITICAL(Frontend, "Benchmark ended before {} frames were emulated", benchmark_frames);
+        return 1;
+    }
     return 0;
 }
@@ -2,6 +2,11 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
 #include <glad/glad.h>
 
 #include <QApplication>
@@ -63,11 +68,14 @@ void EmuThread::run() {
     const auto scope = core_context.Acquire();
     Core::System& system = Core::System::GetInstance();
 
+    // The texture preload runs on the custom texture workers, so it can overlap the GL-bound
+    // shader disk cache load below. Only the disk cache reports progress while both run; the
+    // preload takes over the loading screen if it is still going afterwards.
+    std::future<void> preload_textures;
     if (Settings::values.preload_textures) {
-        emit LoadProgress(VideoCore::LoadCallbackStage::Preload, 0, 0);
-        system.CustomTexManager().PreloadTextures(
-            stop_run, [this](VideoCore::LoadCallbackStage stage, std::size_t value,
-                             std::size_t total) { emit LoadProgress(stage, value, total); });
+        preload_textures = std::async(std::launch::async, [this, &system] {
+            system.CustomTexManager().PreloadTextures(stop_run, nullptr);
+        });
     }
 
     emit LoadProgress(VideoCore::LoadCallbackStage::Prepare, 0, 0);
@@ -77,6 +85,11 @@ void EmuThread::run() {
             emit LoadProgress(stage, value, total);
         });
 
+    if (preload_textures.valid()) {
+        emit LoadProgress(VideoCore::LoadCallbackStage::Preload, 0, 0);
+        preload_textures.get();
+    }
+
     emit LoadProgress(VideoCore::LoadCallbackStage::Complete, 0, 0);
 
     core_context.MakeCurrent();
@@ -257,32 +270,75 @@ public:
         windowHandle()->setSurfaceType(QWindow::OpenGLSurface);
     }
 
+    ~OpenGLRenderWidget() override {
+        StopPresentThread();
+    }
+
     void SetContext(std::unique_ptr<Frontend::GraphicsContext>&& context_) {
         context = std::move(context_);
     }
 
-    void Present() override {
-        if (!isVisible()) {
-            return;
-        }
-        if (!Core::System::GetInstance().IsPoweredOn()) {
+    void StartPresentThread() {
+        stop_present = false;
+        present_thread = std::thread(&OpenGLRenderWidget::PresentLoop, this);
+    }
+
+    void StopPresentThread() {
+        if (!present_thread.joinable()) {
             return;
         }
-        context->MakeCurrent();
-        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
-        if (VideoCore::g_renderer) {
-            VideoCore::g_renderer->TryPresent(100, is_secondary);
-        }
-        context->SwapBuffers();
-        glFinish();
+        stop_present = true;
+        present_thread.join();
+    }
+
+    void paintEvent(QPaintEvent* event) override {
+        // Presentation happens on the dedicated thread; nothing to repaint here and no
+        // self-perpetuating update() loop to keep the GUI thread busy
     }
 
     QPaintEngine* paintEngine() const override {
         return nullptr;
     }
 
+protected:
+    void showEvent(QShowEvent* event) override {
+        RenderWidget::showEvent(event);
+        widget_visible = true;
+    }
+
+    void hideEvent(QHideEvent* event) override {
+        RenderWidget::hideEvent(event);
+        widget_visible = false;
+    }
+
 private:
+    /// Runs on present_thread, so a compositor that is slow to return from the buffer swap
+    /// (or a nested move/resize event loop on the GUI thread) never back-pressures emulation
+    void PresentLoop() {
+        context->MakeCurrent();
+        while (!stop_present.load(std::memory_order_relaxed)) {
+            if (!widget_visible.load(std::memory_order_relaxed) ||
+                !Core::System::GetInstance().IsPoweredOn()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                continue;
+            }
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+            if (VideoCore::g_renderer) {
+                // Waits for the next rendered frame, re-presenting the previous one when none
+                // arrives in time, which paces this loop off the emulation frame rate
+                VideoCore::g_renderer->TryPresent(100, is_secondary);
+            }
+            context->SwapBuffers();
+            glFinish();
+        }
+        context->DoneCurrent();
+    }
+
     std::unique_ptr<Frontend::GraphicsContext> context{};
+    std::thread present_thread;
+    std::atomic_bool stop_present{false};
+    /// Mirrors isVisible() for the present thread, which must not touch widget state
+    std::atomic_bool widget_visible{false};
     bool is_secondary;
 };
 #endif
@@ -716,6 +772,8 @@ bool GRenderWindow::InitializeOpenGL() {
     format.setSwapInterval(Settings::values.use_vsync_new.GetValue());
     child_widget->windowHandle()->setFormat(format);
 
+    child->StartPresentThread();
+
     return true;
 #else
     QMessageBox::warning(this, tr("OpenGL not available!"),
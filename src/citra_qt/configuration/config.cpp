@@ -447,9 +447,11 @@ void Config::ReadCoreValues() {
     qt_config->beginGroup(QStringLiteral("Core"));
 
     ReadGlobalSetting(Settings::values.cpu_clock_percentage);
+    ReadGlobalSetting(Settings::values.emulate_fs_timings);
 
     if (global) {
         ReadBasicSetting(Settings::values.use_cpu_jit);
+        ReadBasicSetting(Settings::values.use_fastmem);
     }
 
     qt_config->endGroup();
@@ -638,6 +640,7 @@ void Config::ReadRendererValues() {
     ReadGlobalSetting(Settings::values.use_disk_shader_cache);
     ReadGlobalSetting(Settings::values.use_vsync_new);
     ReadGlobalSetting(Settings::values.resolution_factor);
+    ReadGlobalSetting(Settings::values.dynamic_resolution);
     ReadGlobalSetting(Settings::values.frame_limit);
 
     ReadGlobalSetting(Settings::values.bg_red);
@@ -648,6 +651,7 @@ void Config::ReadRendererValues() {
 
     if (global) {
         ReadBasicSetting(Settings::values.use_shader_jit);
+        ReadBasicSetting(Settings::values.async_software_rendering);
     }
 
     qt_config->endGroup();
@@ -964,9 +968,11 @@ void Config::SaveCoreValues() {
     qt_config->beginGroup(QStringLiteral("Core"));
 
     WriteGlobalSetting(Settings::values.cpu_clock_percentage);
+    WriteGlobalSetting(Settings::values.emulate_fs_timings);
 
     if (global) {
         WriteBasicSetting(Settings::values.use_cpu_jit);
+        WriteBasicSetting(Settings::values.use_fastmem);
     }
 
     qt_config->endGroup();
@@ -1117,6 +1123,7 @@ void Config::SaveRendererValues() {
     WriteGlobalSetting(Settings::values.use_disk_shader_cache);
     WriteGlobalSetting(Settings::values.use_vsync_new);
     WriteGlobalSetting(Settings::values.resolution_factor);
+    WriteGlobalSetting(Settings::values.dynamic_resolution);
     WriteGlobalSetting(Settings::values.frame_limit);
 
     WriteGlobalSetting(Settings::values.bg_red);
@@ -1128,6 +1135,8 @@ void Config::SaveRendererValues() {
     if (global) {
         WriteSetting(QStringLiteral("use_shader_jit"), Settings::values.use_shader_jit.GetValue(),
                      true);
+        WriteSetting(QStringLiteral("async_software_rendering"),
+                     Settings::values.async_software_rendering.GetValue(), false);
     }
 
     qt_config->endGroup();
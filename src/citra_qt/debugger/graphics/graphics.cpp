@@ -60,7 +60,12 @@ void GPUCommandStreamItemModel::OnGXCommandFinishedInternal(int total_command_co
 
     int prev_command_count = command_count;
     command_count = total_command_count;
-    emit dataChanged(index(prev_command_count, 0), index(total_command_count - 1, 0));
+    if (prev_command_count == total_command_count) {
+        // The history ring buffer wrapped, so every row now maps to a different command
+        emit dataChanged(index(0, 0), index(total_command_count - 1, 0));
+    } else {
+        emit dataChanged(index(prev_command_count, 0), index(total_command_count - 1, 0));
+    }
 }
 
 GPUCommandStreamWidget::GPUCommandStreamWidget(QWidget* parent)
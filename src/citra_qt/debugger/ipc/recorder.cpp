@@ -20,7 +20,7 @@ IPCRecorderWidget::IPCRecorderWidget(QWidget* parent)
     : QDockWidget(parent), ui(std::make_unique<Ui::IPCRecorder>()) {
 
     ui->setupUi(this);
-    qRegisterMetaType<IPCDebugger::RequestRecord>();
+    qRegisterMetaType<std::shared_ptr<const IPCDebugger::RequestRecord>>();
 
     connect(ui->enabled, &QCheckBox::stateChanged,
             [this](int new_state) { SetEnabled(new_state == Qt::Checked); });
@@ -61,7 +61,8 @@ QString IPCRecorderWidget::GetStatusStr(const IPCDebugger::RequestRecord& record
     }
 }
 
-void IPCRecorderWidget::OnEntryUpdated(IPCDebugger::RequestRecord record) {
+void IPCRecorderWidget::OnEntryUpdated(std::shared_ptr<const IPCDebugger::RequestRecord> entry) {
+    const auto& record = *entry;
     if (record.id < id_offset) { // The record has already been deleted by 'Clear'
         return;
     }
@@ -74,16 +75,16 @@ void IPCRecorderWidget::OnEntryUpdated(IPCDebugger::RequestRecord record) {
         service = QStringLiteral("%1 (%2)").arg(service, record.is_hle ? tr("HLE") : tr("LLE"));
     }
 
-    QTreeWidgetItem entry{
+    QTreeWidgetItem row_item{
         {QString::number(record.id), GetStatusStr(record), service, GetFunctionName(record)}};
 
     const int row_id = record.id - id_offset;
     if (ui->main->invisibleRootItem()->childCount() > row_id) {
-        records[row_id] = record;
-        (*ui->main->invisibleRootItem()->child(row_id)) = entry;
+        records[row_id] = std::move(entry);
+        (*ui->main->invisibleRootItem()->child(row_id)) = row_item;
     } else {
-        records.emplace_back(record);
-        ui->main->invisibleRootItem()->addChild(new QTreeWidgetItem(entry));
+        records.emplace_back(std::move(entry));
+        ui->main->invisibleRootItem()->addChild(new QTreeWidgetItem(row_item));
     }
 
     if (record.status == IPCDebugger::RequestStatus::HLEUnimplemented ||
@@ -109,7 +110,9 @@ void IPCRecorderWidget::SetEnabled(bool enabled) {
 
     if (enabled) {
         handle = ipc_recorder.BindCallback(
-            [this](const IPCDebugger::RequestRecord& record) { emit EntryUpdated(record); });
+            [this](std::shared_ptr<const IPCDebugger::RequestRecord> record) {
+                emit EntryUpdated(std::move(record));
+            });
     } else if (handle) {
         ipc_recorder.UnbindCallback(handle);
     }
@@ -179,7 +182,7 @@ void IPCRecorderWidget::ApplyFilterToAll() {
 void IPCRecorderWidget::OpenRecordDialog(QTreeWidgetItem* item, [[maybe_unused]] int column) {
     int index = ui->main->invisibleRootItem()->indexOfChild(item);
 
-    RecordDialog dialog(this, records[static_cast<std::size_t>(index)], item->text(2),
+    RecordDialog dialog(this, *records[static_cast<std::size_t>(index)], item->text(2),
                         item->text(3));
     dialog.exec();
 }
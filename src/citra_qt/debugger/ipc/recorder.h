@@ -24,11 +24,11 @@ public:
     void OnEmulationStarting();
 
 signals:
-    void EntryUpdated(IPCDebugger::RequestRecord record);
+    void EntryUpdated(std::shared_ptr<const IPCDebugger::RequestRecord> record);
 
 private:
     QString GetStatusStr(const IPCDebugger::RequestRecord& record) const;
-    void OnEntryUpdated(IPCDebugger::RequestRecord record);
+    void OnEntryUpdated(std::shared_ptr<const IPCDebugger::RequestRecord> record);
     void SetEnabled(bool enabled);
     void Clear();
     void ApplyFilter(int index);
@@ -44,7 +44,7 @@ private:
     // continuously and only the 'Clear' action can be performed, this is enough.
     // The initial value is 1, which means record 1 = row 0.
     int id_offset = 1;
-    std::vector<IPCDebugger::RequestRecord> records;
+    std::vector<std::shared_ptr<const IPCDebugger::RequestRecord>> records;
 };
 
-Q_DECLARE_METATYPE(IPCDebugger::RequestRecord);
+Q_DECLARE_METATYPE(std::shared_ptr<const IPCDebugger::RequestRecord>);
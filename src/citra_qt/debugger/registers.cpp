@@ -66,16 +66,27 @@ void RegistersWidget::OnDebugModeEntered() {
         return;
 
     // Todo: Handle all cores
-    for (int i = 0; i < core_registers->childCount(); ++i)
-        core_registers->child(i)->setText(
-            1, QStringLiteral("0x%1").arg(Core::GetCore(0).GetReg(i), 8, 16, QLatin1Char('0')));
+    for (int i = 0; i < core_registers->childCount(); ++i) {
+        const u32 value = Core::GetCore(0).GetReg(i);
+        if (!last_values_valid || value != last_core_regs[i]) {
+            core_registers->child(i)->setText(
+                1, QStringLiteral("0x%1").arg(value, 8, 16, QLatin1Char('0')));
+            last_core_regs[i] = value;
+        }
+    }
 
-    for (int i = 0; i < vfp_registers->childCount(); ++i)
-        vfp_registers->child(i)->setText(
-            1, QStringLiteral("0x%1").arg(Core::GetCore(0).GetVFPReg(i), 8, 16, QLatin1Char('0')));
+    for (int i = 0; i < vfp_registers->childCount(); ++i) {
+        const u32 value = Core::GetCore(0).GetVFPReg(i);
+        if (!last_values_valid || value != last_vfp_regs[i]) {
+            vfp_registers->child(i)->setText(
+                1, QStringLiteral("0x%1").arg(value, 8, 16, QLatin1Char('0')));
+            last_vfp_regs[i] = value;
+        }
+    }
 
     UpdateCPSRValues();
     UpdateVFPSystemRegisterValues();
+    last_values_valid = true;
 }
 
 void RegistersWidget::OnDebugModeLeft() {}
@@ -108,6 +119,8 @@ void RegistersWidget::OnEmulationStopping() {
     vfp_system_registers->child(0)->setText(1, QString{});
     vfp_system_registers->child(1)->setText(1, QString{});
 
+    last_values_valid = false;
+
     setEnabled(false);
 }
 
@@ -133,6 +146,10 @@ void RegistersWidget::UpdateCPSRValues() {
     // Todo: Handle all cores
     const u32 cpsr_val = Core::GetCore(0).GetCPSR();
 
+    if (last_values_valid && cpsr_val == last_cpsr)
+        return;
+    last_cpsr = cpsr_val;
+
     cpsr->setText(1, QStringLiteral("0x%1").arg(cpsr_val, 8, 16, QLatin1Char('0')));
     cpsr->child(0)->setText(
         1, QStringLiteral("b%1").arg(cpsr_val & 0x1F, 5, 2, QLatin1Char('0'))); // M - Mode
@@ -197,6 +214,11 @@ void RegistersWidget::UpdateVFPSystemRegisterValues() {
     const u32 fpscr_val = Core::GetCore(0).GetVFPSystemReg(VFP_FPSCR);
     const u32 fpexc_val = Core::GetCore(0).GetVFPSystemReg(VFP_FPEXC);
 
+    if (last_values_valid && fpscr_val == last_fpscr && fpexc_val == last_fpexc)
+        return;
+    last_fpscr = fpscr_val;
+    last_fpexc = fpexc_val;
+
     QTreeWidgetItem* const fpscr = vfp_system_registers->child(0);
     fpscr->setText(1, QStringLiteral("0x%1").arg(fpscr_val, 8, 16, QLatin1Char('0')));
     fpscr->child(0)->setText(1, QString::number(fpscr_val & 1));
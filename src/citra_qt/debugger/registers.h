@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <QDockWidget>
+#include "common/common_types.h"
 
 class QTreeWidget;
 class QTreeWidgetItem;
@@ -44,4 +46,13 @@ private:
     QTreeWidgetItem* vfp_registers;
     QTreeWidgetItem* vfp_system_registers;
     QTreeWidgetItem* cpsr;
+
+    // Register values as of the last refresh; stepping only rewrites the tree items whose
+    // value actually changed instead of re-formatting every register on each pause
+    std::array<u32, 16> last_core_regs{};
+    std::array<u32, 32> last_vfp_regs{};
+    u32 last_cpsr = 0;
+    u32 last_fpscr = 0;
+    u32 last_fpexc = 0;
+    bool last_values_valid = false;
 };
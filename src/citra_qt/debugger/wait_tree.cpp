@@ -49,12 +49,30 @@ std::vector<std::unique_ptr<WaitTreeItem>> WaitTreeItem::GetChildren() const {
     return {};
 }
 
+bool WaitTreeItem::RefreshCache() {
+    QString new_text = GetText();
+    QColor new_color = GetColor();
+    const bool changed = new_text != cached_text || new_color != cached_color;
+    cached_text = std::move(new_text);
+    cached_color = std::move(new_color);
+    return changed;
+}
+
+const QString& WaitTreeItem::CachedText() const {
+    return cached_text;
+}
+
+const QColor& WaitTreeItem::CachedColor() const {
+    return cached_color;
+}
+
 void WaitTreeItem::Expand() {
     if (IsExpandable() && !expanded) {
         children = GetChildren();
         for (std::size_t i = 0; i < children.size(); ++i) {
             children[i]->parent = this;
             children[i]->row = i;
+            children[i]->RefreshCache();
         }
         expanded = true;
     }
@@ -87,6 +105,7 @@ std::vector<std::unique_ptr<WaitTreeThread>> WaitTreeItem::MakeThreadItemList()
         for (std::size_t j = 0; j < threads.size(); ++j) {
             item_list.push_back(std::make_unique<WaitTreeThread>(*threads[j]));
             item_list.back()->row = j;
+            item_list.back()->RefreshCache();
         }
     }
     return item_list;
@@ -424,20 +443,53 @@ QVariant WaitTreeModel::data(const QModelIndex& index, int role) const {
 
     switch (role) {
     case Qt::DisplayRole:
-        return static_cast<WaitTreeItem*>(index.internalPointer())->GetText();
+        return static_cast<WaitTreeItem*>(index.internalPointer())->CachedText();
     case Qt::ForegroundRole:
-        return static_cast<WaitTreeItem*>(index.internalPointer())->GetColor();
+        return static_cast<WaitTreeItem*>(index.internalPointer())->CachedColor();
     default:
         return {};
     }
 }
 
+bool WaitTreeModel::hasChildren(const QModelIndex& parent) const {
+    if (!parent.isValid())
+        return !thread_items.empty();
+
+    // Answered without building the children, so repaints of collapsed items never touch the
+    // kernel objects behind them
+    return static_cast<WaitTreeItem*>(parent.internalPointer())->IsExpandable();
+}
+
 void WaitTreeModel::ClearItems() {
+    beginResetModel();
     thread_items.clear();
+    endResetModel();
 }
 
 void WaitTreeModel::InitItems() {
+    beginResetModel();
     thread_items = WaitTreeItem::MakeThreadItemList();
+    endResetModel();
+}
+
+void WaitTreeModel::RefreshItems() {
+    for (const auto& item : thread_items) {
+        RefreshItem(item.get());
+    }
+}
+
+bool WaitTreeModel::HasItems() const {
+    return !thread_items.empty();
+}
+
+void WaitTreeModel::RefreshItem(WaitTreeItem* item) {
+    if (item->RefreshCache()) {
+        const QModelIndex item_index = createIndex(static_cast<int>(item->Row()), 0, item);
+        emit dataChanged(item_index, item_index);
+    }
+    for (const auto& child : item->Children()) {
+        RefreshItem(child.get());
+    }
 }
 
 WaitTreeWidget::WaitTreeWidget(QWidget* parent) : QDockWidget(tr("Wait Tree"), parent) {
@@ -451,15 +503,27 @@ WaitTreeWidget::WaitTreeWidget(QWidget* parent) : QDockWidget(tr("Wait Tree"), p
 void WaitTreeWidget::OnDebugModeEntered() {
     if (!Core::System::GetInstance().IsPoweredOn())
         return;
-    model->InitItems();
-    view->setModel(model);
+
+    u64 generation = 0;
+    for (u32 i = 0; i < Core::GetNumCores(); ++i) {
+        generation += Core::System::GetInstance().Kernel().GetThreadManager(i).GetStateGeneration();
+    }
+
+    if (model->HasItems() && generation == last_generation) {
+        // No thread was created, destroyed, switched or re-prioritized since the last pause,
+        // so the item layout is still valid and only the displayed values need a refresh
+        model->RefreshItems();
+    } else {
+        model->InitItems();
+    }
+    last_generation = generation;
     setEnabled(true);
 }
 
 void WaitTreeWidget::OnDebugModeLeft() {
+    // The items are kept so the next pause can reuse them; the model serves cached values
+    // while the emulation is running
     setEnabled(false);
-    view->setModel(nullptr);
-    model->ClearItems();
 }
 
 void WaitTreeWidget::OnEmulationStarting(EmuThread* emu_thread) {
@@ -34,6 +34,13 @@ public:
     virtual QString GetText() const = 0;
     virtual QColor GetColor() const;
 
+    /// Recomputes the cached text/color from the underlying kernel object; returns true when
+    /// they changed. Only called while the emulation is paused, so the model can keep serving
+    /// the cached values to the view while the emulation is running.
+    bool RefreshCache();
+    const QString& CachedText() const;
+    const QColor& CachedColor() const;
+
     void Expand();
     WaitTreeItem* Parent() const;
     const std::vector<std::unique_ptr<WaitTreeItem>>& Children() const;
@@ -45,6 +52,8 @@ private:
     bool expanded = false;
     WaitTreeItem* parent = nullptr;
     std::vector<std::unique_ptr<WaitTreeItem>> children;
+    QString cached_text;
+    QColor cached_color;
 };
 
 class WaitTreeText : public WaitTreeItem {
@@ -163,11 +172,18 @@ public:
     QModelIndex parent(const QModelIndex& index) const override;
     int rowCount(const QModelIndex& parent) const override;
     int columnCount(const QModelIndex& parent) const override;
+    bool hasChildren(const QModelIndex& parent) const override;
 
     void ClearItems();
     void InitItems();
+    /// Refreshes the cached values of the already-built items in place, emitting dataChanged
+    /// only for those that differ. Valid only while the thread layout is unchanged.
+    void RefreshItems();
+    bool HasItems() const;
 
 private:
+    void RefreshItem(WaitTreeItem* item);
+
     std::vector<std::unique_ptr<WaitTreeThread>> thread_items;
 };
 
@@ -187,4 +203,6 @@ public slots:
 private:
     QTreeView* view;
     WaitTreeModel* model;
+    /// Sum of the kernel thread managers' state generations as of the last item rebuild
+    u64 last_generation = 0;
 };
@@ -2,12 +2,20 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
+#include <QDataStream>
+#include <QDateTime>
 #include <QDir>
+#include <QFile>
 #include <QFileInfo>
+#include <QHash>
+#include <QSet>
 #include "citra_qt/compatibility_list.h"
 #include "citra_qt/game_list.h"
 #include "citra_qt/game_list_p.h"
@@ -15,6 +23,7 @@
 #include "citra_qt/uisettings.h"
 #include "common/common_paths.h"
 #include "common/file_util.h"
+#include "common/thread_worker.h"
 #include "core/hle/service/am/am.h"
 #include "core/hle/service/fs/archive.h"
 #include "core/loader/loader.h"
@@ -24,6 +33,132 @@ bool HasSupportedFileExtension(const std::string& file_name) {
     const QFileInfo file = QFileInfo(QString::fromStdString(file_name));
     return GameList::supported_file_extensions.contains(file.suffix(), Qt::CaseInsensitive);
 }
+
+/// Everything the game list needs to know about a file, extracted once and cached on disk.
+struct FileMetadata {
+    bool listable = false; ///< True when a loader accepted the file.
+    u64 program_id = 0;
+    u64 extdata_id = 0;
+    QString file_type;
+    u64 file_size = 0;
+    QByteArray smdh;
+};
+
+QDataStream& operator<<(QDataStream& stream, const FileMetadata& meta) {
+    return stream << meta.listable << static_cast<quint64>(meta.program_id)
+                  << static_cast<quint64>(meta.extdata_id) << meta.file_type
+                  << static_cast<quint64>(meta.file_size) << meta.smdh;
+}
+
+QDataStream& operator>>(QDataStream& stream, FileMetadata& meta) {
+    quint64 program_id{};
+    quint64 extdata_id{};
+    quint64 file_size{};
+    stream >> meta.listable >> program_id >> extdata_id >> meta.file_type >> file_size >>
+        meta.smdh;
+    meta.program_id = program_id;
+    meta.extdata_id = extdata_id;
+    meta.file_size = file_size;
+    return stream;
+}
+
+struct CachedFile {
+    qint64 file_size = 0;
+    qint64 mtime = 0;
+    FileMetadata metadata;
+};
+
+QDataStream& operator<<(QDataStream& stream, const CachedFile& file) {
+    return stream << file.file_size << file.mtime << file.metadata;
+}
+
+QDataStream& operator>>(QDataStream& stream, CachedFile& file) {
+    return stream >> file.file_size >> file.mtime >> file.metadata;
+}
+
+using MetadataCache = QHash<QString, CachedFile>;
+
+constexpr quint32 METADATA_CACHE_VERSION = 1;
+
+QString GetMetadataCachePath() {
+    return QString::fromStdString(FileUtil::GetUserPath(FileUtil::UserPath::CacheDir)) +
+           QStringLiteral("game_list_cache.bin");
+}
+
+MetadataCache LoadMetadataCache() {
+    QFile file{GetMetadataCachePath()};
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+    QDataStream stream{&file};
+    stream.setVersion(QDataStream::Qt_5_10);
+    quint32 version{};
+    stream >> version;
+    if (version != METADATA_CACHE_VERSION) {
+        return {};
+    }
+    MetadataCache cache;
+    stream >> cache;
+    if (stream.status() != QDataStream::Ok) {
+        return {};
+    }
+    return cache;
+}
+
+void SaveMetadataCache(const MetadataCache& cache) {
+    QFile file{GetMetadataCachePath()};
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+    QDataStream stream{&file};
+    stream.setVersion(QDataStream::Qt_5_10);
+    stream << METADATA_CACHE_VERSION << cache;
+}
+
+/// Opens the file with its loader and pulls out everything the list displays. This is the
+/// expensive part of a scan and runs on the worker pool.
+FileMetadata ExtractMetadata(const std::string& physical_name) {
+    FileMetadata meta;
+
+    std::unique_ptr<Loader::AppLoader> loader = Loader::GetLoader(physical_name);
+    if (!loader) {
+        return meta;
+    }
+
+    bool executable = false;
+    const auto res = loader->IsExecutable(executable);
+    if (!executable && res != Loader::ResultStatus::ErrorEncrypted) {
+        return meta;
+    }
+    meta.listable = true;
+
+    loader->ReadProgramId(meta.program_id);
+    loader->ReadExtdataId(meta.extdata_id);
+
+    std::vector<u8> smdh;
+    // Look for an update icon if available
+    if (!(meta.program_id & ~0x00040000FFFFFFFF)) {
+        std::string update_path = Service::AM::GetTitleContentPath(
+            Service::FS::MediaType::SDMC, meta.program_id | 0x0000000E00000000);
+        if (FileUtil::Exists(update_path)) {
+            std::unique_ptr<Loader::AppLoader> update_loader = Loader::GetLoader(update_path);
+            if (update_loader) {
+                update_loader->ReadIcon(smdh);
+            }
+        }
+    }
+
+    if (!Loader::IsValidSMDH(smdh)) {
+        // Read the original smdh if there is no valid update smdh
+        loader->ReadIcon(smdh);
+    }
+
+    meta.smdh = QByteArray(reinterpret_cast<const char*>(smdh.data()),
+                           static_cast<int>(smdh.size()));
+    meta.file_type = QString::fromStdString(Loader::GetFileTypeString(loader->GetFileType()));
+    meta.file_size = FileUtil::GetSize(physical_name);
+    return meta;
+}
 } // Anonymous namespace
 
 GameListWorker::GameListWorker(QVector<UISettings::GameDir>& game_dirs,
@@ -45,88 +180,125 @@ void GameListWorker::AddFstEntriesToGameList(const std::string& dir_path, unsign
         const std::string physical_name = directory + DIR_SEP + virtual_name;
         const bool is_dir = FileUtil::IsDirectory(physical_name);
         if (!is_dir && HasSupportedFileExtension(physical_name)) {
-            std::unique_ptr<Loader::AppLoader> loader = Loader::GetLoader(physical_name);
-            if (!loader) {
-                return true;
-            }
+            // Only collect the path here; the expensive loader/SMDH work happens in
+            // ProcessScanQueue, in parallel and backed by the metadata cache.
+            scan_queue.push_back(ScanTarget{physical_name, parent_dir});
+        } else if (is_dir && recursion > 0) {
+            watch_list.append(QString::fromStdString(physical_name));
+            AddFstEntriesToGameList(physical_name, recursion - 1, parent_dir);
+        }
 
-            bool executable = false;
-            const auto res = loader->IsExecutable(executable);
-            if (!executable && res != Loader::ResultStatus::ErrorEncrypted) {
-                return true;
-            }
+        return true;
+    };
 
-            u64 program_id = 0;
-            loader->ReadProgramId(program_id);
-
-            u64 extdata_id = 0;
-            loader->ReadExtdataId(extdata_id);
-
-            std::vector<u8> smdh;
-            // Look for an update icon if available
-            if (!(program_id & ~0x00040000FFFFFFFF)) {
-                std::string update_path = Service::AM::GetTitleContentPath(
-                    Service::FS::MediaType::SDMC, program_id | 0x0000000E00000000);
-                if (FileUtil::Exists(update_path)) {
-                    std::unique_ptr<Loader::AppLoader> update_loader =
-                        Loader::GetLoader(update_path);
-                    if (update_loader) {
-                        update_loader->ReadIcon(smdh);
-                    }
-                }
-            }
+    FileUtil::ForeachDirectoryEntry(nullptr, dir_path, callback);
+}
 
-            if (!Loader::IsValidSMDH(smdh)) {
-                // Read the original smdh if there is no valid update smdh
-                loader->ReadIcon(smdh);
-            }
+void GameListWorker::ProcessScanQueue() {
+    MetadataCache cache = LoadMetadataCache();
+    bool cache_dirty = false;
+
+    Common::ThreadWorker pool{std::max<std::size_t>(std::thread::hardware_concurrency(), 1),
+                              "GameListScan"};
+
+    struct PendingEntry {
+        const ScanTarget* target;
+        qint64 file_size;
+        qint64 mtime;
+        std::optional<FileMetadata> cached;
+        std::future<FileMetadata> future;
+    };
+    std::vector<PendingEntry> pending;
+    pending.reserve(scan_queue.size());
+
+    for (const ScanTarget& target : scan_queue) {
+        const QString path = QString::fromStdString(target.path);
+        const QFileInfo info{path};
+        PendingEntry entry{};
+        entry.target = &target;
+        entry.file_size = info.size();
+        entry.mtime = info.lastModified().toMSecsSinceEpoch();
+
+        const auto it = cache.constFind(path);
+        if (it != cache.constEnd() && it->file_size == entry.file_size &&
+            it->mtime == entry.mtime) {
+            entry.cached = it->metadata;
+        } else {
+            std::packaged_task<FileMetadata()> task(
+                [file = target.path] { return ExtractMetadata(file); });
+            entry.future = task.get_future();
+            pool.QueueWork(std::move(task));
+        }
+        pending.push_back(std::move(entry));
+    }
 
-            const auto system_title = ((program_id >> 32) & 0xFFFFFFFF) == 0x00040010;
-            if (Loader::IsValidSMDH(smdh)) {
-                if (system_title) {
-                    auto smdh_struct = reinterpret_cast<Loader::SMDH*>(smdh.data());
-                    if (!(smdh_struct->flags & Loader::SMDH::Flags::Visible)) {
-                        // Skip system titles without the visible flag.
-                        return true;
-                    }
+    for (PendingEntry& entry : pending) {
+        if (stop_processing) {
+            break;
+        }
+
+        FileMetadata meta = entry.cached ? std::move(*entry.cached) : entry.future.get();
+        const QString path = QString::fromStdString(entry.target->path);
+        if (!entry.cached) {
+            cache.insert(path, CachedFile{entry.file_size, entry.mtime, meta});
+            cache_dirty = true;
+        }
+        if (!meta.listable) {
+            continue;
+        }
+
+        std::vector<u8> smdh(meta.smdh.begin(), meta.smdh.end());
+        const auto system_title = ((meta.program_id >> 32) & 0xFFFFFFFF) == 0x00040010;
+        if (Loader::IsValidSMDH(smdh)) {
+            if (system_title) {
+                auto smdh_struct = reinterpret_cast<Loader::SMDH*>(smdh.data());
+                if (!(smdh_struct->flags & Loader::SMDH::Flags::Visible)) {
+                    // Skip system titles without the visible flag.
+                    continue;
                 }
-            } else if (UISettings::values.game_list_hide_no_icon || system_title) {
-                // Skip this invalid entry
-                return true;
             }
+        } else if (UISettings::values.game_list_hide_no_icon || system_title) {
+            // Skip this invalid entry
+            continue;
+        }
 
-            auto it = FindMatchingCompatibilityEntry(compatibility_list, program_id);
-
-            // The game list uses this as compatibility number for untested games
-            QString compatibility(QStringLiteral("99"));
-            if (it != compatibility_list.end())
-                compatibility = it->second.first;
-
-            emit EntryReady(
-                {
-                    new GameListItemPath(QString::fromStdString(physical_name), smdh, program_id,
-                                         extdata_id),
-                    new GameListItemCompat(compatibility),
-                    new GameListItemRegion(smdh),
-                    new GameListItem(
-                        QString::fromStdString(Loader::GetFileTypeString(loader->GetFileType()))),
-                    new GameListItemSize(FileUtil::GetSize(physical_name)),
-                },
-                parent_dir);
+        const auto it = FindMatchingCompatibilityEntry(compatibility_list, meta.program_id);
 
-        } else if (is_dir && recursion > 0) {
-            watch_list.append(QString::fromStdString(physical_name));
-            AddFstEntriesToGameList(physical_name, recursion - 1, parent_dir);
-        }
+        // The game list uses this as compatibility number for untested games
+        QString compatibility(QStringLiteral("99"));
+        if (it != compatibility_list.end())
+            compatibility = it->second.first;
 
-        return true;
-    };
+        emit EntryReady(
+            {
+                new GameListItemPath(path, smdh, meta.program_id, meta.extdata_id),
+                new GameListItemCompat(compatibility),
+                new GameListItemRegion(smdh),
+                new GameListItem(meta.file_type),
+                new GameListItemSize(meta.file_size),
+            },
+            entry.target->parent_dir);
+    }
 
-    FileUtil::ForeachDirectoryEntry(nullptr, dir_path, callback);
+    if (cache_dirty && !stop_processing) {
+        // Drop cache entries for files that no longer exist in any scanned directory so the
+        // cache does not grow without bound.
+        QSet<QString> visited;
+        visited.reserve(static_cast<int>(scan_queue.size()));
+        for (const ScanTarget& target : scan_queue) {
+            visited.insert(QString::fromStdString(target.path));
+        }
+        for (auto it = cache.begin(); it != cache.end();) {
+            it = visited.contains(it.key()) ? std::next(it) : cache.erase(it);
+        }
+        SaveMetadataCache(cache);
+    }
+    scan_queue.clear();
 }
 
 void GameListWorker::run() {
     stop_processing = false;
+    scan_queue.clear();
     for (UISettings::GameDir& game_dir : game_dirs) {
         if (game_dir.path == QStringLiteral("INSTALLED")) {
             QString games_path =
@@ -163,6 +335,8 @@ void GameListWorker::run() {
         }
     }
 
+    ProcessScanQueue();
+
     emit Finished(watch_list);
 }
 
@@ -7,6 +7,7 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 #include <QList>
 #include <QObject>
 #include <QRunnable>
@@ -51,12 +52,23 @@ signals:
     void Finished(QStringList watch_list);
 
 private:
+    /// A file found during the directory walk, waiting for its metadata to be extracted.
+    struct ScanTarget {
+        std::string path;
+        GameListDir* parent_dir;
+    };
+
     void AddFstEntriesToGameList(const std::string& dir_path, unsigned int recursion,
                                  GameListDir* parent_dir);
 
+    /// Extracts metadata for the queued files in parallel, consulting the on-disk cache,
+    /// and emits the resulting game list entries in scan order.
+    void ProcessScanQueue();
+
     QVector<UISettings::GameDir>& game_dirs;
     const CompatibilityList& compatibility_list;
 
+    std::vector<ScanTarget> scan_queue;
     QStringList watch_list;
     std::atomic_bool stop_processing;
 };
@@ -667,7 +667,11 @@ void GMainWindow::InitializeHotkeys() {
         UpdateStatusBar();
     });
     connect_shortcut(QStringLiteral("Mute Audio"),
-                     [] { Settings::values.audio_muted = !Settings::values.audio_muted; });
+                     [] {
+                         Settings::values.audio_muted = !Settings::values.audio_muted;
+                         // The audio thread reads the volume from the settings snapshot
+                         Settings::PublishFrameSettings();
+                     });
 
     // We use "static" here in order to avoid capturing by lambda due to a MSVC bug, which makes the
     // variable hold a garbage value after this function exits
@@ -2344,6 +2348,28 @@ void GMainWindow::UpdateStatusBar() {
     game_fps_label->setText(tr("Game: %1 FPS").arg(results.game_fps, 0, 'f', 0));
     emu_frametime_label->setText(tr("Frame: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
 
+    // Surface the always-on hot-path counters so slow titles can be diagnosed in the field
+    using Common::PerfCounters::Counter;
+    const auto counter = [&results](Counter c) {
+        return static_cast<qulonglong>(results.counters[static_cast<std::size_t>(c)]);
+    };
+    const QString counter_text = tr("Since the last update:\n"
+                                    "SVC calls: %1\n"
+                                    "IPC bytes: %2\n"
+                                    "Surface uploads: %3\n"
+                                    "JIT invalidations: %4\n"
+                                    "Audio underruns: %5\n"
+                                    "GPU time: %6 ms")
+                                     .arg(counter(Counter::SvcCalls))
+                                     .arg(counter(Counter::IpcBytesTranslated))
+                                     .arg(counter(Counter::SurfaceUploads))
+                                     .arg(counter(Counter::JitInvalidations))
+                                     .arg(counter(Counter::AudioUnderruns))
+                                     .arg(counter(Counter::GpuFrameUs) / 1000);
+    emu_speed_label->setToolTip(counter_text);
+    game_fps_label->setToolTip(counter_text);
+    emu_frametime_label->setToolTip(counter_text);
+
     emu_speed_label->setVisible(true);
     game_fps_label->setVisible(true);
     emu_frametime_label->setVisible(true);
@@ -2870,6 +2896,8 @@ int main(int argc, char* argv[]) {
                      &GMainWindow::OnAppFocusStateChanged);
 
     int result = app.exec();
-    detached_tasks.WaitForAllTasks();
+    // Give pending telemetry submissions a bounded window; the payloads are spooled to disk and
+    // retried next session, so exiting must not wait on a slow network
+    detached_tasks.WaitForAllTasks(std::chrono::seconds{3});
     return result;
 }
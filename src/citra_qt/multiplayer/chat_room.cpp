@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <array>
 #include <future>
 #include <QColor>
@@ -361,11 +362,45 @@ void ChatRoom::UpdateIconDisplay() {
 }
 
 void ChatRoom::SetPlayerList(const Network::RoomMember::MemberList& member_list) {
-    // TODO(B3N30): Remember which row is selected
-    player_list->removeRows(0, player_list->rowCount());
+    // Patch the existing rows instead of clearing the model, so a single join or leave does
+    // not rebuild (and deselect) the whole list
+    for (int row = player_list->rowCount() - 1; row >= 0; --row) {
+        const std::string nickname =
+            player_list->item(row)->data(PlayerListItem::NicknameRole).toString().toStdString();
+        const bool still_present =
+            std::any_of(member_list.begin(), member_list.end(),
+                        [&nickname](const auto& member) { return member.nickname == nickname; });
+        if (!still_present) {
+            player_list->removeRow(row);
+        }
+    }
+
     for (const auto& member : member_list) {
         if (member.nickname.empty())
             continue;
+
+        int existing_row = -1;
+        for (int row = 0; row < player_list->rowCount(); ++row) {
+            if (player_list->item(row)->data(PlayerListItem::NicknameRole).toString() ==
+                QString::fromStdString(member.nickname)) {
+                existing_row = row;
+                break;
+            }
+        }
+        if (existing_row != -1) {
+            QStandardItem* item = player_list->item(existing_row);
+            const bool unchanged =
+                item->data(PlayerListItem::UsernameRole).toString() ==
+                    QString::fromStdString(member.username) &&
+                item->data(PlayerListItem::AvatarUrlRole).toString() ==
+                    QString::fromStdString(member.avatar_url) &&
+                item->data(PlayerListItem::GameNameRole).toString() ==
+                    QString::fromStdString(member.game_info.name);
+            if (unchanged) {
+                continue;
+            }
+        }
+
         QStandardItem* name_item = new PlayerListItem(member.nickname, member.username,
                                                       member.avatar_url, member.game_info.name);
 
@@ -401,10 +436,13 @@ void ChatRoom::SetPlayerList(const Network::RoomMember::MemberList& member_list)
         }
 #endif
 
-        player_list->invisibleRootItem()->appendRow(name_item);
+        if (existing_row != -1) {
+            player_list->setItem(existing_row, name_item);
+        } else {
+            player_list->invisibleRootItem()->appendRow(name_item);
+        }
     }
     UpdateIconDisplay();
-    // TODO(B3N30): Restore row selection
 }
 
 void ChatRoom::OnChatTextChanged() {
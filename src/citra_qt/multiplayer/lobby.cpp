@@ -2,6 +2,8 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <QHash>
 #include <QInputDialog>
 #include <QList>
 #include <QtConcurrent/QtConcurrentRun>
@@ -33,6 +35,7 @@ Lobby::Lobby(QWidget* parent, QStandardItemModel* list,
     watcher = new QFutureWatcher<void>(this);
 
     model = new QStandardItemModel(ui->room_list);
+    ResetModel();
 
     // Create a proxy to the game list to get the list of games owned
     game_list = new QStandardItemModel(this);
@@ -196,7 +199,8 @@ void Lobby::ResetModel() {
 
 void Lobby::RefreshLobby() {
     if (auto session = announce_multiplayer_session.lock()) {
-        ResetModel();
+        // The previous rows stay visible (and usable) while the new list is fetched; they are
+        // patched in place in OnRefreshLobby
         ui->refresh_list->setEnabled(false);
         ui->refresh_list->setText(tr("Refreshing"));
         room_list_watcher.setFuture(
@@ -208,16 +212,28 @@ void Lobby::RefreshLobby() {
 
 void Lobby::OnRefreshLobby() {
     AnnounceMultiplayerRoom::RoomList new_room_list = room_list_watcher.result();
-    for (auto room : new_room_list) {
-        // find the icon for the game if this person owns that game.
-        QPixmap smdh_icon;
-        for (int r = 0; r < game_list->rowCount(); ++r) {
-            auto index = game_list->index(r, 0);
-            auto game_id = game_list->data(index, GameListItemPath::ProgramIdRole).toULongLong();
-            if (game_id != 0 && room.preferred_game_id == game_id) {
-                smdh_icon = game_list->data(index, Qt::DecorationRole).value<QPixmap>();
-            }
+
+    // Resolve the owned-game icons once per refresh instead of scanning the whole game list
+    // again for every room
+    QHash<qulonglong, QPixmap> game_icons;
+    for (int r = 0; r < game_list->rowCount(); ++r) {
+        auto index = game_list->index(r, 0);
+        auto game_id = game_list->data(index, GameListItemPath::ProgramIdRole).toULongLong();
+        if (game_id != 0) {
+            game_icons.insert(game_id, game_list->data(index, Qt::DecorationRole).value<QPixmap>());
         }
+    }
+
+    // Map the rows currently in the model by room verification UID, so rooms that are still
+    // announced get patched in place and the view keeps its scroll position and selection
+    QHash<QString, int> previous_rows;
+    for (int i = 0; i < model->rowCount(); ++i) {
+        previous_rows.insert(
+            model->item(i, Column::HOST)->data(LobbyItemHost::HostVerifyUIDRole).toString(), i);
+    }
+
+    for (auto room : new_room_list) {
+        const QPixmap smdh_icon = game_icons.value(room.preferred_game_id);
 
         QList<QVariant> members;
         for (auto member : room.members) {
@@ -238,7 +254,6 @@ void Lobby::OnRefreshLobby() {
                               room.port, QString::fromStdString(room.verify_UID)),
             new LobbyItemMemberList(members, room.max_player),
         });
-        model->appendRow(row);
         // To make the rows expandable, add the member data as a child of the first column of the
         // rows with people in them and have qt set them to colspan after the model is finished
         // resetting
@@ -249,6 +264,28 @@ void Lobby::OnRefreshLobby() {
         if (!room.members.empty()) {
             first_item->appendRow(new LobbyItemExpandedMemberList(members));
         }
+
+        const auto row_itr = previous_rows.find(QString::fromStdString(room.verify_UID));
+        if (row_itr != previous_rows.end()) {
+            for (int col = 0; col < row.size(); ++col) {
+                model->setItem(row_itr.value(), col, row[col]);
+            }
+            previous_rows.erase(row_itr);
+        } else {
+            model->appendRow(row);
+        }
+    }
+
+    // Remove rooms that are no longer announced, highest row first so the collected indices
+    // stay valid while removing
+    std::vector<int> stale_rows;
+    stale_rows.reserve(previous_rows.size());
+    for (auto itr = previous_rows.cbegin(); itr != previous_rows.cend(); ++itr) {
+        stale_rows.push_back(itr.value());
+    }
+    std::sort(stale_rows.rbegin(), stale_rows.rend());
+    for (const int stale_row : stale_rows) {
+        model->removeRow(stale_row);
     }
 
     // Reenable the refresh button and resize the columns
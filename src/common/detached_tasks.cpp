@@ -5,35 +5,46 @@
 #include <thread>
 #include "common/assert.h"
 #include "common/detached_tasks.h"
+#include "common/logging/log.h"
 
 namespace Common {
 
-DetachedTasks* DetachedTasks::instance = nullptr;
+std::shared_ptr<DetachedTasks::State> DetachedTasks::state;
 
 DetachedTasks::DetachedTasks() {
-    ASSERT(instance == nullptr);
-    instance = this;
+    ASSERT(state == nullptr);
+    state = std::make_shared<State>();
 }
 
 void DetachedTasks::WaitForAllTasks() {
-    std::unique_lock lock{mutex};
-    cv.wait(lock, [this]() { return count == 0; });
+    std::unique_lock lock{state->mutex};
+    state->cv.wait(lock, [] { return state->count == 0; });
+}
+
+bool DetachedTasks::WaitForAllTasks(std::chrono::milliseconds deadline) {
+    std::unique_lock lock{state->mutex};
+    return state->cv.wait_for(lock, deadline, [] { return state->count == 0; });
 }
 
 DetachedTasks::~DetachedTasks() {
-    std::unique_lock lock{mutex};
-    ASSERT(count == 0);
-    instance = nullptr;
+    {
+        std::unique_lock lock{state->mutex};
+        if (state->count != 0) {
+            LOG_WARNING(Common, "Abandoning {} unfinished detached task(s) at exit", state->count);
+        }
+    }
+    state.reset();
 }
 
 void DetachedTasks::AddTask(std::function<void()> task) {
-    std::unique_lock lock{instance->mutex};
-    ++instance->count;
-    std::thread([task{std::move(task)}]() {
+    auto task_state = state;
+    std::unique_lock lock{task_state->mutex};
+    ++task_state->count;
+    std::thread([task_state, task{std::move(task)}]() {
         task();
-        std::unique_lock lock{instance->mutex};
-        --instance->count;
-        std::notify_all_at_thread_exit(instance->cv, std::move(lock));
+        std::unique_lock lock{task_state->mutex};
+        --task_state->count;
+        std::notify_all_at_thread_exit(task_state->cv, std::move(lock));
     }).detach();
 }
 
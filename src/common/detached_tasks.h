@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 
 namespace Common {
 
@@ -27,14 +29,25 @@ public:
     ~DetachedTasks();
     void WaitForAllTasks();
 
+    /**
+     * Waits until all tasks finish or the deadline expires, whichever comes first. Tasks still
+     * running when the deadline expires are abandoned to the OS; their bookkeeping state is kept
+     * alive through a shared pointer so this remains safe.
+     * @returns true if no tasks remain, false if the deadline expired first
+     */
+    bool WaitForAllTasks(std::chrono::milliseconds deadline);
+
     static void AddTask(std::function<void()> task);
 
 private:
-    static DetachedTasks* instance;
-
-    std::condition_variable cv;
-    std::mutex mutex;
-    int count = 0;
+    struct State {
+        std::condition_variable cv;
+        std::mutex mutex;
+        int count = 0;
+    };
+
+    /// Shared with every task thread so that tasks abandoned at the deadline stay safe
+    static std::shared_ptr<State> state;
 };
 
 } // namespace Common
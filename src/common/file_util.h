@@ -105,6 +105,9 @@ private:
 // Overloaded GetSize, accepts FILE*
 [[nodiscard]] u64 GetSize(FILE* f);
 
+// Returns the modification time of filename in seconds since the epoch, or 0 on failure
+[[nodiscard]] u64 GetModificationTime(const std::string& filename);
+
 // Returns true if successful, or path already exists.
 bool CreateDir(const std::string& filename);
 
@@ -41,6 +41,27 @@ inline u64 HashCombine(std::size_t seed, const u64 hash) {
     return seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
 }
 
+/**
+ * Computes a 64-bit fingerprint of a data block by hashing its length together with the head,
+ * tail and evenly strided samples of its contents. This is much faster than ComputeHash64 on
+ * large blocks, but collisions are more likely, so it is only suitable for duplicate detection
+ * and similar heuristics, never as a persistent identifier.
+ */
+static inline u64 ComputeSampledHash64(const void* data, std::size_t len) noexcept {
+    constexpr std::size_t block_size = 1024;
+    constexpr std::size_t num_blocks = 8;
+    if (len <= block_size * num_blocks) {
+        return ComputeHash64(data, len);
+    }
+    const char* bytes = static_cast<const char*>(data);
+    const std::size_t stride = (len - block_size) / (num_blocks - 1);
+    u64 hash = len;
+    for (std::size_t i = 0; i < num_blocks; ++i) {
+        hash = HashCombine(hash, CityHash64(bytes + i * stride, block_size));
+    }
+    return hash;
+}
+
 template <typename T>
 struct IdentityHash {
     std::size_t operator()(const T& value) const {
@@ -0,0 +1,350 @@
+// Copyright 2024 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#ifdef _WIN32
+#include <map>
+#include <vector>
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+#endif
+
+#include "common/assert.h"
+#include "common/host_memory.h"
+#include "common/logging/log.h"
+
+namespace Common {
+
+#ifdef _WIN32
+
+// The placeholder virtual memory primitives are only available on Windows 10 1803 and newer, so
+// they are resolved at runtime rather than linked against.
+using PFN_VirtualAlloc2 = PVOID(WINAPI*)(HANDLE, PVOID, SIZE_T, ULONG, ULONG,
+                                         MEM_EXTENDED_PARAMETER*, ULONG);
+using PFN_MapViewOfFile3 = PVOID(WINAPI*)(HANDLE, HANDLE, PVOID, ULONG64, SIZE_T, ULONG, ULONG,
+                                          MEM_EXTENDED_PARAMETER*, ULONG);
+using PFN_UnmapViewOfFile2 = BOOL(WINAPI*)(HANDLE, PVOID, ULONG);
+
+class HostMemory::Impl {
+public:
+    Impl(u64 backing_size_, u64 virtual_size_)
+        : backing_size{backing_size_}, virtual_size{virtual_size_} {
+        if (const HMODULE kernelbase = GetModuleHandleW(L"kernelbase.dll")) {
+            pfn_VirtualAlloc2 = reinterpret_cast<PFN_VirtualAlloc2>(
+                GetProcAddress(kernelbase, "VirtualAlloc2"));
+            pfn_MapViewOfFile3 = reinterpret_cast<PFN_MapViewOfFile3>(
+                GetProcAddress(kernelbase, "MapViewOfFile3"));
+            pfn_UnmapViewOfFile2 = reinterpret_cast<PFN_UnmapViewOfFile2>(
+                GetProcAddress(kernelbase, "UnmapViewOfFile2"));
+        }
+
+        mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                     static_cast<DWORD>(backing_size >> 32),
+                                     static_cast<DWORD>(backing_size), nullptr);
+        if (!mapping) {
+            LOG_ERROR(Common_Memory, "Failed to allocate {} MiB of backing memory",
+                      backing_size >> 20);
+            return;
+        }
+        backing_base = static_cast<u8*>(
+            MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, backing_size));
+        if (!backing_base) {
+            LOG_ERROR(Common_Memory, "Failed to map backing memory");
+            return;
+        }
+
+        if (virtual_size == 0 || !pfn_VirtualAlloc2 || !pfn_MapViewOfFile3 ||
+            !pfn_UnmapViewOfFile2) {
+            return;
+        }
+        virtual_base = static_cast<u8*>(pfn_VirtualAlloc2(
+            GetCurrentProcess(), nullptr, virtual_size,
+            MEM_RESERVE | MEM_RESERVE_PLACEHOLDER, PAGE_NOACCESS, nullptr, 0));
+        if (!virtual_base) {
+            LOG_WARNING(Common_Memory, "Failed to reserve the fastmem arena, continuing without");
+        }
+    }
+
+    ~Impl() {
+        if (virtual_base) {
+            while (!views.empty()) {
+                UnmapView(views.begin()->first);
+            }
+            VirtualFree(virtual_base, 0, MEM_RELEASE);
+        }
+        if (backing_base) {
+            UnmapViewOfFile(backing_base);
+        }
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+    }
+
+    void Map(u64 virtual_offset, u64 host_offset, u64 length) {
+        // The caller guarantees the target range is unmapped, so it lies within a single free
+        // gap, which by the maintained invariant is a single placeholder. Split the exact range
+        // out of it, then replace the placeholder with a view of the backing memory.
+        const auto [gap_start, gap_end] = GapAround(virtual_offset);
+        if (gap_start != virtual_offset || gap_end != virtual_offset + length) {
+            if (!VirtualFree(virtual_base + virtual_offset, length,
+                             MEM_RELEASE | MEM_PRESERVE_PLACEHOLDER)) {
+                LOG_ERROR(Common_Memory, "Failed to split placeholder at {:x}+{:x}",
+                          virtual_offset, length);
+                return;
+            }
+        }
+        void* const view =
+            pfn_MapViewOfFile3(mapping, GetCurrentProcess(), virtual_base + virtual_offset,
+                               host_offset, length, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE,
+                               nullptr, 0);
+        if (!view) {
+            // Leaving the range as a trapping placeholder is safe; accesses will take the slow
+            // path instead.
+            LOG_ERROR(Common_Memory, "Failed to map view at {:x}+{:x}", virtual_offset, length);
+            CoalesceGap(virtual_offset);
+            return;
+        }
+        views.emplace(virtual_offset, View{length, host_offset});
+    }
+
+    void Unmap(u64 virtual_offset, u64 length) {
+        const u64 end = virtual_offset + length;
+        auto it = views.upper_bound(virtual_offset);
+        if (it != views.begin()) {
+            --it;
+        }
+        // Collect intersecting views first; unmapping mutates the map.
+        std::vector<u64> intersecting;
+        for (; it != views.end() && it->first < end; ++it) {
+            if (it->first + it->second.length > virtual_offset) {
+                intersecting.push_back(it->first);
+            }
+        }
+        for (const u64 view_offset : intersecting) {
+            const View view = views.at(view_offset);
+            UnmapView(view_offset);
+            // Remap any portions of the view that fall outside the requested range.
+            if (view_offset < virtual_offset) {
+                Map(view_offset, view.host_offset, virtual_offset - view_offset);
+            }
+            const u64 view_end = view_offset + view.length;
+            if (view_end > end) {
+                Map(end, view.host_offset + (end - view_offset), view_end - end);
+            }
+        }
+    }
+
+    bool IsValid() const {
+        return backing_base != nullptr;
+    }
+
+    u8* backing_base{};
+    u8* virtual_base{};
+
+private:
+    struct View {
+        u64 length;
+        u64 host_offset;
+    };
+
+    /// Returns the bounds of the unmapped gap containing the given offset.
+    std::pair<u64, u64> GapAround(u64 virtual_offset) const {
+        u64 gap_start = 0;
+        u64 gap_end = virtual_size;
+        auto it = views.upper_bound(virtual_offset);
+        if (it != views.end()) {
+            gap_end = it->first;
+        }
+        if (it != views.begin()) {
+            --it;
+            gap_start = it->first + it->second.length;
+        }
+        return {gap_start, gap_end};
+    }
+
+    /// Merges all placeholders within the gap containing the given offset into a single
+    /// placeholder, restoring the invariant relied upon by Map().
+    void CoalesceGap(u64 virtual_offset) {
+        const auto [gap_start, gap_end] = GapAround(virtual_offset);
+        if (gap_end > gap_start) {
+            // Fails harmlessly if the gap is already a single placeholder.
+            VirtualFree(virtual_base + gap_start, gap_end - gap_start,
+                        MEM_RELEASE | MEM_COALESCE_PLACEHOLDERS);
+        }
+    }
+
+    void UnmapView(u64 view_offset) {
+        if (!pfn_UnmapViewOfFile2(GetCurrentProcess(), virtual_base + view_offset,
+                                  MEM_PRESERVE_PLACEHOLDER)) {
+            LOG_ERROR(Common_Memory, "Failed to unmap view at {:x}", view_offset);
+        }
+        views.erase(view_offset);
+        CoalesceGap(view_offset);
+    }
+
+    u64 backing_size{};
+    u64 virtual_size{};
+    HANDLE mapping{};
+    std::map<u64, View> views;
+
+    PFN_VirtualAlloc2 pfn_VirtualAlloc2{};
+    PFN_MapViewOfFile3 pfn_MapViewOfFile3{};
+    PFN_UnmapViewOfFile2 pfn_UnmapViewOfFile2{};
+};
+
+#elif defined(__unix__) || defined(__APPLE__)
+
+class HostMemory::Impl {
+public:
+    Impl(u64 backing_size_, u64 virtual_size_)
+        : backing_size{backing_size_}, virtual_size{virtual_size_} {
+#ifdef __linux__
+        fd = memfd_create("citra_fastmem", 0);
+#endif
+        if (fd < 0) {
+            // Fall back to a named POSIX shared memory object, unlinked immediately so it does
+            // not outlive the process.
+            char shm_name[64];
+            std::snprintf(shm_name, sizeof(shm_name), "/citra_fastmem_%d",
+                          static_cast<int>(getpid()));
+            fd = shm_open(shm_name, O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (fd < 0) {
+                LOG_ERROR(Common_Memory, "Failed to create shared memory object: {}",
+                          strerror(errno));
+                return;
+            }
+            shm_unlink(shm_name);
+        }
+        if (ftruncate(fd, static_cast<off_t>(backing_size)) < 0) {
+            LOG_ERROR(Common_Memory, "Failed to allocate {} MiB of backing memory: {}",
+                      backing_size >> 20, strerror(errno));
+            return;
+        }
+        void* const backing =
+            mmap(nullptr, backing_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (backing == MAP_FAILED) {
+            LOG_ERROR(Common_Memory, "Failed to map backing memory: {}", strerror(errno));
+            return;
+        }
+        backing_base = static_cast<u8*>(backing);
+
+        if (virtual_size == 0) {
+            return;
+        }
+        void* const arena = mmap(nullptr, virtual_size, PROT_NONE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (arena == MAP_FAILED) {
+            LOG_WARNING(Common_Memory, "Failed to reserve the fastmem arena, continuing without");
+            return;
+        }
+        virtual_base = static_cast<u8*>(arena);
+    }
+
+    ~Impl() {
+        if (virtual_base) {
+            munmap(virtual_base, virtual_size);
+        }
+        if (backing_base) {
+            munmap(backing_base, backing_size);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    void Map(u64 virtual_offset, u64 host_offset, u64 length) {
+        void* const ret = mmap(virtual_base + virtual_offset, length, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_FIXED, fd, static_cast<off_t>(host_offset));
+        if (ret == MAP_FAILED) {
+            LOG_ERROR(Common_Memory, "Failed to map view at {:x}+{:x}: {}", virtual_offset, length,
+                      strerror(errno));
+        }
+    }
+
+    void Unmap(u64 virtual_offset, u64 length) {
+        // Replace the range with a fresh trapping reservation instead of unmapping it, so the
+        // arena stays contiguous and no foreign allocation can move into the hole.
+        void* const ret = mmap(virtual_base + virtual_offset, length, PROT_NONE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+        if (ret == MAP_FAILED) {
+            LOG_ERROR(Common_Memory, "Failed to unmap view at {:x}+{:x}: {}", virtual_offset,
+                      length, strerror(errno));
+        }
+    }
+
+    bool IsValid() const {
+        return backing_base != nullptr;
+    }
+
+    u8* backing_base{};
+    u8* virtual_base{};
+
+private:
+    u64 backing_size{};
+    u64 virtual_size{};
+    int fd = -1;
+};
+
+#else
+
+// Unsupported platform; only the plain allocation fallback below is available.
+class HostMemory::Impl {
+public:
+    Impl(u64, u64) {}
+
+    void Map(u64, u64, u64) {}
+    void Unmap(u64, u64) {}
+
+    bool IsValid() const {
+        return false;
+    }
+
+    u8* backing_base{};
+    u8* virtual_base{};
+};
+
+#endif
+
+HostMemory::HostMemory(u64 backing_size_, u64 virtual_size_)
+    : backing_size{backing_size_}, virtual_size{virtual_size_} {
+    impl = std::make_unique<Impl>(backing_size, virtual_size);
+    if (impl->IsValid()) {
+        backing_base = impl->backing_base;
+        virtual_base = impl->virtual_base;
+        return;
+    }
+    // Shared memory is unavailable; fall back to a plain allocation without an arena.
+    impl.reset();
+    fallback_buffer = std::make_unique<u8[]>(backing_size);
+    backing_base = fallback_buffer.get();
+}
+
+HostMemory::~HostMemory() = default;
+
+void HostMemory::Map(u64 virtual_offset, u64 host_offset, u64 length) {
+    if (!virtual_base || length == 0) {
+        return;
+    }
+    ASSERT(virtual_offset + length <= virtual_size);
+    ASSERT(host_offset + length <= backing_size);
+    impl->Map(virtual_offset, host_offset, length);
+}
+
+void HostMemory::Unmap(u64 virtual_offset, u64 length) {
+    if (!virtual_base || length == 0) {
+        return;
+    }
+    ASSERT(virtual_offset + length <= virtual_size);
+    impl->Unmap(virtual_offset, length);
+}
+
+} // namespace Common
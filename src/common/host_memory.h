@@ -0,0 +1,77 @@
+// Copyright 2024 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Provides a block of shared host memory that backs the emulated physical memory regions, plus an
+ * optional contiguous virtual address arena into which pages of the backing block can be mirrored
+ * at arbitrary offsets. The arena allows a JIT to translate emulated virtual addresses with a
+ * single host address computation (arena base + guest address), with accesses to unmapped pages
+ * trapping via a host fault instead of a software page-table walk.
+ *
+ * If the host does not support the required virtual memory primitives, the backing block is still
+ * allocated but no arena is reserved; `VirtualBasePointer()` then returns nullptr and callers are
+ * expected to fall back to software address translation.
+ */
+class HostMemory {
+public:
+    /**
+     * @param backing_size Size of the shared backing block, in bytes. Must be page-aligned.
+     * @param virtual_size Size of the virtual arena to reserve, in bytes. May be zero to skip
+     *                     reserving an arena entirely.
+     */
+    explicit HostMemory(u64 backing_size, u64 virtual_size);
+    ~HostMemory();
+
+    HostMemory(const HostMemory&) = delete;
+    HostMemory& operator=(const HostMemory&) = delete;
+
+    /**
+     * Mirrors a range of the backing block into the virtual arena. The range must currently be
+     * unmapped in the arena. All arguments must be page-aligned. No-op if there is no arena.
+     */
+    void Map(u64 virtual_offset, u64 host_offset, u64 length);
+
+    /**
+     * Removes any mappings within a range of the virtual arena, returning it to a trapping state.
+     * Unmapped subranges are skipped. All arguments must be page-aligned. No-op if there is no
+     * arena.
+     */
+    void Unmap(u64 virtual_offset, u64 length);
+
+    u8* BackingBasePointer() {
+        return backing_base;
+    }
+    const u8* BackingBasePointer() const {
+        return backing_base;
+    }
+
+    /// Base of the virtual arena, or nullptr if no arena could be reserved.
+    u8* VirtualBasePointer() {
+        return virtual_base;
+    }
+    const u8* VirtualBasePointer() const {
+        return virtual_base;
+    }
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl;
+
+    u64 backing_size{};
+    u64 virtual_size{};
+    u8* backing_base{};
+    u8* virtual_base{};
+
+    /// Fallback allocation used when shared memory is unavailable on the host.
+    std::unique_ptr<u8[]> fallback_buffer;
+};
+
+} // namespace Common
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <chrono>
 #include <condition_variable>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -43,8 +44,20 @@ public:
 
     void PushEntry(Class log_class, Level log_level, const char* filename, unsigned int line_num,
                    const char* function, std::string message) {
-        message_queue.Push(
-            CreateEntry(log_class, log_level, filename, line_num, function, std::move(message)));
+        Entry entry = CreateEntry(log_class, log_level, filename, line_num, function);
+        entry.message = std::move(message);
+        message_queue.Push(std::move(entry));
+    }
+
+    void PushDeferredEntry(Class log_class, Level log_level, const char* filename,
+                           unsigned int line_num, const char* function, const char* format,
+                           DeferredFormatter formatter, const void* args, std::size_t args_size) {
+        DEBUG_ASSERT(args_size <= MaxDeferredArgsSize);
+        Entry entry = CreateEntry(log_class, log_level, filename, line_num, function);
+        entry.deferred_format = format;
+        entry.deferred_formatter = formatter;
+        std::memcpy(entry.deferred_args.data(), args, args_size);
+        message_queue.Push(std::move(entry));
     }
 
     void AddBackend(std::unique_ptr<Backend> backend) {
@@ -74,6 +87,12 @@ private:
         backend_thread = std::thread([&] {
             Entry entry;
             auto write_logs = [&](Entry& e) {
+                // Deferred entries carry their format string and argument values; build the
+                // message here so the formatting cost is paid on this thread, not the caller's
+                if (e.deferred_formatter) {
+                    e.message = e.deferred_formatter(e.deferred_format, e.deferred_args.data());
+                    e.deferred_formatter = nullptr;
+                }
                 std::lock_guard lock{writing_mutex};
                 for (const auto& backend : backends) {
                     backend->Write(e);
@@ -105,7 +124,7 @@ private:
     }
 
     Entry CreateEntry(Class log_class, Level log_level, const char* filename, unsigned int line_nr,
-                      const char* function, std::string message) const {
+                      const char* function) const {
         using std::chrono::duration_cast;
         using std::chrono::steady_clock;
 
@@ -117,7 +136,6 @@ private:
         entry.filename = filename;
         entry.line_num = line_nr;
         entry.function = function;
-        entry.message = std::move(message);
 
         return entry;
     }
@@ -125,7 +143,7 @@ private:
     std::mutex writing_mutex;
     std::thread backend_thread;
     std::vector<std::unique_ptr<Backend>> backends;
-    Common::MPSCQueue<Log::Entry> message_queue;
+    Common::MPMCQueue<Log::Entry, 0x1000> message_queue;
     Filter filter;
     std::chrono::steady_clock::time_point time_origin{std::chrono::steady_clock::now()};
 };
@@ -302,4 +320,11 @@ void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
     instance.PushEntry(log_class, log_level, filename, line_num, function,
                        fmt::vformat(format, args));
 }
+
+void DeferredLogMessageImpl(Class log_class, Level log_level, const char* filename,
+                            unsigned int line_num, const char* function, const char* format,
+                            DeferredFormatter formatter, const void* args, std::size_t args_size) {
+    Impl::Instance().PushDeferredEntry(log_class, log_level, filename, line_num, function, format,
+                                       formatter, args, args_size);
+}
 } // namespace Log
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -24,10 +26,17 @@ struct Entry {
     Level log_level;
     const char* filename;
     unsigned int line_num;
-    std::string function;
+    const char* function;
     std::string message;
     bool final_entry = false;
 
+    // Set for entries whose message is formatted on the logger thread instead of the caller:
+    // deferred_format points to a string literal and deferred_args holds the argument tuple
+    // that deferred_formatter expects
+    const char* deferred_format = nullptr;
+    DeferredFormatter deferred_formatter = nullptr;
+    alignas(std::max_align_t) std::array<u8, MaxDeferredArgsSize> deferred_args{};
+
     Entry() = default;
     Entry(Entry&& o) = default;
 
@@ -6,6 +6,10 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
 #include "common/common_types.h"
 #include "common/logging/formatter.h"
 
@@ -35,6 +39,19 @@ enum class Level : u8 {
     Count ///< Total number of logging levels
 };
 
+// Messages below this level are compiled out entirely: neither the call nor the evaluation of
+// its arguments is emitted. Can be overridden from the build system by defining
+// CITRA_MINIMUM_LOG_LEVEL to the numeric value of a Level enumerator.
+#ifndef CITRA_MINIMUM_LOG_LEVEL
+#ifdef _DEBUG
+#define CITRA_MINIMUM_LOG_LEVEL 0 // Trace
+#else
+#define CITRA_MINIMUM_LOG_LEVEL 1 // Debug
+#endif
+#endif
+
+constexpr Level MinimumLoggableLevel = static_cast<Level>(CITRA_MINIMUM_LOG_LEVEL);
+
 typedef u8 ClassType;
 
 /**
@@ -158,19 +175,57 @@ extern Filter filter;
 
 void SetGlobalFilter(const Filter& f);
 
+/// Formats a deferred log entry on the logger thread. `args` points to the argument tuple that
+/// was captured into the entry when the message was queued.
+using DeferredFormatter = std::string (*)(const char* format, const void* args);
+
+/// Maximum combined size of the arguments that can be captured for deferred formatting
+constexpr std::size_t MaxDeferredArgsSize = 64;
+
 /// Logs a message to the global logger, using fmt
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
                        unsigned int line_num, const char* function, const char* format,
                        const fmt::format_args& args);
 
+/// Queues a message whose formatting is deferred to the logger thread. `format` must point to
+/// storage that outlives the program; the logging macros always pass string literals.
+void DeferredLogMessageImpl(Class log_class, Level log_level, const char* filename,
+                            unsigned int line_num, const char* function, const char* format,
+                            DeferredFormatter formatter, const void* args, std::size_t args_size);
+
+namespace detail {
+template <typename... Args>
+std::string FormatDeferredMessage(const char* format, const void* args) {
+    const auto& arg_tuple = *static_cast<const std::tuple<Args...>*>(args);
+    return std::apply(
+        [format](const Args&... unpacked) {
+            return fmt::vformat(format, fmt::make_format_args(unpacked...));
+        },
+        arg_tuple);
+}
+} // namespace detail
+
 template <typename... Args>
 void FmtLogMessage(Class log_class, Level log_level, const char* filename, unsigned int line_num,
                    const char* function, const char* format, const Args&... args) {
     if (!filter.CheckMessage(log_class, log_level))
         return;
 
-    FmtLogMessageImpl(log_class, log_level, filename, line_num, function, format,
-                      fmt::make_format_args(args...));
+    // Arithmetic and enum arguments are captured by value and formatted on the logger thread,
+    // keeping the formatting cost off the calling thread. Anything that may reference memory
+    // owned by the caller (strings, pointers, custom types) is formatted eagerly as before.
+    using ArgTuple = std::tuple<std::remove_cvref_t<Args>...>;
+    constexpr bool deferrable = ((std::is_arithmetic_v<std::remove_cvref_t<Args>> ||
+                                  std::is_enum_v<std::remove_cvref_t<Args>>)&&...);
+    if constexpr (deferrable && sizeof(ArgTuple) <= MaxDeferredArgsSize) {
+        const ArgTuple arg_tuple{args...};
+        DeferredLogMessageImpl(log_class, log_level, filename, line_num, function, format,
+                               detail::FormatDeferredMessage<std::remove_cvref_t<Args>...>,
+                               &arg_tuple, sizeof(ArgTuple));
+    } else {
+        FmtLogMessageImpl(log_class, log_level, filename, line_num, function, format,
+                          fmt::make_format_args(args...));
+    }
 }
 
 } // namespace Log
@@ -180,26 +235,21 @@ void FmtLogMessage(Class log_class, Level log_level, const char* filename, unsig
     ::Log::FmtLogMessage(log_class, log_level, ::Log::TrimSourcePath(__FILE__), __LINE__,          \
                          __func__, __VA_ARGS__)
 
-#ifdef _DEBUG
-#define LOG_TRACE(log_class, ...)                                                                  \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Trace,                             \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
-#else
-#define LOG_TRACE(log_class, fmt, ...) (void(0))
-#endif
-
-#define LOG_DEBUG(log_class, ...)                                                                  \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Debug,                             \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
-#define LOG_INFO(log_class, ...)                                                                   \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Info,                              \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
-#define LOG_WARNING(log_class, ...)                                                                \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Warning,                           \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
-#define LOG_ERROR(log_class, ...)                                                                  \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Error,                             \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
-#define LOG_CRITICAL(log_class, ...)                                                               \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Critical,                          \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
+// Calls below the compile-time level floor are removed entirely, including the evaluation of
+// their arguments
+#define LOG_IMPL(log_class, log_level, ...)                                                        \
+    do {                                                                                           \
+        if constexpr (static_cast<u8>(::Log::Level::log_level) >=                                  \
+                      static_cast<u8>(::Log::MinimumLoggableLevel)) {                              \
+            ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::log_level,                 \
+                                 ::Log::TrimSourcePath(__FILE__), __LINE__, __func__,              \
+                                 __VA_ARGS__);                                                     \
+        }                                                                                          \
+    } while (0)
+
+#define LOG_TRACE(log_class, ...) LOG_IMPL(log_class, Trace, __VA_ARGS__)
+#define LOG_DEBUG(log_class, ...) LOG_IMPL(log_class, Debug, __VA_ARGS__)
+#define LOG_INFO(log_class, ...) LOG_IMPL(log_class, Info, __VA_ARGS__)
+#define LOG_WARNING(log_class, ...) LOG_IMPL(log_class, Warning, __VA_ARGS__)
+#define LOG_ERROR(log_class, ...) LOG_IMPL(log_class, Error, __VA_ARGS__)
+#define LOG_CRITICAL(log_class, ...) LOG_IMPL(log_class, Critical, __VA_ARGS__)
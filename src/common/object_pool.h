@@ -0,0 +1,119 @@
+// Copyright 2025 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Common {
+
+/**
+ * Free-list pool for fixed-size blocks. Blocks are carved out of chunk allocations and
+ * recycled through a LIFO free list, so steady-state allocation and deallocation never touch
+ * the global allocator. Memory is only returned to the system when the pool is destroyed;
+ * the footprint is bounded by the high-water mark of live objects.
+ */
+template <std::size_t BlockSize, std::size_t BlockAlign>
+class FixedBlockPool {
+public:
+    static constexpr std::size_t BLOCKS_PER_CHUNK = 64;
+
+    void* Allocate() {
+        std::scoped_lock lock{mutex};
+        if (free_list == nullptr) {
+            AllocateChunk();
+        }
+        FreeBlock* block = free_list;
+        free_list = block->next;
+        return block;
+    }
+
+    void Deallocate(void* pointer) {
+        std::scoped_lock lock{mutex};
+        FreeBlock* block = static_cast<FreeBlock*>(pointer);
+        block->next = free_list;
+        free_list = block;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct alignas(BlockAlign > alignof(FreeBlock) ? BlockAlign : alignof(FreeBlock)) Block {
+        std::byte storage[BlockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : BlockSize];
+    };
+
+    void AllocateChunk() {
+        auto& chunk = chunks.emplace_back(std::make_unique<Block[]>(BLOCKS_PER_CHUNK));
+        for (std::size_t i = 0; i < BLOCKS_PER_CHUNK; ++i) {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(&chunk[i]);
+            block->next = free_list;
+            free_list = block;
+        }
+    }
+
+    std::mutex mutex;
+    FreeBlock* free_list = nullptr;
+    std::vector<std::unique_ptr<Block[]>> chunks;
+};
+
+/**
+ * Minimal allocator handing out blocks from a per-type FixedBlockPool, intended for
+ * std::allocate_shared so that the object and its control block come from the pool in one
+ * block. Only single-object allocations are supported.
+ */
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(GetPool().Allocate());
+    }
+
+    void deallocate(T* pointer, std::size_t n) noexcept {
+        if (n != 1) {
+            ::operator delete(pointer);
+            return;
+        }
+        GetPool().Deallocate(pointer);
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>&) const noexcept {
+        return true;
+    }
+
+private:
+    static FixedBlockPool<sizeof(T), alignof(T)>& GetPool() {
+        static FixedBlockPool<sizeof(T), alignof(T)> pool;
+        return pool;
+    }
+};
+
+/**
+ * Creates a shared_ptr whose object and control block live in a pool shared by all objects of
+ * the same type, avoiding a global allocator round trip per object. Use for types that are
+ * created and destroyed at high rates.
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> AllocateShared(Args&&... args) {
+    return std::allocate_shared<T>(PoolAllocator<T>{}, std::forward<Args>(args)...);
+}
+
+} // namespace Common
@@ -2,9 +2,11 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <array>
 #include <utility>
 #include <vector>
+#include "common/hash.h"
 #include "common/logging/log.h"
 #include "common/param_package.h"
 #include "common/string_util.h"
@@ -46,7 +48,15 @@ ParamPackage::ParamPackage(const std::string& serialized) {
     }
 }
 
-ParamPackage::ParamPackage(std::initializer_list<DataType::value_type> list) : data(list) {}
+ParamPackage::ParamPackage(std::initializer_list<DataType::value_type> list) {
+    for (const auto& pair : list) {
+        // Keep the first occurrence of duplicate keys, matching std::map's range construction
+        const auto it = Find(pair.first);
+        if (it == data.end() || it->first != pair.first) {
+            data.insert(it, pair);
+        }
+    }
+}
 
 std::string ParamPackage::Serialize() const {
     if (data.empty())
@@ -69,8 +79,8 @@ std::string ParamPackage::Serialize() const {
 }
 
 std::string ParamPackage::Get(const std::string& key, const std::string& default_value) const {
-    auto pair = data.find(key);
-    if (pair == data.end()) {
+    const auto pair = Find(key);
+    if (pair == data.end() || pair->first != key) {
         LOG_DEBUG(Common, "key {} not found", key);
         return default_value;
     }
@@ -79,8 +89,8 @@ std::string ParamPackage::Get(const std::string& key, const std::string& default
 }
 
 int ParamPackage::Get(const std::string& key, int default_value) const {
-    auto pair = data.find(key);
-    if (pair == data.end()) {
+    const auto pair = Find(key);
+    if (pair == data.end() || pair->first != key) {
         LOG_DEBUG(Common, "key {} not found", key);
         return default_value;
     }
@@ -94,8 +104,8 @@ int ParamPackage::Get(const std::string& key, int default_value) const {
 }
 
 float ParamPackage::Get(const std::string& key, float default_value) const {
-    auto pair = data.find(key);
-    if (pair == data.end()) {
+    const auto pair = Find(key);
+    if (pair == data.end() || pair->first != key) {
         LOG_DEBUG(Common, "key {} not found", key);
         return default_value;
     }
@@ -109,27 +119,74 @@ float ParamPackage::Get(const std::string& key, float default_value) const {
 }
 
 void ParamPackage::Set(const std::string& key, std::string value) {
-    data.insert_or_assign(key, std::move(value));
+    const auto it = Find(key);
+    if (it != data.end() && it->first == key) {
+        it->second = std::move(value);
+    } else {
+        data.insert(it, {key, std::move(value)});
+    }
+    hash_dirty = true;
 }
 
 void ParamPackage::Set(const std::string& key, int value) {
-    data.insert_or_assign(key, std::to_string(value));
+    Set(key, std::to_string(value));
 }
 
 void ParamPackage::Set(const std::string& key, float value) {
-    data.insert_or_assign(key, std::to_string(value));
+    Set(key, std::to_string(value));
 }
 
 bool ParamPackage::Has(const std::string& key) const {
-    return data.find(key) != data.end();
+    const auto it = Find(key);
+    return it != data.end() && it->first == key;
 }
 
 void ParamPackage::Erase(const std::string& key) {
-    data.erase(key);
+    const auto it = Find(key);
+    if (it != data.end() && it->first == key) {
+        data.erase(it);
+        hash_dirty = true;
+    }
 }
 
 void ParamPackage::Clear() {
     data.clear();
+    hash_dirty = true;
+}
+
+u64 ParamPackage::Hash() const {
+    if (hash_dirty) {
+        u64 hash = data.size();
+        // The data is kept sorted by key, so equal contents always hash in the same order
+        for (const auto& [key, value] : data) {
+            hash = HashCombine(hash, ComputeHash64(key.data(), key.size()));
+            hash = HashCombine(hash, ComputeHash64(value.data(), value.size()));
+        }
+        cached_hash = hash;
+        hash_dirty = false;
+    }
+    return cached_hash;
+}
+
+bool ParamPackage::operator==(const ParamPackage& other) const {
+    if (Hash() != other.Hash()) {
+        return false;
+    }
+    return std::equal(data.begin(), data.end(), other.data.begin(), other.data.end());
+}
+
+bool ParamPackage::operator!=(const ParamPackage& other) const {
+    return !operator==(other);
+}
+
+ParamPackage::DataType::iterator ParamPackage::Find(const std::string& key) {
+    return std::lower_bound(data.begin(), data.end(), key,
+                            [](const auto& pair, const std::string& k) { return pair.first < k; });
+}
+
+ParamPackage::DataType::const_iterator ParamPackage::Find(const std::string& key) const {
+    return std::lower_bound(data.begin(), data.end(), key,
+                            [](const auto& pair, const std::string& k) { return pair.first < k; });
 }
 
 ParamPackage::DataType::iterator ParamPackage::begin() {
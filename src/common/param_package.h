@@ -5,15 +5,19 @@
 #pragma once
 
 #include <initializer_list>
-#include <map>
 #include <string>
+#include <utility>
+#include <boost/container/small_vector.hpp>
+#include "common/common_types.h"
 
 namespace Common {
 
 /// A string-based key-value container supporting serializing to and deserializing from a string
 class ParamPackage {
 public:
-    using DataType = std::map<std::string, std::string>;
+    // Input device parameters are almost always a handful of short key-value pairs, so they are
+    // stored as a sorted flat vector with inline storage instead of a node-based map
+    using DataType = boost::container::small_vector<std::pair<std::string, std::string>, 4>;
 
     ParamPackage() = default;
     explicit ParamPackage(const std::string& serialized);
@@ -35,6 +39,13 @@ public:
     void Erase(const std::string& key);
     void Clear();
 
+    /// Returns a 64-bit hash over the contents, cached until the next mutation. Two packages
+    /// with the same key-value pairs hash identically regardless of insertion order.
+    [[nodiscard]] u64 Hash() const;
+
+    [[nodiscard]] bool operator==(const ParamPackage& other) const;
+    [[nodiscard]] bool operator!=(const ParamPackage& other) const;
+
     // For range-based for
     DataType::iterator begin();
     DataType::const_iterator begin() const;
@@ -42,7 +53,12 @@ public:
     DataType::const_iterator end() const;
 
 private:
+    DataType::iterator Find(const std::string& key);
+    DataType::const_iterator Find(const std::string& key) const;
+
     DataType data;
+    mutable u64 cached_hash = 0;
+    mutable bool hash_dirty = true;
 };
 
 } // namespace Common
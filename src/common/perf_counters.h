@@ -0,0 +1,58 @@
+// Copyright 2023 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include "common/common_types.h"
+
+namespace Common::PerfCounters {
+
+/**
+ * Always-on hot-path counters. Unlike the MicroProfile scopes, which are too expensive to
+ * leave enabled in shipped builds, each of these is a single relaxed atomic increment.
+ * Core::PerfStats aggregates the running totals over each stats interval so frontends can
+ * display them and diagnose slow titles without a custom instrumented build.
+ */
+enum class Counter : std::size_t {
+    SvcCalls,          ///< System calls dispatched
+    IpcBytesTranslated, ///< Bytes moved while translating IPC command buffers
+    SurfaceUploads,    ///< Surfaces uploaded by the rasterizer cache
+    JitInvalidations,  ///< JIT instruction-cache invalidation requests
+    AudioUnderruns,    ///< Sink callbacks that ran out of queued samples
+    SwapchainAcquireUs, ///< Microseconds spent waiting to acquire a swapchain image
+    GpuFrameUs,        ///< Microseconds of GPU time measured by per-frame timestamp queries
+    Count,
+};
+
+constexpr std::size_t NumCounters = static_cast<std::size_t>(Counter::Count);
+
+/// Short names for each counter, in enum order; used for CSV headers and overlays
+constexpr std::array<const char*, NumCounters> CounterNames = {
+    "svc_calls",       "ipc_bytes",            "surface_uploads", "jit_invalidations",
+    "audio_underruns", "swapchain_acquire_us", "gpu_frame_us",
+};
+
+namespace detail {
+inline std::array<std::atomic<u64>, NumCounters> counters{};
+} // namespace detail
+
+/// Adds to a counter; safe to call from any thread and never takes a lock
+inline void Add(Counter counter, u64 value = 1) {
+    detail::counters[static_cast<std::size_t>(counter)].fetch_add(value,
+                                                                  std::memory_order_relaxed);
+}
+
+/// Returns the running totals accumulated since process start
+inline std::array<u64, NumCounters> GetTotals() {
+    std::array<u64, NumCounters> totals;
+    for (std::size_t i = 0; i < NumCounters; i++) {
+        totals[i] = detail::counters[i].load(std::memory_order_relaxed);
+    }
+    return totals;
+}
+
+} // namespace Common::PerfCounters
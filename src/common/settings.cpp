@@ -75,7 +75,32 @@ std::string_view GetTextureFilterName(TextureFilter filter) {
 Values values = {};
 static bool configuring_global = true;
 
+static FrameSettings CaptureFrameSettings() {
+    return FrameSettings{
+        .graphics_api = values.graphics_api.GetValue(),
+        .resolution_factor = values.resolution_factor.GetValue(),
+        .dynamic_resolution = values.dynamic_resolution.GetValue(),
+        .frame_limit = values.frame_limit.GetValue(),
+        .volume = Volume(),
+    };
+}
+
+// Defined after `values` so the initial capture sees the default-constructed settings
+static std::atomic<std::shared_ptr<const FrameSettings>> frame_settings{
+    std::make_shared<const FrameSettings>(CaptureFrameSettings())};
+
+std::shared_ptr<const FrameSettings> GetFrameSettings() {
+    return frame_settings.load(std::memory_order_acquire);
+}
+
+void PublishFrameSettings() {
+    frame_settings.store(std::make_shared<const FrameSettings>(CaptureFrameSettings()),
+                         std::memory_order_release);
+}
+
 void Apply() {
+    PublishFrameSettings();
+
     GDBStub::SetServerPort(values.gdbstub_port.GetValue());
     GDBStub::ToggleServer(values.use_gdbstub.GetValue());
 
@@ -103,27 +128,49 @@ void Apply() {
         Core::DSP().SetSink(values.output_type.GetValue(), values.output_device.GetValue());
         Core::DSP().EnableStretching(values.enable_audio_stretching.GetValue());
 
-        auto hid = Service::HID::GetModule(system);
-        if (hid) {
-            hid->ReloadInputDevices();
+        // Journal of the values these subsystems were last configured with. Apply runs on
+        // every dialog OK, so only reload a subsystem when its settings actually changed.
+        static InputProfile applied_input_profile;
+        static std::vector<TouchFromButtonMap> applied_touch_maps;
+        static decltype(values.camera_name) applied_camera_name;
+        static decltype(values.camera_config) applied_camera_config;
+        static decltype(values.camera_flip) applied_camera_flip;
+
+        if (values.current_input_profile != applied_input_profile ||
+            values.touch_from_button_maps != applied_touch_maps) {
+            applied_input_profile = values.current_input_profile;
+            applied_touch_maps = values.touch_from_button_maps;
+
+            auto hid = Service::HID::GetModule(system);
+            if (hid) {
+                hid->ReloadInputDevices();
+            }
+
+            auto apt = Service::APT::GetModule(system);
+            if (apt) {
+                apt->GetAppletManager()->ReloadInputDevices();
+            }
+
+            auto sm = system.ServiceManager();
+            auto ir_user = sm.GetService<Service::IR::IR_USER>("ir:USER");
+            if (ir_user)
+                ir_user->ReloadInputDevices();
+            auto ir_rst = sm.GetService<Service::IR::IR_RST>("ir:rst");
+            if (ir_rst)
+                ir_rst->ReloadInputDevices();
         }
 
-        auto apt = Service::APT::GetModule(system);
-        if (apt) {
-            apt->GetAppletManager()->ReloadInputDevices();
-        }
-
-        auto sm = system.ServiceManager();
-        auto ir_user = sm.GetService<Service::IR::IR_USER>("ir:USER");
-        if (ir_user)
-            ir_user->ReloadInputDevices();
-        auto ir_rst = sm.GetService<Service::IR::IR_RST>("ir:rst");
-        if (ir_rst)
-            ir_rst->ReloadInputDevices();
-
-        auto cam = Service::CAM::GetModule(system);
-        if (cam) {
-            cam->ReloadCameraDevices();
+        if (values.camera_name != applied_camera_name ||
+            values.camera_config != applied_camera_config ||
+            values.camera_flip != applied_camera_flip) {
+            applied_camera_name = values.camera_name;
+            applied_camera_config = values.camera_config;
+            applied_camera_flip = values.camera_flip;
+
+            auto cam = Service::CAM::GetModule(system);
+            if (cam) {
+                cam->ReloadCameraDevices();
+            }
         }
 
         Service::MIC::ReloadMic(system);
@@ -140,7 +187,9 @@ void LogSettings() {
 
     LOG_INFO(Config, "Citra Configuration:");
     log_setting("Core_UseCpuJit", values.use_cpu_jit.GetValue());
+    log_setting("Core_UseFastmem", values.use_fastmem.GetValue());
     log_setting("Core_CPUClockPercentage", values.cpu_clock_percentage.GetValue());
+    log_setting("Core_EmulateFsTimings", values.emulate_fs_timings.GetValue());
     log_setting("Renderer_UseGLES", values.use_gles.GetValue());
     log_setting("Renderer_GraphicsAPI", GetGraphicsAPIName(values.graphics_api.GetValue()));
     log_setting("Renderer_AsyncShaders", values.async_shader_compilation.GetValue());
@@ -150,7 +199,9 @@ void LogSettings() {
     log_setting("Renderer_UseHwShader", values.use_hw_shader.GetValue());
     log_setting("Renderer_ShadersAccurateMul", values.shaders_accurate_mul.GetValue());
     log_setting("Renderer_UseShaderJit", values.use_shader_jit.GetValue());
+    log_setting("Renderer_AsyncSoftwareRendering", values.async_software_rendering.GetValue());
     log_setting("Renderer_UseResolutionFactor", values.resolution_factor.GetValue());
+    log_setting("Renderer_DynamicResolution", values.dynamic_resolution.GetValue());
     log_setting("Renderer_FrameLimit", values.frame_limit.GetValue());
     log_setting("Renderer_VSyncNew", values.use_vsync_new.GetValue());
     log_setting("Renderer_PostProcessingShader", values.pp_shader_name.GetValue());
@@ -230,6 +281,7 @@ void RestoreGlobalState(bool is_powered_on) {
     // Core
     values.cpu_clock_percentage.SetGlobal(true);
     values.is_new_3ds.SetGlobal(true);
+    values.emulate_fs_timings.SetGlobal(true);
 
     // Renderer
     values.graphics_api.SetGlobal(true);
@@ -242,6 +294,7 @@ void RestoreGlobalState(bool is_powered_on) {
     values.shaders_accurate_mul.SetGlobal(true);
     values.use_vsync_new.SetGlobal(true);
     values.resolution_factor.SetGlobal(true);
+    values.dynamic_resolution.SetGlobal(true);
     values.frame_limit.SetGlobal(true);
     values.texture_filter.SetGlobal(true);
     values.layout_option.SetGlobal(true);
@@ -259,6 +312,8 @@ void RestoreGlobalState(bool is_powered_on) {
     values.dump_textures.SetGlobal(true);
     values.custom_textures.SetGlobal(true);
     values.preload_textures.SetGlobal(true);
+
+    PublishFrameSettings();
 }
 
 void LoadProfile(int index) {
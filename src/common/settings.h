@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -391,11 +392,15 @@ struct InputProfile {
     std::string udp_input_address;
     u16 udp_input_port;
     u8 udp_pad_index;
+
+    bool operator==(const InputProfile&) const = default;
 };
 
 struct TouchFromButtonMap {
     std::string name;
     std::vector<std::string> buttons;
+
+    bool operator==(const TouchFromButtonMap&) const = default;
 };
 
 /// A special region value indicating that citra will automatically select a region
@@ -411,8 +416,10 @@ struct Values {
 
     // Core
     Setting<bool> use_cpu_jit{true, "use_cpu_jit"};
+    Setting<bool> use_fastmem{true, "use_fastmem"};
     SwitchableSetting<s32, true> cpu_clock_percentage{100, 5, 400, "cpu_clock_percentage"};
     SwitchableSetting<bool> is_new_3ds{true, "is_new_3ds"};
+    SwitchableSetting<bool> emulate_fs_timings{true, "emulate_fs_timings"};
 
     // Data Storage
     Setting<bool> use_virtual_sd{true, "use_virtual_sd"};
@@ -436,12 +443,15 @@ struct Values {
     SwitchableSetting<bool> spirv_shader_gen{true, "spirv_shader_gen"};
     SwitchableSetting<bool> async_shader_compilation{false, "async_shader_compilation"};
     SwitchableSetting<bool> async_presentation{true, "async_presentation"};
+    Setting<bool> async_software_rendering{false, "async_software_rendering"};
     SwitchableSetting<bool> use_hw_shader{true, "use_hw_shader"};
     SwitchableSetting<bool> use_disk_shader_cache{true, "use_disk_shader_cache"};
     SwitchableSetting<bool> shaders_accurate_mul{true, "shaders_accurate_mul"};
     SwitchableSetting<bool> use_vsync_new{true, "use_vsync_new"};
     Setting<bool> use_shader_jit{true, "use_shader_jit"};
     SwitchableSetting<u32, true> resolution_factor{1, 0, 10, "resolution_factor"};
+    SwitchableSetting<bool> dynamic_resolution{false, "dynamic_resolution"};
+    Setting<u32> scaled_surface_budget_mb{1024, "scaled_surface_budget_mb"};
     SwitchableSetting<u16, true> frame_limit{100, 0, 1000, "frame_limit"};
     SwitchableSetting<TextureFilter> texture_filter{TextureFilter::None, "texture_filter"};
 
@@ -523,6 +533,29 @@ struct Values {
 
 extern Values values;
 
+/**
+ * Immutable snapshot of the settings that hot loops read every frame. A fresh snapshot is
+ * published whenever the live values may have changed; readers grab one reference-counted
+ * pointer per frame (or per audio callback) and then read plain fields from it, so the
+ * emulation, video and audio threads never observe Settings::values mid-update and pay no
+ * synchronization cost beyond a single pointer load.
+ */
+struct FrameSettings {
+    GraphicsAPI graphics_api;
+    u32 resolution_factor;
+    bool dynamic_resolution;
+    u16 frame_limit;
+    /// Linear volume with mute already applied
+    float volume;
+};
+
+/// Returns the per-frame settings snapshot current at the last publish; never null
+std::shared_ptr<const FrameSettings> GetFrameSettings();
+
+/// Captures the live values into a new immutable snapshot. Apply() publishes automatically;
+/// frontends that mutate values directly (e.g. a mute hotkey) must publish themselves.
+void PublishFrameSettings();
+
 bool IsConfiguringGlobal();
 void SetConfiguringGlobal(bool is_global);
 
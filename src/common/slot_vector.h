@@ -59,6 +59,9 @@ public:
         new (&values[index].object) T(std::forward<Args>(args)...);
         SetStorageBit(index);
 
+        dense_position[index] = static_cast<u32>(dense_live.size());
+        dense_live.push_back(index);
+
         return SlotId{index};
     }
 
@@ -66,6 +69,35 @@ public:
         values[id.index].object.~T();
         free_list.push_back(id.index);
         ResetStorageBit(id.index);
+
+        // Swap-remove from the packed live array and fix up the moved element's remap entry
+        const u32 pos = dense_position[id.index];
+        const u32 last = dense_live.back();
+        dense_live[pos] = last;
+        dense_position[last] = pos;
+        dense_live.pop_back();
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return dense_live.size();
+    }
+
+    /**
+     * Invokes func(SlotId, T&) for every live element by scanning a contiguous array of live
+     * indices, in unspecified order. The container must not be mutated during the traversal.
+     */
+    template <typename Func>
+    void each(Func&& func) {
+        for (const u32 index : dense_live) {
+            func(SlotId{index}, values[index].object);
+        }
+    }
+
+    template <typename Func>
+    void each(Func&& func) const {
+        for (const u32 index : dense_live) {
+            func(SlotId{index}, values[index].object);
+        }
     }
 
 private:
@@ -127,6 +159,7 @@ private:
         }
 
         stored_bitset.resize((new_capacity + 63) / 64);
+        dense_position.resize(new_capacity);
 
         const size_t old_free_size = free_list.size();
         free_list.resize(old_free_size + (new_capacity - values_capacity));
@@ -143,6 +176,11 @@ private:
 
     std::vector<u64> stored_bitset;
     std::vector<u32> free_list;
+
+    // Packed indices of the live elements plus a slot-index-to-packed-position remap table,
+    // giving O(1) insert/erase and allocation-order-independent dense iteration
+    std::vector<u32> dense_live;
+    std::vector<u32> dense_position;
 };
 
 } // namespace Common
@@ -4,9 +4,7 @@
 
 #include <algorithm>
 #include <cctype>
-#include <codecvt>
 #include <cstdlib>
-#include <locale>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -154,14 +152,167 @@ std::string ReplaceAll(std::string result, const std::string& src, const std::st
     return result;
 }
 
+/// Replacement character emitted for unpaired surrogates and malformed sequences
+constexpr u32 REPLACEMENT_CHARACTER = 0xFFFD;
+
+std::size_t UTF16ToUTF8(std::u16string_view input, std::span<char> output) {
+    const std::size_t size = input.size();
+    std::size_t i = 0;
+    std::size_t out = 0;
+    while (i < size) {
+        // Guest strings are overwhelmingly ASCII (paths, titles), so copy them through in
+        // blocks of 8 units; the trivial loops vectorize. Falls back to the scalar decoder
+        // as soon as a block contains a non-ASCII unit.
+        while (size - i >= 8 && output.size() - out >= 8) {
+            u16 bits = 0;
+            for (std::size_t j = 0; j < 8; ++j) {
+                bits |= static_cast<u16>(input[i + j]);
+            }
+            if (bits >= 0x80) {
+                break;
+            }
+            for (std::size_t j = 0; j < 8; ++j) {
+                output[out + j] = static_cast<char>(input[i + j]);
+            }
+            i += 8;
+            out += 8;
+        }
+        if (i >= size) {
+            break;
+        }
+
+        u32 codepoint = input[i++];
+        if (codepoint >= 0xD800 && codepoint < 0xDC00) {
+            if (i < size && input[i] >= 0xDC00 && input[i] < 0xE000) {
+                codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (input[i++] - 0xDC00);
+            } else {
+                codepoint = REPLACEMENT_CHARACTER;
+            }
+        } else if (codepoint >= 0xDC00 && codepoint < 0xE000) {
+            codepoint = REPLACEMENT_CHARACTER;
+        }
+
+        if (codepoint < 0x80) {
+            if (out + 1 > output.size()) {
+                break;
+            }
+            output[out++] = static_cast<char>(codepoint);
+        } else if (codepoint < 0x800) {
+            if (out + 2 > output.size()) {
+                break;
+            }
+            output[out++] = static_cast<char>(0xC0 | (codepoint >> 6));
+            output[out++] = static_cast<char>(0x80 | (codepoint & 0x3F));
+        } else if (codepoint < 0x10000) {
+            if (out + 3 > output.size()) {
+                break;
+            }
+            output[out++] = static_cast<char>(0xE0 | (codepoint >> 12));
+            output[out++] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            output[out++] = static_cast<char>(0x80 | (codepoint & 0x3F));
+        } else {
+            if (out + 4 > output.size()) {
+                break;
+            }
+            output[out++] = static_cast<char>(0xF0 | (codepoint >> 18));
+            output[out++] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+            output[out++] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            output[out++] = static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+    }
+    return out;
+}
+
+std::size_t UTF8ToUTF16(std::string_view input, std::span<char16_t> output) {
+    const std::size_t size = input.size();
+    std::size_t i = 0;
+    std::size_t out = 0;
+
+    const auto continuation = [&](std::size_t offset) {
+        return offset < size && (static_cast<u8>(input[offset]) & 0xC0) == 0x80;
+    };
+
+    while (i < size) {
+        // Same ASCII block fast path as UTF16ToUTF8
+        while (size - i >= 8 && output.size() - out >= 8) {
+            u8 bits = 0;
+            for (std::size_t j = 0; j < 8; ++j) {
+                bits |= static_cast<u8>(input[i + j]);
+            }
+            if (bits >= 0x80) {
+                break;
+            }
+            for (std::size_t j = 0; j < 8; ++j) {
+                output[out + j] = static_cast<char16_t>(input[i + j]);
+            }
+            i += 8;
+            out += 8;
+        }
+        if (i >= size) {
+            break;
+        }
+
+        const u8 lead = static_cast<u8>(input[i]);
+        u32 codepoint = REPLACEMENT_CHARACTER;
+        if (lead < 0x80) {
+            codepoint = lead;
+            i += 1;
+        } else if ((lead & 0xE0) == 0xC0 && continuation(i + 1)) {
+            codepoint = ((lead & 0x1Fu) << 6) | (static_cast<u8>(input[i + 1]) & 0x3Fu);
+            if (codepoint < 0x80) {
+                codepoint = REPLACEMENT_CHARACTER; // overlong encoding
+            }
+            i += 2;
+        } else if ((lead & 0xF0) == 0xE0 && continuation(i + 1) && continuation(i + 2)) {
+            codepoint = ((lead & 0x0Fu) << 12) | ((static_cast<u8>(input[i + 1]) & 0x3Fu) << 6) |
+                        (static_cast<u8>(input[i + 2]) & 0x3Fu);
+            if (codepoint < 0x800 || (codepoint >= 0xD800 && codepoint < 0xE000)) {
+                codepoint = REPLACEMENT_CHARACTER;
+            }
+            i += 3;
+        } else if ((lead & 0xF8) == 0xF0 && continuation(i + 1) && continuation(i + 2) &&
+                   continuation(i + 3)) {
+            codepoint = ((lead & 0x07u) << 18) | ((static_cast<u8>(input[i + 1]) & 0x3Fu) << 12) |
+                        ((static_cast<u8>(input[i + 2]) & 0x3Fu) << 6) |
+                        (static_cast<u8>(input[i + 3]) & 0x3Fu);
+            if (codepoint < 0x10000 || codepoint > 0x10FFFF) {
+                codepoint = REPLACEMENT_CHARACTER;
+            }
+            i += 4;
+        } else {
+            i += 1; // malformed byte
+        }
+
+        if (codepoint < 0x10000) {
+            if (out + 1 > output.size()) {
+                break;
+            }
+            output[out++] = static_cast<char16_t>(codepoint);
+        } else {
+            if (out + 2 > output.size()) {
+                break;
+            }
+            codepoint -= 0x10000;
+            output[out++] = static_cast<char16_t>(0xD800 + (codepoint >> 10));
+            output[out++] = static_cast<char16_t>(0xDC00 + (codepoint & 0x3FF));
+        }
+    }
+    return out;
+}
+
 std::string UTF16ToUTF8(std::u16string_view input) {
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.to_bytes(input.data(), input.data() + input.size());
+    // Worst case is three bytes per UTF-16 unit (surrogate pairs yield four bytes from two
+    // units), so a single upfront allocation always suffices
+    std::string output(input.size() * 3, '\0');
+    output.resize(UTF16ToUTF8(input, std::span{output}));
+    return output;
 }
 
 std::u16string UTF8ToUTF16(std::string_view input) {
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.from_bytes(input.data(), input.data() + input.size());
+    // Every UTF-8 byte expands to at most one UTF-16 unit
+    std::u16string output(input.size(), u'\0');
+    output.resize(UTF8ToUTF16(input, std::span{output}));
+    return output;
 }
 
 #ifdef _WIN32
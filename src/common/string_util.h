@@ -6,9 +6,11 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
+#include <boost/container/small_vector.hpp>
 #include "common/common_types.h"
 #include "common/swap.h"
 
@@ -49,6 +51,18 @@ void BuildCompleteFilename(std::string& _CompleteFilename, const std::string& _P
 [[nodiscard]] std::string UTF16ToUTF8(std::u16string_view input);
 [[nodiscard]] std::u16string UTF8ToUTF16(std::string_view input);
 
+/**
+ * Converts UTF-16 text into a caller-provided buffer without allocating, returning the number
+ * of bytes written. Conversion stops at a codepoint boundary if the buffer is too small.
+ */
+std::size_t UTF16ToUTF8(std::u16string_view input, std::span<char> output);
+
+/**
+ * Converts UTF-8 text into a caller-provided buffer without allocating, returning the number
+ * of UTF-16 units written. Conversion stops at a codepoint boundary if the buffer is too small.
+ */
+std::size_t UTF8ToUTF16(std::string_view input, std::span<char16_t> output);
+
 #ifdef _WIN32
 [[nodiscard]] std::string UTF16ToUTF8(const std::wstring& input);
 [[nodiscard]] std::wstring UTF8ToUTF16W(const std::string& str);
@@ -71,17 +85,18 @@ template <typename InIt>
 }
 
 /**
- * Converts a UTF-16 text in a container to a UTF-8 std::string.
+ * Converts a UTF-16 text in a container to a UTF-8 std::string. The text is cut off at the
+ * first NUL character. Typical guest buffers (names, titles) fit the inline storage, so the
+ * only allocation is the returned string.
  */
 template <typename T>
 std::string UTF16BufferToUTF8(const T& text) {
     const auto text_end = std::find(text.begin(), text.end(), u'\0');
-    const std::size_t text_size = std::distance(text.begin(), text_end);
-    std::u16string buffer(text_size, 0);
-    std::transform(text.begin(), text_end, buffer.begin(), [](u16_le character) {
+    boost::container::small_vector<char16_t, 64> buffer;
+    std::transform(text.begin(), text_end, std::back_inserter(buffer), [](u16_le character) {
         return static_cast<char16_t>(static_cast<u16>(character));
     });
-    return UTF16ToUTF8(buffer);
+    return UTF16ToUTF8(std::u16string_view{buffer.data(), buffer.size()});
 }
 
 /**
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <deque>
 #include <boost/serialization/deque.hpp>
 #include <boost/serialization/split_member.hpp>
@@ -23,16 +24,13 @@ struct ThreadQueueList {
 
     // Number of priority levels. (Valid levels are [0..NUM_QUEUES).)
     static constexpr Priority NUM_QUEUES = N;
-
-    ThreadQueueList() {
-        first = nullptr;
-    }
+    static_assert(NUM_QUEUES <= 64, "The occupancy bitmap only tracks 64 priority levels");
 
     // Only for debugging, returns priority level.
     [[nodiscard]] Priority contains(const T& uid) const {
         for (Priority i = 0; i < NUM_QUEUES; ++i) {
-            const Queue& cur = queues[i];
-            if (std::find(cur.data.cbegin(), cur.data.cend(), uid) != cur.data.cend()) {
+            const std::deque<T>& cur = queues[i];
+            if (std::find(cur.cbegin(), cur.cend(), uid) != cur.cend()) {
                 return i;
             }
         }
@@ -41,167 +39,102 @@ struct ThreadQueueList {
     }
 
     [[nodiscard]] T get_first() const {
-        const Queue* cur = first;
-        while (cur != nullptr) {
-            if (!cur->data.empty()) {
-                return cur->data.front();
-            }
-            cur = cur->next_nonempty;
+        if (nonempty_mask == 0) {
+            return T();
         }
-
-        return T();
+        return queues[std::countr_zero(nonempty_mask)].front();
     }
 
     T pop_first() {
-        Queue* cur = first;
-        while (cur != nullptr) {
-            if (!cur->data.empty()) {
-                auto tmp = std::move(cur->data.front());
-                cur->data.pop_front();
-                return tmp;
-            }
-            cur = cur->next_nonempty;
+        if (nonempty_mask == 0) {
+            return T();
         }
-
-        return T();
+        return pop(std::countr_zero(nonempty_mask));
     }
 
     T pop_first_better(Priority priority) {
-        Queue* cur = first;
-        Queue* stop = &queues[priority];
-        while (cur < stop) {
-            if (!cur->data.empty()) {
-                auto tmp = std::move(cur->data.front());
-                cur->data.pop_front();
-                return tmp;
-            }
-            cur = cur->next_nonempty;
+        const u64 better_mask = nonempty_mask & ((u64(1) << priority) - 1);
+        if (better_mask == 0) {
+            return T();
         }
-
-        return T();
+        return pop(std::countr_zero(better_mask));
     }
 
     void push_front(Priority priority, const T& thread_id) {
-        Queue* cur = &queues[priority];
-        cur->data.push_front(thread_id);
+        queues[priority].push_front(thread_id);
+        nonempty_mask |= u64(1) << priority;
     }
 
     void push_back(Priority priority, const T& thread_id) {
-        Queue* cur = &queues[priority];
-        cur->data.push_back(thread_id);
+        queues[priority].push_back(thread_id);
+        nonempty_mask |= u64(1) << priority;
     }
 
     void move(const T& thread_id, Priority old_priority, Priority new_priority) {
         remove(old_priority, thread_id);
-        prepare(new_priority);
         push_back(new_priority, thread_id);
     }
 
     void remove(Priority priority, const T& thread_id) {
-        Queue* const cur = &queues[priority];
-        const auto iter = std::remove(cur->data.begin(), cur->data.end(), thread_id);
-        cur->data.erase(iter, cur->data.end());
+        std::deque<T>& cur = queues[priority];
+        const auto iter = std::remove(cur.begin(), cur.end(), thread_id);
+        cur.erase(iter, cur.end());
+        if (cur.empty()) {
+            nonempty_mask &= ~(u64(1) << priority);
+        }
     }
 
     void rotate(Priority priority) {
-        Queue* cur = &queues[priority];
+        std::deque<T>& cur = queues[priority];
 
-        if (cur->data.size() > 1) {
-            cur->data.push_back(std::move(cur->data.front()));
-            cur->data.pop_front();
+        if (cur.size() > 1) {
+            cur.push_back(std::move(cur.front()));
+            cur.pop_front();
         }
     }
 
     void clear() {
-        queues.fill(Queue());
-        first = nullptr;
+        queues.fill(std::deque<T>());
+        nonempty_mask = 0;
     }
 
     [[nodiscard]] bool empty(Priority priority) const {
-        const Queue* cur = &queues[priority];
-        return cur->data.empty();
-    }
-
-    void prepare(Priority priority) {
-        Queue* cur = &queues[priority];
-        if (cur->next_nonempty == UnlinkedTag())
-            link(priority);
+        return queues[priority].empty();
     }
 
 private:
-    struct Queue {
-        // Points to the next active priority, skipping over ones that have never been used.
-        Queue* next_nonempty = UnlinkedTag();
-        // Double-ended queue of threads in this priority level
-        std::deque<T> data;
-    };
-
-    /// Special tag used to mark priority levels that have never been used.
-    static Queue* UnlinkedTag() {
-        return reinterpret_cast<Queue*>(1);
-    }
-
-    void link(Priority priority) {
-        Queue* cur = &queues[priority];
-
-        for (int i = priority - 1; i >= 0; --i) {
-            if (queues[i].next_nonempty != UnlinkedTag()) {
-                cur->next_nonempty = queues[i].next_nonempty;
-                queues[i].next_nonempty = cur;
-                return;
-            }
+    T pop(Priority priority) {
+        std::deque<T>& cur = queues[priority];
+        auto tmp = std::move(cur.front());
+        cur.pop_front();
+        if (cur.empty()) {
+            nonempty_mask &= ~(u64(1) << priority);
         }
-
-        cur->next_nonempty = first;
-        first = cur;
+        return tmp;
     }
 
-    // The first queue that's ever been used.
-    Queue* first;
+    // Bit i is set when queues[i] is non-empty, so the runnable candidate with the best
+    // priority is found with a single count-trailing-zeros instead of a scan.
+    u64 nonempty_mask = 0;
     // The priority level queues of thread ids.
-    std::array<Queue, NUM_QUEUES> queues;
-
-    s64 ToIndex(const Queue* q) const {
-        if (q == nullptr) {
-            return -2;
-        } else if (q == UnlinkedTag()) {
-            return -1;
-        } else {
-            return q - queues.data();
-        }
-    }
-
-    Queue* ToPointer(s64 idx) {
-        if (idx == -1) {
-            return UnlinkedTag();
-        } else if (idx < 0) {
-            return nullptr;
-        } else {
-            return &queues[idx];
-        }
-    }
+    std::array<std::deque<T>, NUM_QUEUES> queues;
 
     friend class boost::serialization::access;
     template <class Archive>
     void save(Archive& ar, const unsigned int file_version) const {
-        const s64 idx = ToIndex(first);
-        ar << idx;
         for (std::size_t i = 0; i < NUM_QUEUES; i++) {
-            const s64 idx1 = ToIndex(queues[i].next_nonempty);
-            ar << idx1;
-            ar << queues[i].data;
+            ar << queues[i];
         }
     }
 
     template <class Archive>
     void load(Archive& ar, const unsigned int file_version) {
-        s64 idx;
-        ar >> idx;
-        first = ToPointer(idx);
+        nonempty_mask = 0;
         for (std::size_t i = 0; i < NUM_QUEUES; i++) {
-            ar >> idx;
-            queues[i].next_nonempty = ToPointer(idx);
-            ar >> queues[i].data;
+            ar >> queues[i];
+            if (!queues[i].empty()) {
+                nonempty_mask |= u64(1) << i;
+            }
         }
     }
 
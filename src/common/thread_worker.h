@@ -6,13 +6,14 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <type_traits>
 #include <vector>
-#include <queue>
 
 #include "common/polyfill_thread.h"
 #include "common/thread.h"
@@ -36,33 +37,56 @@ class StatefulThreadWorker {
         std::conditional_t<with_state, std::function<StateType(size_t)>, DummyCallable>;
 
 public:
+    /**
+     * Tracks a group of related tasks so a caller can wait on just those tasks with
+     * WaitForGroup instead of full quiescence. Queue all tasks of the group before
+     * waiting on it; the group must outlive every task queued against it.
+     */
+    class Group {
+        friend class StatefulThreadWorker;
+        std::atomic<size_t> scheduled{0};
+        std::atomic<size_t> done{0};
+    };
+
     explicit StatefulThreadWorker(size_t num_workers, std::string_view name, StateMaker func = {})
         : workers_queued{num_workers}, thread_name{name} {
+        queues.reserve(num_workers);
+        for (size_t i = 0; i < num_workers; ++i) {
+            queues.emplace_back(std::make_unique<WorkerQueue>());
+        }
         const auto lambda = [this, func](std::stop_token stop_token, size_t index) {
             Common::SetCurrentThreadName(thread_name.data());
             {
                 [[maybe_unused]] std::conditional_t<with_state, StateType, int> state{func(index)};
                 while (!stop_token.stop_requested()) {
-                    Task task;
-                    {
-                        std::unique_lock lock{queue_mutex};
-                        if (requests.empty()) {
+                    Item item;
+                    if (!TryGetItem(index, item)) {
+                        std::unique_lock lock{sleep_mutex};
+                        if (pending_tasks.load(std::memory_order_acquire) == 0) {
                             wait_condition.notify_all();
                         }
-                        Common::CondvarWait(condition, lock, stop_token,
-                                            [this] { return !requests.empty(); });
-                        if (stop_token.stop_requested()) {
-                            break;
-                        }
-                        task = std::move(requests.front());
-                        requests.pop();
+                        Common::CondvarWait(condition, lock, stop_token, [this] {
+                            return pending_tasks.load(std::memory_order_acquire) != 0;
+                        });
+                        continue;
                     }
                     if constexpr (with_state) {
-                        task(&state);
+                        item.task(&state);
                     } else {
-                        task();
+                        item.task();
+                    }
+                    const size_t done = ++work_done;
+                    bool notify = done >= work_scheduled.load(std::memory_order_acquire);
+                    if (item.group) {
+                        const size_t group_done =
+                            item.group->done.fetch_add(1, std::memory_order_acq_rel) + 1;
+                        notify |= group_done >=
+                                  item.group->scheduled.load(std::memory_order_acquire);
+                    }
+                    if (notify) {
+                        std::scoped_lock lock{sleep_mutex};
+                        wait_condition.notify_all();
                     }
-                    ++work_done;
                 }
             }
             ++workers_stopped;
@@ -80,34 +104,123 @@ public:
     StatefulThreadWorker& operator=(StatefulThreadWorker&&) = delete;
     StatefulThreadWorker(StatefulThreadWorker&&) = delete;
 
-    void QueueWork(Task work) {
+    void QueueWork(Task work, Group* group = nullptr) {
+        const size_t index = next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+        if (group) {
+            group->scheduled.fetch_add(1, std::memory_order_relaxed);
+        }
+        ++work_scheduled;
+        pending_tasks.fetch_add(1, std::memory_order_release);
         {
-            std::unique_lock lock{queue_mutex};
-            requests.emplace(std::move(work));
-            ++work_scheduled;
+            auto& queue = *queues[index];
+            std::scoped_lock lock{queue.mutex};
+            queue.tasks.push_back(Item{std::move(work), group});
         }
+        // Empty critical section so the wakeup can't slip between a sleeping worker's
+        // predicate check and its wait
+        { std::scoped_lock lock{sleep_mutex}; }
         condition.notify_one();
     }
 
+    /// Queues a whole batch of tasks with one lock acquisition per worker queue and a
+    /// single wakeup, instead of paying the submission overhead per task
+    void QueueWork(std::vector<Task> batch, Group* group = nullptr) {
+        if (batch.empty()) {
+            return;
+        }
+        const size_t num_queues = queues.size();
+        if (group) {
+            group->scheduled.fetch_add(batch.size(), std::memory_order_relaxed);
+        }
+        work_scheduled += batch.size();
+        pending_tasks.fetch_add(batch.size(), std::memory_order_release);
+        const size_t base = next_queue.fetch_add(batch.size(), std::memory_order_relaxed);
+        for (size_t q = 0; q < num_queues && q < batch.size(); ++q) {
+            auto& queue = *queues[(base + q) % num_queues];
+            std::scoped_lock lock{queue.mutex};
+            // Every num_queues-th task lands on this queue so the batch spreads evenly
+            for (size_t i = q; i < batch.size(); i += num_queues) {
+                queue.tasks.push_back(Item{std::move(batch[i]), group});
+            }
+        }
+        { std::scoped_lock lock{sleep_mutex}; }
+        condition.notify_all();
+    }
+
     void WaitForRequests(std::stop_token stop_token = {}) {
         std::stop_callback callback(stop_token, [this] {
             for (auto& thread : threads) {
                 thread.request_stop();
             }
         });
-        std::unique_lock lock{queue_mutex};
+        std::unique_lock lock{sleep_mutex};
         wait_condition.wait(lock, [this] {
             return workers_stopped >= workers_queued || work_done >= work_scheduled;
         });
     }
 
+    /// Waits until every task queued against the group has finished executing
+    void WaitForGroup(Group& group, std::stop_token stop_token = {}) {
+        std::stop_callback callback(stop_token, [this] {
+            for (auto& thread : threads) {
+                thread.request_stop();
+            }
+        });
+        std::unique_lock lock{sleep_mutex};
+        wait_condition.wait(lock, [this, &group] {
+            return workers_stopped >= workers_queued ||
+                   group.done.load(std::memory_order_acquire) >=
+                       group.scheduled.load(std::memory_order_acquire);
+        });
+    }
+
     const std::size_t NumWorkers() const noexcept {
         return threads.size();
     }
 
 private:
-    std::queue<Task> requests;
-    std::mutex queue_mutex;
+    struct Item {
+        Task task;
+        Group* group = nullptr;
+    };
+
+    /// One queue per worker; each worker services its own queue from the back for cache
+    /// locality and steals from the front of the other queues when it runs dry, so
+    /// submissions and pops never funnel through a single lock
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Item> tasks;
+    };
+
+    bool TryGetItem(size_t index, Item& item) {
+        const size_t num_queues = queues.size();
+        {
+            auto& own = *queues[index];
+            std::scoped_lock lock{own.mutex};
+            if (!own.tasks.empty()) {
+                item = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                pending_tasks.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+        }
+        for (size_t offset = 1; offset < num_queues; ++offset) {
+            auto& victim = *queues[(index + offset) % num_queues];
+            std::scoped_lock lock{victim.mutex};
+            if (!victim.tasks.empty()) {
+                item = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                pending_tasks.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::atomic<size_t> next_queue{};
+    std::atomic<size_t> pending_tasks{};
+    std::mutex sleep_mutex;
     std::condition_variable_any condition;
     std::condition_variable wait_condition;
     std::atomic<size_t> work_scheduled{};
@@ -10,7 +10,10 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
 
 namespace Common {
@@ -169,4 +172,167 @@ private:
     SPSCQueue<T> spsc_queue;
     std::mutex write_lock;
 };
+
+// a fixed-capacity lock-free multi-reader, multi-writer queue
+// (Dmitry Vyukov's bounded MPMC design)
+//
+// Unlike SPSCQueue this never allocates after construction: elements live in a
+// ring of slots guarded by per-slot sequence numbers, so pushing and popping on
+// hot paths generate no allocator traffic. Capacity must be a power of two.
+
+template <typename T, std::size_t Capacity>
+class MPMCQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+public:
+    MPMCQueue() : slots{std::make_unique<Slot[]>(Capacity)} {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] std::size_t Size() const {
+        const std::size_t head = dequeue_pos.load(std::memory_order_acquire);
+        const std::size_t tail = enqueue_pos.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+
+    [[nodiscard]] bool Empty() const {
+        return Size() == 0;
+    }
+
+    /// Enqueues an element, returning false instead of blocking when the ring is full.
+    /// The element is left untouched on failure.
+    template <typename Arg>
+    bool TryPush(Arg&& t) {
+        const std::size_t previous_size = Size();
+        if (!TryEnqueue(std::forward<Arg>(t))) {
+            return false;
+        }
+
+        // Acquire the mutex and then immediately release it as a fence, so a consumer that
+        // observed the queue as empty right before this element became visible does not
+        // sleep through the wakeup (same scheme as SPSCQueue::Push).
+        if (previous_size == 0) {
+            std::lock_guard lock{cv_mutex};
+        }
+        cv.notify_one();
+        return true;
+    }
+
+    template <typename Arg>
+    void Push(Arg&& t) {
+        // A full ring means the consumer is behind by a whole Capacity; yield until a slot
+        // frees up rather than silently dropping the element.
+        while (!TryPush(std::forward<Arg>(t))) {
+            std::this_thread::yield();
+        }
+    }
+
+    bool Pop(T& t) {
+        std::size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots[pos & (Capacity - 1)];
+            const std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            const auto diff =
+                static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the producer for this slot has not finished writing it yet
+                return false;
+            } else {
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        t = std::move(slot->data);
+        slot->sequence.store(pos + Capacity, std::memory_order_release);
+        return true;
+    }
+
+    T PopWait() {
+        T t;
+        if (!Pop(t)) {
+            std::unique_lock lock{cv_mutex};
+            cv.wait(lock, [this, &t] { return Pop(t); });
+        }
+        return t;
+    }
+
+    /// Enqueues up to count elements and returns how many actually fit; the whole batch
+    /// shares a single consumer wakeup instead of paying one per element
+    std::size_t PushRange(const T* data, std::size_t count) {
+        const std::size_t previous_size = Size();
+        std::size_t pushed = 0;
+        while (pushed < count && TryEnqueue(data[pushed])) {
+            ++pushed;
+        }
+        if (pushed == 0) {
+            return 0;
+        }
+        if (previous_size == 0) {
+            std::lock_guard lock{cv_mutex};
+        }
+        cv.notify_one();
+        return pushed;
+    }
+
+    /// Dequeues up to max_count elements into dest and returns how many were popped
+    std::size_t PopRange(T* dest, std::size_t max_count) {
+        std::size_t popped = 0;
+        while (popped < max_count && Pop(dest[popped])) {
+            ++popped;
+        }
+        return popped;
+    }
+
+    // not thread-safe
+    void Clear() {
+        T t;
+        while (Pop(t)) {
+        }
+    }
+
+private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        T data;
+    };
+
+    /// Reserves a slot and writes the element, without waking a waiting consumer.
+    /// Returns false when the ring is full.
+    template <typename Arg>
+    bool TryEnqueue(Arg&& t) {
+        std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots[pos & (Capacity - 1)];
+            const std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // this slot still holds an element from the previous lap
+                return false;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->data = std::forward<Arg>(t);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<std::size_t> enqueue_pos{0};
+    std::atomic<std::size_t> dequeue_pos{0};
+    std::mutex cv_mutex;
+    std::condition_variable cv;
+};
 } // namespace Common
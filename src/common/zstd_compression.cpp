@@ -33,19 +33,86 @@ std::vector<u8> CompressDataZSTDDefault(const u8* source, std::size_t source_siz
     return CompressDataZSTD(source, source_size, ZSTD_CLEVEL_DEFAULT);
 }
 
-std::vector<u8> DecompressDataZSTD(const std::vector<u8>& compressed) {
-    const std::size_t decompressed_size =
-        ZSTD_getFrameContentSize(compressed.data(), compressed.size());
-    std::vector<u8> decompressed(decompressed_size);
+std::vector<u8> CompressDataZSTDMultithreaded(const u8* source, std::size_t source_size,
+                                              s32 compression_level, u32 num_workers) {
+    compression_level = std::clamp(compression_level, ZSTD_minCLevel(), ZSTD_maxCLevel());
+
+    ZSTD_CCtx* const cctx = ZSTD_createCCtx();
+    if (!cctx) {
+        return {};
+    }
+
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, compression_level);
+    // The result is deliberately ignored: when the library was built without multithreading
+    // support this fails and the context compresses single-threaded instead
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, static_cast<int>(num_workers));
+
+    const std::size_t max_compressed_size = ZSTD_compressBound(source_size);
+    std::vector<u8> compressed(max_compressed_size);
 
-    const std::size_t uncompressed_result_size = ZSTD_decompress(
-        decompressed.data(), decompressed.size(), compressed.data(), compressed.size());
+    const std::size_t compressed_size =
+        ZSTD_compress2(cctx, compressed.data(), compressed.size(), source, source_size);
+    ZSTD_freeCCtx(cctx);
 
-    if (decompressed_size != uncompressed_result_size || ZSTD_isError(uncompressed_result_size)) {
-        // Decompression failed
+    if (ZSTD_isError(compressed_size)) {
+        // Compression failed
         return {};
     }
+
+    compressed.resize(compressed_size);
+
+    return compressed;
+}
+
+std::vector<u8> CompressDataZSTDMultithreadedDefault(const u8* source, std::size_t source_size,
+                                                     u32 num_workers) {
+    return CompressDataZSTDMultithreaded(source, source_size, ZSTD_CLEVEL_DEFAULT, num_workers);
+}
+
+std::vector<u8> DecompressDataZSTD(const std::vector<u8>& compressed) {
+    return DecompressDataZSTD(compressed.data(), compressed.size());
+}
+
+std::vector<u8> DecompressDataZSTD(const u8* compressed, std::size_t compressed_size) {
+    std::vector<u8> decompressed;
+    std::size_t offset = 0;
+
+    // The input may consist of several concatenated frames (e.g. chunked savestates); walk
+    // them in order and append each frame's content.
+    while (offset < compressed_size) {
+        const std::size_t frame_size =
+            ZSTD_findFrameCompressedSize(compressed + offset, compressed_size - offset);
+        if (ZSTD_isError(frame_size)) {
+            // Malformed input
+            return {};
+        }
+
+        const unsigned long long content_size =
+            ZSTD_getFrameContentSize(compressed + offset, frame_size);
+        if (content_size == ZSTD_CONTENTSIZE_ERROR || content_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+            return {};
+        }
+
+        const std::size_t old_size = decompressed.size();
+        decompressed.resize(old_size + static_cast<std::size_t>(content_size));
+
+        const std::size_t uncompressed_result_size =
+            ZSTD_decompress(decompressed.data() + old_size, static_cast<std::size_t>(content_size),
+                            compressed + offset, frame_size);
+
+        if (content_size != uncompressed_result_size || ZSTD_isError(uncompressed_result_size)) {
+            // Decompression failed
+            return {};
+        }
+
+        offset += frame_size;
+    }
     return decompressed;
 }
 
+std::size_t GetZSTDFrameSize(const u8* source, std::size_t source_size) {
+    const std::size_t frame_size = ZSTD_findFrameCompressedSize(source, source_size);
+    return ZSTD_isError(frame_size) ? 0 : frame_size;
+}
+
 } // namespace Common::Compression
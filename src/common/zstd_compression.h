@@ -33,8 +33,39 @@ namespace Common::Compression {
  */
 [[nodiscard]] std::vector<u8> CompressDataZSTDDefault(const u8* source, std::size_t source_size);
 
+/**
+ * Compresses a source memory region with Zstandard using multiple worker threads and returns the
+ * compressed data in a vector. Falls back to single-threaded compression when the zstd library
+ * was built without multithreading support.
+ *
+ * @param source the uncompressed source memory region.
+ * @param source_size the size in bytes of the uncompressed source memory region.
+ * @param compression_level the used compression level. Should be between 1 and 22.
+ * @param num_workers the number of zstd worker threads to use.
+ *
+ * @return the compressed data.
+ */
+[[nodiscard]] std::vector<u8> CompressDataZSTDMultithreaded(const u8* source,
+                                                            std::size_t source_size,
+                                                            s32 compression_level, u32 num_workers);
+
+/**
+ * Compresses a source memory region with Zstandard using multiple worker threads and the default
+ * compression level, and returns the compressed data in a vector.
+ *
+ * @param source the uncompressed source memory region.
+ * @param source_size the size in bytes of the uncompressed source memory region.
+ * @param num_workers the number of zstd worker threads to use.
+ *
+ * @return the compressed data.
+ */
+[[nodiscard]] std::vector<u8> CompressDataZSTDMultithreadedDefault(const u8* source,
+                                                                   std::size_t source_size,
+                                                                   u32 num_workers);
+
 /**
  * Decompresses a source memory region with Zstandard and returns the uncompressed data in a vector.
+ * The source may consist of one or more concatenated frames.
  *
  * @param compressed the compressed source memory region.
  *
@@ -42,4 +73,26 @@ namespace Common::Compression {
  */
 [[nodiscard]] std::vector<u8> DecompressDataZSTD(const std::vector<u8>& compressed);
 
+/**
+ * Decompresses a source memory region with Zstandard and returns the uncompressed data in a vector.
+ * The source may consist of one or more concatenated frames.
+ *
+ * @param compressed the compressed source memory region.
+ * @param compressed_size the size in bytes of the compressed source memory region.
+ *
+ * @return the decompressed data.
+ */
+[[nodiscard]] std::vector<u8> DecompressDataZSTD(const u8* compressed, std::size_t compressed_size);
+
+/**
+ * Returns the compressed size of the Zstandard frame at the start of the given memory region,
+ * or 0 if the region does not start with a valid frame. Useful for walking concatenated frames.
+ *
+ * @param source the compressed source memory region.
+ * @param source_size the size in bytes of the compressed source memory region.
+ *
+ * @return the size in bytes of the first frame, or 0 on error.
+ */
+[[nodiscard]] std::size_t GetZSTDFrameSize(const u8* source, std::size_t source_size);
+
 } // namespace Common::Compression
@@ -2,11 +2,13 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstdint>
 #include <cstring>
 #include <dynarmic/interface/A32/a32.h>
 #include <dynarmic/interface/optimization_flags.h>
 #include "common/assert.h"
 #include "common/microprofile.h"
+#include "common/perf_counters.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/arm_dynarmic_cp15.h"
 #include "core/arm/dynarmic/arm_exclusive_monitor.h"
@@ -324,6 +326,7 @@ void ARM_Dynarmic::ClearInstructionCache() {
 }
 
 void ARM_Dynarmic::InvalidateCacheRange(u32 start_address, std::size_t length) {
+    Common::PerfCounters::Add(Common::PerfCounters::Counter::JitInvalidations);
     jit->InvalidateCacheRange(start_address, length);
 }
 
@@ -369,6 +372,18 @@ std::unique_ptr<Dynarmic::A32::Jit> ARM_Dynarmic::MakeJit() {
     config.coprocessors[15] = std::make_shared<DynarmicCP15>(cp15_state);
     config.define_unpredictable_behaviour = true;
 
+    // A full code cache forces dynarmic to throw away every compiled block and re-JIT them as
+    // they are next executed, which shows up as multi-frame stutters in long sessions. Size the
+    // cache generously so this never happens in practice.
+    config.code_cache_size = 256 * 1024 * 1024;
+
+    // When the fastmem arena is available, let the JIT emit raw loads/stores against it and
+    // fall back to the page table (and from there the memory callbacks) on host faults.
+    if (u8* const fastmem_base = memory.GetFastmemArenaBase()) {
+        config.fastmem_pointer = reinterpret_cast<std::uintptr_t>(fastmem_base);
+        config.recompile_on_fastmem_failure = true;
+    }
+
     // Multi-process state
     config.processor_id = GetID();
     config.global_monitor = &exclusive_monitor.monitor;
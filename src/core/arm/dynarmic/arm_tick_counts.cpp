@@ -2,8 +2,10 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
 #include <bit>
 #include <functional>
+#include <vector>
 #include "common/common_types.h"
 #include "common/string_literal.h"
 #include "core/arm/dynarmic/arm_tick_counts.h"
@@ -468,6 +470,31 @@ const std::array thumb_matchers{
     // clang-format on
 };
 
+// First-level decode index over the classic ARM decode bits [27:20] and [7:4]. Each bucket
+// holds, in table order, only the matchers that can still accept an instruction with those
+// bits, so the per-instruction query dynarmic makes while translating a block scans one or
+// two candidates instead of the whole matcher table.
+constexpr std::size_t NUM_DECODE_BUCKETS = 0x1000;
+constexpr u32 DECODE_INDEX_MASK = 0x0FF000F0;
+
+constexpr std::size_t DecodeBucket(u32 instruction) {
+    return ((instruction >> 16) & 0xFF0) | ((instruction >> 4) & 0xF);
+}
+
+std::array<std::vector<const Matcher*>, NUM_DECODE_BUCKETS> BuildArmDecodeIndex() {
+    std::array<std::vector<const Matcher*>, NUM_DECODE_BUCKETS> index;
+    for (std::size_t bucket = 0; bucket < NUM_DECODE_BUCKETS; bucket++) {
+        const u32 instruction = static_cast<u32>(((bucket & 0xFF0) << 16) | ((bucket & 0xF) << 4));
+        for (const auto& matcher : arm_matchers) {
+            if ((instruction & matcher.mask & DECODE_INDEX_MASK) ==
+                (matcher.expect & DECODE_INDEX_MASK)) {
+                index[bucket].push_back(&matcher);
+            }
+        }
+    }
+    return index;
+}
+
 } // namespace
 
 namespace Core {
@@ -477,13 +504,11 @@ u64 TicksForInstruction(bool is_thumb, u32 instruction) {
         return 1;
     }
 
-    const auto matches_instruction = [instruction](const auto& matcher) {
-        return (instruction & matcher.mask) == matcher.expect;
-    };
-
-    auto iter = std::find_if(arm_matchers.begin(), arm_matchers.end(), matches_instruction);
-    if (iter != arm_matchers.end()) {
-        return iter->fn(instruction);
+    static const auto arm_decode_index = BuildArmDecodeIndex();
+    for (const Matcher* matcher : arm_decode_index[DecodeBucket(instruction)]) {
+        if ((instruction & matcher->mask) == matcher->expect) {
+            return matcher->fn(instruction);
+        }
     }
     return 1;
 }
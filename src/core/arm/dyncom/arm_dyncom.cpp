@@ -88,6 +88,7 @@ void ARM_DynCom::Step() {
 
 void ARM_DynCom::ClearInstructionCache() {
     state->instruction_cache.clear();
+    state->dispatch_cache.fill({});
     trans_cache_buf_top = 0;
 }
 
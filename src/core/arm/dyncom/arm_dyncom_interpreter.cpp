@@ -1640,15 +1640,31 @@ DISPATCH : {
         cpu->Reg[15] &= 0xfffffffc;
 
     // Find the cached instruction cream, otherwise translate it...
-    auto itr = cpu->instruction_cache.find(cpu->Reg[15]);
-    if (itr != cpu->instruction_cache.end()) {
-        ptr = itr->second;
-    } else if (cpu->NumInstrsToExecute != 1) {
-        if (InterpreterTranslateBlock(cpu, ptr, cpu->Reg[15]) == FETCH_EXCEPTION)
-            goto END;
+    const u32 dispatch_pc = cpu->Reg[15];
+    auto& entry = cpu->dispatch_cache[(dispatch_pc >> 1) & (ARMul_State::DISPATCH_CACHE_SIZE - 1)];
+    if (entry.pc == dispatch_pc) {
+        ptr = entry.ptr;
     } else {
-        if (InterpreterTranslateSingle(cpu, ptr, cpu->Reg[15]) == FETCH_EXCEPTION)
-            goto END;
+        auto itr = cpu->instruction_cache.find(dispatch_pc);
+        if (itr != cpu->instruction_cache.end()) {
+            ptr = itr->second;
+        } else {
+            // The arena-backed translation cache has no eviction; when it is nearly full,
+            // recycle it wholesale so translating the next block can never overflow it.
+            if (trans_cache_buf_top >= TRANS_CACHE_SIZE - TRANS_CACHE_RESERVE) {
+                cpu->instruction_cache.clear();
+                cpu->dispatch_cache.fill({});
+                trans_cache_buf_top = 0;
+            }
+            if (cpu->NumInstrsToExecute != 1) {
+                if (InterpreterTranslateBlock(cpu, ptr, dispatch_pc) == FETCH_EXCEPTION)
+                    goto END;
+            } else {
+                if (InterpreterTranslateSingle(cpu, ptr, dispatch_pc) == FETCH_EXCEPTION)
+                    goto END;
+            }
+        }
+        entry = {dispatch_pc, ptr};
     }
 
 #ifndef ANDROID
@@ -494,5 +494,8 @@ extern const transop_fp_t arm_instruction_trans[];
 extern const std::size_t arm_instruction_trans_len;
 
 #define TRANS_CACHE_SIZE (64 * 1024 * 2000)
+// Headroom kept free in the translation cache; recycling happens before a translation could
+// start within this reserve, so no single block can overflow the arena.
+#define TRANS_CACHE_RESERVE (1024 * 1024)
 extern char trans_cache_buf[TRANS_CACHE_SIZE];
 extern std::size_t trans_cache_buf_top;
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <atomic>
+#include <vector>
 #include "common/arch.h"
 #if CITRA_ARCH(x86_64) || CITRA_ARCH(arm64)
 #include "core/arm/dynarmic/arm_exclusive_monitor.h"
@@ -13,6 +15,112 @@ namespace Core {
 
 ExclusiveMonitor::~ExclusiveMonitor() = default;
 
+namespace {
+
+constexpr u64 RESERVATION_NONE = ~u64{0};
+
+/// The ARM11 MPCore tags exclusive reservations at eight-word (32 byte) granularity.
+constexpr u64 ReservationGranule(VAddr addr) {
+    return addr & ~u64{0x1F};
+}
+
+/// Lock-free exclusive monitor backed by one atomic reservation word per core.
+///
+/// ExclusiveRead publishes the reservation granule for the reading core; ExclusiveWrite
+/// succeeds only if the core still holds its reservation and the memory word still contains
+/// the value observed at the read, enforced by a host compare-and-swap in
+/// MemorySystem::WriteExclusive. A successful writer then knocks out other cores'
+/// reservations on the same granule with per-word CAS, so contending LDREX/STREX loops on
+/// different host threads never take a lock.
+class PassthroughExclusiveMonitor final : public ExclusiveMonitor {
+public:
+    explicit PassthroughExclusiveMonitor(Memory::MemorySystem& memory_, std::size_t num_cores)
+        : memory{memory_}, reservations(num_cores), values(num_cores) {
+        for (auto& reservation : reservations) {
+            reservation.store(RESERVATION_NONE, std::memory_order_relaxed);
+        }
+    }
+    ~PassthroughExclusiveMonitor() override = default;
+
+    u8 ExclusiveRead8(std::size_t core_index, VAddr addr) override {
+        return ReadAndMark<u8>(core_index, addr, memory.Read8(addr));
+    }
+    u16 ExclusiveRead16(std::size_t core_index, VAddr addr) override {
+        return ReadAndMark<u16>(core_index, addr, memory.Read16(addr));
+    }
+    u32 ExclusiveRead32(std::size_t core_index, VAddr addr) override {
+        return ReadAndMark<u32>(core_index, addr, memory.Read32(addr));
+    }
+    u64 ExclusiveRead64(std::size_t core_index, VAddr addr) override {
+        return ReadAndMark<u64>(core_index, addr, memory.Read64(addr));
+    }
+
+    void ClearExclusive(std::size_t core_index) override {
+        reservations[core_index].store(RESERVATION_NONE, std::memory_order_release);
+    }
+
+    bool ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) override {
+        return WriteIfReserved<u8>(core_index, vaddr, [&](u8 expected) {
+            return memory.WriteExclusive8(vaddr, value, expected);
+        });
+    }
+    bool ExclusiveWrite16(std::size_t core_index, VAddr vaddr, u16 value) override {
+        return WriteIfReserved<u16>(core_index, vaddr, [&](u16 expected) {
+            return memory.WriteExclusive16(vaddr, value, expected);
+        });
+    }
+    bool ExclusiveWrite32(std::size_t core_index, VAddr vaddr, u32 value) override {
+        return WriteIfReserved<u32>(core_index, vaddr, [&](u32 expected) {
+            return memory.WriteExclusive32(vaddr, value, expected);
+        });
+    }
+    bool ExclusiveWrite64(std::size_t core_index, VAddr vaddr, u64 value) override {
+        return WriteIfReserved<u64>(core_index, vaddr, [&](u64 expected) {
+            return memory.WriteExclusive64(vaddr, value, expected);
+        });
+    }
+
+private:
+    template <typename T>
+    T ReadAndMark(std::size_t core_index, VAddr addr, T value) {
+        // values[core_index] is only touched by the owning core; the reservation word is the
+        // only cross-core communication.
+        values[core_index] = static_cast<u64>(value);
+        reservations[core_index].store(ReservationGranule(addr), std::memory_order_seq_cst);
+        return value;
+    }
+
+    template <typename T, typename WriteFunc>
+    bool WriteIfReserved(std::size_t core_index, VAddr vaddr, WriteFunc&& write_func) {
+        const u64 granule = ReservationGranule(vaddr);
+        if (reservations[core_index].load(std::memory_order_seq_cst) != granule) {
+            return false;
+        }
+        // STREX clears the local reservation whether or not the store succeeds.
+        reservations[core_index].store(RESERVATION_NONE, std::memory_order_seq_cst);
+        if (!write_func(static_cast<T>(values[core_index]))) {
+            return false;
+        }
+        // Invalidate any other core still holding a reservation on this granule so its
+        // pending STREX fails and the loop retries from the updated value.
+        for (std::size_t i = 0; i < reservations.size(); i++) {
+            if (i == core_index) {
+                continue;
+            }
+            u64 expected = granule;
+            reservations[i].compare_exchange_strong(expected, RESERVATION_NONE,
+                                                    std::memory_order_seq_cst);
+        }
+        return true;
+    }
+
+    Memory::MemorySystem& memory;
+    std::vector<std::atomic<u64>> reservations;
+    std::vector<u64> values;
+};
+
+} // namespace
+
 std::unique_ptr<Core::ExclusiveMonitor> MakeExclusiveMonitor(Memory::MemorySystem& memory,
                                                              std::size_t num_cores) {
 #if CITRA_ARCH(x86_64) || CITRA_ARCH(arm64)
@@ -20,8 +128,7 @@ std::unique_ptr<Core::ExclusiveMonitor> MakeExclusiveMonitor(Memory::MemorySyste
         return std::make_unique<Core::DynarmicExclusiveMonitor>(memory, num_cores);
     }
 #endif
-    // TODO(merry): Passthrough exclusive monitor
-    return nullptr;
+    return std::make_unique<PassthroughExclusiveMonitor>(memory, num_cores);
 }
 
 } // namespace Core
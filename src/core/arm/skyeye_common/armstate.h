@@ -256,6 +256,22 @@ public:
     // process for our purposes), not per ARMul_State (which tracks CPU core state).
     std::unordered_map<u32, std::size_t> instruction_cache;
 
+    /// Number of entries in the direct-mapped dispatch cache fronting instruction_cache.
+    static constexpr std::size_t DISPATCH_CACHE_SIZE = 0x1000;
+
+    struct DispatchCacheEntry {
+        u32 pc = 1; ///< Tag; defaults to an unalignable value so empty entries never match.
+        std::size_t ptr = 0;
+    };
+
+    /**
+     * Direct-mapped front-end for instruction_cache, mapping a block start PC to its offset in
+     * the translation cache arena without paying for an unordered_map lookup on every block
+     * dispatch. Entries whose tag does not match fall back to instruction_cache. Must be cleared
+     * whenever instruction_cache is.
+     */
+    std::array<DispatchCacheEntry, DISPATCH_CACHE_SIZE> dispatch_cache{};
+
 private:
     void ResetMPCoreCP15Registers();
 
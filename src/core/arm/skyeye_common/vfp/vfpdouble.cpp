@@ -52,6 +52,8 @@
  */
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include "common/logging/log.h"
 #include "core/arm/skyeye_common/vfp/asm_vfp.h"
 #include "core/arm/skyeye_common/vfp/vfp.h"
@@ -893,6 +895,80 @@ u32 vfp_double_multiply(struct vfp_double* vdd, struct vfp_double* vdn, struct v
     return 0;
 }
 
+enum class vfp_fast_op { add, mul, nmul, div };
+
+/*
+ * Fast path for arithmetic on normal, finite operands in round-to-nearest mode with no exception
+ * traps enabled: compute the result with host floating point instead of walking the soft-float
+ * path. Since both operands and result are double precision there is a single rounding step, and
+ * inexactness is recovered exactly from an error term: TwoSum for addition, and an fma residual
+ * for multiplication and division. Returns false whenever an operand or the result needs the
+ * precise path for bit-exact flags.
+ */
+static bool vfp_double_fast_op(ARMul_State* state, int dd, u64 n, u64 m, u32 fpscr, vfp_fast_op op,
+                               u32* exceptions) {
+    if ((fpscr & (FPSCR_RMODE_MASK | FPSCR_IDE | FPSCR_IXE | FPSCR_UFE | FPSCR_OFE | FPSCR_DZE |
+                  FPSCR_IOE)) != FPSCR_ROUND_NEAREST) {
+        return false;
+    }
+
+    const auto is_normal = [](u64 v) {
+        const u64 exp = (v >> 52) & 0x7ff;
+        return exp != 0 && exp != 0x7ff;
+    };
+    if (!is_normal(n) || !is_normal(m)) {
+        return false;
+    }
+
+    double a, b;
+    std::memcpy(&a, &n, sizeof(a));
+    std::memcpy(&b, &m, sizeof(b));
+
+    double result;
+    bool inexact;
+    switch (op) {
+    case vfp_fast_op::add: {
+        result = a + b;
+        // TwoSum error term: zero iff the sum is exact.
+        const double bv = result - a;
+        const double av = result - bv;
+        inexact = (a - av) + (b - bv) != 0.0;
+        break;
+    }
+    case vfp_fast_op::mul:
+        result = a * b;
+        inexact = std::fma(a, b, -result) != 0.0;
+        break;
+    case vfp_fast_op::nmul:
+        result = a * b;
+        inexact = std::fma(a, b, -result) != 0.0;
+        result = -result;
+        break;
+    case vfp_fast_op::div:
+    default:
+        result = a / b;
+        inexact = std::fma(result, b, -a) != 0.0;
+        break;
+    }
+
+    u64 d;
+    std::memcpy(&d, &result, sizeof(d));
+    if (!is_normal(d)) {
+        // Overflow, underflow or an exact zero; the precise path sets the right flags.
+        return false;
+    }
+    // Stay clear of the underflow boundary, where tininess is detected before rounding.
+    if (std::fabs(result) < 0x1p-1021) {
+        return false;
+    }
+
+    if (inexact) {
+        *exceptions |= FPSCR_IXC;
+    }
+    vfp_put_double(state, d, dd);
+    return true;
+}
+
 #define NEG_MULTIPLY (1 << 0)
 #define NEG_SUBTRACT (1 << 1)
 
@@ -970,6 +1046,10 @@ static u32 vfp_double_fmul(ARMul_State* state, int dd, int dn, int dm, u32 fpscr
     u32 exceptions = 0;
 
     LOG_TRACE(Core_ARM11, "In {}", __FUNCTION__);
+    if (vfp_double_fast_op(state, dd, vfp_get_double(state, dn), vfp_get_double(state, dm), fpscr,
+                           vfp_fast_op::mul, &exceptions))
+        return exceptions;
+
     exceptions |= vfp_double_unpack(&vdn, vfp_get_double(state, dn), fpscr);
     if (vdn.exponent == 0 && vdn.significand)
         vfp_double_normalise_denormal(&vdn);
@@ -990,6 +1070,10 @@ static u32 vfp_double_fnmul(ARMul_State* state, int dd, int dn, int dm, u32 fpsc
     u32 exceptions = 0;
 
     LOG_TRACE(Core_ARM11, "In {}", __FUNCTION__);
+    if (vfp_double_fast_op(state, dd, vfp_get_double(state, dn), vfp_get_double(state, dm), fpscr,
+                           vfp_fast_op::nmul, &exceptions))
+        return exceptions;
+
     exceptions |= vfp_double_unpack(&vdn, vfp_get_double(state, dn), fpscr);
     if (vdn.exponent == 0 && vdn.significand)
         vfp_double_normalise_denormal(&vdn);
@@ -1012,6 +1096,10 @@ static u32 vfp_double_fadd(ARMul_State* state, int dd, int dn, int dm, u32 fpscr
     u32 exceptions = 0;
 
     LOG_TRACE(Core_ARM11, "In {}", __FUNCTION__);
+    if (vfp_double_fast_op(state, dd, vfp_get_double(state, dn), vfp_get_double(state, dm), fpscr,
+                           vfp_fast_op::add, &exceptions))
+        return exceptions;
+
     exceptions |= vfp_double_unpack(&vdn, vfp_get_double(state, dn), fpscr);
     if (vdn.exponent == 0 && vdn.significand)
         vfp_double_normalise_denormal(&vdn);
@@ -1033,6 +1121,13 @@ static u32 vfp_double_fsub(ARMul_State* state, int dd, int dn, int dm, u32 fpscr
     u32 exceptions = 0;
 
     LOG_TRACE(Core_ARM11, "In {}", __FUNCTION__);
+    // Subtraction is addition with the second operand negated; the fast path only accepts
+    // normal operands, for which the packed negation is exact.
+    if (vfp_double_fast_op(state, dd, vfp_get_double(state, dn),
+                           vfp_get_double(state, dm) ^ (1ULL << 63), fpscr, vfp_fast_op::add,
+                           &exceptions))
+        return exceptions;
+
     exceptions |= vfp_double_unpack(&vdn, vfp_get_double(state, dn), fpscr);
     if (vdn.exponent == 0 && vdn.significand)
         vfp_double_normalise_denormal(&vdn);
@@ -1060,6 +1155,10 @@ static u32 vfp_double_fdiv(ARMul_State* state, int dd, int dn, int dm, u32 fpscr
     int tm, tn;
 
     LOG_TRACE(Core_ARM11, "In {}", __FUNCTION__);
+    if (vfp_double_fast_op(state, dd, vfp_get_double(state, dn), vfp_get_double(state, dm), fpscr,
+                           vfp_fast_op::div, &exceptions))
+        return exceptions;
+
     exceptions |= vfp_double_unpack(&vdn, vfp_get_double(state, dn), fpscr);
     exceptions |= vfp_double_unpack(&vdm, vfp_get_double(state, dm), fpscr);
 
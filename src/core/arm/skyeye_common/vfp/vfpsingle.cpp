@@ -52,6 +52,8 @@
  */
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "common/logging/log.h"
@@ -910,6 +912,86 @@ static u32 vfp_single_multiply(struct vfp_single* vsd, struct vfp_single* vsn,
     return 0;
 }
 
+enum class vfp_fast_op { add, mul, nmul, div };
+
+/*
+ * Fast path for arithmetic on normal, finite operands in round-to-nearest mode with no exception
+ * traps enabled: compute the result with host floating point instead of walking the soft-float
+ * path. Evaluating in double precision guarantees the correctly rounded single-precision result
+ * for these operations (the operand precision is less than half the intermediate precision), and
+ * makes inexactness detectable exactly: the double product/quotient comparison for mul/div, plus
+ * a TwoSum error term for addition. Returns false whenever an operand or the result needs the
+ * precise path for bit-exact flags.
+ */
+static bool vfp_single_fast_op(ARMul_State* state, int sd, s32 n, s32 m, u32 fpscr, vfp_fast_op op,
+                               u32* exceptions) {
+    if ((fpscr & (FPSCR_RMODE_MASK | FPSCR_IDE | FPSCR_IXE | FPSCR_UFE | FPSCR_OFE | FPSCR_DZE |
+                  FPSCR_IOE)) != FPSCR_ROUND_NEAREST) {
+        return false;
+    }
+
+    const auto is_normal = [](u32 v) {
+        const u32 exp = (v >> 23) & 0xff;
+        return exp != 0 && exp != 0xff;
+    };
+    if (!is_normal(static_cast<u32>(n)) || !is_normal(static_cast<u32>(m))) {
+        return false;
+    }
+
+    float fn, fm;
+    std::memcpy(&fn, &n, sizeof(fn));
+    std::memcpy(&fm, &m, sizeof(fm));
+    const double a = fn;
+    const double b = fm;
+
+    double result;
+    bool inexact;
+    switch (op) {
+    case vfp_fast_op::add: {
+        result = a + b;
+        // TwoSum error term: zero iff the double-precision sum is exact.
+        const double bv = result - a;
+        const double av = result - bv;
+        inexact = (a - av) + (b - bv) != 0.0;
+        break;
+    }
+    case vfp_fast_op::mul:
+        // The double product of two singles is exact.
+        result = a * b;
+        inexact = false;
+        break;
+    case vfp_fast_op::nmul:
+        result = -(a * b);
+        inexact = false;
+        break;
+    case vfp_fast_op::div:
+    default:
+        // The double quotient rounds to the correct single result, and compares equal to it
+        // exactly when the true quotient is representable.
+        result = a / b;
+        inexact = false;
+        break;
+    }
+
+    const float rounded = static_cast<float>(result);
+    u32 d;
+    std::memcpy(&d, &rounded, sizeof(d));
+    if (!is_normal(d)) {
+        // Overflow, underflow or an exact zero; the precise path sets the right flags.
+        return false;
+    }
+    // Stay clear of the underflow boundary, where tininess is detected before rounding.
+    if (std::fabs(result) < 0x1p-125) {
+        return false;
+    }
+
+    if (inexact || static_cast<double>(rounded) != result) {
+        *exceptions |= FPSCR_IXC;
+    }
+    vfp_put_float(state, static_cast<s32>(d), sd);
+    return true;
+}
+
 #define NEG_MULTIPLY (1 << 0)
 #define NEG_SUBTRACT (1 << 1)
 
@@ -996,6 +1078,9 @@ static u32 vfp_single_fmul(ARMul_State* state, int sd, int sn, s32 m, u32 fpscr)
 
     LOG_TRACE(Core_ARM11, "s{} = {:08x}", sn, n);
 
+    if (vfp_single_fast_op(state, sd, n, m, fpscr, vfp_fast_op::mul, &exceptions))
+        return exceptions;
+
     exceptions |= vfp_single_unpack(&vsn, n, fpscr);
     if (vsn.exponent == 0 && vsn.significand)
         vfp_single_normalise_denormal(&vsn);
@@ -1018,6 +1103,9 @@ static u32 vfp_single_fnmul(ARMul_State* state, int sd, int sn, s32 m, u32 fpscr
 
     LOG_TRACE(Core_ARM11, "s{} = {:08x}", sn, n);
 
+    if (vfp_single_fast_op(state, sd, n, m, fpscr, vfp_fast_op::nmul, &exceptions))
+        return exceptions;
+
     exceptions |= vfp_single_unpack(&vsn, n, fpscr);
     if (vsn.exponent == 0 && vsn.significand)
         vfp_single_normalise_denormal(&vsn);
@@ -1041,6 +1129,9 @@ static u32 vfp_single_fadd(ARMul_State* state, int sd, int sn, s32 m, u32 fpscr)
 
     LOG_TRACE(Core_ARM11, "s{} = {:08x}", sn, n);
 
+    if (vfp_single_fast_op(state, sd, n, m, fpscr, vfp_fast_op::add, &exceptions))
+        return exceptions;
+
     /*
      * Unpack and normalise denormals.
      */
@@ -1092,6 +1183,9 @@ static u32 vfp_single_fdiv(ARMul_State* state, int sd, int sn, s32 m, u32 fpscr)
 
     LOG_TRACE(Core_ARM11, "s{} = {:08x}", sn, n);
 
+    if (vfp_single_fast_op(state, sd, n, m, fpscr, vfp_fast_op::div, &exceptions))
+        return exceptions;
+
     exceptions |= vfp_single_unpack(&vsn, n, fpscr);
     exceptions |= vfp_single_unpack(&vsm, m, fpscr);
 
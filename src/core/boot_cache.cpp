@@ -0,0 +1,92 @@
+// Copyright 2025 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <fmt/format.h>
+#include "common/file_util.h"
+#include "common/hash.h"
+#include "common/logging/log.h"
+#include "common/swap.h"
+#include "core/boot_cache.h"
+
+namespace Core {
+
+namespace {
+
+#pragma pack(push, 1)
+struct BootCacheEntry {
+    std::array<u8, 4> magic; /// Unique identifier to check the file type (always "CBT"0x1B)
+    u32_le version;          /// Bumped whenever the layout or the cached fields change
+    u64_le rom_size;         /// Size of the ROM this entry was created from
+    u64_le rom_mtime;        /// Modification time of the ROM this entry was created from
+    u64_le program_id;
+    u32_le system_mode;
+    u8 n3ds_mode;
+};
+#pragma pack(pop)
+
+constexpr std::array<u8, 4> boot_cache_magic{{'C', 'B', 'T', 0x1B}};
+constexpr u32 boot_cache_version = 1;
+
+std::string GetBootCachePath(const std::string& rom_path) {
+    // The program id is not known before the ROM is parsed, so entries are keyed by a hash of
+    // the ROM path instead.
+    return fmt::format("{}boot/{:016X}.cache",
+                       FileUtil::GetUserPath(FileUtil::UserPath::CacheDir),
+                       Common::ComputeHash64(rom_path.data(), rom_path.size()));
+}
+
+} // namespace
+
+std::optional<BootMetadata> LoadBootMetadata(const std::string& rom_path) {
+    const auto path = GetBootCachePath(rom_path);
+    FileUtil::IOFile file(path, "rb");
+    if (!file) {
+        return std::nullopt;
+    }
+
+    BootCacheEntry entry;
+    if (file.ReadObject(entry) != 1) {
+        LOG_WARNING(Core, "Could not read boot cache entry {}", path);
+        return std::nullopt;
+    }
+    if (entry.magic != boot_cache_magic || entry.version != boot_cache_version) {
+        return std::nullopt;
+    }
+    if (entry.rom_size != FileUtil::GetSize(rom_path) ||
+        entry.rom_mtime != FileUtil::GetModificationTime(rom_path)) {
+        LOG_INFO(Core, "ROM changed since the boot cache entry was created, ignoring it");
+        return std::nullopt;
+    }
+
+    return BootMetadata{
+        .program_id = entry.program_id,
+        .system_mode = entry.system_mode,
+        .n3ds_mode = entry.n3ds_mode,
+    };
+}
+
+void SaveBootMetadata(const std::string& rom_path, const BootMetadata& metadata) {
+    const auto path = GetBootCachePath(rom_path);
+    if (!FileUtil::CreateFullPath(path)) {
+        LOG_ERROR(Core, "Could not create path {}", path);
+        return;
+    }
+
+    BootCacheEntry entry{};
+    entry.magic = boot_cache_magic;
+    entry.version = boot_cache_version;
+    entry.rom_size = FileUtil::GetSize(rom_path);
+    entry.rom_mtime = FileUtil::GetModificationTime(rom_path);
+    entry.program_id = metadata.program_id;
+    entry.system_mode = metadata.system_mode;
+    entry.n3ds_mode = metadata.n3ds_mode;
+
+    FileUtil::IOFile file(path, "wb");
+    if (!file || file.WriteObject(entry) != 1) {
+        LOG_ERROR(Core, "Could not write boot cache entry {}", path);
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,31 @@
+// Copyright 2025 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include "common/common_types.h"
+
+namespace Core {
+
+/// Loader metadata resolved during a previous boot of the same ROM. Knowing these values up
+/// front lets System::Load start kernel initialization without walking the NCCH headers first.
+struct BootMetadata {
+    u64 program_id;
+    u32 system_mode;
+    u8 n3ds_mode;
+};
+
+/**
+ * Reads the cached boot metadata for the ROM at the given path.
+ * @returns The cached metadata, or std::nullopt when there is no cache entry for this ROM or
+ *          the entry is stale (the file's size or modification time changed).
+ */
+std::optional<BootMetadata> LoadBootMetadata(const std::string& rom_path);
+
+/// Records the resolved boot metadata for the ROM at the given path in the cache.
+void SaveBootMetadata(const std::string& rom_path, const BootMetadata& metadata);
+
+} // namespace Core
@@ -6,6 +6,7 @@
 #include <cmath>
 #include <fstream>
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 #include <boost/iostreams/device/file_descriptor.hpp>
@@ -131,12 +132,8 @@ static inline void AddOffsetOp(const GatewayCheat::CheatLine& line, State& state
 }
 
 static inline void JokerOp(const GatewayCheat::CheatLine& line, State& state,
-                           const Core::System& system) {
-    u32 pad_state = system.ServiceManager()
-                        .GetService<Service::HID::Module::Interface>("hid:USER")
-                        ->GetModule()
-                        ->GetState()
-                        .hex;
+                           const Service::HID::Module& hid) {
+    u32 pad_state = hid.GetState().hex;
     bool pressed = (pad_state & line.value) == line.value;
     if (!pressed) {
         state.if_flag++;
@@ -211,6 +208,7 @@ GatewayCheat::CheatLine::CheatLine(const std::string& line) {
 GatewayCheat::GatewayCheat(std::string name_, std::vector<CheatLine> cheat_lines_,
                            std::string comments_)
     : name(std::move(name_)), cheat_lines(std::move(cheat_lines_)), comments(std::move(comments_)) {
+    ScanLines();
 }
 
 GatewayCheat::GatewayCheat(std::string name_, std::string code, std::string comments_)
@@ -224,13 +222,40 @@ GatewayCheat::GatewayCheat(std::string name_, std::string code, std::string comm
             temp_cheat_lines.emplace_back(line);
     }
     cheat_lines = std::move(temp_cheat_lines);
+    ScanLines();
 }
 
 GatewayCheat::~GatewayCheat() = default;
 
+void GatewayCheat::ScanLines() {
+    for (const auto& line : cheat_lines) {
+        if (line.valid && line.type != CheatType::Null) {
+            has_executable_lines = true;
+        }
+        if (line.type == CheatType::Joker) {
+            reads_pad_state = true;
+        }
+    }
+}
+
 void GatewayCheat::Execute(Core::System& system) const {
+    if (!has_executable_lines) {
+        return;
+    }
+
     State state;
 
+    // Resolving "hid:USER" walks the service manager by name, so do it once per run rather
+    // than once per Joker line.
+    std::shared_ptr<Service::HID::Module> hid;
+    if (reads_pad_state) {
+        hid = Service::HID::GetModule(system);
+        if (!hid) {
+            LOG_ERROR(Core_Cheats, "HID service is not initialized, skipping cheat");
+            return;
+        }
+    }
+
     Memory::MemorySystem& memory = system.Memory();
     auto Read8 = [&memory](VAddr addr) { return memory.Read8(addr); };
     auto Read16 = [&memory](VAddr addr) { return memory.Read16(addr); };
@@ -241,7 +266,7 @@ void GatewayCheat::Execute(Core::System& system) const {
 
     for (state.current_line_nr = 0; state.current_line_nr < cheat_lines.size();
          state.current_line_nr++) {
-        auto line = cheat_lines[state.current_line_nr];
+        const auto& line = cheat_lines[state.current_line_nr];
         if (state.if_flag > 0) {
             switch (line.type) {
             case CheatType::GreaterThan32:
@@ -410,7 +435,7 @@ void GatewayCheat::Execute(Core::System& system) const {
         }
         case CheatType::Joker: {
             // DD000000 XXXXXXXX – if KEYPAD has value XXXXXXXX execute next block
-            JokerOp(line, state, system);
+            JokerOp(line, state, *hid);
             break;
         }
         case CheatType::Patch: {
@@ -80,9 +80,15 @@ public:
     static std::vector<std::unique_ptr<CheatBase>> LoadFile(const std::string& filepath);
 
 private:
+    /// Precompute facts about the cheat lines so Execute can skip work for cheats
+    /// that have nothing to do.
+    void ScanLines();
+
     std::atomic<bool> enabled = false;
     const std::string name;
     std::vector<CheatLine> cheat_lines;
     const std::string comments;
+    bool has_executable_lines = false; ///< Whether any line does something when executed
+    bool reads_pad_state = false;      ///< Whether any Joker line needs the HID pad state
 };
 } // namespace Cheats
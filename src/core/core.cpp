@@ -2,7 +2,10 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <future>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 #include <boost/serialization/array.hpp>
@@ -18,6 +21,7 @@
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #endif
 #include "core/arm/dyncom/arm_dyncom.h"
+#include "core/boot_cache.h"
 #include "core/cheats/cheats.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -46,6 +50,7 @@
 #include "core/loader/loader.h"
 #include "core/movie.h"
 #include "core/rpc/rpc_server.h"
+#include "core/savestate.h"
 #include "network/network.h"
 #include "video_core/custom_textures/custom_tex_manager.h"
 #include "video_core/renderer_base.h"
@@ -193,13 +198,33 @@ System::ResultStatus System::RunLoop(bool tight_loop) {
         // with a max slice that is the minimum of all max slices of all cores
         // TODO: Make special check for idle since we can easily revert the time of idle cores
         s64 max_slice = Timing::MAX_SLICE_LENGTH;
+        bool all_cores_idle = true;
         for (const auto& cpu_core : cpu_cores) {
             kernel->SetRunningCPU(cpu_core.get());
             cpu_core->GetTimer().Advance();
             cpu_core->PrepareReschedule();
-            kernel->GetThreadManager(cpu_core->GetID()).Reschedule();
+            auto& thread_manager = kernel->GetThreadManager(cpu_core->GetID());
+            thread_manager.Reschedule();
+            all_cores_idle &= thread_manager.GetCurrentThread() == nullptr &&
+                              !thread_manager.HaveReadyThreads();
             max_slice = std::min(max_slice, cpu_core->GetTimer().GetMaxSliceLength());
         }
+
+        // With nothing runnable on any core, no instruction can execute before the next
+        // scheduled event fires (VBlank, thread wakeup, HW update), so let the slice reach
+        // that event directly instead of idling towards it MAX_SLICE_LENGTH at a time.
+        // Games that sleep on VBlank in menu screens spend nearly all of their time here.
+        // SetNextSlice below still clamps each core to its own next event, and idle cores
+        // consume their slice instantly through Timer::Idle().
+        if (all_cores_idle) {
+            s64 next_event = std::numeric_limits<s64>::max();
+            for (const auto& cpu_core : cpu_cores) {
+                next_event = std::min(next_event, cpu_core->GetTimer().GetCyclesUntilNextEvent());
+            }
+            if (next_event != std::numeric_limits<s64>::max()) {
+                max_slice = std::max(max_slice, next_event);
+            }
+        }
         for (auto& cpu_core : cpu_cores) {
             cpu_core->GetTimer().SetNextSlice(max_slice);
             auto start_ticks = cpu_core->GetTimer().GetTicks();
@@ -257,34 +282,55 @@ System::ResultStatus System::Load(Frontend::EmuWindow& emu_window, const std::st
         LOG_CRITICAL(Core, "Failed to obtain loader for {}!", filepath);
         return ResultStatus::ErrorGetLoader;
     }
-    std::pair<std::optional<u32>, Loader::ResultStatus> system_mode =
-        app_loader->LoadKernelSystemMode();
-
-    if (system_mode.second != Loader::ResultStatus::Success) {
-        LOG_CRITICAL(Core, "Failed to determine system mode (Error {})!",
-                     static_cast<int>(system_mode.second));
 
-        switch (system_mode.second) {
-        case Loader::ResultStatus::ErrorEncrypted:
-            return ResultStatus::ErrorLoader_ErrorEncrypted;
-        case Loader::ResultStatus::ErrorInvalidFormat:
-            return ResultStatus::ErrorLoader_ErrorInvalidFormat;
-        case Loader::ResultStatus::ErrorGbaTitle:
-            return ResultStatus::ErrorLoader_ErrorGbaTitle;
-        default:
-            return ResultStatus::ErrorSystemMode;
+    u32 system_mode;
+    u8 n3ds_mode;
+    std::future<void> rom_parse;
+    const std::optional<BootMetadata> boot_metadata = LoadBootMetadata(filepath);
+    if (boot_metadata) {
+        // Repeat launch of a known ROM: the kernel configuration was recorded on a previous
+        // boot, so initialization can begin right away while the NCCH header walk runs on
+        // another thread. Errors the walk would have surfaced here (e.g. an encrypted ROM)
+        // are caught by app_loader->Load() below instead.
+        system_mode = boot_metadata->system_mode;
+        n3ds_mode = boot_metadata->n3ds_mode;
+        rom_parse = std::async(std::launch::async, [this] { app_loader->LoadKernelSystemMode(); });
+    } else {
+        std::pair<std::optional<u32>, Loader::ResultStatus> mode_result =
+            app_loader->LoadKernelSystemMode();
+
+        if (mode_result.second != Loader::ResultStatus::Success) {
+            LOG_CRITICAL(Core, "Failed to determine system mode (Error {})!",
+                         static_cast<int>(mode_result.second));
+
+            switch (mode_result.second) {
+            case Loader::ResultStatus::ErrorEncrypted:
+                return ResultStatus::ErrorLoader_ErrorEncrypted;
+            case Loader::ResultStatus::ErrorInvalidFormat:
+                return ResultStatus::ErrorLoader_ErrorInvalidFormat;
+            case Loader::ResultStatus::ErrorGbaTitle:
+                return ResultStatus::ErrorLoader_ErrorGbaTitle;
+            default:
+                return ResultStatus::ErrorSystemMode;
+            }
         }
-    }
 
-    ASSERT(system_mode.first);
-    auto n3ds_mode = app_loader->LoadKernelN3dsMode();
-    ASSERT(n3ds_mode.first);
+        ASSERT(mode_result.first);
+        auto n3ds_mode_result = app_loader->LoadKernelN3dsMode();
+        ASSERT(n3ds_mode_result.first);
+        system_mode = *mode_result.first;
+        n3ds_mode = *n3ds_mode_result.first;
+    }
     u32 num_cores = 2;
     if (Settings::values.is_new_3ds) {
         num_cores = 4;
     }
-    ResultStatus init_result{
-        Init(emu_window, secondary_window, *system_mode.first, *n3ds_mode.first, num_cores)};
+    ResultStatus init_result{Init(emu_window, secondary_window, system_mode, n3ds_mode, num_cores)};
+    // The loader must not be touched (and may not be destroyed) while the background header
+    // walk is still using it.
+    if (rom_parse.valid()) {
+        rom_parse.get();
+    }
     if (init_result != ResultStatus::Success) {
         LOG_CRITICAL(Core, "Failed to initialize system (Error {})!",
                      static_cast<u32>(init_result));
@@ -316,15 +362,29 @@ System::ResultStatus System::Load(Frontend::EmuWindow& emu_window, const std::st
         LOG_ERROR(Core, "Failed to find title id for ROM (Error {})",
                   static_cast<u32>(load_result));
     }
+    if (!boot_metadata) {
+        SaveBootMetadata(filepath, BootMetadata{.program_id = title_id,
+                                                .system_mode = system_mode,
+                                                .n3ds_mode = n3ds_mode});
+    }
+    // The custom texture scan only walks the load directory, so it can overlap the cheat
+    // database load below. It must be finished before this returns, since the frontend may
+    // start preloading textures right away.
+    std::future<void> texture_scan;
+    if (Settings::values.custom_textures) {
+        texture_scan =
+            std::async(std::launch::async, [this] { custom_tex_manager->FindCustomTextures(); });
+    }
+
     cheat_engine = std::make_unique<Cheats::CheatEngine>(title_id, *this);
     perf_stats = std::make_unique<PerfStats>(title_id);
 
-    if (Settings::values.custom_textures) {
-        custom_tex_manager->FindCustomTextures();
-    }
     if (Settings::values.dump_textures) {
         custom_tex_manager->WriteConfig();
     }
+    if (texture_scan.valid()) {
+        texture_scan.get();
+    }
 
     status = ResultStatus::Success;
     m_emu_window = &emu_window;
@@ -550,6 +610,7 @@ void System::Shutdown(bool is_deserializing) {
         perf_stats.reset();
         cheat_engine.reset();
         app_loader.reset();
+        rewind_buffer.reset();
     }
     custom_tex_manager.reset();
     telemetry_session.reset();
@@ -65,6 +65,7 @@ class RendererBase;
 namespace Core {
 
 class ExclusiveMonitor;
+class RewindBuffer;
 class Timing;
 
 class System {
@@ -319,6 +320,13 @@ public:
 
     void LoadState(u32 slot);
 
+    /// Captures a rewind point into the in-memory rewind ring.
+    void CaptureRewindPoint();
+
+    /// Restores the newest rewind point and drops it from the ring.
+    /// Returns false when no rewind points are available.
+    bool Rewind();
+
     /// Self delete ncch
     bool SetSelfDelete(const std::string& file) {
         if (m_filepath == file) {
@@ -369,6 +377,9 @@ private:
     /// Cheats manager
     std::unique_ptr<Cheats::CheatEngine> cheat_engine;
 
+    /// Rewind snapshot ring; created lazily on the first capture
+    std::unique_ptr<RewindBuffer> rewind_buffer;
+
     /// Video dumper backend
     std::unique_ptr<VideoDumper::Backend> video_dumper;
 
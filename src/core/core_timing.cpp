@@ -67,12 +67,12 @@ void Timing::ScheduleEvent(s64 cycles_into_future, const TimingEventType* event_
         if (!timer->is_timer_sane)
             timer->ForceExceptionCheck(cycles_into_future);
 
-        timer->event_queue.emplace_back(
-            Event{timeout, timer->event_fifo_id++, user_data, event_type});
-        std::push_heap(timer->event_queue.begin(), timer->event_queue.end(), std::greater<>());
+        timer->InsertEvent(Event{timeout, timer->event_fifo_id++, user_data, event_type});
     } else {
-        timer->ts_queue.Push(Event{static_cast<s64>(timer->GetTicks() + cycles_into_future), 0,
-                                   user_data, event_type});
+        // Foreign-thread posts go through the lock-free staging ring and are folded into the
+        // wheel by MoveEvents() at the next Advance(), so they never contend with the owning
+        // thread's InsertEvent. The fifo_order is assigned at drain time.
+        timer->ts_queue.Push(Event{timeout, 0, user_data, event_type});
     }
 }
 
@@ -81,17 +81,11 @@ void Timing::UnscheduleEvent(const TimingEventType* event_type, std::uintptr_t u
         return;
     }
     for (auto timer : timers) {
-        auto itr = std::remove_if(
-            timer->event_queue.begin(), timer->event_queue.end(),
+        // Drain the staging ring first so events posted from other threads are also removable
+        timer->MoveEvents();
+        timer->RemoveEvents(
             [&](const Event& e) { return e.type == event_type && e.user_data == user_data; });
-
-        // Removing random items breaks the invariant so we have to re-establish it.
-        if (itr != timer->event_queue.end()) {
-            timer->event_queue.erase(itr, timer->event_queue.end());
-            std::make_heap(timer->event_queue.begin(), timer->event_queue.end(), std::greater<>());
-        }
     }
-    // TODO:remove events from ts_queue
 }
 
 void Timing::RemoveEvent(const TimingEventType* event_type) {
@@ -99,16 +93,9 @@ void Timing::RemoveEvent(const TimingEventType* event_type) {
         return;
     }
     for (auto timer : timers) {
-        auto itr = std::remove_if(timer->event_queue.begin(), timer->event_queue.end(),
-                                  [&](const Event& e) { return e.type == event_type; });
-
-        // Removing random items breaks the invariant so we have to re-establish it.
-        if (itr != timer->event_queue.end()) {
-            timer->event_queue.erase(itr, timer->event_queue.end());
-            std::make_heap(timer->event_queue.begin(), timer->event_queue.end(), std::greater<>());
-        }
+        timer->MoveEvents();
+        timer->RemoveEvents([&](const Event& e) { return e.type == event_type; });
     }
-    // TODO:remove events from ts_queue
 }
 
 void Timing::SetCurrentTimer(std::size_t core_id) {
@@ -168,20 +155,119 @@ void Timing::Timer::ForceExceptionCheck(s64 cycles) {
 void Timing::Timer::MoveEvents() {
     for (Event ev; ts_queue.Pop(ev);) {
         ev.fifo_order = event_fifo_id++;
-        event_queue.emplace_back(std::move(ev));
-        std::push_heap(event_queue.begin(), event_queue.end(), std::greater<>());
+        InsertEvent(std::move(ev));
+    }
+}
+
+void Timing::Timer::InsertEvent(Event&& event) {
+    const s64 horizon = (wheel_cursor + static_cast<s64>(WHEEL_BUCKETS)) << WHEEL_SHIFT;
+    if (event.time >= horizon) {
+        far_queue.emplace_back(std::move(event));
+        std::push_heap(far_queue.begin(), far_queue.end(), std::greater<>());
+        return;
+    }
+    // Events due in the past (zero-cycle schedules) are clamped to the cursor bucket so
+    // they fire on the next Advance().
+    const s64 bucket = std::max(event.time >> WHEEL_SHIFT, wheel_cursor);
+    wheel[static_cast<std::size_t>(bucket) & (WHEEL_BUCKETS - 1)].emplace_back(std::move(event));
+}
+
+void Timing::Timer::CollectDueEvents(std::vector<Event>& due) {
+    const s64 current_bucket = executed_ticks >> WHEEL_SHIFT;
+    for (s64 b = wheel_cursor; b <= current_bucket; ++b) {
+        auto& bucket = wheel[static_cast<std::size_t>(b) & (WHEEL_BUCKETS - 1)];
+        if (bucket.empty()) {
+            continue;
+        }
+        if (b < current_bucket) {
+            // Fully elapsed bucket; everything in it is due.
+            due.insert(due.end(), std::make_move_iterator(bucket.begin()),
+                       std::make_move_iterator(bucket.end()));
+            bucket.clear();
+        } else {
+            // The bucket containing executed_ticks may still hold future events.
+            const auto itr = std::partition(bucket.begin(), bucket.end(), [this](const Event& e) {
+                return e.time > executed_ticks;
+            });
+            due.insert(due.end(), std::make_move_iterator(itr),
+                       std::make_move_iterator(bucket.end()));
+            bucket.erase(itr, bucket.end());
+        }
+    }
+    wheel_cursor = current_bucket;
+
+    // Migrate far-future events that have entered the wheel window.
+    const s64 horizon = (current_bucket + static_cast<s64>(WHEEL_BUCKETS)) << WHEEL_SHIFT;
+    while (!far_queue.empty() && far_queue.front().time < horizon) {
+        Event ev = std::move(far_queue.front());
+        std::pop_heap(far_queue.begin(), far_queue.end(), std::greater<>());
+        far_queue.pop_back();
+        InsertEvent(std::move(ev));
+    }
+
+    std::sort(due.begin(), due.end());
+}
+
+void Timing::Timer::RemoveEvents(const std::function<bool(const Event&)>& pred) {
+    for (auto& bucket : wheel) {
+        bucket.erase(std::remove_if(bucket.begin(), bucket.end(), pred), bucket.end());
+    }
+    const auto itr = std::remove_if(far_queue.begin(), far_queue.end(), pred);
+    // Removing random items breaks the heap invariant so we have to re-establish it.
+    if (itr != far_queue.end()) {
+        far_queue.erase(itr, far_queue.end());
+        std::make_heap(far_queue.begin(), far_queue.end(), std::greater<>());
+    }
+}
+
+s64 Timing::Timer::NextEventTime() const {
+    s64 next_time = std::numeric_limits<s64>::max();
+    if (!far_queue.empty()) {
+        next_time = far_queue.front().time;
+    }
+    // The first non-empty bucket in cyclic order from the cursor holds the earliest wheel
+    // events; scanning at most WHEEL_BUCKETS mostly-empty buckets is cheap per slice.
+    const auto start = static_cast<std::size_t>(wheel_cursor);
+    for (std::size_t i = 0; i < WHEEL_BUCKETS; ++i) {
+        const auto& bucket = wheel[(start + i) & (WHEEL_BUCKETS - 1)];
+        if (bucket.empty()) {
+            continue;
+        }
+        for (const Event& event : bucket) {
+            next_time = std::min(next_time, event.time);
+        }
+        break;
     }
+    return next_time;
+}
+
+std::vector<Timing::Event> Timing::Timer::GetAllEvents() const {
+    std::vector<Event> events;
+    for (const auto& bucket : wheel) {
+        events.insert(events.end(), bucket.begin(), bucket.end());
+    }
+    events.insert(events.end(), far_queue.begin(), far_queue.end());
+    std::sort(events.begin(), events.end());
+    return events;
 }
 
 s64 Timing::Timer::GetMaxSliceLength() const {
-    const auto& next_event = event_queue.begin();
-    if (next_event != event_queue.end()) {
-        ASSERT(next_event->time - executed_ticks > 0);
-        return next_event->time - executed_ticks;
+    const s64 next_time = NextEventTime();
+    if (next_time != std::numeric_limits<s64>::max()) {
+        ASSERT(next_time - executed_ticks > 0);
+        return next_time - executed_ticks;
     }
     return MAX_SLICE_LENGTH;
 }
 
+s64 Timing::Timer::GetCyclesUntilNextEvent() const {
+    const s64 next_time = NextEventTime();
+    if (next_time == std::numeric_limits<s64>::max()) {
+        return next_time;
+    }
+    return next_time - executed_ticks;
+}
+
 void Timing::Timer::Advance() {
     MoveEvents();
 
@@ -193,14 +279,20 @@ void Timing::Timer::Advance() {
 
     is_timer_sane = true;
 
-    while (!event_queue.empty() && event_queue.front().time <= executed_ticks) {
-        Event evt = std::move(event_queue.front());
-        std::pop_heap(event_queue.begin(), event_queue.end(), std::greater<>());
-        event_queue.pop_back();
-        if (evt.type->callback != nullptr) {
-            evt.type->callback(evt.user_data, static_cast<int>(executed_ticks - evt.time));
-        } else {
-            LOG_ERROR(Core, "Event '{}' has no callback", *evt.type->name);
+    // Callbacks may schedule new zero-delay events, so keep collecting until quiescent.
+    std::vector<Event> due;
+    while (true) {
+        due.clear();
+        CollectDueEvents(due);
+        if (due.empty()) {
+            break;
+        }
+        for (Event& evt : due) {
+            if (evt.type->callback != nullptr) {
+                evt.type->callback(evt.user_data, static_cast<int>(executed_ticks - evt.time));
+            } else {
+                LOG_ERROR(Core, "Event '{}' has no callback", *evt.type->name);
+            }
         }
     }
 
@@ -211,9 +303,10 @@ void Timing::Timer::SetNextSlice(s64 max_slice_length) {
     slice_length = max_slice_length;
 
     // Still events left (scheduled in the future)
-    if (!event_queue.empty()) {
-        slice_length = static_cast<int>(
-            std::min<s64>(event_queue.front().time - executed_ticks, max_slice_length));
+    const s64 next_time = NextEventTime();
+    if (next_time != std::numeric_limits<s64>::max()) {
+        slice_length =
+            static_cast<int>(std::min<s64>(next_time - executed_ticks, max_slice_length));
     }
 
     downcount = slice_length;
@@ -17,6 +17,7 @@
  *   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
  */
 
+#include <array>
 #include <chrono>
 #include <functional>
 #include <limits>
@@ -186,6 +187,12 @@ public:
 
         s64 GetMaxSliceLength() const;
 
+        /// Returns the number of cycles from the current time until the earliest pending event,
+        /// or s64 max if there is none. Unlike GetMaxSliceLength() there is no fallback for
+        /// event-less timers, so the dispatcher can tell "no constraint" apart from "an event
+        /// exactly MAX_SLICE_LENGTH away" when fast-forwarding idle cores.
+        s64 GetCyclesUntilNextEvent() const;
+
         void Advance();
 
         void SetNextSlice(s64 max_slice_length = MAX_SLICE_LENGTH);
@@ -205,15 +212,37 @@ public:
 
     private:
         friend class Timing;
-        // The queue is a min-heap using std::make_heap/push_heap/pop_heap.
-        // We don't use std::priority_queue because we need to be able to serialize, unserialize and
-        // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't
-        // accommodated by the standard adaptor class.
-        std::vector<Event> event_queue;
+
+        // Near-term events live in a timer wheel indexed by absolute bucket number, making
+        // schedule/unschedule O(1) for the periodic audio/DSP events that reschedule every
+        // few emulated milliseconds. Events beyond the wheel horizon go to a min-heap
+        // (std::push_heap/pop_heap) and migrate into the wheel as it advances.
+        // We don't use std::priority_queue for the far queue because we need to be able to
+        // serialize, unserialize and erase arbitrary events (RemoveEvent()) regardless of the
+        // queue order. These aren't accommodated by the standard adaptor class.
+        static constexpr std::size_t WHEEL_BUCKETS = 128; // must be a power of two
+        static constexpr int WHEEL_SHIFT = 14;            // ~61us worth of cycles per bucket
+
+        /// Files an event into the wheel or, past the horizon, into the far queue.
+        void InsertEvent(Event&& event);
+        /// Moves all events due at executed_ticks into `due`, sorted by (time, fifo_order),
+        /// advancing the wheel cursor and migrating far-queue events that entered the window.
+        void CollectDueEvents(std::vector<Event>& due);
+        /// Erases all pending events matching the predicate.
+        void RemoveEvents(const std::function<bool(const Event&)>& pred);
+        /// Returns the time of the earliest pending event, or s64 max if there is none.
+        s64 NextEventTime() const;
+        /// Returns all pending events sorted by (time, fifo_order), for serialization.
+        std::vector<Event> GetAllEvents() const;
+
+        std::array<std::vector<Event>, WHEEL_BUCKETS> wheel;
+        // Absolute bucket number the wheel has been processed up to.
+        s64 wheel_cursor = 0;
+        std::vector<Event> far_queue;
         u64 event_fifo_id = 0;
         // the queue for storing the events from other threads threadsafe until they will be added
         // to the event_queue by the emu thread
-        Common::MPSCQueue<Event> ts_queue;
+        Common::MPMCQueue<Event, 0x100> ts_queue;
         // Are we in a function that has been called from Advance()
         // If events are sheduled from a function that gets called from Advance(),
         // don't change slice_length and downcount.
@@ -232,17 +261,42 @@ public:
         // under/overclocking the guest cpu
         double cpu_clock_scale = 1.0;
 
+        // The archive format is unchanged from the binary-heap implementation: a flat,
+        // sorted vector of pending events followed by the timer state.
+        template <class Archive>
+        void save(Archive& ar, const unsigned int) const {
+            const_cast<Timer*>(this)->MoveEvents();
+            std::vector<Event> event_queue = GetAllEvents();
+            ar& event_queue;
+            ar& event_fifo_id;
+            ar& slice_length;
+            ar& downcount;
+            ar& executed_ticks;
+            ar& idled_cycles;
+        }
+
         template <class Archive>
-        void serialize(Archive& ar, const unsigned int) {
-            MoveEvents();
+        void load(Archive& ar, const unsigned int) {
+            std::vector<Event> event_queue;
             ar& event_queue;
             ar& event_fifo_id;
             ar& slice_length;
             ar& downcount;
             ar& executed_ticks;
             ar& idled_cycles;
+
+            for (auto& bucket : wheel) {
+                bucket.clear();
+            }
+            far_queue.clear();
+            wheel_cursor = executed_ticks >> WHEEL_SHIFT;
+            for (Event& event : event_queue) {
+                InsertEvent(std::move(event));
+            }
         }
         friend class boost::serialization::access;
+
+        BOOST_SERIALIZATION_SPLIT_MEMBER()
     };
 
     explicit Timing(std::size_t num_cores, u32 cpu_clock_percentage);
@@ -11,6 +11,16 @@ VideoFrame::VideoFrame(std::size_t width_, std::size_t height_, u8* data_)
     : width(width_), height(height_), stride(static_cast<u32>(width * 4)),
       data(data_, data_ + width * height * 4) {}
 
+void VideoFrame::Assign(std::size_t width_, std::size_t height_, const u8* data_) {
+    width = width_;
+    height = height_;
+    stride = static_cast<u32>(width * 4);
+    data.resize(width * height * 4);
+    if (!data.empty()) {
+        std::memcpy(data.data(), data_, data.size());
+    }
+}
+
 Backend::~Backend() = default;
 NullBackend::~NullBackend() = default;
 
@@ -23,13 +23,18 @@ public:
     std::vector<u8> data;
 
     VideoFrame(std::size_t width_ = 0, std::size_t height_ = 0, u8* data_ = nullptr);
+
+    /// Refills the frame from raw pixel data, reusing the existing storage when large enough.
+    void Assign(std::size_t width_, std::size_t height_, const u8* data_);
 };
 
 class Backend {
 public:
     virtual ~Backend();
     virtual bool StartDumping(const std::string& path, const Layout::FramebufferLayout& layout) = 0;
-    virtual void AddVideoFrame(VideoFrame frame) = 0;
+    /// Submits a frame for encoding. Implementations may swap their internal storage into
+    /// frame, handing an already-consumed buffer back to the caller for reuse.
+    virtual void AddVideoFrame(VideoFrame& frame) = 0;
     virtual void AddAudioFrame(AudioCore::StereoFrame16 frame) = 0;
     virtual void AddAudioSample(const std::array<s16, 2>& sample) = 0;
     virtual void StopDumping() = 0;
@@ -44,7 +49,7 @@ public:
                       const Layout::FramebufferLayout& /*layout*/) override {
         return false;
     }
-    void AddVideoFrame(VideoFrame /*frame*/) override {}
+    void AddVideoFrame(VideoFrame& /*frame*/) override {}
     void AddAudioFrame(AudioCore::StereoFrame16 /*frame*/) override {}
     void AddAudioSample(const std::array<s16, 2>& /*sample*/) override {}
     void StopDumping() override {}
@@ -778,9 +778,11 @@ bool FFmpegBackend::StartDumping(const std::string& path, const Layout::Framebuf
     return true;
 }
 
-void FFmpegBackend::AddVideoFrame(VideoFrame frame) {
+void FFmpegBackend::AddVideoFrame(VideoFrame& frame) {
     event1.Wait();
-    video_frame_buffers[next_buffer] = std::move(frame);
+    // Swap rather than move so the producer gets the previously encoded buffer back and can
+    // refill it without allocating.
+    std::swap(video_frame_buffers[next_buffer], frame);
     event2.Set();
 }
 
@@ -808,7 +810,8 @@ void FFmpegBackend::StopDumping() {
     VideoCore::g_renderer->CleanupVideoDumping();
 
     // Flush the video processing queue
-    AddVideoFrame(VideoFrame());
+    VideoFrame empty_frame;
+    AddVideoFrame(empty_frame);
     for (auto i : {0, 1}) {
         // Flush the audio processing queue
         audio_frame_queues[i].Push(VariableAudioFrame());
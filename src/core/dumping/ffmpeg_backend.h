@@ -187,7 +187,7 @@ public:
     FFmpegBackend();
     ~FFmpegBackend() override;
     bool StartDumping(const std::string& path, const Layout::FramebufferLayout& layout) override;
-    void AddVideoFrame(VideoFrame frame) override;
+    void AddVideoFrame(VideoFrame& frame) override;
     void AddAudioFrame(AudioCore::StereoFrame16 frame) override;
     void AddAudioSample(const std::array<s16, 2>& sample) override;
     void StopDumping() override;
@@ -126,7 +126,7 @@ public:
 
         const auto full_path = path_parser.BuildHostPath(mount_point);
 
-        switch (path_parser.GetHostStatus(mount_point)) {
+        switch (path_status_cache.GetHostStatus(path_parser, mount_point)) {
         case PathParser::InvalidMountPoint:
             LOG_CRITICAL(Service_FS, "(unreachable) Invalid mount point {}", mount_point);
             return ERROR_FILE_NOT_FOUND;
@@ -68,9 +68,16 @@ void LayeredFS::Load() {
 
     ASSERT_MSG(header.header_length == sizeof(header), "Header size is incorrect");
 
+    // Slurp both metadata tables in one read each; parsing them entry by entry would issue
+    // three small reads per file, which gets very slow for large RomFS images
+    std::vector<u8> dir_table(header.directory_metadata_table.length);
+    romfs->ReadFile(header.directory_metadata_table.offset, dir_table.size(), dir_table.data());
+    std::vector<u8> file_table(header.file_metadata_table.length);
+    romfs->ReadFile(header.file_metadata_table.offset, file_table.size(), file_table.data());
+
     // TODO: is root always the first directory in table?
     root.parent = &root;
-    LoadDirectory(root, 0);
+    LoadDirectory(root, 0, dir_table, file_table);
 
     if (load_relocations) {
         LoadRelocations();
@@ -82,19 +89,29 @@ void LayeredFS::Load() {
 
 LayeredFS::~LayeredFS() = default;
 
-u32 LayeredFS::LoadDirectory(Directory& current, u32 offset) {
+static std::string ReadName(const std::vector<u8>& table, u32 offset, u32 name_length) {
+    std::vector<u16_le> buffer(name_length / sizeof(u16_le));
+    std::memcpy(buffer.data(), table.data() + offset, name_length);
+
+    std::u16string name(buffer.size(), 0);
+    std::transform(buffer.begin(), buffer.end(), name.begin(), [](u16_le character) {
+        return static_cast<char16_t>(static_cast<u16>(character));
+    });
+    return Common::UTF16ToUTF8(name);
+}
+
+u32 LayeredFS::LoadDirectory(Directory& current, u32 offset, const std::vector<u8>& dir_table,
+                             const std::vector<u8>& file_table) {
     DirectoryMetadata metadata;
-    romfs->ReadFile(header.directory_metadata_table.offset + offset, sizeof(metadata),
-                    reinterpret_cast<u8*>(&metadata));
+    std::memcpy(&metadata, dir_table.data() + offset, sizeof(metadata));
 
-    current.name = ReadName(header.directory_metadata_table.offset + offset + sizeof(metadata),
-                            metadata.name_length);
+    current.name = ReadName(dir_table, offset + sizeof(metadata), metadata.name_length);
     current.path = current.parent->path + current.name + DIR_SEP;
     directory_path_map.emplace(current.path, &current);
 
     u32 file_offset = metadata.first_file_offset;
     while (file_offset != 0xFFFFFFFF) {
-        file_offset = LoadFile(current, file_offset);
+        file_offset = LoadFile(current, file_offset, file_table);
     }
 
     u32 child_directory_offset = metadata.first_child_directory_offset;
@@ -103,20 +120,19 @@ u32 LayeredFS::LoadDirectory(Directory& current, u32 offset) {
         auto& directory = *child;
         directory.parent = &current;
         current.directories.emplace_back(std::move(child));
-        child_directory_offset = LoadDirectory(directory, child_directory_offset);
+        child_directory_offset =
+            LoadDirectory(directory, child_directory_offset, dir_table, file_table);
     }
 
     return metadata.next_sibling_offset;
 }
 
-u32 LayeredFS::LoadFile(Directory& parent, u32 offset) {
+u32 LayeredFS::LoadFile(Directory& parent, u32 offset, const std::vector<u8>& file_table) {
     FileMetadata metadata;
-    romfs->ReadFile(header.file_metadata_table.offset + offset, sizeof(metadata),
-                    reinterpret_cast<u8*>(&metadata));
+    std::memcpy(&metadata, file_table.data() + offset, sizeof(metadata));
 
     auto file = std::make_unique<File>();
-    file->name = ReadName(header.file_metadata_table.offset + offset + sizeof(metadata),
-                          metadata.name_length);
+    file->name = ReadName(file_table, offset + sizeof(metadata), metadata.name_length);
     file->path = parent.path + file->name;
     file->relocation.original_offset = header.file_data_offset + metadata.file_data_offset;
     file->relocation.size = metadata.file_data_length;
@@ -128,17 +144,6 @@ u32 LayeredFS::LoadFile(Directory& parent, u32 offset) {
     return metadata.next_sibling_offset;
 }
 
-std::string LayeredFS::ReadName(u32 offset, u32 name_length) {
-    std::vector<u16_le> buffer(name_length / sizeof(u16_le));
-    romfs->ReadFile(offset, name_length, reinterpret_cast<u8*>(buffer.data()));
-
-    std::u16string name(buffer.size(), 0);
-    std::transform(buffer.begin(), buffer.end(), name.begin(), [](u16_le character) {
-        return static_cast<char16_t>(static_cast<u16>(character));
-    });
-    return Common::UTF16ToUTF8(name);
-}
-
 void LayeredFS::LoadRelocations() {
     if (!FileUtil::Exists(patch_path)) {
         return;
@@ -402,7 +407,8 @@ void LayeredFS::BuildFiles() {
         metadata.file_data_length = file->relocation.size;
         current_data_offset += Common::AlignUp(metadata.file_data_length, 16);
         if (metadata.file_data_length != 0) {
-            data_offset_map.emplace(metadata.file_data_offset, file);
+            // file_list is walked in assignment order, so the index stays sorted by offset
+            data_offset_index.emplace_back(metadata.file_data_offset, file);
         }
 
         const auto bucket =
@@ -501,8 +507,12 @@ std::size_t LayeredFS::ReadFile(std::size_t offset, std::size_t length, u8* buff
         offset -= metadata.size();
     }
 
-    // Read files
-    auto current = (--data_offset_map.upper_bound(offset));
+    // Read files, binary searching for the file covering the current offset
+    auto current = std::upper_bound(data_offset_index.begin(), data_offset_index.end(), offset,
+                                    [](std::size_t off, const std::pair<u64, File*>& entry) {
+                                        return off < entry.first;
+                                    }) -
+                   1;
     while (read_size < length) {
         const auto relative_offset = offset - current->first;
         std::size_t to_read{};
@@ -4,10 +4,10 @@
 
 #pragma once
 
-#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/export.hpp>
@@ -63,15 +63,14 @@ private:
         Directory* parent;
     };
 
-    std::string ReadName(u32 offset, u32 name_length);
-
-    // Loads the current directory, then its children.
+    // Loads the current directory, then its children, parsing the in-memory metadata tables.
     // Returns offset of the next sibling directory to load (0xFFFFFFFF if the last directory)
-    u32 LoadDirectory(Directory& current, u32 offset);
+    u32 LoadDirectory(Directory& current, u32 offset, const std::vector<u8>& dir_table,
+                      const std::vector<u8>& file_table);
 
-    // Load the file at offset.
+    // Load the file at offset in the in-memory file metadata table.
     // Returns offset of the next sibling file to load (0xFFFFFFFF if the last file)
-    u32 LoadFile(Directory& parent, u32 offset);
+    u32 LoadFile(Directory& parent, u32 offset, const std::vector<u8>& file_table);
 
     // Load replace/create relocations
     void LoadRelocations();
@@ -109,8 +108,9 @@ private:
     Directory root;
     std::unordered_map<std::string, File*> file_path_map;
     std::unordered_map<std::string, Directory*> directory_path_map;
-    std::map<u64, File*> data_offset_map; // assigned data offset -> file
-    std::vector<u8> metadata;             // Includes header, hash table and metadata
+    // assigned data offset -> file, sorted by offset so reads can binary search
+    std::vector<std::pair<u64, File*>> data_offset_index;
+    std::vector<u8> metadata; // Includes header, hash table and metadata
 
     // Used for rebuilding header
     std::vector<u32_le> directory_hash_table;
@@ -8,6 +8,7 @@
 #include <cryptopp/modes.h>
 #include <cryptopp/sha.h>
 #include "common/common_types.h"
+#include "common/hash.h"
 #include "common/logging/log.h"
 #include "core/core.h"
 #include "core/file_sys/layered_fs.h"
@@ -89,17 +90,26 @@ static bool LZSS_Decompress(const u8* compressed, u32 compressed_size, u8* decom
                 segment_offset &= 0x0FFF;
                 segment_offset += 2;
 
-                // Check if compression is out of bounds
+                // Check the whole match once instead of every byte: the first read, at
+                // out + segment_offset, is the highest index touched, and the writes cover
+                // [out - segment_size, out).
                 if (out < segment_size)
                     return false;
+                if (out + segment_offset >= decompressed_size)
+                    return false;
 
-                for (unsigned j = 0; j < segment_size; j++) {
-                    // Check if compression is out of bounds
-                    if (out + segment_offset >= decompressed_size)
-                        return false;
-
-                    u8 data = decompressed[out + segment_offset];
-                    decompressed[--out] = data;
+                if (segment_offset + 1 >= segment_size) {
+                    // The read and write windows do not overlap, copy the match in one go
+                    std::memcpy(decompressed + out - segment_size,
+                                decompressed + out - segment_size + segment_offset + 1,
+                                segment_size);
+                    out -= segment_size;
+                } else {
+                    // Overlapping match replicating a pattern, copy it a byte at a time
+                    for (unsigned j = 0; j < segment_size; j++) {
+                        u8 data = decompressed[out + segment_offset];
+                        decompressed[--out] = data;
+                    }
                 }
             } else {
                 // Check if compression is out of bounds
@@ -113,6 +123,47 @@ static bool LZSS_Decompress(const u8* compressed, u32 compressed_size, u8* decom
     return true;
 }
 
+/// Returns the path of the cached decompressed .code section for the given hash.
+static std::string GetCodeCachePath(u64 code_hash) {
+    return fmt::format("{}code_cache/{:016x}.code",
+                       FileUtil::GetUserPath(FileUtil::UserPath::CacheDir), code_hash);
+}
+
+/**
+ * Loads a previously decompressed .code section from the cache.
+ * @param code_hash Hash of the compressed section the cache entry was created from
+ * @param expected_size Decompressed size according to the LZSS footer
+ * @param buffer Filled with the decompressed section on success
+ * @return True when a matching cache entry was loaded, otherwise false
+ */
+static bool LoadCachedCode(u64 code_hash, u32 expected_size, std::vector<u8>& buffer) {
+    FileUtil::IOFile cache_file(GetCodeCachePath(code_hash), "rb");
+    if (!cache_file.IsOpen() || cache_file.GetSize() != expected_size) {
+        return false;
+    }
+    buffer.resize(expected_size);
+    if (cache_file.ReadBytes(buffer.data(), buffer.size()) != buffer.size()) {
+        buffer.clear();
+        return false;
+    }
+    return true;
+}
+
+/// Stores a decompressed .code section in the cache; failures only cost the next boot time.
+static void SaveCachedCode(u64 code_hash, const std::vector<u8>& buffer) {
+    const std::string path = GetCodeCachePath(code_hash);
+    if (!FileUtil::CreateFullPath(path)) {
+        return;
+    }
+    FileUtil::IOFile cache_file(path, "wb");
+    if (!cache_file.IsOpen() ||
+        cache_file.WriteBytes(buffer.data(), buffer.size()) != buffer.size()) {
+        // A truncated entry would never match the expected size, but don't leave it around
+        cache_file.Close();
+        FileUtil::Delete(path);
+    }
+}
+
 NCCHContainer::NCCHContainer(const std::string& filepath, u32 ncch_offset, u32 partition)
     : ncch_offset(ncch_offset), partition(partition), filepath(filepath) {
     file = FileUtil::IOFile(filepath, "rb");
@@ -555,12 +606,20 @@ Loader::ResultStatus NCCHContainer::LoadSectionExeFS(const char* name, std::vect
                     dec.ProcessData(&temp_buffer[0], &temp_buffer[0], section.size);
                 }
 
-                // Decompress .code section...
+                // The cache key is the hash of the compressed (already decrypted) section, so
+                // entries can never go stale: an updated title hashes differently.
+                const u64 code_hash = Common::ComputeHash64(&temp_buffer[0], section.size);
                 u32 decompressed_size = LZSS_GetDecompressedSize(&temp_buffer[0], section.size);
+                if (LoadCachedCode(code_hash, decompressed_size, buffer)) {
+                    return Loader::ResultStatus::Success;
+                }
+
+                // Decompress .code section...
                 buffer.resize(decompressed_size);
                 if (!LZSS_Decompress(&temp_buffer[0], section.size, buffer.data(),
                                      decompressed_size))
                     return Loader::ResultStatus::ErrorInvalidFormat;
+                SaveCachedCode(code_hash, buffer);
             } else {
                 // Section is uncompressed...
                 buffer.resize(section.size);
@@ -17,17 +17,14 @@ namespace FileSys::Patch {
 bool ApplyIpsPatch(const std::vector<u8>& ips, std::vector<u8>& buffer) {
     std::size_t cursor = 5;
     std::size_t patch_length = ips.size() - 3;
-    std::string ips_header(ips.begin(), ips.begin() + 5);
 
-    if (ips_header != "PATCH") {
+    if (ips.size() < 5 || std::memcmp(ips.data(), "PATCH", 5) != 0) {
         LOG_INFO(Service_FS, "Attempted to load invalid IPS");
         return false;
     }
 
     while (cursor < patch_length) {
-        std::string eof_check(ips.begin() + cursor, ips.begin() + cursor + 3);
-
-        if (eof_check == "EOF")
+        if (std::memcmp(&ips[cursor], "EOF", 3) == 0)
             return false;
 
         std::size_t offset = ips[cursor] << 16 | ips[cursor + 1] << 8 | ips[cursor + 2];
@@ -40,8 +37,7 @@ bool ApplyIpsPatch(const std::vector<u8>& ips, std::vector<u8>& buffer) {
             if (buffer.size() < offset + length)
                 return false;
 
-            for (u32 i = 0; i < length; ++i)
-                buffer[offset + i] = ips[cursor + 7];
+            std::memset(&buffer[offset], ips[cursor + 7], length);
 
             cursor += 8;
 
@@ -176,8 +172,7 @@ public:
             return false;
         }
 
-        // Process all patch commands.
-        std::memset(m_target.data(), 0, m_target.size());
+        // Process all patch commands. The caller hands in a zero-filled target buffer.
         while (m_patch.Tell() < command_end_offset) {
             if (!HandleCommand())
                 return false;
@@ -241,10 +236,20 @@ private:
             return false;
         if (m_target_relative_offset + length > m_target.size())
             return false;
-        // Byte by byte copy.
-        for (size_t i = 0; i < length; ++i)
-            m_target.data()[m_target.Tell() + i] = m_target.data()[m_target_relative_offset++];
-        m_target.Seek(m_target.Tell() + length);
+        u8* target = m_target.data();
+        const std::size_t write_offset = m_target.Tell();
+        if (m_target_relative_offset >= write_offset ||
+            m_target_relative_offset + length <= write_offset) {
+            // Reads stay ahead of (or clear of) the writes, copy the command as one block
+            std::memmove(target + write_offset, target + m_target_relative_offset, length);
+            m_target_relative_offset += length;
+        } else {
+            // The writes overlap data this command still reads: the copy replicates a
+            // pattern, so it has to run a byte at a time
+            for (size_t i = 0; i < length; ++i)
+                target[write_offset + i] = target[m_target_relative_offset++];
+        }
+        m_target.Seek(write_offset + length);
         return true;
     }
 
@@ -273,7 +278,10 @@ bool ApplyBpsPatch(const std::vector<u8>& patch, std::vector<u8>& buffer) {
 
     patch_stream.Seek(0);
 
-    const std::vector<u8> source = buffer;
+    // Hand the current contents over as the patch source and rebuild the target in a freshly
+    // zeroed buffer, instead of duplicating the whole file to patch it in place.
+    const std::vector<u8> source = std::move(buffer);
+    buffer.assign(source.size(), 0);
     Bps::Stream source_stream{source.data(), source.size()};
     Bps::Stream target_stream{buffer.data(), buffer.size()};
     Bps::PatchApplier applier{source_stream, target_stream, patch_stream};
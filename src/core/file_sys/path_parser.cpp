@@ -95,4 +95,24 @@ std::string PathParser::BuildHostPath(std::string_view mount_point) const {
     return path;
 }
 
+PathParser::HostStatus PathStatusCache::GetHostStatus(const PathParser& parser,
+                                                      std::string_view mount_point) {
+    const std::string host_path = parser.BuildHostPath(mount_point);
+    const auto iter = statuses.find(host_path);
+    if (iter != statuses.end()) {
+        return iter->second;
+    }
+    const auto status = parser.GetHostStatus(mount_point);
+    statuses.emplace(host_path, status);
+    return status;
+}
+
+void PathStatusCache::InvalidatePath(const PathParser& parser, std::string_view mount_point) {
+    statuses.erase(parser.BuildHostPath(mount_point));
+}
+
+void PathStatusCache::InvalidateAll() {
+    statuses.clear();
+}
+
 } // namespace FileSys
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include "core/file_sys/archive_backend.h"
 
@@ -58,4 +60,26 @@ private:
     bool is_root{};
 };
 
+/**
+ * A cache of GetHostStatus results, keyed by the host path. Titles that probe for optional
+ * files issue hundreds of failed opens per second, and each probe costs one host stat per path
+ * component; archives with a sub file system can route lookups through this cache and
+ * invalidate it from their write paths.
+ */
+class PathStatusCache {
+public:
+    /// Looks up the status of the parsed path, querying the host on a cache miss.
+    PathParser::HostStatus GetHostStatus(const PathParser& parser, std::string_view mount_point);
+
+    /// Forgets the status of a single file path, e.g. after creating or deleting it.
+    void InvalidatePath(const PathParser& parser, std::string_view mount_point);
+
+    /// Forgets everything. Used after directory-level changes, which can affect the status of
+    /// any path below them.
+    void InvalidateAll();
+
+private:
+    std::unordered_map<std::string, PathParser::HostStatus> statuses;
+};
+
 } // namespace FileSys
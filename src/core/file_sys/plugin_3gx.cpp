@@ -63,9 +63,42 @@ static bool ReadSection(std::vector<u8>& data_out, FileUtil::IOFile& file, std::
     return true;
 }
 
+std::unordered_map<std::string, FileSys::Plugin3GXLoader::CachedPlugin>
+    FileSys::Plugin3GXLoader::plugin_cache;
+
 Loader::ResultStatus FileSys::Plugin3GXLoader::Load(
     Service::PLGLDR::PLG_LDR::PluginLoaderContext& plg_context, Kernel::Process& process,
     Kernel::KernelSystem& kernel) {
+    // Reuse the parsed image from a previous boot if the file has not changed since
+    const u64 file_size = FileUtil::GetSize(plg_context.plugin_path);
+    const u64 modification_time = FileUtil::GetModificationTime(plg_context.plugin_path);
+    if (const auto it = plugin_cache.find(plg_context.plugin_path);
+        it != plugin_cache.end() && it->second.file_size == file_size &&
+        it->second.modification_time == modification_time) {
+        const CachedPlugin& cached = it->second;
+        header = cached.header;
+        author = cached.author;
+        title = cached.title;
+        summary = cached.summary;
+        description = cached.description;
+        compatible_TID = cached.compatible_TID;
+        exe_sections = cached.exe_sections;
+        exe_load_func = cached.exe_load_func;
+        std::copy(cached.exe_load_args.begin(), cached.exe_load_args.end(), exe_load_args);
+
+        if (!compatible_TID.empty() &&
+            std::find(compatible_TID.begin(), compatible_TID.end(),
+                      static_cast<u32>(process.codeset->program_id)) == compatible_TID.end()) {
+            LOG_ERROR(Service_PLGLDR,
+                      "Failed to load 3GX plugin. Not compatible with loaded process: {}",
+                      plg_context.plugin_path);
+            return Loader::ResultStatus::Error;
+        }
+
+        LOG_INFO(Service_PLGLDR, "Loading cached plugin - Title: {} - Author: {}", title, author);
+        return Map(plg_context, process, kernel);
+    }
+
     FileUtil::IOFile file(plg_context.plugin_path, "rb");
     if (!file.IsOpen()) {
         LOG_ERROR(Service_PLGLDR, "Failed to load 3GX plugin. Not found: {}",
@@ -146,18 +179,37 @@ Loader::ResultStatus FileSys::Plugin3GXLoader::Load(
                sizeof(_3gx_Infos::builtin_load_exe_args));
     }
 
-    // Load code sections
-    if (!ReadSection(text_section, file, header.executable.code_offset,
-                     header.executable.code_size) ||
-        !ReadSection(rodata_section, file, header.executable.rodata_offset,
-                     header.executable.rodata_size) ||
-        !ReadSection(data_section, file, header.executable.data_offset,
-                     header.executable.data_size)) {
-        LOG_ERROR(Service_PLGLDR, "Failed to load 3GX plugin. File corrupted: {}",
-                  plg_context.plugin_path);
-        return Loader::ResultStatus::Error;
+    // Load code sections, concatenated in executable layout order so that mapping can copy
+    // them into guest memory in one go
+    exe_sections.clear();
+    exe_sections.reserve(header.executable.code_size + header.executable.rodata_size +
+                         header.executable.data_size);
+    std::vector<u8> section;
+    for (const auto& [offset, size] :
+         {std::pair<u32, u32>{header.executable.code_offset, header.executable.code_size},
+          {header.executable.rodata_offset, header.executable.rodata_size},
+          {header.executable.data_offset, header.executable.data_size}}) {
+        if (!ReadSection(section, file, offset, size)) {
+            LOG_ERROR(Service_PLGLDR, "Failed to load 3GX plugin. File corrupted: {}",
+                      plg_context.plugin_path);
+            return Loader::ResultStatus::Error;
+        }
+        exe_sections.insert(exe_sections.end(), section.begin(), section.end());
     }
 
+    CachedPlugin& cached = plugin_cache[plg_context.plugin_path];
+    cached.file_size = file_size;
+    cached.modification_time = modification_time;
+    cached.header = header;
+    cached.author = author;
+    cached.title = title;
+    cached.summary = summary;
+    cached.description = description;
+    cached.compatible_TID = compatible_TID;
+    cached.exe_sections = exe_sections;
+    cached.exe_load_func = exe_load_func;
+    std::copy(std::begin(exe_load_args), std::end(exe_load_args), cached.exe_load_args.begin());
+
     return Map(plg_context, process, kernel);
 }
 
@@ -182,9 +234,9 @@ Loader::ResultStatus FileSys::Plugin3GXLoader::Map(
     // Map memory block. This behaviour mimics how plugins are loaded on 3DS as much as possible.
     // Calculate the sizes of the different memory regions
     const u32 block_size = mem_region_sizes[header.infos.flags.memory_region_size.Value()];
-    const u32 exe_size = (sizeof(PluginHeader) + text_section.size() + rodata_section.size() +
-                          data_section.size() + header.executable.bss_size + 0x1000) &
-                         ~0xFFF;
+    const u32 exe_size =
+        (sizeof(PluginHeader) + exe_sections.size() + header.executable.bss_size + 0x1000) &
+        ~0xFFF;
 
     // Allocate the framebuffer block so that is in the highest FCRAM position possible
     auto offset_fb =
@@ -221,18 +273,9 @@ Loader::ResultStatus FileSys::Plugin3GXLoader::Map(
     ASSERT(vma.Succeeded());
     process.vm_manager.Reprotect(vma.Unwrap(), Kernel::VMAPermission::ReadWriteExecute);
 
-    // Write text section
+    // Write the text, rodata and data sections in a single copy
     kernel.memory.WriteBlock(process, _3GX_exe_load_addr + sizeof(PluginHeader),
-                             text_section.data(), header.executable.code_size);
-    // Write rodata section
-    kernel.memory.WriteBlock(
-        process, _3GX_exe_load_addr + sizeof(PluginHeader) + header.executable.code_size,
-        rodata_section.data(), header.executable.rodata_size);
-    // Write data section
-    kernel.memory.WriteBlock(process,
-                             _3GX_exe_load_addr + sizeof(PluginHeader) +
-                                 header.executable.code_size + header.executable.rodata_size,
-                             data_section.data(), header.executable.data_size);
+                             exe_sections.data(), exe_sections.size());
     // Prepare plugin header and write it
     PluginHeader plugin_header = {0};
     plugin_header.version = header.version;
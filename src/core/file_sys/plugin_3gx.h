@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <array>
+#include <unordered_map>
 #include <core/file_sys/archive_backend.h>
 #include "common/common_types.h"
 #include "common/swap.h"
@@ -139,11 +141,29 @@ private:
     std::string description;
 
     std::vector<u32> compatible_TID;
-    std::vector<u8> text_section;
-    std::vector<u8> data_section;
-    std::vector<u8> rodata_section;
+    /// Text, rodata and data sections concatenated in executable layout order, so that mapping
+    /// copies them into guest memory in a single block write.
+    std::vector<u8> exe_sections;
 
     std::vector<u32> exe_load_func;
     u32_le exe_load_args[4];
+
+    /// A fully parsed plugin image, cached so that rebooting a modded title does not re-read
+    /// and re-parse the 3GX file. Entries are revalidated against the file size and
+    /// modification time.
+    struct CachedPlugin {
+        u64 file_size;
+        u64 modification_time;
+        _3gx_Header header;
+        std::string author;
+        std::string title;
+        std::string summary;
+        std::string description;
+        std::vector<u32> compatible_TID;
+        std::vector<u8> exe_sections;
+        std::vector<u32> exe_load_func;
+        std::array<u32_le, 4> exe_load_args;
+    };
+    static std::unordered_map<std::string, CachedPlugin> plugin_cache;
 };
 } // namespace FileSys
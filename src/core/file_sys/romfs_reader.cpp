@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cstring>
 #include <cryptopp/aes.h>
 #include <cryptopp/modes.h>
 #include "common/archives.h"
@@ -8,18 +9,143 @@ SERIALIZE_EXPORT_IMPL(FileSys::DirectRomFSReader)
 
 namespace FileSys {
 
+struct DirectRomFSReader::CipherContext {
+    CipherContext(const std::array<u8, 16>& key, const std::array<u8, 16>& ctr)
+        : aes(key.data(), key.size(), ctr.data()) {}
+
+    CryptoPP::CTR_Mode<CryptoPP::AES>::Decryption aes;
+};
+
+DirectRomFSReader::DirectRomFSReader(FileUtil::IOFile&& file, std::size_t file_offset,
+                                     std::size_t data_size)
+    : is_encrypted(false), file(std::move(file)), file_offset(file_offset), data_size(data_size) {}
+
+DirectRomFSReader::DirectRomFSReader(FileUtil::IOFile&& file, std::size_t file_offset,
+                                     std::size_t data_size, const std::array<u8, 16>& key,
+                                     const std::array<u8, 16>& ctr, std::size_t crypto_offset)
+    : is_encrypted(true), file(std::move(file)), key(key), ctr(ctr), file_offset(file_offset),
+      crypto_offset(crypto_offset), data_size(data_size) {}
+
+DirectRomFSReader::~DirectRomFSReader() = default;
+
 std::size_t DirectRomFSReader::ReadFile(std::size_t offset, std::size_t length, u8* buffer) {
-    if (length == 0)
-        return 0; // Crypto++ does not like zero size buffer
-    file.Seek(file_offset + offset, SEEK_SET);
-    std::size_t read_length = std::min(length, static_cast<std::size_t>(data_size) - offset);
-    read_length = file.ReadBytes(buffer, read_length);
-    if (is_encrypted) {
-        CryptoPP::CTR_Mode<CryptoPP::AES>::Decryption d(key.data(), key.size(), ctr.data());
-        d.Seek(crypto_offset + offset);
-        d.ProcessData(buffer, buffer, read_length);
-    }
-    return read_length;
+    if (length == 0 || offset >= data_size)
+        return 0;
+    length = std::min(length, static_cast<std::size_t>(data_size) - offset);
+
+    std::lock_guard cache_lock{cache_mutex};
+    std::size_t remaining = length;
+    while (remaining > 0) {
+        const u64 block_index = offset / CACHE_BLOCK_SIZE;
+        const std::size_t block_offset = offset % CACHE_BLOCK_SIZE;
+        const CacheBlock& block = GetBlock(block_index);
+        if (block_offset >= block.data.size()) {
+            // Short read from the backing file
+            break;
+        }
+        const std::size_t copy_size = std::min(remaining, block.data.size() - block_offset);
+        std::memcpy(buffer, block.data.data() + block_offset, copy_size);
+        buffer += copy_size;
+        offset += copy_size;
+        remaining -= copy_size;
+    }
+    return length - remaining;
+}
+
+const DirectRomFSReader::CacheBlock& DirectRomFSReader::GetBlock(u64 block_index) {
+    ++cache_age;
+    for (CacheBlock& block : cache) {
+        if (block.block_index == block_index) {
+            block.age = cache_age;
+            return block;
+        }
+    }
+
+    // Miss: fetch the block together with the following ones in a single read, so that the
+    // sequential reads loaders produce hit the cache instead of issuing one read each
+    const std::vector<u8> staging = FetchBlocks(block_index, main_cipher);
+    CacheBlock* result = InsertBlocks(block_index, staging);
+    // Predict that the reader will keep going and decrypt the next group in the background
+    SchedulePrefetch(block_index + READAHEAD_BLOCKS);
+    return *result;
+}
+
+std::vector<u8> DirectRomFSReader::FetchBlocks(u64 block_index,
+                                               std::unique_ptr<CipherContext>& cipher) {
+    const u64 start = block_index * CACHE_BLOCK_SIZE;
+    const std::size_t fetch_size = static_cast<std::size_t>(
+        std::min<u64>(READAHEAD_BLOCKS * CACHE_BLOCK_SIZE, data_size - start));
+    std::vector<u8> staging(fetch_size);
+    {
+        std::lock_guard file_lock{file_mutex};
+        file.Seek(file_offset + start, SEEK_SET);
+        staging.resize(file.ReadBytes(staging.data(), fetch_size));
+    }
+    if (is_encrypted && !staging.empty()) {
+        if (!cipher) {
+            cipher = std::make_unique<CipherContext>(key, ctr);
+        }
+        // Repositioning the counter reuses the expanded key schedule, unlike constructing a
+        // fresh cipher for every fetch
+        cipher->aes.Resynchronize(ctr.data(), static_cast<int>(ctr.size()));
+        cipher->aes.Seek(crypto_offset + start);
+        cipher->aes.ProcessData(staging.data(), staging.data(), staging.size());
+    }
+    return staging;
+}
+
+DirectRomFSReader::CacheBlock* DirectRomFSReader::InsertBlocks(u64 block_index,
+                                                               const std::vector<u8>& staging) {
+    const std::size_t num_blocks =
+        std::max<std::size_t>(1, (staging.size() + CACHE_BLOCK_SIZE - 1) / CACHE_BLOCK_SIZE);
+    CacheBlock* result = nullptr;
+    for (std::size_t i = 0; i < num_blocks; ++i) {
+        CacheBlock& slot = FindSlot(block_index + i);
+        slot.block_index = block_index + i;
+        slot.age = cache_age;
+        const auto begin = staging.begin() + i * CACHE_BLOCK_SIZE;
+        const auto end = staging.begin() + std::min(staging.size(), (i + 1) * CACHE_BLOCK_SIZE);
+        slot.data.assign(begin, end);
+        if (i == 0) {
+            result = &slot;
+        }
+    }
+    return result;
+}
+
+void DirectRomFSReader::SchedulePrefetch(u64 block_index) {
+    if (block_index * CACHE_BLOCK_SIZE >= data_size || pending_prefetch == block_index) {
+        return;
+    }
+    for (const CacheBlock& block : cache) {
+        if (block.block_index == block_index) {
+            return;
+        }
+    }
+    if (!prefetch_worker) {
+        prefetch_worker = std::make_unique<Common::ThreadWorker>(1, "RomFSPrefetch");
+    }
+    pending_prefetch = block_index;
+    prefetch_worker->QueueWork([this, block_index] {
+        const std::vector<u8> staging = FetchBlocks(block_index, prefetch_cipher);
+        std::lock_guard cache_lock{cache_mutex};
+        ++cache_age;
+        InsertBlocks(block_index, staging);
+        pending_prefetch = INVALID_BLOCK;
+    });
+}
+
+DirectRomFSReader::CacheBlock& DirectRomFSReader::FindSlot(u64 block_index) {
+    CacheBlock* lru = &cache[0];
+    for (CacheBlock& block : cache) {
+        if (block.block_index == block_index) {
+            return block;
+        }
+        if (block.age < lru->age) {
+            lru = &block;
+        }
+    }
+    return *lru;
 }
 
 } // namespace FileSys
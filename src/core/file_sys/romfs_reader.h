@@ -1,11 +1,16 @@
 #pragma once
 
 #include <array>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/export.hpp>
 #include "common/common_types.h"
 #include "common/file_util.h"
+#include "common/thread_worker.h"
 
 namespace FileSys {
 
@@ -30,17 +35,14 @@ private:
  */
 class DirectRomFSReader : public RomFSReader {
 public:
-    DirectRomFSReader(FileUtil::IOFile&& file, std::size_t file_offset, std::size_t data_size)
-        : is_encrypted(false), file(std::move(file)), file_offset(file_offset),
-          data_size(data_size) {}
+    // Defined in the .cpp together with the destructor, where CipherContext is complete.
+    DirectRomFSReader(FileUtil::IOFile&& file, std::size_t file_offset, std::size_t data_size);
 
     DirectRomFSReader(FileUtil::IOFile&& file, std::size_t file_offset, std::size_t data_size,
                       const std::array<u8, 16>& key, const std::array<u8, 16>& ctr,
-                      std::size_t crypto_offset)
-        : is_encrypted(true), file(std::move(file)), key(key), ctr(ctr), file_offset(file_offset),
-          crypto_offset(crypto_offset), data_size(data_size) {}
+                      std::size_t crypto_offset);
 
-    ~DirectRomFSReader() override = default;
+    ~DirectRomFSReader() override;
 
     std::size_t GetSize() const override {
         return data_size;
@@ -49,6 +51,42 @@ public:
     std::size_t ReadFile(std::size_t offset, std::size_t length, u8* buffer) override;
 
 private:
+    /// Granularity of reads against the backing file. Reads are aligned to this block size,
+    /// so many small sequential reads collapse into a few large ones.
+    static constexpr std::size_t CACHE_BLOCK_SIZE = 64 * 1024;
+    /// Number of recently used blocks kept decrypted in memory.
+    static constexpr std::size_t CACHE_BLOCKS = 16;
+    /// Number of consecutive blocks fetched per backing-file read, as readahead for the
+    /// sequential access patterns loaders produce.
+    static constexpr std::size_t READAHEAD_BLOCKS = 4;
+    static constexpr u64 INVALID_BLOCK = std::numeric_limits<u64>::max();
+
+    /// A cached (and, for encrypted titles, already decrypted) block of RomFS data.
+    struct CacheBlock {
+        u64 block_index = INVALID_BLOCK;
+        u64 age = 0;
+        std::vector<u8> data;
+    };
+
+    /// Returns the cached block with the given index, fetching it (plus readahead) on a miss.
+    /// Must be called with cache_mutex held.
+    const CacheBlock& GetBlock(u64 block_index);
+    /// Returns the slot already holding block_index, or the least recently used one.
+    CacheBlock& FindSlot(u64 block_index);
+    /// Holds an AES-CTR cipher with its key schedule expanded once, instead of re-expanding
+    /// it on every block fetch. Defined in the .cpp to keep CryptoPP out of this header.
+    struct CipherContext;
+
+    /// Reads and decrypts a group of up to READAHEAD_BLOCKS blocks from the backing file,
+    /// using (and lazily creating) the given cipher context.
+    std::vector<u8> FetchBlocks(u64 block_index, std::unique_ptr<CipherContext>& cipher);
+    /// Distributes fetched data into cache slots; returns the slot of the first block.
+    /// Must be called with cache_mutex held.
+    CacheBlock* InsertBlocks(u64 block_index, const std::vector<u8>& staging);
+    /// Queues a background fetch of the given block group unless it is already cached or
+    /// in flight. Must be called with cache_mutex held.
+    void SchedulePrefetch(u64 block_index);
+
     bool is_encrypted;
     FileUtil::IOFile file;
     std::array<u8, 16> key;
@@ -57,6 +95,26 @@ private:
     u64 crypto_offset;
     u64 data_size;
 
+    // The block cache is transient and deliberately not serialized; it is refilled on demand
+    // after a savestate load.
+    std::array<CacheBlock, CACHE_BLOCKS> cache;
+    u64 cache_age = 0;
+    u64 pending_prefetch = INVALID_BLOCK;
+
+    /// Cipher contexts for the caller thread (used with cache_mutex held) and the prefetch
+    /// worker respectively, so the two never share one and need no extra locking.
+    std::unique_ptr<CipherContext> main_cipher;
+    std::unique_ptr<CipherContext> prefetch_cipher;
+
+    /// Serializes access to `file`. The prefetch worker always releases it before taking
+    /// cache_mutex, so the two locks cannot form a cycle.
+    std::mutex file_mutex;
+    /// Protects the cache slots, cache_age and pending_prefetch.
+    std::mutex cache_mutex;
+    /// Created lazily on the first cache miss. Declared last so it is destroyed (and its
+    /// queued work joined) before the file and mutexes it uses.
+    std::unique_ptr<Common::ThreadWorker> prefetch_worker;
+
     DirectRomFSReader() = default;
 
     template <class Archive>
@@ -2,8 +2,13 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
 #include "common/archives.h"
 #include "common/file_util.h"
+#include "common/thread_worker.h"
 #include "core/file_sys/disk_archive.h"
 #include "core/file_sys/errors.h"
 #include "core/file_sys/path_parser.h"
@@ -38,6 +43,113 @@ public:
     SERIALIZE_DELAY_GENERATOR
 };
 
+/**
+ * A DiskFile that completes guest writes immediately and applies them to the host file from a
+ * background thread, so titles that save continuously do not stall on slow SD or network
+ * storage. Reads, resizes, guest-requested flushes, Close() and savestates drain the pending
+ * writes first, so every ordering point the guest can observe behaves exactly like the
+ * synchronous path.
+ */
+class WriteBackDiskFile : public DiskFile {
+public:
+    WriteBackDiskFile(FileUtil::IOFile&& file_, const Mode& mode_,
+                      std::unique_ptr<DelayGenerator> delay_generator_)
+        : DiskFile(std::move(file_), mode_, std::move(delay_generator_)) {}
+
+    ~WriteBackDiskFile() override {
+        DrainWrites();
+    }
+
+    ResultVal<std::size_t> Read(u64 offset, std::size_t length, u8* buffer) const override {
+        DrainWrites();
+        return DiskFile::Read(offset, length, buffer);
+    }
+
+    ResultVal<std::size_t> Write(u64 offset, std::size_t length, bool flush,
+                                 const u8* buffer) override {
+        if (!mode.write_flag)
+            return ERROR_INVALID_OPEN_FLAGS;
+
+        if (!worker) {
+            worker = std::make_unique<Common::ThreadWorker>(1, "SaveDataWriter");
+        }
+        {
+            std::lock_guard lock{pending_mutex};
+            ++pending_writes;
+        }
+        worker->QueueWork([this, offset, data = std::vector<u8>(buffer, buffer + length)] {
+            file->Seek(offset, SEEK_SET);
+            file->WriteBytes(data.data(), data.size());
+            std::lock_guard lock{pending_mutex};
+            if (--pending_writes == 0) {
+                pending_cv.notify_all();
+            }
+        });
+        if (flush) {
+            // The guest asked for durability; wait for the backlog before flushing
+            DrainWrites();
+            file->Flush();
+        }
+        return MakeResult<std::size_t>(length);
+    }
+
+    u64 GetSize() const override {
+        DrainWrites();
+        return DiskFile::GetSize();
+    }
+
+    bool SetSize(u64 size) const override {
+        DrainWrites();
+        return DiskFile::SetSize(size);
+    }
+
+    bool Close() const override {
+        DrainWrites();
+        return DiskFile::Close();
+    }
+
+    void Flush() const override {
+        DrainWrites();
+        DiskFile::Flush();
+    }
+
+private:
+    /// Blocks until the background thread has applied every queued write, logging how long the
+    /// drain took so slow backing storage can be diagnosed.
+    void DrainWrites() const {
+        std::unique_lock lock{pending_mutex};
+        if (pending_writes == 0) {
+            return;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        const std::size_t backlog = pending_writes;
+        pending_cv.wait(lock, [this] { return pending_writes == 0; });
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        LOG_DEBUG(Service_FS, "Drained {} pending save writes in {} us", backlog,
+                  elapsed.count());
+    }
+
+    mutable std::mutex pending_mutex;
+    mutable std::condition_variable pending_cv;
+    std::size_t pending_writes = 0;
+    /// Created on the first write. The destructor drains before the members are torn down, so
+    /// no queued work outlives the file handle.
+    std::unique_ptr<Common::ThreadWorker> worker;
+
+    WriteBackDiskFile() = default;
+
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int) {
+        // Savestates must capture the settled file contents
+        if (Archive::is_saving::value) {
+            DrainWrites();
+        }
+        ar& boost::serialization::base_object<DiskFile>(*this);
+    }
+    friend class boost::serialization::access;
+};
+
 ResultVal<std::unique_ptr<FileBackend>> SaveDataArchive::OpenFile(const Path& path,
                                                                   const Mode& mode) const {
     LOG_DEBUG(Service_FS, "called path={} mode={:01X}", path.DebugStr(), mode.hex);
@@ -61,7 +173,7 @@ ResultVal<std::unique_ptr<FileBackend>> SaveDataArchive::OpenFile(const Path& pa
 
     const auto full_path = path_parser.BuildHostPath(mount_point);
 
-    switch (path_parser.GetHostStatus(mount_point)) {
+    switch (path_status_cache.GetHostStatus(path_parser, mount_point)) {
     case PathParser::InvalidMountPoint:
         LOG_CRITICAL(Service_FS, "(unreachable) Invalid mount point {}", mount_point);
         return ERROR_FILE_NOT_FOUND;
@@ -80,6 +192,7 @@ ResultVal<std::unique_ptr<FileBackend>> SaveDataArchive::OpenFile(const Path& pa
         } else {
             // Create the file
             FileUtil::CreateEmptyFile(full_path);
+            path_status_cache.InvalidatePath(path_parser, mount_point);
         }
         break;
     case PathParser::FileFound:
@@ -93,7 +206,8 @@ ResultVal<std::unique_ptr<FileBackend>> SaveDataArchive::OpenFile(const Path& pa
     }
 
     std::unique_ptr<DelayGenerator> delay_generator = std::make_unique<SaveDataDelayGenerator>();
-    auto disk_file = std::make_unique<DiskFile>(std::move(file), mode, std::move(delay_generator));
+    auto disk_file =
+        std::make_unique<WriteBackDiskFile>(std::move(file), mode, std::move(delay_generator));
     return MakeResult<std::unique_ptr<FileBackend>>(std::move(disk_file));
 }
 
@@ -107,7 +221,7 @@ ResultCode SaveDataArchive::DeleteFile(const Path& path) const {
 
     const auto full_path = path_parser.BuildHostPath(mount_point);
 
-    switch (path_parser.GetHostStatus(mount_point)) {
+    switch (path_status_cache.GetHostStatus(path_parser, mount_point)) {
     case PathParser::InvalidMountPoint:
         LOG_CRITICAL(Service_FS, "(unreachable) Invalid mount point {}", mount_point);
         return ERROR_FILE_NOT_FOUND;
@@ -124,6 +238,7 @@ ResultCode SaveDataArchive::DeleteFile(const Path& path) const {
     }
 
     if (FileUtil::Delete(full_path)) {
+        path_status_cache.InvalidatePath(path_parser, mount_point);
         return RESULT_SUCCESS;
     }
 
@@ -151,6 +266,8 @@ ResultCode SaveDataArchive::RenameFile(const Path& src_path, const Path& dest_pa
     const auto dest_path_full = path_parser_dest.BuildHostPath(mount_point);
 
     if (FileUtil::Rename(src_path_full, dest_path_full)) {
+        path_status_cache.InvalidatePath(path_parser_src, mount_point);
+        path_status_cache.InvalidatePath(path_parser_dest, mount_point);
         return RESULT_SUCCESS;
     }
 
@@ -162,7 +279,7 @@ ResultCode SaveDataArchive::RenameFile(const Path& src_path, const Path& dest_pa
 
 template <typename T>
 static ResultCode DeleteDirectoryHelper(const Path& path, const std::string& mount_point,
-                                        T deleter) {
+                                        PathStatusCache& path_status_cache, T deleter) {
     const PathParser path_parser(path);
 
     if (!path_parser.IsValid()) {
@@ -175,7 +292,7 @@ static ResultCode DeleteDirectoryHelper(const Path& path, const std::string& mou
 
     const auto full_path = path_parser.BuildHostPath(mount_point);
 
-    switch (path_parser.GetHostStatus(mount_point)) {
+    switch (path_status_cache.GetHostStatus(path_parser, mount_point)) {
     case PathParser::InvalidMountPoint:
         LOG_CRITICAL(Service_FS, "(unreachable) Invalid mount point {}", mount_point);
         return ERROR_PATH_NOT_FOUND;
@@ -192,6 +309,8 @@ static ResultCode DeleteDirectoryHelper(const Path& path, const std::string& mou
     }
 
     if (deleter(full_path)) {
+        // Anything below the deleted directory may have changed status
+        path_status_cache.InvalidateAll();
         return RESULT_SUCCESS;
     }
 
@@ -200,12 +319,13 @@ static ResultCode DeleteDirectoryHelper(const Path& path, const std::string& mou
 }
 
 ResultCode SaveDataArchive::DeleteDirectory(const Path& path) const {
-    return DeleteDirectoryHelper(path, mount_point, FileUtil::DeleteDir);
+    return DeleteDirectoryHelper(path, mount_point, path_status_cache, FileUtil::DeleteDir);
 }
 
 ResultCode SaveDataArchive::DeleteDirectoryRecursively(const Path& path) const {
-    return DeleteDirectoryHelper(
-        path, mount_point, [](const std::string& p) { return FileUtil::DeleteDirRecursively(p); });
+    return DeleteDirectoryHelper(path, mount_point, path_status_cache, [](const std::string& p) {
+        return FileUtil::DeleteDirRecursively(p);
+    });
 }
 
 ResultCode SaveDataArchive::CreateFile(const FileSys::Path& path, u64 size) const {
@@ -218,7 +338,7 @@ ResultCode SaveDataArchive::CreateFile(const FileSys::Path& path, u64 size) cons
 
     const auto full_path = path_parser.BuildHostPath(mount_point);
 
-    switch (path_parser.GetHostStatus(mount_point)) {
+    switch (path_status_cache.GetHostStatus(path_parser, mount_point)) {
     case PathParser::InvalidMountPoint:
         LOG_CRITICAL(Service_FS, "(unreachable) Invalid mount point {}", mount_point);
         return ERROR_FILE_NOT_FOUND;
@@ -238,6 +358,7 @@ ResultCode SaveDataArchive::CreateFile(const FileSys::Path& path, u64 size) cons
 
     if (size == 0) {
         FileUtil::CreateEmptyFile(full_path);
+        path_status_cache.InvalidatePath(path_parser, mount_point);
         return RESULT_SUCCESS;
     }
 
@@ -245,6 +366,7 @@ ResultCode SaveDataArchive::CreateFile(const FileSys::Path& path, u64 size) cons
     // Creates a sparse file (or a normal file on filesystems without the concept of sparse files)
     // We do this by seeking to the right size, then writing a single null byte.
     if (file.Seek(size - 1, SEEK_SET) && file.WriteBytes("", 1) == 1) {
+        path_status_cache.InvalidatePath(path_parser, mount_point);
         return RESULT_SUCCESS;
     }
 
@@ -263,7 +385,7 @@ ResultCode SaveDataArchive::CreateDirectory(const Path& path) const {
 
     const auto full_path = path_parser.BuildHostPath(mount_point);
 
-    switch (path_parser.GetHostStatus(mount_point)) {
+    switch (path_status_cache.GetHostStatus(path_parser, mount_point)) {
     case PathParser::InvalidMountPoint:
         LOG_CRITICAL(Service_FS, "(unreachable) Invalid mount point {}", mount_point);
         return ERROR_FILE_NOT_FOUND;
@@ -282,6 +404,8 @@ ResultCode SaveDataArchive::CreateDirectory(const Path& path) const {
     }
 
     if (FileUtil::CreateDir(mount_point + path.AsString())) {
+        // Cached PathNotFound entries below the new directory are now stale
+        path_status_cache.InvalidateAll();
         return RESULT_SUCCESS;
     }
 
@@ -330,7 +454,7 @@ ResultVal<std::unique_ptr<DirectoryBackend>> SaveDataArchive::OpenDirectory(
 
     const auto full_path = path_parser.BuildHostPath(mount_point);
 
-    switch (path_parser.GetHostStatus(mount_point)) {
+    switch (path_status_cache.GetHostStatus(path_parser, mount_point)) {
     case PathParser::InvalidMountPoint:
         LOG_CRITICAL(Service_FS, "(unreachable) Invalid mount point {}", mount_point);
         return ERROR_FILE_NOT_FOUND;
@@ -359,3 +483,4 @@ u64 SaveDataArchive::GetFreeBytes() const {
 
 SERIALIZE_EXPORT_IMPL(FileSys::SaveDataArchive)
 SERIALIZE_EXPORT_IMPL(FileSys::SaveDataDelayGenerator)
+SERIALIZE_EXPORT_IMPL(FileSys::WriteBackDiskFile)
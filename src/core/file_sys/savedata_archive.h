@@ -8,6 +8,7 @@
 #include "core/file_sys/archive_backend.h"
 #include "core/file_sys/directory_backend.h"
 #include "core/file_sys/file_backend.h"
+#include "core/file_sys/path_parser.h"
 #include "core/hle/result.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +39,9 @@ public:
 
 protected:
     std::string mount_point;
+    /// Caches host path lookups so repeated probes for missing files do not re-stat the host
+    /// file system. Transient; every write path below invalidates the affected entries.
+    mutable PathStatusCache path_status_cache;
     SaveDataArchive() = default;
 
 private:
@@ -50,10 +54,12 @@ private:
 };
 
 class SaveDataDelayGenerator;
+class WriteBackDiskFile;
 class ExtSaveDataArchive;
 
 } // namespace FileSys
 
 BOOST_CLASS_EXPORT_KEY(FileSys::SaveDataArchive)
 BOOST_CLASS_EXPORT_KEY(FileSys::SaveDataDelayGenerator)
+BOOST_CLASS_EXPORT_KEY(FileSys::WriteBackDiskFile)
 BOOST_CLASS_EXPORT_KEY(FileSys::ExtSaveDataArchive)
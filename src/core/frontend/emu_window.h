@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -62,6 +63,10 @@ public:
      * returns nullptr
      */
     virtual Frontend::Frame* TryGetPresentFrame(int timeout_ms) = 0;
+
+    /// Number of rendered frames that were discarded before presentation. The renderer
+    /// periodically drains this counter into the performance statistics.
+    std::atomic<u32> dropped_frames{};
 };
 
 /**
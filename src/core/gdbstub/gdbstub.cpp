@@ -6,12 +6,14 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <csignal>
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
 #include <map>
 #include <numeric>
+#include <thread>
 #include <fcntl.h>
 #include <fmt/format.h>
 
@@ -31,6 +33,7 @@
 #endif
 
 #include "common/logging/log.h"
+#include "common/thread.h"
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
 #include "core/gdbstub/gdbstub.h"
@@ -158,8 +161,24 @@ using BreakpointMap = std::map<VAddr, Breakpoint>;
 BreakpointMap breakpoints_execute;
 BreakpointMap breakpoints_read;
 BreakpointMap breakpoints_write;
+
+// Tracks whether any breakpoint map is non-empty, so the watchpoint checks on the memory
+// hot path reduce to a single relaxed load while no breakpoints are set (the common case
+// when the stub is merely left attached).
+std::atomic<bool> any_breakpoints(false);
+
+// Reader thread that blocks in select() on behalf of the CPU loop, so an attached but idle
+// client no longer costs one select() syscall per RunLoop iteration.
+std::thread packet_reader_thread;
+std::atomic<bool> packet_reader_running(false);
+std::atomic<bool> packet_available(false);
 } // Anonymous namespace
 
+static void UpdateBreakpointFlag() {
+    any_breakpoints = !breakpoints_execute.empty() || !breakpoints_read.empty() ||
+                      !breakpoints_write.empty();
+}
+
 static Kernel::Thread* FindThreadById(int id) {
     u32 num_cores = Core::GetNumCores();
     for (u32 i = 0; i < num_cores; ++i) {
@@ -419,9 +438,14 @@ static void RemoveBreakpoint(BreakpointType type, VAddr addr) {
         }
     }
     p.erase(addr);
+    UpdateBreakpointFlag();
 }
 
 BreakpointAddress GetNextBreakpointFromAddress(VAddr addr, BreakpointType type) {
+    if (!any_breakpoints.load(std::memory_order_relaxed)) {
+        return {0, BreakpointType::None};
+    }
+
     const BreakpointMap& p = GetBreakpointMap(type);
     const auto next_breakpoint = p.lower_bound(addr);
     BreakpointAddress breakpoint;
@@ -438,6 +462,10 @@ BreakpointAddress GetNextBreakpointFromAddress(VAddr addr, BreakpointType type)
 }
 
 bool CheckBreakpoint(VAddr addr, BreakpointType type) {
+    if (!any_breakpoints.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
     if (!IsConnected()) {
         return false;
     }
@@ -708,6 +736,38 @@ static bool IsDataAvailable() {
     return FD_ISSET(gdbserver_socket, &fd_socket) != 0;
 }
 
+/// Block in select() on behalf of the CPU loop and flag when a packet is waiting.
+static void PacketReaderLoop() {
+    Common::SetCurrentThreadName("GDBStub reader");
+
+    while (packet_reader_running) {
+        if (packet_available) {
+            // Wait for the CPU loop to consume the previous notification; data left in the
+            // socket keeps select() returning immediately once the flag is cleared.
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        const int fd = gdbserver_socket;
+        if (fd < 0) {
+            break;
+        }
+
+        fd_set fd_socket;
+        FD_ZERO(&fd_socket);
+        FD_SET(static_cast<u32>(fd), &fd_socket);
+
+        // Time out periodically so shutdown requests are noticed.
+        struct timeval t;
+        t.tv_sec = 0;
+        t.tv_usec = 100 * 1000;
+
+        if (select(fd + 1, &fd_socket, nullptr, nullptr, &t) > 0 && FD_ISSET(fd, &fd_socket)) {
+            packet_available = true;
+        }
+    }
+}
+
 /// Send requested register to gdb client.
 static void ReadRegister() {
     static u8 reply[64];
@@ -940,6 +1000,7 @@ static bool CommitBreakpoint(BreakpointType type, VAddr addr, u32 len) {
         Core::GetRunningCore().ClearInstructionCache();
     }
     p.insert({addr, breakpoint});
+    UpdateBreakpointFlag();
 
     LOG_DEBUG(Debug_GDBStub, "gdb: added {} breakpoint: {:08x} bytes at {:08x}\n", type,
               breakpoint.len, breakpoint.addr);
@@ -1048,6 +1109,15 @@ void HandlePacket() {
         return;
     }
 
+    // While running normally, only touch the socket once the reader thread has seen data;
+    // an attached but idle client then costs a single relaxed load per iteration. While
+    // halted we poll directly so stepping latency is unchanged.
+    if (!halt_loop && packet_reader_running) {
+        if (!packet_available.exchange(false)) {
+            return;
+        }
+    }
+
     if (!IsDataAvailable()) {
         return;
     }
@@ -1160,6 +1230,7 @@ static void Init(u16 port) {
     breakpoints_execute.clear();
     breakpoints_read.clear();
     breakpoints_write.clear();
+    UpdateBreakpointFlag();
 
     // Start gdb server
     LOG_INFO(Debug_GDBStub, "Starting GDB server on port {}...", port);
@@ -1211,6 +1282,10 @@ static void Init(u16 port) {
     } else {
         LOG_INFO(Debug_GDBStub, "Client connected.\n");
         saddr_client.sin_addr.s_addr = ntohl(saddr_client.sin_addr.s_addr);
+
+        packet_available = false;
+        packet_reader_running = true;
+        packet_reader_thread = std::thread(PacketReaderLoop);
     }
 
     // Clean up temporary socket if it's still alive at this point.
@@ -1230,10 +1305,14 @@ void Shutdown() {
     defer_start = false;
 
     LOG_INFO(Debug_GDBStub, "Stopping GDB ...");
+    packet_reader_running = false;
     if (gdbserver_socket != -1) {
         shutdown(gdbserver_socket, SHUT_RDWR);
         gdbserver_socket = -1;
     }
+    if (packet_reader_thread.joinable()) {
+        packet_reader_thread.join();
+    }
 
 #ifdef _WIN32
     WSACleanup();
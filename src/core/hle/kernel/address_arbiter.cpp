@@ -40,7 +40,7 @@ void AddressArbiter::ResumeAllThreads(VAddr address) {
     waiting_threads.erase(itr, waiting_threads.end());
 }
 
-std::shared_ptr<Thread> AddressArbiter::ResumeHighestPriorityThread(VAddr address) {
+void AddressArbiter::ResumeHighestPriorityThreads(VAddr address, s32 count) {
     // Determine which threads are waiting on this address, those should be considered for wakeup.
     auto matches_start = std::stable_partition(
         waiting_threads.begin(), waiting_threads.end(), [address](const auto& thread) {
@@ -49,22 +49,21 @@ std::shared_ptr<Thread> AddressArbiter::ResumeHighestPriorityThread(VAddr addres
             return thread->wait_address != address;
         });
 
-    // Iterate through threads, find highest priority thread that is waiting to be arbitrated.
-    // Note: The real kernel will pick the first thread in the list if more than one have the
-    // same highest priority value. Lower priority values mean higher priority.
-    auto itr = std::min_element(matches_start, waiting_threads.end(),
-                                [](const auto& lhs, const auto& rhs) {
-                                    return lhs->current_priority < rhs->current_priority;
-                                });
+    // Order the matches by priority once and wake the first `count` of them in a single pass,
+    // instead of rescanning the whole wait list per woken thread. The real kernel picks the
+    // first thread in the list among equal priorities, which the stable sort preserves.
+    std::stable_sort(matches_start, waiting_threads.end(),
+                     [](const auto& lhs, const auto& rhs) {
+                         return lhs->current_priority < rhs->current_priority;
+                     });
 
-    if (itr == waiting_threads.end())
-        return nullptr;
+    const auto num_matches = static_cast<std::size_t>(waiting_threads.end() - matches_start);
+    const auto wake_end =
+        matches_start + std::min(static_cast<std::size_t>(std::max(count, 0)), num_matches);
+    std::for_each(matches_start, wake_end, [](auto& thread) { thread->ResumeFromWait(); });
 
-    auto thread = *itr;
-    thread->ResumeFromWait();
-
-    waiting_threads.erase(itr);
-    return thread;
+    // Remove the woken up threads from the wait list.
+    waiting_threads.erase(matches_start, wake_end);
 }
 
 AddressArbiter::AddressArbiter(KernelSystem& kernel)
@@ -115,9 +114,8 @@ ResultCode AddressArbiter::ArbitrateAddress(std::shared_ptr<Thread> thread, Arbi
         if (value < 0) {
             ResumeAllThreads(address);
         } else {
-            // Resume first N threads
-            for (int i = 0; i < value; i++)
-                ResumeHighestPriorityThread(address);
+            // Resume the N highest-priority threads in one batch
+            ResumeHighestPriorityThreads(address, value);
         }
         break;
 
@@ -70,9 +70,9 @@ private:
     /// Resume all threads found to be waiting on the address under this address arbiter
     void ResumeAllThreads(VAddr address);
 
-    /// Resume one thread found to be waiting on the address under this address arbiter and return
-    /// the resumed thread.
-    std::shared_ptr<Thread> ResumeHighestPriorityThread(VAddr address);
+    /// Resume the `count` highest-priority threads found to be waiting on the address under
+    /// this address arbiter, in a single pass over the wait list
+    void ResumeHighestPriorityThreads(VAddr address, s32 count);
 
     /// Threads waiting for the address arbiter to be signaled.
     std::vector<std::shared_ptr<Thread>> waiting_threads;
@@ -6,6 +6,7 @@
 #include <vector>
 #include "common/archives.h"
 #include "common/assert.h"
+#include "common/object_pool.h"
 #include "core/hle/kernel/event.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/thread.h"
@@ -18,7 +19,7 @@ Event::Event(KernelSystem& kernel) : WaitObject(kernel) {}
 Event::~Event() {}
 
 std::shared_ptr<Event> KernelSystem::CreateEvent(ResetType reset_type, std::string name) {
-    auto evt{std::make_shared<Event>(*this)};
+    auto evt{Common::AllocateShared<Event>(*this)};
 
     evt->signaled = false;
     evt->reset_type = reset_type;
@@ -89,6 +89,30 @@ public:
         return DynamicObjectCast<T>(GetGeneric(handle));
     }
 
+    /**
+     * Looks up a handle without touching the object's reference count. The returned pointer
+     * borrows the table's reference: it is only valid as long as the handle stays open, which
+     * holds for the duration of the current SVC. Use Get() instead whenever the object needs to
+     * outlive the lookup.
+     * @return Pointer to the looked-up object, or `nullptr` if the handle is not valid.
+     */
+    Object* GetRawGeneric(Handle handle) const;
+
+    /**
+     * Looks up a handle without touching the object's reference count, verifying its type. The
+     * same lifetime restrictions as for GetRawGeneric() apply.
+     * @return Pointer to the looked-up object, or `nullptr` if the handle is not valid or its
+     *         type differs from the requested one.
+     */
+    template <class T>
+    T* GetRaw(Handle handle) const {
+        Object* object = GetRawGeneric(handle);
+        if (object != nullptr && object->GetHandleType() == T::HANDLE_TYPE) {
+            return static_cast<T*>(object);
+        }
+        return nullptr;
+    }
+
     /// Closes all handles held in this table.
     void Clear();
 
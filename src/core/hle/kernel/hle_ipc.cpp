@@ -6,6 +6,7 @@
 #include <vector>
 #include "common/assert.h"
 #include "common/common_types.h"
+#include "common/object_pool.h"
 #include "core/core.h"
 #include "core/hle/kernel/event.h"
 #include "core/hle/kernel/handle_table.h"
@@ -80,14 +81,16 @@ std::shared_ptr<Event> HLERequestContext::SleepClientThread(
     const std::string& reason, std::chrono::nanoseconds timeout,
     std::shared_ptr<WakeupCallback> callback) {
     // Put the client thread to sleep until the wait event is signaled or the timeout expires.
-    thread->wakeup_callback = std::make_shared<ThreadCallback>(shared_from_this(), callback);
+    thread->wakeup_callback = Common::AllocateShared<ThreadCallback>(shared_from_this(), callback);
 
     auto event = kernel.CreateEvent(Kernel::ResetType::OneShot, "HLE Pause Event: " + reason);
     thread->status = ThreadStatus::WaitHleEvent;
     thread->wait_objects = {event};
     event->AddWaitingThread(thread);
 
-    if (timeout.count() > 0)
+    // A negative timeout means the thread sleeps until the event is signaled. A zero timeout
+    // still schedules the wakeup so the reply is delivered on the next core timing advance.
+    if (timeout.count() >= 0)
         thread->WakeAfterDelay(timeout.count());
 
     return event;
@@ -316,6 +319,18 @@ void MappedBuffer::Write(const void* src_buffer, std::size_t offset, std::size_t
     memory->WriteBlock(*process, address + static_cast<VAddr>(offset), src_buffer, size);
 }
 
+const u8* MappedBuffer::GetReadPointer(std::size_t offset, std::size_t size) {
+    ASSERT(perms & IPC::R);
+    ASSERT(offset + size <= this->size);
+    return memory->GetPointerForRange(*process, address + static_cast<VAddr>(offset), size);
+}
+
+u8* MappedBuffer::GetWritePointer(std::size_t offset, std::size_t size) {
+    ASSERT(perms & IPC::W);
+    ASSERT(offset + size <= this->size);
+    return memory->GetPointerForRange(*process, address + static_cast<VAddr>(offset), size);
+}
+
 } // namespace Kernel
 
 SERIALIZE_EXPORT_IMPL(Kernel::HLERequestContext::ThreadCallback)
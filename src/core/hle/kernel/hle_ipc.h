@@ -132,6 +132,20 @@ public:
     // interface for service
     void Read(void* dest_buffer, std::size_t offset, std::size_t size);
     void Write(const void* src_buffer, std::size_t offset, std::size_t size);
+
+    /**
+     * Returns a host pointer through which the given range of the buffer can be read in place,
+     * avoiding an intermediate copy, or nullptr if the guest range is not backed by contiguous
+     * plain host memory. Callers must fall back to Read() when nullptr is returned.
+     */
+    const u8* GetReadPointer(std::size_t offset, std::size_t size);
+
+    /**
+     * Returns a host pointer through which the given range of the buffer can be written in
+     * place, or nullptr if the guest range is not backed by contiguous plain host memory.
+     * Callers must fall back to Write() when nullptr is returned.
+     */
+    u8* GetWritePointer(std::size_t offset, std::size_t size);
     std::size_t GetSize() const {
         return size;
     }
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include "common/alignment.h"
 #include "common/memory_ref.h"
+#include "common/perf_counters.h"
 #include "core/core.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/handle_table.h"
@@ -41,6 +42,9 @@ ResultCode TranslateCommandBuffer(Kernel::KernelSystem& kernel, Memory::MemorySy
     std::array<u32, IPC::COMMAND_BUFFER_LENGTH> cmd_buf;
     memory.ReadBlock(*src_process, src_address, cmd_buf.data(), command_size * sizeof(u32));
 
+    Common::PerfCounters::Add(Common::PerfCounters::Counter::IpcBytesTranslated,
+                              command_size * sizeof(u32));
+
     const bool should_record = kernel.GetIPCRecorder().IsEnabled();
 
     std::vector<u32> untranslated_cmdbuf;
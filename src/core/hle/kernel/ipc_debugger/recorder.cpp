@@ -50,6 +50,17 @@ void Recorder::RegisterRequest(const std::shared_ptr<Kernel::ClientSession>& cli
                                const std::shared_ptr<Kernel::Thread>& client_thread) {
     const u32 thread_id = client_thread->GetThreadId();
 
+    {
+        std::scoped_lock lock{filter_mutex};
+        if (!filter_port_name.empty()) {
+            const auto& port = client_session->parent->port;
+            if (!port || port->GetName().rfind(filter_port_name, 0) != 0) {
+                filtered_threads.insert(thread_id);
+                return;
+            }
+        }
+    }
+
     if (auto owner_process = client_thread->owner_process.lock()) {
         RequestRecord record = {/* id */ ++record_count,
                                 /* status */ RequestStatus::Sent,
@@ -72,12 +83,27 @@ void Recorder::SetRequestInfo(const std::shared_ptr<Kernel::Thread>& client_thre
                               std::vector<u32> translated_cmdbuf,
                               const std::shared_ptr<Kernel::Thread>& server_thread) {
     const u32 thread_id = client_thread->GetThreadId();
+    if (filtered_threads.count(thread_id)) {
+        return;
+    }
     if (!record_map.count(thread_id)) {
         // This is possible when the recorder is enabled after application started
         LOG_ERROR(Kernel, "No request is assoicated with the thread");
         return;
     }
 
+    {
+        std::scoped_lock lock{filter_mutex};
+        if (filter_command_id >= 0 &&
+            (untranslated_cmdbuf.empty() ||
+             untranslated_cmdbuf[0] >> 16 != static_cast<u32>(filter_command_id))) {
+            record_map.erase(thread_id);
+            client_session_map.erase(thread_id);
+            filtered_threads.insert(thread_id);
+            return;
+        }
+    }
+
     auto& record = *record_map[thread_id];
     record.status = RequestStatus::Handling;
     record.untranslated_request_cmdbuf = std::move(untranslated_cmdbuf);
@@ -111,6 +137,9 @@ void Recorder::SetReplyInfo(const std::shared_ptr<Kernel::Thread>& client_thread
                             std::vector<u32> untranslated_cmdbuf,
                             std::vector<u32> translated_cmdbuf) {
     const u32 thread_id = client_thread->GetThreadId();
+    if (filtered_threads.erase(thread_id)) {
+        return;
+    }
     if (!record_map.count(thread_id)) {
         // This is possible when the recorder is enabled after application started
         LOG_ERROR(Kernel, "No request is assoicated with the thread");
@@ -131,6 +160,9 @@ void Recorder::SetReplyInfo(const std::shared_ptr<Kernel::Thread>& client_thread
 
 void Recorder::SetHLEUnimplemented(const std::shared_ptr<Kernel::Thread>& client_thread) {
     const u32 thread_id = client_thread->GetThreadId();
+    if (filtered_threads.count(thread_id)) {
+        return;
+    }
     if (!record_map.count(thread_id)) {
         // This is possible when the recorder is enabled after application started
         LOG_ERROR(Kernel, "No request is assoicated with the thread");
@@ -156,8 +188,14 @@ void Recorder::UnbindCallback(const CallbackHandle& handle) {
 void Recorder::InvokeCallbacks(const RequestRecord& request) {
     {
         std::shared_lock lock(callback_mutex);
+        if (callbacks.empty()) {
+            return;
+        }
+        // Take one shared snapshot for all callbacks, so that receivers on other threads
+        // can retain the record without deep-copying the command buffers again.
+        auto snapshot = std::make_shared<RequestRecord>(request);
         for (const auto& iter : callbacks) {
-            (*iter)(request);
+            (*iter)(snapshot);
         }
     }
 }
@@ -166,4 +204,10 @@ void Recorder::SetEnabled(bool enabled_) {
     enabled.store(enabled_, std::memory_order_relaxed);
 }
 
+void Recorder::SetCaptureFilter(std::string port_name, int command_id) {
+    std::scoped_lock lock{filter_mutex};
+    filter_port_name = std::move(port_name);
+    filter_command_id = command_id;
+}
+
 } // namespace IPCDebugger
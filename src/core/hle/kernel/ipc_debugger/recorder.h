@@ -7,10 +7,12 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include "common/common_types.h"
 
@@ -64,7 +66,7 @@ struct RequestRecord {
     std::vector<u32> translated_reply_cmdbuf;
 };
 
-using CallbackType = std::function<void(const RequestRecord&)>;
+using CallbackType = std::function<void(std::shared_ptr<const RequestRecord>)>;
 using CallbackHandle = std::shared_ptr<CallbackType>;
 
 class Recorder {
@@ -108,6 +110,14 @@ public:
      */
     void SetEnabled(bool enabled);
 
+    /**
+     * Restricts recording to requests on client ports whose name starts with port_name
+     * (empty = record all ports) and/or with the given command id (negative = record all
+     * commands). Filtered requests are dropped before their command buffers are copied,
+     * which keeps the recorder cheap enough to stay enabled during long sessions.
+     */
+    void SetCaptureFilter(std::string port_name, int command_id);
+
     CallbackHandle BindCallback(CallbackType callback);
     void UnbindCallback(const CallbackHandle& handle);
 
@@ -120,6 +130,14 @@ private:
     // Temporary client session map for function name handling
     std::unordered_map<u32, std::shared_ptr<Kernel::ClientSession>> client_session_map;
 
+    // Threads whose current request was dropped by the capture filter; their follow-up
+    // events are ignored silently instead of logging a missing-record error.
+    std::unordered_set<u32> filtered_threads;
+
+    std::string filter_port_name;
+    int filter_command_id = -1;
+    mutable std::mutex filter_mutex;
+
     std::atomic_bool enabled{false};
 
     std::set<CallbackHandle> callbacks;
@@ -189,9 +189,21 @@ MemoryRegionInfo::IntervalSet MemoryRegionInfo::HeapAllocate(u32 size) {
     IntervalSet result;
     u32 rest = size;
 
-    // Try allocating from the higher address
+    // Prefer the highest single block that can hold the entire allocation. A contiguous
+    // backing maps as one VMA instead of one per fragment, which keeps the address space from
+    // degrading as the free list fragments over long sessions.
     for (auto iter = free_blocks.rbegin(); iter != free_blocks.rend(); ++iter) {
         ASSERT(iter->bounds() == boost::icl::interval_bounds::right_open());
+        if (iter->upper() - iter->lower() >= size) {
+            result += Interval(iter->upper() - size, iter->upper());
+            free_blocks -= result;
+            used += size;
+            return result;
+        }
+    }
+
+    // No single block suffices, so scavenge fragments from the higher addresses
+    for (auto iter = free_blocks.rbegin(); iter != free_blocks.rend(); ++iter) {
         if (iter->upper() - iter->lower() >= rest) {
             // Requested size is fulfilled with this block
             result += Interval(iter->upper() - rest, iter->upper());
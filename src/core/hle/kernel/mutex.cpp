@@ -5,6 +5,7 @@
 #include <vector>
 #include "common/archives.h"
 #include "common/assert.h"
+#include "common/object_pool.h"
 #include "core/core.h"
 #include "core/global.h"
 #include "core/hle/kernel/errors.h"
@@ -30,7 +31,7 @@ Mutex::Mutex(KernelSystem& kernel) : WaitObject(kernel), kernel(kernel) {}
 Mutex::~Mutex() {}
 
 std::shared_ptr<Mutex> KernelSystem::CreateMutex(bool initial_locked, std::string name) {
-    auto mutex{std::make_shared<Mutex>(*this)};
+    auto mutex{Common::AllocateShared<Mutex>(*this)};
 
     mutex->lock_count = 0;
     mutex->name = std::move(name);
@@ -9,6 +9,7 @@
 #include <boost/serialization/vector.hpp>
 #include "common/archives.h"
 #include "common/assert.h"
+#include "common/object_pool.h"
 #include "core/hle/kernel/client_port.h"
 #include "core/hle/kernel/errors.h"
 #include "core/hle/kernel/hle_ipc.h"
@@ -44,8 +45,8 @@ void ServerPort::Acquire(Thread* thread) {
 }
 
 KernelSystem::PortPair KernelSystem::CreatePortPair(u32 max_sessions, std::string name) {
-    auto server_port{std::make_shared<ServerPort>(*this)};
-    auto client_port{std::make_shared<ClientPort>(*this)};
+    auto server_port{Common::AllocateShared<ServerPort>(*this)};
+    auto client_port{Common::AllocateShared<ClientPort>(*this)};
 
     server_port->name = name + "_Server";
     client_port->name = name + "_Client";
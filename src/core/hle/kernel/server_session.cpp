@@ -7,6 +7,9 @@
 #include <boost/serialization/string.hpp>
 #include <boost/serialization/vector.hpp>
 #include "common/archives.h"
+#include "common/object_pool.h"
+#include "core/arm/arm_interface.h"
+#include "core/core_timing.h"
 #include "core/hle/kernel/client_port.h"
 #include "core/hle/kernel/client_session.h"
 #include "core/hle/kernel/hle_ipc.h"
@@ -47,7 +50,7 @@ ServerSession::~ServerSession() {
 
 ResultVal<std::shared_ptr<ServerSession>> ServerSession::Create(KernelSystem& kernel,
                                                                 std::string name) {
-    auto server_session{std::make_shared<ServerSession>(kernel)};
+    auto server_session{Common::AllocateShared<ServerSession>(kernel)};
 
     server_session->name = std::move(name);
     server_session->parent = nullptr;
@@ -91,7 +94,7 @@ ResultCode ServerSession::HandleSyncRequest(std::shared_ptr<Thread> thread) {
                                 cmd_buf.size() * sizeof(u32));
 
         auto context =
-            std::make_shared<Kernel::HLERequestContext>(kernel, SharedFrom(this), thread);
+            Common::AllocateShared<Kernel::HLERequestContext>(kernel, SharedFrom(this), thread);
         context->PopulateFromIncomingCommandBuffer(cmd_buf.data(), current_process);
 
         hle_handler->HandleSyncRequest(*context);
@@ -109,27 +112,41 @@ ResultCode ServerSession::HandleSyncRequest(std::shared_ptr<Thread> thread) {
     }
 
     if (thread->status == ThreadStatus::Running) {
-        // Put the thread to sleep until the server replies, it will be awoken in
-        // svcReplyAndReceive for LLE servers.
-        thread->status = ThreadStatus::WaitIPC;
-
         if (hle_handler != nullptr) {
-            // For HLE services, we put the request threads to sleep for a short duration to
-            // simulate IPC overhead, but only if the HLE handler didn't put the thread to sleep for
-            // other reasons like an async callback. The IPC overhead is needed to prevent
-            // starvation when a thread only does sync requests to HLE services while a
-            // lower-priority thread is waiting to run.
+            // For HLE services, we simulate the IPC overhead of a real sync request, but only if
+            // the HLE handler didn't put the thread to sleep for other reasons like an async
+            // callback. The IPC overhead is needed to prevent starvation when a thread only does
+            // sync requests to HLE services while a lower-priority thread is waiting to run.
 
             // This delay was approximated in a homebrew application by measuring the average time
             // it takes for svcSendSyncRequest to return when performing the SetLcdForceBlack IPC
             // request to the GSP:GPU service in a n3DS with firmware 11.6. The measured values have
             // a high variance and vary between models.
-            static constexpr u64 IPCDelayNanoseconds = 39000;
-            thread->WakeAfterDelay(IPCDelayNanoseconds);
+            static constexpr s64 IPCDelayNanoseconds = 39000;
+
+            if (!kernel.GetCurrentThreadManager().HaveReadyThreads()) {
+                // The handler replied synchronously and no other thread could use the core while
+                // the caller slept, so resume it directly and charge the IPC overhead as CPU time
+                // instead. This skips the reschedule and the pair of context switches on nearly
+                // every HLE sync request.
+                kernel.current_cpu->GetTimer().AddTicks(
+                    static_cast<u64>(nsToCycles(IPCDelayNanoseconds)));
+            } else {
+                // Another thread is ready: sleep through the delay so it gets the core, which is
+                // what prevents sync-request spam from starving lower-priority threads.
+                thread->status = ThreadStatus::WaitIPC;
+                thread->WakeAfterDelay(IPCDelayNanoseconds);
+                kernel.PrepareReschedule();
+            }
         } else {
+            // Put the thread to sleep until the server replies, it will be awoken in
+            // svcReplyAndReceive for LLE servers.
+            thread->status = ThreadStatus::WaitIPC;
+
             // Add the thread to the list of threads that have issued a sync request with this
             // server.
             pending_requesting_threads.push_back(std::move(thread));
+            kernel.PrepareReschedule();
         }
     }
 
@@ -142,7 +159,7 @@ ResultCode ServerSession::HandleSyncRequest(std::shared_ptr<Thread> thread) {
 KernelSystem::SessionPair KernelSystem::CreateSessionPair(const std::string& name,
                                                           std::shared_ptr<ClientPort> port) {
     auto server_session = ServerSession::Create(*this, name + "_Server").Unwrap();
-    auto client_session{std::make_shared<ClientSession>(*this)};
+    auto client_session{Common::AllocateShared<ClientSession>(*this)};
     client_session->name = name + "_Client";
 
     std::shared_ptr<Session> parent(new Session);
@@ -195,17 +195,27 @@ VMAPermission SharedMemory::ConvertPermissions(MemoryPermission permission) {
 };
 
 u8* SharedMemory::GetPointer(u32 offset) {
-    if (backing_blocks.size() != 1) {
-        LOG_WARNING(Kernel, "Unsafe GetPointer on discontinuous SharedMemory");
+    // Walk the backing blocks so that offsets into discontinuous mappings resolve to the
+    // correct block instead of overrunning the first one.
+    for (auto& [backing_memory, block_size] : backing_blocks) {
+        if (offset < block_size) {
+            return backing_memory.GetPtr() + offset;
+        }
+        offset -= block_size;
     }
-    return backing_blocks[0].first + offset;
+    LOG_ERROR(Kernel, "Out of bounds GetPointer on SharedMemory");
+    return nullptr;
 }
 
 const u8* SharedMemory::GetPointer(u32 offset) const {
-    if (backing_blocks.size() != 1) {
-        LOG_WARNING(Kernel, "Unsafe GetPointer on discontinuous SharedMemory");
+    for (const auto& [backing_memory, block_size] : backing_blocks) {
+        if (offset < block_size) {
+            return backing_memory.GetPtr() + offset;
+        }
+        offset -= block_size;
     }
-    return backing_blocks[0].first + offset;
+    LOG_ERROR(Kernel, "Out of bounds GetPointer on SharedMemory");
+    return nullptr;
 }
 
 } // namespace Kernel
@@ -80,10 +80,11 @@ Handler::Handler(Core::Timing& timing) : timing(timing) {
 
     init_time = GetInitTime();
 
-    using namespace std::placeholders;
-    update_time_event = timing.RegisterEvent("SharedPage::UpdateTimeCallback",
-                                             std::bind(&Handler::UpdateTimeCallback, this, _1, _2));
-    timing.ScheduleEvent(0, update_time_event, 0, 0);
+    // The date/time fields carry the tick they were written at together with a
+    // tick-to-second coefficient, so the guest extrapolates the current time from the tick
+    // counter on every read. Writing them once here is therefore enough; no periodic
+    // refresh event is needed.
+    UpdateTimeFields();
 
     float slidestate = Settings::values.factor_3d.GetValue() / 100.0f;
     shared_page.sliderstate_3d = static_cast<float_le>(slidestate);
@@ -118,7 +119,7 @@ u64 Handler::GetSystemTime() const {
     return console_time;
 }
 
-void Handler::UpdateTimeCallback(std::uintptr_t user_data, int cycles_late) {
+void Handler::UpdateTimeFields() {
     DateTime& date_time =
         shared_page.date_time_counter % 2 ? shared_page.date_time_0 : shared_page.date_time_1;
 
@@ -128,9 +129,6 @@ void Handler::UpdateTimeCallback(std::uintptr_t user_data, int cycles_late) {
     date_time.tick_offset = 0;
 
     ++shared_page.date_time_counter;
-
-    // system time is updated hourly
-    timing.ScheduleEvent(msToCycles(60 * 60 * 1000) - cycles_late, update_time_event);
 }
 
 void Handler::SetMacAddress(const MacAddress& addr) {
@@ -114,9 +114,8 @@ public:
 
 private:
     u64 GetSystemTime() const;
-    void UpdateTimeCallback(std::uintptr_t user_data, int cycles_late);
+    void UpdateTimeFields();
     Core::Timing& timing;
-    Core::TimingEventType* update_time_event;
     std::chrono::seconds init_time;
 
     SharedPageDef shared_page;
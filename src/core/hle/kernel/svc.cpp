@@ -7,6 +7,8 @@
 #include <fmt/format.h>
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/object_pool.h"
+#include "common/perf_counters.h"
 #include "common/scm_rev.h"
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
@@ -359,6 +361,10 @@ private:
 
     friend class SVCWrapper<SVC>;
 
+    // Fast dispatch for the most frequent SVCs; returns false to fall back to the table.
+    bool CallSVCFast(u32 immediate);
+    void ReturnResult(ARM_Interface& cpu, ResultCode result);
+
     // ARM interfaces
 
     u32 GetReg(std::size_t n);
@@ -656,8 +662,9 @@ ResultCode SVC::SendSyncRequest(Handle handle) {
 
     LOG_TRACE(Kernel_SVC, "called handle=0x{:08X}({})", handle, session->GetName());
 
-    system.PrepareReschedule();
-
+    // Note: no unconditional PrepareReschedule here. ServerSession::HandleSyncRequest requests a
+    // reschedule on the paths that actually block the caller, so a synchronous HLE reply falls
+    // straight back to guest code.
     auto thread = SharedFrom(kernel.GetCurrentThreadManager().GetCurrentThread());
 
     if (kernel.GetIPCRecorder().IsEnabled()) {
@@ -810,7 +817,7 @@ ResultCode SVC::WaitSynchronization1(Handle handle, s64 nano_seconds) {
         // Create an event to wake the thread up after the specified nanosecond delay has passed
         thread->WakeAfterDelay(nano_seconds);
 
-        thread->wakeup_callback = std::make_shared<SVC_SyncCallback>(false);
+        thread->wakeup_callback = Common::AllocateShared<SVC_SyncCallback>(false);
 
         system.PrepareReschedule();
 
@@ -887,7 +894,7 @@ ResultCode SVC::WaitSynchronizationN(s32* out, VAddr handles_address, s32 handle
         // Create an event to wake the thread up after the specified nanosecond delay has passed
         thread->WakeAfterDelay(nano_seconds);
 
-        thread->wakeup_callback = std::make_shared<SVC_SyncCallback>(false);
+        thread->wakeup_callback = Common::AllocateShared<SVC_SyncCallback>(false);
 
         system.PrepareReschedule();
 
@@ -934,7 +941,7 @@ ResultCode SVC::WaitSynchronizationN(s32* out, VAddr handles_address, s32 handle
         // Create an event to wake the thread up after the specified nanosecond delay has passed
         thread->WakeAfterDelay(nano_seconds);
 
-        thread->wakeup_callback = std::make_shared<SVC_SyncCallback>(true);
+        thread->wakeup_callback = Common::AllocateShared<SVC_SyncCallback>(true);
 
         system.PrepareReschedule();
 
@@ -1078,7 +1085,7 @@ ResultCode SVC::ReplyAndReceive(s32* index, VAddr handles_address, s32 handle_co
 
     thread->wait_objects = std::move(objects);
 
-    thread->wakeup_callback = std::make_shared<SVC_IPCCallback>(system);
+    thread->wakeup_callback = Common::AllocateShared<SVC_IPCCallback>(system);
 
     system.PrepareReschedule();
 
@@ -1290,8 +1297,7 @@ void SVC::ExitThread() {
 
 /// Gets the priority for the specified thread
 ResultCode SVC::GetThreadPriority(u32* priority, Handle handle) {
-    const std::shared_ptr<Thread> thread =
-        kernel.GetCurrentProcess()->handle_table.Get<Thread>(handle);
+    const Thread* thread = kernel.GetCurrentProcess()->handle_table.GetRaw<Thread>(handle);
     if (thread == nullptr)
         return ERR_INVALID_HANDLE;
 
@@ -1354,8 +1360,8 @@ ResultCode SVC::ReleaseMutex(Handle handle) {
 ResultCode SVC::GetProcessId(u32* process_id, Handle process_handle) {
     LOG_TRACE(Kernel_SVC, "called process=0x{:08X}", process_handle);
 
-    const std::shared_ptr<Process> process =
-        kernel.GetCurrentProcess()->handle_table.Get<Process>(process_handle);
+    const Process* process =
+        kernel.GetCurrentProcess()->handle_table.GetRaw<Process>(process_handle);
     if (process == nullptr)
         return ERR_INVALID_HANDLE;
 
@@ -1367,8 +1373,7 @@ ResultCode SVC::GetProcessId(u32* process_id, Handle process_handle) {
 ResultCode SVC::GetProcessIdOfThread(u32* process_id, Handle thread_handle) {
     LOG_TRACE(Kernel_SVC, "called thread=0x{:08X}", thread_handle);
 
-    const std::shared_ptr<Thread> thread =
-        kernel.GetCurrentProcess()->handle_table.Get<Thread>(thread_handle);
+    const Thread* thread = kernel.GetCurrentProcess()->handle_table.GetRaw<Thread>(thread_handle);
     if (thread == nullptr)
         return ERR_INVALID_HANDLE;
 
@@ -1383,8 +1388,7 @@ ResultCode SVC::GetProcessIdOfThread(u32* process_id, Handle thread_handle) {
 ResultCode SVC::GetThreadId(u32* thread_id, Handle handle) {
     LOG_TRACE(Kernel_SVC, "called thread=0x{:08X}", handle);
 
-    const std::shared_ptr<Thread> thread =
-        kernel.GetCurrentProcess()->handle_table.Get<Thread>(handle);
+    const Thread* thread = kernel.GetCurrentProcess()->handle_table.GetRaw<Thread>(handle);
     if (thread == nullptr)
         return ERR_INVALID_HANDLE;
 
@@ -1409,8 +1413,7 @@ ResultCode SVC::CreateSemaphore(Handle* out_handle, s32 initial_count, s32 max_c
 ResultCode SVC::ReleaseSemaphore(s32* count, Handle handle, s32 release_count) {
     LOG_TRACE(Kernel_SVC, "called release_count={}, handle=0x{:08X}", release_count, handle);
 
-    std::shared_ptr<Semaphore> semaphore =
-        kernel.GetCurrentProcess()->handle_table.Get<Semaphore>(handle);
+    Semaphore* semaphore = kernel.GetCurrentProcess()->handle_table.GetRaw<Semaphore>(handle);
     if (semaphore == nullptr)
         return ERR_INVALID_HANDLE;
 
@@ -1503,7 +1506,7 @@ ResultCode SVC::DuplicateHandle(Handle* out, Handle handle) {
 ResultCode SVC::SignalEvent(Handle handle) {
     LOG_TRACE(Kernel_SVC, "called event=0x{:08X}", handle);
 
-    std::shared_ptr<Event> evt = kernel.GetCurrentProcess()->handle_table.Get<Event>(handle);
+    Event* evt = kernel.GetCurrentProcess()->handle_table.GetRaw<Event>(handle);
     if (evt == nullptr)
         return ERR_INVALID_HANDLE;
 
@@ -1516,7 +1519,7 @@ ResultCode SVC::SignalEvent(Handle handle) {
 ResultCode SVC::ClearEvent(Handle handle) {
     LOG_TRACE(Kernel_SVC, "called event=0x{:08X}", handle);
 
-    std::shared_ptr<Event> evt = kernel.GetCurrentProcess()->handle_table.Get<Event>(handle);
+    Event* evt = kernel.GetCurrentProcess()->handle_table.GetRaw<Event>(handle);
     if (evt == nullptr)
         return ERR_INVALID_HANDLE;
 
@@ -1540,7 +1543,7 @@ ResultCode SVC::CreateTimer(Handle* out_handle, u32 reset_type) {
 ResultCode SVC::ClearTimer(Handle handle) {
     LOG_TRACE(Kernel_SVC, "called timer=0x{:08X}", handle);
 
-    std::shared_ptr<Timer> timer = kernel.GetCurrentProcess()->handle_table.Get<Timer>(handle);
+    Timer* timer = kernel.GetCurrentProcess()->handle_table.GetRaw<Timer>(handle);
     if (timer == nullptr)
         return ERR_INVALID_HANDLE;
 
@@ -1556,7 +1559,7 @@ ResultCode SVC::SetTimer(Handle handle, s64 initial, s64 interval) {
         return ERR_OUT_OF_RANGE_KERNEL;
     }
 
-    std::shared_ptr<Timer> timer = kernel.GetCurrentProcess()->handle_table.Get<Timer>(handle);
+    Timer* timer = kernel.GetCurrentProcess()->handle_table.GetRaw<Timer>(handle);
     if (timer == nullptr)
         return ERR_INVALID_HANDLE;
 
@@ -1569,7 +1572,7 @@ ResultCode SVC::SetTimer(Handle handle, s64 initial, s64 interval) {
 ResultCode SVC::CancelTimer(Handle handle) {
     LOG_TRACE(Kernel_SVC, "called timer=0x{:08X}", handle);
 
-    std::shared_ptr<Timer> timer = kernel.GetCurrentProcess()->handle_table.Get<Timer>(handle);
+    Timer* timer = kernel.GetCurrentProcess()->handle_table.GetRaw<Timer>(handle);
     if (timer == nullptr)
         return ERR_INVALID_HANDLE;
 
@@ -2317,8 +2320,70 @@ const SVC::FunctionDef* SVC::GetSVCInfo(u32 func_num) {
 
 MICROPROFILE_DEFINE(Kernel_SVC, "Kernel", "SVC", MP_RGB(70, 200, 70));
 
+/// Writes an SVC result to r0, with the same error logging the generic wrapper performs.
+void SVC::ReturnResult(ARM_Interface& cpu, ResultCode result) {
+    if (result.IsError()) {
+        LOG_ERROR(Kernel_SVC, "level={} summary={} module={} description={}",
+                  result.level.ExtractValue(result.raw), result.summary.ExtractValue(result.raw),
+                  result.module.ExtractValue(result.raw),
+                  result.description.ExtractValue(result.raw));
+    }
+    cpu.SetReg(0, result.raw);
+}
+
+/**
+ * Dispatches the SVCs that dominate IPC-heavy titles directly, touching only the registers
+ * each call actually uses through one cached core reference instead of going through the
+ * generic Wrap() marshalling. The register assignments below mirror exactly what SVCWrapper
+ * derives from each signature, so behaviour is unchanged.
+ */
+bool SVC::CallSVCFast(u32 immediate) {
+    ARM_Interface& cpu = system.GetRunningCore();
+    switch (immediate) {
+    case 0x18: // SignalEvent
+        LOG_TRACE(Kernel_SVC, "calling SignalEvent");
+        ReturnResult(cpu, SignalEvent(static_cast<Handle>(cpu.GetReg(0))));
+        return true;
+    case 0x24: { // WaitSynchronization1
+        LOG_TRACE(Kernel_SVC, "calling WaitSynchronization1");
+        const Handle handle = static_cast<Handle>(cpu.GetReg(0));
+        // The s64 timeout is aligned to an even register pair (r2, r3).
+        const s64 nano_seconds = static_cast<s64>(static_cast<u64>(cpu.GetReg(2)) |
+                                                  (static_cast<u64>(cpu.GetReg(3)) << 32));
+        ReturnResult(cpu, WaitSynchronization1(handle, nano_seconds));
+        return true;
+    }
+    case 0x28: { // GetSystemTick
+        LOG_TRACE(Kernel_SVC, "calling GetSystemTick");
+        const u64 ticks = static_cast<u64>(GetSystemTick());
+        cpu.SetReg(0, static_cast<u32>(ticks));
+        cpu.SetReg(1, static_cast<u32>(ticks >> 32));
+        return true;
+    }
+    case 0x32: // SendSyncRequest
+        LOG_TRACE(Kernel_SVC, "calling SendSyncRequest");
+        ReturnResult(cpu, SendSyncRequest(static_cast<Handle>(cpu.GetReg(0))));
+        return true;
+    case 0x4F: { // ReplyAndReceive
+        LOG_TRACE(Kernel_SVC, "calling ReplyAndReceive");
+        const VAddr handles_address = cpu.GetReg(1);
+        const s32 handle_count = static_cast<s32>(cpu.GetReg(2));
+        const Handle reply_target = static_cast<Handle>(cpu.GetReg(3));
+        s32 index = 0;
+        const ResultCode result =
+            ReplyAndReceive(&index, handles_address, handle_count, reply_target);
+        ReturnResult(cpu, result);
+        cpu.SetReg(1, static_cast<u32>(index));
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
 void SVC::CallSVC(u32 immediate) {
     MICROPROFILE_SCOPE(Kernel_SVC);
+    Common::PerfCounters::Add(Common::PerfCounters::Counter::SvcCalls);
 
     // Lock the global kernel mutex when we enter the kernel HLE.
     std::lock_guard lock{HLE::g_hle_lock};
@@ -2326,6 +2391,10 @@ void SVC::CallSVC(u32 immediate) {
     DEBUG_ASSERT_MSG(kernel.GetCurrentProcess()->status == ProcessStatus::Running,
                      "Running threads from exiting processes is unimplemented");
 
+    if (CallSVCFast(immediate)) {
+        return;
+    }
+
     const FunctionDef* info = GetSVCInfo(immediate);
     LOG_TRACE(Kernel_SVC, "calling {}", info->name);
     if (info) {
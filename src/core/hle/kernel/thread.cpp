@@ -11,6 +11,7 @@
 #include "common/common_types.h"
 #include "common/logging/log.h"
 #include "common/math_util.h"
+#include "common/object_pool.h"
 #include "common/serialization/boost_flat_set.h"
 #include "core/arm/arm_interface.h"
 #include "core/arm/skyeye_common/armstate.h"
@@ -80,6 +81,8 @@ Thread* ThreadManager::GetCurrentThread() const {
 }
 
 void Thread::Stop() {
+    ++thread_manager.state_generation;
+
     // Cancel any outstanding wakeup events for this thread
     thread_manager.kernel.timing.UnscheduleEvent(thread_manager.ThreadWakeupEventType, thread_id);
     thread_manager.wakeup_callback_table.erase(thread_id);
@@ -116,6 +119,8 @@ void ThreadManager::SwitchContext(Thread* new_thread) {
     Thread* previous_thread = GetCurrentThread();
     std::shared_ptr<Process> previous_process = nullptr;
 
+    ++state_generation;
+
     Core::Timing& timing = kernel.timing;
 
     // Save context for previous thread
@@ -195,6 +200,7 @@ Thread* ThreadManager::PopNextReadyThread() {
 void ThreadManager::WaitCurrentThread_Sleep() {
     Thread* thread = GetCurrentThread();
     thread->status = ThreadStatus::WaitSleep;
+    ++state_generation;
 }
 
 void ThreadManager::ExitCurrentThread() {
@@ -274,6 +280,7 @@ void Thread::ResumeFromWait() {
 
     thread_manager.ready_queue.push_back(current_priority, this);
     status = ThreadStatus::Ready;
+    ++thread_manager.state_generation;
     thread_manager.kernel.PrepareReschedule();
 }
 
@@ -358,10 +365,9 @@ ResultVal<std::shared_ptr<Thread>> KernelSystem::CreateThread(
                           ErrorSummary::InvalidArgument, ErrorLevel::Permanent);
     }
 
-    auto thread{std::make_shared<Thread>(*this, processor_id)};
+    auto thread{Common::AllocateShared<Thread>(*this, processor_id)};
 
     thread_managers[processor_id]->thread_list.push_back(thread);
-    thread_managers[processor_id]->ready_queue.prepare(priority);
 
     thread->thread_id = NewThreadId();
     thread->status = ThreadStatus::Dormant;
@@ -421,6 +427,7 @@ ResultVal<std::shared_ptr<Thread>> KernelSystem::CreateThread(
 
     thread_managers[processor_id]->ready_queue.push_back(thread->current_priority, thread.get());
     thread->status = ThreadStatus::Ready;
+    ++thread_managers[processor_id]->state_generation;
 
     return MakeResult<std::shared_ptr<Thread>>(std::move(thread));
 }
@@ -431,10 +438,9 @@ void Thread::SetPriority(u32 priority) {
     // If thread was ready, adjust queues
     if (status == ThreadStatus::Ready)
         thread_manager.ready_queue.move(this, current_priority, priority);
-    else
-        thread_manager.ready_queue.prepare(priority);
 
     nominal_priority = current_priority = priority;
+    ++thread_manager.state_generation;
 }
 
 void Thread::UpdatePriority() {
@@ -450,9 +456,8 @@ void Thread::BoostPriority(u32 priority) {
     // If thread was ready, adjust queues
     if (status == ThreadStatus::Ready)
         thread_manager.ready_queue.move(this, current_priority, priority);
-    else
-        thread_manager.ready_queue.prepare(priority);
     current_priority = priority;
+    ++thread_manager.state_generation;
 }
 
 std::shared_ptr<Thread> SetupMainThread(KernelSystem& kernel, u32 entry_point, u32 priority,
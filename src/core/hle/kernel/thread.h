@@ -115,6 +115,15 @@ public:
      */
     const std::vector<std::shared_ptr<Thread>>& GetThreadList();
 
+    /**
+     * Returns a counter incremented on every thread state change (creation, exit, context
+     * switch, wakeup, priority change). Debugger views compare it against the value they saw
+     * last to skip rebuilding state that cannot have changed.
+     */
+    u64 GetStateGeneration() const {
+        return state_generation;
+    }
+
     void SetCPU(ARM_Interface& cpu_) {
         cpu = &cpu_;
     }
@@ -157,6 +166,10 @@ private:
     // Lists all threadsthat aren't deleted.
     std::vector<std::shared_ptr<Thread>> thread_list;
 
+    /// Bumped on every thread state change; see GetStateGeneration(). Deliberately not
+    /// serialized: loading a state invalidates anything built from the old counter value.
+    u64 state_generation = 0;
+
     friend class Thread;
     friend class KernelSystem;
 
@@ -167,6 +180,10 @@ private:
         ar& ready_queue;
         ar& wakeup_callback_table;
         ar& thread_list;
+        if (Archive::is_loading::value) {
+            // The loaded threads share nothing with what debugger views may have cached
+            ++state_generation;
+        }
     }
 };
 
@@ -49,6 +49,7 @@ VMManager::~VMManager() = default;
 void VMManager::Reset() {
     ASSERT(!is_locked);
 
+    cached_vma_valid = false;
     vma_map.clear();
 
     // Initialize the map with a single free region covering the entire managed space.
@@ -64,9 +65,16 @@ void VMManager::Reset() {
 VMManager::VMAHandle VMManager::FindVMA(VAddr target) const {
     if (target >= MAX_ADDRESS) {
         return vma_map.end();
-    } else {
-        return std::prev(vma_map.upper_bound(target));
     }
+    if (cached_vma_valid) {
+        const VirtualMemoryArea& vma = cached_vma->second;
+        if (target >= vma.base && target < vma.base + vma.size) {
+            return cached_vma;
+        }
+    }
+    cached_vma = std::prev(vma_map.upper_bound(target));
+    cached_vma_valid = true;
+    return cached_vma;
 }
 
 ResultVal<VAddr> VMManager::MapBackingMemoryToBase(VAddr base, u32 region_size, MemoryRef memory,
@@ -166,14 +174,13 @@ ResultCode VMManager::ChangeMemoryState(VAddr target, u32 size, MemoryState expe
     CASCADE_RESULT(auto vma, CarveVMARange(target, size));
 
     const VMAIter end = vma_map.end();
-    // The comparison against the end of the range must be done using addresses since VMAs can be
-    // merged during this process, causing invalidation of the iterators.
     while (vma != end && vma->second.base < target_end) {
         vma->second.permissions = new_perms;
         vma->second.meminfo_state = new_state;
         UpdatePageTableForVMA(vma->second);
-        vma = std::next(MergeAdjacent(vma));
+        ++vma;
     }
+    CoalesceRange(target, size);
 
     return RESULT_SUCCESS;
 }
@@ -191,7 +198,7 @@ VMManager::VMAIter VMManager::Unmap(VMAIter vma_handle) {
 
     UpdatePageTableForVMA(vma);
 
-    return MergeAdjacent(vma_handle);
+    return vma_handle;
 }
 
 ResultCode VMManager::UnmapRange(VAddr target, u32 size) {
@@ -201,11 +208,10 @@ ResultCode VMManager::UnmapRange(VAddr target, u32 size) {
     const VAddr target_end = target + size;
 
     const VMAIter end = vma_map.end();
-    // The comparison against the end of the range must be done using addresses since VMAs can be
-    // merged during this process, causing invalidation of the iterators.
     while (vma != end && vma->second.base < target_end) {
         vma = std::next(Unmap(vma));
     }
+    CoalesceRange(target, size);
 
     ASSERT(FindVMA(target)->second.size >= size);
     return RESULT_SUCCESS;
@@ -230,11 +236,12 @@ ResultCode VMManager::ReprotectRange(VAddr target, u32 size, VMAPermission new_p
     const VAddr target_end = target + size;
 
     const VMAIter end = vma_map.end();
-    // The comparison against the end of the range must be done using addresses since VMAs can be
-    // merged during this process, causing invalidation of the iterators.
     while (vma != end && vma->second.base < target_end) {
-        vma = std::next(StripIterConstness(Reprotect(vma, new_perms)));
+        vma->second.permissions = new_perms;
+        UpdatePageTableForVMA(vma->second);
+        ++vma;
     }
+    CoalesceRange(target, size);
 
     return RESULT_SUCCESS;
 }
@@ -359,6 +366,7 @@ VMManager::VMAIter VMManager::MergeAdjacent(VMAIter iter) {
     if (next_vma != vma_map.end() && iter->second.CanBeMergedWith(next_vma->second)) {
         iter->second.size += next_vma->second.size;
         vma_map.erase(next_vma);
+        cached_vma_valid = false;
     }
 
     if (iter != vma_map.begin()) {
@@ -366,6 +374,7 @@ VMManager::VMAIter VMManager::MergeAdjacent(VMAIter iter) {
         if (prev_vma->second.CanBeMergedWith(iter->second)) {
             prev_vma->second.size += iter->second.size;
             vma_map.erase(iter);
+            cached_vma_valid = false;
             iter = prev_vma;
         }
     }
@@ -373,6 +382,33 @@ VMManager::VMAIter VMManager::MergeAdjacent(VMAIter iter) {
     return iter;
 }
 
+void VMManager::CoalesceRange(VAddr target, u32 size) {
+    VMAIter vma = StripIterConstness(FindVMA(target));
+    if (vma == vma_map.end()) {
+        return;
+    }
+    // The VMA preceding the range may be mergeable with the first one inside it.
+    if (vma != vma_map.begin()) {
+        --vma;
+    }
+
+    const VAddr target_end = target + size;
+    while (vma != vma_map.end() && vma->second.base < target_end) {
+        const VMAIter next_vma = std::next(vma);
+        if (next_vma == vma_map.end()) {
+            break;
+        }
+        if (vma->second.CanBeMergedWith(next_vma->second)) {
+            // Stay on the grown VMA; it may absorb the following one as well.
+            vma->second.size += next_vma->second.size;
+            vma_map.erase(next_vma);
+            cached_vma_valid = false;
+        } else {
+            vma = next_vma;
+        }
+    }
+}
+
 void VMManager::UpdatePageTableForVMA(const VirtualMemoryArea& vma) {
     switch (vma.type) {
     case VMAType::Free:
@@ -137,7 +137,12 @@ public:
     /// Clears the address space map, re-initializing with a single free area.
     void Reset();
 
-    /// Finds the VMA in which the given address is included in, or `vma_map.end()`.
+    /**
+     * Finds the VMA in which the given address is included in, or `vma_map.end()`.
+     * The result of the previous lookup is cached and checked first, since accesses tend to
+     * cluster in the same region; CRO load/unload in particular hammers this with runs of
+     * nearby addresses.
+     */
     VMAHandle FindVMA(VAddr target) const;
 
     // TODO(yuriks): Should these functions actually return the handle?
@@ -223,7 +228,8 @@ private:
     /// Converts a VMAHandle to a mutable VMAIter.
     VMAIter StripIterConstness(const VMAHandle& iter);
 
-    /// Unmaps the given VMA.
+    /// Unmaps the given VMA. Does not coalesce; the caller is expected to do so once it is done
+    /// modifying the range.
     VMAIter Unmap(VMAIter vma);
 
     /**
@@ -250,6 +256,13 @@ private:
      */
     VMAIter MergeAdjacent(VMAIter vma);
 
+    /**
+     * Coalesces all mergeable VMAs overlapping or bordering the given range in a single pass.
+     * Range operations defer merging to this instead of re-merging after every VMA they touch,
+     * so each VMA is visited once.
+     */
+    void CoalesceRange(VAddr target, u32 size);
+
     /// Updates the pages corresponding to this VMA so they match the VMA's attributes.
     void UpdatePageTableForVMA(const VirtualMemoryArea& vma);
 
@@ -260,12 +273,18 @@ private:
     // assert. VMManager locks itself after deserialization.
     bool is_locked{};
 
+    // Result of the last FindVMA call. Splits and in-place updates leave the node valid (the
+    // bounds are re-checked on every hit); the erase sites invalidate it. Not serialized.
+    mutable VMAHandle cached_vma{};
+    mutable bool cached_vma_valid = false;
+
     template <class Archive>
     void serialize(Archive& ar, const unsigned int) {
         ar& vma_map;
         ar& page_table;
         if (Archive::is_loading::value) {
             is_locked = true;
+            cached_vma_valid = false;
         }
     }
     friend class boost::serialization::access;
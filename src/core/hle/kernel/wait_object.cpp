@@ -79,24 +79,65 @@ std::shared_ptr<Thread> WaitObject::GetHighestPriorityReadyThread() const {
 }
 
 void WaitObject::WakeupAllWaitingThreads() {
-    while (auto thread = GetHighestPriorityReadyThread()) {
-        if (!thread->IsSleepingOnWaitAll()) {
-            Acquire(thread.get());
-        } else {
-            for (auto& object : thread->wait_objects) {
-                object->Acquire(thread.get());
+    // Collect the candidates and order them by priority once, instead of rescanning the whole
+    // wait list for the next-best thread after every wakeup. Acquiring can consume the object
+    // (mutex ownership, semaphore counts), so readiness is still re-checked per thread at wakeup
+    // time, and the pass repeats until it wakes nobody, preserving the one-at-a-time semantics.
+    // Note: The real kernel picks the first thread in the list among equal priorities, which
+    // the stable sort preserves.
+    bool woke_any = true;
+    while (woke_any) {
+        woke_any = false;
+
+        std::vector<std::shared_ptr<Thread>> candidates = waiting_threads;
+        std::stable_sort(candidates.begin(), candidates.end(),
+                         [](const auto& lhs, const auto& rhs) {
+                             return lhs->current_priority < rhs->current_priority;
+                         });
+
+        for (auto& thread : candidates) {
+            // Skip threads that an earlier wakeup in this pass has already removed from the
+            // wait list (e.g. through a wakeup callback).
+            if (thread->status != ThreadStatus::WaitSynchAny &&
+                thread->status != ThreadStatus::WaitSynchAll &&
+                thread->status != ThreadStatus::WaitHleEvent) {
+                continue;
+            }
+
+            if (ShouldWait(thread.get()))
+                continue;
+
+            // A thread is ready to run if it's either in ThreadStatus::WaitSynchAny or
+            // in ThreadStatus::WaitSynchAll and the rest of the objects it is waiting on are
+            // ready.
+            if (thread->status == ThreadStatus::WaitSynchAll &&
+                std::any_of(thread->wait_objects.begin(), thread->wait_objects.end(),
+                            [&thread](const std::shared_ptr<WaitObject>& object) {
+                                return object->ShouldWait(thread.get());
+                            })) {
+                continue;
             }
-        }
 
-        // Invoke the wakeup callback before clearing the wait objects
-        if (thread->wakeup_callback)
-            thread->wakeup_callback->WakeUp(ThreadWakeupReason::Signal, thread, SharedFrom(this));
+            if (!thread->IsSleepingOnWaitAll()) {
+                Acquire(thread.get());
+            } else {
+                for (auto& object : thread->wait_objects) {
+                    object->Acquire(thread.get());
+                }
+            }
+
+            // Invoke the wakeup callback before clearing the wait objects
+            if (thread->wakeup_callback)
+                thread->wakeup_callback->WakeUp(ThreadWakeupReason::Signal, thread,
+                                                SharedFrom(this));
 
-        for (auto& object : thread->wait_objects)
-            object->RemoveWaitingThread(thread.get());
-        thread->wait_objects.clear();
+            for (auto& object : thread->wait_objects)
+                object->RemoveWaitingThread(thread.get());
+            thread->wait_objects.clear();
 
-        thread->ResumeFromWait();
+            thread->ResumeFromWait();
+            woke_any = true;
+        }
     }
 
     if (hle_notifier)
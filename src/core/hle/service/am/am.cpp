@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <future>
 #include <cryptopp/aes.h>
 #include <cryptopp/modes.h>
 #include <fmt/format.h>
@@ -13,6 +14,7 @@
 #include "common/file_util.h"
 #include "common/logging/log.h"
 #include "common/string_util.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/errors.h"
 #include "core/file_sys/ncch_container.h"
@@ -174,10 +176,17 @@ ResultVal<std::size_t> CIAFile::WriteContentData(u64 offset, std::size_t length,
             // Since the incoming TMD has already been written, we can use GetTitleContentPath
             // to get the content paths to write to.
             FileSys::TitleMetadata tmd = container.GetTitleMetadata();
-            FileUtil::IOFile file(GetTitleContentPath(media_type, tmd.GetTitleID(), i, is_update),
-                                  content_written[i] ? "ab" : "wb");
+            if (content_files.size() <= i) {
+                content_files.resize(tmd.GetContentCount());
+            }
+            auto& file = content_files[i];
+            if (!file) {
+                file = std::make_unique<FileUtil::IOFile>(
+                    GetTitleContentPath(media_type, tmd.GetTitleID(), i, is_update),
+                    content_written[i] ? "ab" : "wb");
+            }
 
-            if (!file.IsOpen()) {
+            if (!file->IsOpen()) {
                 return FileSys::ERROR_INSUFFICIENT_SPACE;
             }
 
@@ -193,11 +202,15 @@ ResultVal<std::size_t> CIAFile::WriteContentData(u64 offset, std::size_t length,
                 decryption_state->content[i].ProcessData(temp.data(), temp.data(), temp.size());
             }
 
-            file.WriteBytes(temp.data(), temp.size());
+            file->WriteBytes(temp.data(), temp.size());
 
             // Keep tabs on how much of this content ID has been written so new range_min
             // values can be calculated.
             content_written[i] += available_to_write;
+            if (content_written[i] >= size) {
+                // This content is complete; release the handle early
+                file.reset();
+            }
             LOG_DEBUG(Service_AM, "Wrote {:x} to content {}, total {:x}", available_to_write, i,
                       content_written[i]);
         }
@@ -286,6 +299,8 @@ bool CIAFile::SetSize(u64 size) const {
 }
 
 bool CIAFile::Close() const {
+    content_files.clear();
+
     bool complete = true;
     for (std::size_t i = 0; i < container.GetTitleMetadata().GetContentCount(); i++) {
         if (content_written[i] < container.GetContentSize(static_cast<u16>(i)))
@@ -371,21 +386,46 @@ InstallStatus InstallCIA(const std::string& path,
         if (!file.IsOpen())
             return InstallStatus::ErrorFailedToOpenFile;
 
-        std::array<u8, 0x10000> buffer;
-        std::size_t total_bytes_read = 0;
-        while (total_bytes_read != file.GetSize()) {
-            std::size_t bytes_read = file.ReadBytes(buffer.data(), buffer.size());
-            auto result = installFile.Write(static_cast<u64>(total_bytes_read), bytes_read, true,
-                                            static_cast<u8*>(buffer.data()));
-
-            if (update_callback)
-                update_callback(total_bytes_read, file.GetSize());
+        // Pipeline the install: while the worker decrypts and writes out one chunk, the next
+        // chunk is already being read from the source file. Alternating between two buffers is
+        // safe because a buffer is only refilled two submissions after it was queued, and its
+        // write is harvested in between.
+        Common::ThreadWorker worker(1, "CIAInstall");
+        std::array<std::vector<u8>, 2> buffers{std::vector<u8>(0x10000), std::vector<u8>(0x10000)};
+        std::future<ResultVal<std::size_t>> pending;
+        const auto harvest = [&pending] {
+            const auto result = pending.get();
             if (result.Failed()) {
                 LOG_ERROR(Service_AM, "CIA file installation aborted with error code {:08x}",
                           result.Code().raw);
+                return false;
+            }
+            return true;
+        };
+
+        std::size_t current = 0;
+        std::size_t total_bytes_read = 0;
+        while (total_bytes_read != file.GetSize()) {
+            auto& buffer = buffers[current];
+            const std::size_t bytes_read = file.ReadBytes(buffer.data(), buffer.size());
+            if (pending.valid() && !harvest()) {
                 return InstallStatus::ErrorAborted;
             }
+
+            std::packaged_task<ResultVal<std::size_t>()> task(
+                [&installFile, offset = static_cast<u64>(total_bytes_read), bytes_read, &buffer] {
+                    return installFile.Write(offset, bytes_read, true, buffer.data());
+                });
+            pending = task.get_future();
+            worker.QueueWork(std::move(task));
+
+            if (update_callback)
+                update_callback(total_bytes_read, file.GetSize());
             total_bytes_read += bytes_read;
+            current ^= 1;
+        }
+        if (pending.valid() && !harvest()) {
+            return InstallStatus::ErrorAborted;
         }
         installFile.Close();
 
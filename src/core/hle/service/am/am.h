@@ -14,6 +14,7 @@
 #include <boost/serialization/vector.hpp>
 #include "common/common_types.h"
 #include "common/construct.h"
+#include "common/file_util.h"
 #include "common/swap.h"
 #include "core/file_sys/cia_container.h"
 #include "core/file_sys/file_backend.h"
@@ -98,6 +99,10 @@ private:
     std::vector<u64> content_written;
     Service::FS::MediaType media_type;
 
+    // Open handle per content index, so sequential chunks append to an already open file
+    // instead of reopening it for every write. Closed (and cleared) by Close().
+    mutable std::vector<std::unique_ptr<FileUtil::IOFile>> content_files;
+
     class DecryptionState;
     std::unique_ptr<DecryptionState> decryption_state;
 };
@@ -442,6 +442,24 @@ ResultCode AppletManager::SendNotification(Notification notification) {
             ErrorLevel::Status};
 }
 
+std::shared_ptr<Kernel::Process> AppletManager::LaunchNativeApplet(AppletId applet_id) {
+    auto cfg = Service::CFG::GetModule(system);
+    const auto title_id = GetTitleIdForApplet(applet_id, cfg->GetRegionValue());
+
+    if (unavailable_applet_titles.count(title_id) > 0) {
+        return nullptr;
+    }
+
+    auto process = NS::LaunchTitle(FS::MediaType::NAND, title_id);
+    if (!process) {
+        // Probing the NAND for a missing title hits the host filesystem, and games open
+        // applets like swkbd frequently. The result will not change while we are running,
+        // so don't try this title again and fall back to the HLE applet right away.
+        unavailable_applet_titles.insert(title_id);
+    }
+    return process;
+}
+
 ResultCode AppletManager::PrepareToStartLibraryApplet(AppletId applet_id) {
     // The real APT service returns an error if there's a pending APT parameter when this function
     // is called.
@@ -458,9 +476,7 @@ ResultCode AppletManager::PrepareToStartLibraryApplet(AppletId applet_id) {
     last_library_launcher_slot = active_slot;
     last_prepared_library_applet = applet_id;
 
-    auto cfg = Service::CFG::GetModule(system);
-    auto process =
-        NS::LaunchTitle(FS::MediaType::NAND, GetTitleIdForApplet(applet_id, cfg->GetRegionValue()));
+    auto process = LaunchNativeApplet(applet_id);
     if (process) {
         return RESULT_SUCCESS;
     }
@@ -486,9 +502,7 @@ ResultCode AppletManager::PreloadLibraryApplet(AppletId applet_id) {
     last_library_launcher_slot = active_slot;
     last_prepared_library_applet = applet_id;
 
-    auto cfg = Service::CFG::GetModule(system);
-    auto process =
-        NS::LaunchTitle(FS::MediaType::NAND, GetTitleIdForApplet(applet_id, cfg->GetRegionValue()));
+    auto process = LaunchNativeApplet(applet_id);
     if (process) {
         return RESULT_SUCCESS;
     }
@@ -627,9 +641,7 @@ ResultCode AppletManager::StartSystemApplet(AppletId applet_id,
     const auto slot_id =
         applet_id == AppletId::HomeMenu ? AppletSlot::HomeMenu : AppletSlot::SystemApplet;
     if (!GetAppletSlot(slot_id)->registered) {
-        auto cfg = Service::CFG::GetModule(system);
-        auto process = NS::LaunchTitle(FS::MediaType::NAND,
-                                       GetTitleIdForApplet(applet_id, cfg->GetRegionValue()));
+        auto process = LaunchNativeApplet(applet_id);
         if (!process) {
             // TODO: Find the right error code.
             return {ErrorDescription::NotFound, ErrorModule::Applet, ErrorSummary::NotSupported,
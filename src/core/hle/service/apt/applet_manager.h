@@ -8,6 +8,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <unordered_set>
 #include <vector>
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/optional.hpp>
@@ -23,6 +24,10 @@ namespace Core {
 class System;
 }
 
+namespace Kernel {
+class Process;
+}
+
 namespace Service::APT {
 
 /// Signals used by APT functions
@@ -427,6 +432,10 @@ private:
     bool application_cancelled = false;
     AppletSlot application_close_target = AppletSlot::Error;
 
+    /// Applet title IDs whose NAND launch has already failed this session. Derived from the
+    /// host filesystem, so not serialized.
+    std::unordered_set<u64> unavailable_applet_titles;
+
     Core::TimingEventType* home_button_update_event;
     std::atomic<bool> is_device_reload_pending{true};
     std::unique_ptr<Input::ButtonDevice> home_button;
@@ -450,6 +459,11 @@ private:
     /// otherwise it queues for sending when the application registers itself with APT::Enable.
     void SendApplicationParameterAfterRegistration(const MessageParameter& parameter);
 
+    /// Launches the LLE title for the given applet. Skips the NAND probe entirely when an
+    /// earlier launch of the same title already failed, so repeated opens of an applet that
+    /// falls back to HLE don't hit the host filesystem every time.
+    std::shared_ptr<Kernel::Process> LaunchNativeApplet(AppletId applet_id);
+
     void EnsureHomeMenuLoaded();
 
     void CaptureFrameBuffers();
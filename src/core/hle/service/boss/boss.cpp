@@ -20,6 +20,7 @@
 #undef ERROR_ALREADY_EXISTS
 #endif
 #endif
+#include <chrono>
 #include <boost/url/src.hpp>
 #include <core/file_sys/archive_systemsavedata.h>
 #include <cryptopp/aes.h>
@@ -30,6 +31,7 @@
 #include "core/file_sys/errors.h"
 #include "core/file_sys/file_backend.h"
 #include "core/hle/ipc_helpers.h"
+#include "core/hle/lock.h"
 #include "core/hle/service/boss/boss.h"
 #include "core/hle/service/boss/boss_p.h"
 #include "core/hle/service/boss/boss_u.h"
@@ -632,6 +634,14 @@ bool Module::Interface::DownloadBossDataFromURL(std::string_view url, std::strin
     client->set_follow_location(true);
     client->enable_server_certificate_verification(false);
 
+    {
+        std::lock_guard lock(etag_mutex);
+        const auto cached_etag = etag_cache.find(std::string(file_name));
+        if (cached_etag != etag_cache.end()) {
+            request.headers.emplace("If-None-Match", cached_etag->second);
+        }
+    }
+
     const auto result = client->send(request);
     if (!result) {
         LOG_ERROR(Service_BOSS, "GET to {}://{}{} returned null", scheme, host, path);
@@ -641,6 +651,12 @@ bool Module::Interface::DownloadBossDataFromURL(std::string_view url, std::strin
     }
     LOG_DEBUG(Service_BOSS, "Got result");
     const auto& response = result.value();
+    if (response.status == 304) {
+        // Not modified: the content from the previous download is still in the extdata.
+        LOG_DEBUG(Service_BOSS, "Content for task {} is unchanged, reusing previous download",
+                  file_name);
+        return true;
+    }
     if (response.status >= 400) {
         LOG_ERROR(Service_BOSS, "GET to {}://{}{} returned error status code: {}", scheme, host,
                   path, response.status);
@@ -649,6 +665,15 @@ bool Module::Interface::DownloadBossDataFromURL(std::string_view url, std::strin
     if (!response.headers.contains("content-type")) {
         LOG_ERROR(Service_BOSS, "GET to {}://{}{} returned no content", scheme, host, path);
     }
+
+    // Remember the content's ETag only once the download fully succeeds, so the next run of
+    // this task can revalidate instead of redownloading.
+    const auto store_etag = [&] {
+        if (response.has_header("ETag")) {
+            std::lock_guard lock(etag_mutex);
+            etag_cache[std::string(file_name)] = response.get_header_value("ETag");
+        }
+    };
     LOG_DEBUG(Service_BOSS, "Downloaded content is: {}", response.body);
 
     if (response.body.size() < boss_payload_header_length) {
@@ -825,6 +850,7 @@ bool Module::Interface::DownloadBossDataFromURL(std::string_view url, std::strin
                                   payload.data() + news_header_size + news_message_size);
                 image_file->Close();
             }
+            store_etag();
             return true;
         }
         return false;
@@ -846,6 +872,7 @@ bool Module::Interface::DownloadBossDataFromURL(std::string_view url, std::strin
     file->Write(0, boss_header_length, true, reinterpret_cast<u8*>(&header));
     file->Write(boss_header_length, payload_size, true, payload.data());
     file->Close();
+    store_etag();
     return true;
 #else
     LOG_ERROR(Service_BOSS, "Cannot download data as web services are not enabled");
@@ -1146,14 +1173,33 @@ void Module::Interface::StartTask(Kernel::HLERequestContext& ctx) {
             } else {
                 char* url_pointer = reinterpret_cast<char*>(
                     std::any_cast<std::vector<u8>&>(task_id_list[task_id].props[url_id]).data());
-                std::string_view url(url_pointer, strnlen(url_pointer, url_size));
-                std::string_view file_name(task_id.c_str(),
-                                           strnlen(task_id.c_str(), task_id.size()));
-                if (DownloadBossDataFromURL(url, file_name)) {
-                    LOG_DEBUG(Service_BOSS, "Downloaded from {} successfully", url);
-                    task_id_list[task_id].success = true;
+                std::string url(url_pointer, strnlen(url_pointer, url_size));
+                const auto prev_download = download_futures.find(task_id);
+                if (prev_download != download_futures.end() && prev_download->second.valid() &&
+                    prev_download->second.wait_for(std::chrono::seconds(0)) !=
+                        std::future_status::ready) {
+                    LOG_WARNING(Service_BOSS, "Task {} is still downloading", task_id);
                 } else {
-                    LOG_WARNING(Service_BOSS, "Failed to download from {}", url);
+                    // Run the download on its own thread, like HTTP_C requests; the guest
+                    // observes completion through the task status and the task finish
+                    // event instead of this service call blocking on network I/O.
+                    download_futures[task_id] =
+                        std::async(std::launch::async, [this, url, task_id] {
+                            const bool success = DownloadBossDataFromURL(url, task_id);
+                            // The service handlers run with the HLE lock held, so taking it
+                            // here makes the status update and event signal safe.
+                            std::lock_guard lock(HLE::g_hle_lock);
+                            const auto task = task_id_list.find(task_id);
+                            if (task != task_id_list.end()) {
+                                task->second.success = success;
+                            }
+                            if (success) {
+                                LOG_DEBUG(Service_BOSS, "Downloaded from {} successfully", url);
+                            } else {
+                                LOG_WARNING(Service_BOSS, "Failed to download from {}", url);
+                            }
+                            boss->task_finish_event->Signal();
+                        });
                 }
             }
         }
@@ -5,7 +5,11 @@
 #pragma once
 
 #include <any>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <boost/serialization/shared_ptr.hpp>
 #include <core/loader/loader.h>
 #include "core/file_sys/archive_backend.h"
@@ -1119,6 +1123,12 @@ public:
         std::map<std::string, BossTaskProperties> task_id_list;
         BossTaskProperties cur_props;
 
+        /// Downloads currently running in the background, keyed by task id.
+        std::map<std::string, std::future<void>> download_futures;
+        /// ETags of completed downloads, used to skip redownloading unchanged content.
+        std::map<std::string, std::string> etag_cache;
+        std::mutex etag_mutex;
+
         FileSys::Path GetBossDataDir();
         bool DownloadBossDataFromURL(std::string_view url, std::string_view file_name);
         std::vector<NsDataEntry> GetNsDataEntries();
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <chrono>
 #include "common/archives.h"
 #include "common/bit_set.h"
 #include "common/logging/log.h"
@@ -103,62 +104,56 @@ void Module::PortConfig::Clear() {
     transfer_bytes = 256;
 }
 
+/**
+ * Crops a captured frame to the configured trimming area. This runs on the capture thread, so
+ * that at completion time only a contiguous copy to the destination process remains.
+ */
+static std::vector<u16> TrimFrame(std::vector<u16>&& frame, const Resolution& resolution, u16 x0,
+                                  u16 y0, u16 x1, u16 y1) {
+    const u32 original_width = resolution.width;
+    if (x1 <= x0 || y1 <= y0 || x1 > original_width || y1 > resolution.height) {
+        LOG_ERROR(Service_CAM, "Invalid trimming coordinates x0={}, y0={}, x1={}, y1={}", x0, y0,
+                  x1, y1);
+        return {};
+    }
+    const u32 trim_width = x1 - x0;
+    const u32 trim_height = y1 - y0;
+
+    std::vector<u16> trimmed;
+    trimmed.reserve(trim_width * trim_height);
+    for (u32 y = 0; y < trim_height; ++y) {
+        // Note: the source line can be truncated if the frame size doesn't match the resolution.
+        const std::size_t src_offset = (y0 + y) * original_width + x0;
+        if (src_offset >= frame.size()) {
+            break;
+        }
+        const std::size_t line_pixels = std::min<std::size_t>(trim_width, frame.size() - src_offset);
+        trimmed.insert(trimmed.end(), frame.begin() + src_offset,
+                       frame.begin() + src_offset + line_pixels);
+    }
+    return trimmed;
+}
+
 void Module::CompletionEventCallBack(u64 port_id, s64) {
     PortConfig& port = ports[port_id];
-    const CameraConfig& camera = cameras[port.camera_id];
-    const auto buffer = port.capture_result.get();
-
-    if (port.is_trimming) {
-        u32 trim_width;
-        u32 trim_height;
-        const int original_width = camera.contexts[camera.current_context].resolution.width;
-        const int original_height = camera.contexts[camera.current_context].resolution.height;
-        if (port.x1 <= port.x0 || port.y1 <= port.y0 || port.x1 > original_width ||
-            port.y1 > original_height) {
-            LOG_ERROR(Service_CAM, "Invalid trimming coordinates x0={}, y0={}, x1={}, y1={}",
-                      port.x0, port.y0, port.x1, port.y1);
-            trim_width = 0;
-            trim_height = 0;
-        } else {
-            trim_width = port.x1 - port.x0;
-            trim_height = port.y1 - port.y0;
-        }
 
-        u32 trim_size = (port.x1 - port.x0) * (port.y1 - port.y0) * 2;
-        if (port.dest_size != trim_size) {
-            LOG_ERROR(Service_CAM, "The destination size ({}) doesn't match the source ({})!",
-                      port.dest_size, trim_size);
-        }
+    // Never stall the emulation thread on the capture task; if the frame isn't ready yet, check
+    // again shortly instead of blocking in the event handler.
+    if (port.capture_result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        system.CoreTiming().ScheduleEvent(msToCycles(1), completion_event_callback, port_id);
+        return;
+    }
 
-        const u32 src_offset = port.y0 * original_width + port.x0;
-        const u16* src_ptr = buffer.data() + src_offset;
-        // Note: src_size_left is int because it can be negative if the buffer size doesn't match.
-        int src_size_left = static_cast<int>((buffer.size() - src_offset) * sizeof(u16));
-        VAddr dest_ptr = port.dest;
-        // Note: dest_size_left and line_bytes are int to match the type of src_size_left.
-        int dest_size_left = static_cast<int>(port.dest_size);
-        const int line_bytes = static_cast<int>(trim_width * sizeof(u16));
-
-        for (u32 y = 0; y < trim_height; ++y) {
-            int copy_length = std::min({line_bytes, dest_size_left, src_size_left});
-            if (copy_length <= 0) {
-                break;
-            }
-            system.Memory().WriteBlock(*port.dest_process, dest_ptr, src_ptr, copy_length);
-            dest_ptr += copy_length;
-            dest_size_left -= copy_length;
-            src_ptr += original_width;
-            src_size_left -= original_width * sizeof(u16);
-        }
-    } else {
-        std::size_t buffer_size = buffer.size() * sizeof(u16);
-        if (port.dest_size != buffer_size) {
-            LOG_ERROR(Service_CAM, "The destination size ({}) doesn't match the source ({})!",
-                      port.dest_size, buffer_size);
-        }
-        system.Memory().WriteBlock(*port.dest_process, port.dest, buffer.data(),
-                                   std::min<std::size_t>(port.dest_size, buffer_size));
+    // The frame has already been converted and trimmed by the capture task, so all that is left
+    // is handing the buffer over to the destination process.
+    const auto buffer = port.capture_result.get();
+    const std::size_t buffer_size = buffer.size() * sizeof(u16);
+    if (port.dest_size != buffer_size) {
+        LOG_ERROR(Service_CAM, "The destination size ({}) doesn't match the source ({})!",
+                  port.dest_size, buffer_size);
     }
+    system.Memory().WriteBlock(*port.dest_process, port.dest, buffer.data(),
+                               std::min<std::size_t>(port.dest_size, buffer_size));
 
     port.is_receiving = false;
     port.completion_event->Signal();
@@ -189,17 +184,26 @@ void Module::StartReceiving(int port_id) {
     PortConfig& port = ports[port_id];
     port.is_receiving = true;
 
-    // launches a capture task asynchronously
+    // launches a capture task asynchronously. The trimming configuration is sampled here so the
+    // crop can also run on the capture task, like it does on hardware during the capture.
     CameraConfig& camera = cameras[port.camera_id];
-    port.capture_result = std::async(std::launch::async, [&camera, &port, this] {
-        if (is_camera_reload_pending.exchange(false)) {
-            // reinitialize the camera according to new settings
-            camera.impl->StopCapture();
-            LoadCameraImplementation(camera, port.camera_id);
-            camera.impl->StartCapture();
-        }
-        return camera.impl->ReceiveFrame();
-    });
+    port.capture_result = std::async(
+        std::launch::async,
+        [&camera, this, camera_id = port.camera_id, is_trimming = port.is_trimming,
+         resolution = camera.contexts[camera.current_context].resolution, x0 = port.x0,
+         y0 = port.y0, x1 = port.x1, y1 = port.y1] {
+            if (is_camera_reload_pending.exchange(false)) {
+                // reinitialize the camera according to new settings
+                camera.impl->StopCapture();
+                LoadCameraImplementation(camera, camera_id);
+                camera.impl->StartCapture();
+            }
+            std::vector<u16> frame = camera.impl->ReceiveFrame();
+            if (is_trimming) {
+                frame = TrimFrame(std::move(frame), resolution, x0, y0, x1, y1);
+            }
+            return frame;
+        });
 
     // schedules a completion event according to the frame rate. The event will block on the
     // capture task if it is not finished within the expected time
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/unique_ptr.hpp>
 #include <cryptopp/base64.h>
@@ -75,6 +76,7 @@ void Module::Interface::Open(Kernel::HLERequestContext& ctx) {
         if (dir_result.Failed()) {
             if (open_mode.create) {
                 cecd->cecd_system_save_data_archive->CreateDirectory(path);
+                cecd->InvalidateMboxIndex(path_type, ncch_program_id);
                 rb.Push(RESULT_SUCCESS);
             } else {
                 LOG_DEBUG(Service_CECD, "Failed to open directory: {}", path.AsString());
@@ -436,6 +438,9 @@ void Module::Interface::WriteMessage(Kernel::HLERequestContext& ctx) {
             static_cast<u32>(message->Write(0, buffer_size, true, buffer.data()).Unwrap());
         message->Close();
 
+        if (is_outbox)
+            cecd->IndexOutboxMessage(ncch_program_id, id_buffer, buffer);
+
         rb.Push(RESULT_SUCCESS);
     } else {
         rb.Push(ResultCode(ErrorDescription::NoData, ErrorModule::CEC, ErrorSummary::NotFound,
@@ -523,6 +528,9 @@ void Module::Interface::WriteMessageWithHMAC(Kernel::HLERequestContext& ctx) {
             static_cast<u32>(message->Write(0, buffer_size, true, buffer.data()).Unwrap());
         message->Close();
 
+        if (is_outbox)
+            cecd->IndexOutboxMessage(ncch_program_id, id_buffer, buffer);
+
         rb.Push(RESULT_SUCCESS);
     } else {
         rb.Push(ResultCode(ErrorDescription::NoData, ErrorModule::CEC, ErrorSummary::NotFound,
@@ -556,9 +564,14 @@ void Module::Interface::Delete(Kernel::HLERequestContext& ctx) {
     case CecDataPathType::RootDir:
     case CecDataPathType::MboxDir:
     case CecDataPathType::InboxDir:
-    case CecDataPathType::OutboxDir:
-        rb.Push(cecd->cecd_system_save_data_archive->DeleteDirectoryRecursively(path));
+    case CecDataPathType::OutboxDir: {
+        const ResultCode result =
+            cecd->cecd_system_save_data_archive->DeleteDirectoryRecursively(path);
+        if (result.IsSuccess())
+            cecd->InvalidateMboxIndex(path_type, ncch_program_id);
+        rb.Push(result);
         break;
+    }
     default: // If not directory, then it is a file
         if (message_id_size == 0) {
             rb.Push(cecd->cecd_system_save_data_archive->DeleteFile(path));
@@ -571,7 +584,10 @@ void Module::Interface::Delete(Kernel::HLERequestContext& ctx) {
                                                            : CecDataPathType::InboxMsg,
                                                  ncch_program_id, id_buffer)
                     .data();
-            rb.Push(cecd->cecd_system_save_data_archive->DeleteFile(message_path));
+            const ResultCode result = cecd->cecd_system_save_data_archive->DeleteFile(message_path);
+            if (result.IsSuccess() && is_outbox)
+                cecd->DiscardOutboxMessage(ncch_program_id, id_buffer);
+            rb.Push(result);
         }
     }
 
@@ -1007,35 +1023,17 @@ void Module::CheckAndUpdateFile(const CecDataPathType path_type, const u32 ncch_
                     }
                 }
             } else { // ncch_program_id == 0, remove/update activated boxes
-                /// We need to read the /CEC directory to find out which titles, if any,
-                /// are activated. The num_of_titles = (total_read_count) - 1, to adjust for
-                /// the MBoxList____ file that is present in the directory as well.
-                FileSys::Path root_path(
-                    GetCecDataPathTypeAsString(CecDataPathType::RootDir, 0).data());
-
-                auto dir_result = cecd_system_save_data_archive->OpenDirectory(root_path);
-
-                auto root_dir = std::move(dir_result).Unwrap();
-                std::vector<FileSys::Entry> entries(max_num_boxes + 1); // + 1 mboxlist
-                const u32 entry_count = root_dir->Read(max_num_boxes + 1, entries.data());
-                root_dir->Close();
-
-                LOG_DEBUG(Service_CECD, "Number of entries found in /CEC: {}", entry_count);
-
-                std::string mbox_list_name("MBoxList____");
-                std::string file_name;
-                std::u16string u16_filename;
-
-                // Loop through entries but don't add mboxlist____ to itself.
-                for (u32 i = 0; i < entry_count; i++) {
-                    u16_filename = std::u16string(entries[i].filename);
-                    file_name = Common::UTF16ToUTF8(u16_filename);
-
-                    if (mbox_list_name.compare(file_name) != 0) {
-                        LOG_DEBUG(Service_CECD, "Adding title to mboxlist____: {}", file_name);
-                        std::memcpy(&mbox_list_header.box_names[mbox_list_header.num_boxes++],
-                                    file_name.data(), valid_name_size);
-                    }
+                /// The set of activated titles is the list of box directories under /CEC,
+                /// which the in-memory index keeps without re-reading the directory on
+                /// every call. MBoxList____ itself is already filtered out of the list.
+                const auto& box_list = GetCecBoxList();
+
+                LOG_DEBUG(Service_CECD, "Number of boxes indexed in /CEC: {}", box_list.size());
+
+                for (const std::string& file_name : box_list) {
+                    LOG_DEBUG(Service_CECD, "Adding title to mboxlist____: {}", file_name);
+                    std::memcpy(&mbox_list_header.box_names[mbox_list_header.num_boxes++],
+                                file_name.data(), valid_name_size);
                 }
             }
         }
@@ -1196,55 +1194,19 @@ void Module::CheckAndUpdateFile(const CecDataPathType path_type, const u32 ncch_
             LOG_DEBUG(Service_CECD, "CecOutBoxInfoHeader max batch size != max message number");
         }
 
-        /// We need to read the /CEC/<id>/OutBox directory to find out which messages, if any,
-        /// are present. The num_of_messages = (total_read_count) - 2, to adjust for
-        /// the BoxInfo____ and OBIndex_____files that are present in the directory as well.
-        FileSys::Path outbox_path(
-            GetCecDataPathTypeAsString(CecDataPathType::OutboxDir, ncch_program_id).data());
-
-        auto dir_result = cecd_system_save_data_archive->OpenDirectory(outbox_path);
+        /// The messages present in /CEC/<id>/OutBox are tracked by the in-memory
+        /// index, so the message files don't have to be re-read here.
+        const auto& outbox_messages = GetOutboxMessages(ncch_program_id);
 
-        auto outbox_dir = std::move(dir_result).Unwrap();
-        std::vector<FileSys::Entry> entries(outbox_info_header.max_message_num + 2);
-        const u32 entry_count =
-            outbox_dir->Read(outbox_info_header.max_message_num + 2, entries.data());
-        outbox_dir->Close();
-
-        LOG_DEBUG(Service_CECD, "Number of entries found in /OutBox: {}", entry_count);
+        LOG_DEBUG(Service_CECD, "Number of messages indexed in /OutBox: {}",
+                  outbox_messages.size());
         std::array<CecMessageHeader, 8> message_headers;
 
-        std::string boxinfo_name("BoxInfo_____");
-        std::string obindex_name("OBIndex_____");
-        std::string file_name;
-        std::u16string u16_filename;
-
-        for (u32 i = 0; i < entry_count; i++) {
-            u16_filename = std::u16string(entries[i].filename);
-            file_name = Common::UTF16ToUTF8(u16_filename);
-
-            if (boxinfo_name.compare(file_name) != 0 && obindex_name.compare(file_name) != 0) {
-                LOG_DEBUG(Service_CECD, "Adding message to BoxInfo_____: {}", file_name);
-
-                FileSys::Path message_path(
-                    (GetCecDataPathTypeAsString(CecDataPathType::OutboxDir, ncch_program_id) + "/" +
-                     file_name)
-                        .data());
-
-                FileSys::Mode mode;
-                mode.read_flag.Assign(1);
-
-                auto message_result = cecd_system_save_data_archive->OpenFile(message_path, mode);
-
-                auto message = std::move(message_result).Unwrap();
-                const u32 message_size = static_cast<u32>(message->GetSize());
-                std::vector<u8> buffer(message_size);
-
-                message->Read(0, message_size, buffer.data()).Unwrap();
-                message->Close();
-
-                std::memcpy(&message_headers[outbox_info_header.message_num++], buffer.data(),
-                            sizeof(CecMessageHeader));
-            }
+        for (const auto& message : outbox_messages) {
+            if (outbox_info_header.message_num >= message_headers.size())
+                break;
+            LOG_DEBUG(Service_CECD, "Adding message to BoxInfo_____: {}", message.name);
+            message_headers[outbox_info_header.message_num++] = message.header;
         }
 
         if (outbox_info_header.message_num > 0) {
@@ -1289,52 +1251,19 @@ void Module::CheckAndUpdateFile(const CecDataPathType path_type, const u32 ncch_
             obindex_header.message_num = 0;
         }
 
-        /// We need to read the /CEC/<id>/OutBox directory to find out which messages, if any,
-        /// are present. The num_of_messages = (total_read_count) - 2, to adjust for
-        /// the BoxInfo____ and OBIndex_____files that are present in the directory as well.
-        FileSys::Path outbox_path(
-            GetCecDataPathTypeAsString(CecDataPathType::OutboxDir, ncch_program_id).data());
-
-        auto dir_result = cecd_system_save_data_archive->OpenDirectory(outbox_path);
+        /// The messages present in /CEC/<id>/OutBox are tracked by the in-memory
+        /// index, so the message files don't have to be re-read here.
+        const auto& outbox_messages = GetOutboxMessages(ncch_program_id);
 
-        auto outbox_dir = std::move(dir_result).Unwrap();
-        std::vector<FileSys::Entry> entries(8);
-        const u32 entry_count = outbox_dir->Read(8, entries.data());
-        outbox_dir->Close();
-
-        LOG_DEBUG(Service_CECD, "Number of entries found in /OutBox: {}", entry_count);
+        LOG_DEBUG(Service_CECD, "Number of messages indexed in /OutBox: {}",
+                  outbox_messages.size());
         std::array<std::array<u8, 8>, 8> message_ids;
 
-        std::string boxinfo_name("BoxInfo_____");
-        std::string obindex_name("OBIndex_____");
-        std::string file_name;
-        std::u16string u16_filename;
-
-        for (u32 i = 0; i < entry_count; i++) {
-            u16_filename = std::u16string(entries[i].filename);
-            file_name = Common::UTF16ToUTF8(u16_filename);
-
-            if (boxinfo_name.compare(file_name) != 0 && obindex_name.compare(file_name) != 0) {
-                FileSys::Path message_path(
-                    (GetCecDataPathTypeAsString(CecDataPathType::OutboxDir, ncch_program_id) + "/" +
-                     file_name)
-                        .data());
-
-                FileSys::Mode mode;
-                mode.read_flag.Assign(1);
-
-                auto message_result = cecd_system_save_data_archive->OpenFile(message_path, mode);
-
-                auto message = std::move(message_result).Unwrap();
-                const u32 message_size = static_cast<u32>(message->GetSize());
-                std::vector<u8> buffer(message_size);
-
-                message->Read(0, message_size, buffer.data()).Unwrap();
-                message->Close();
-
-                // Message id is at offset 0x20, and is 8 bytes
-                std::memcpy(&message_ids[obindex_header.message_num++], buffer.data() + 0x20, 8);
-            }
+        for (const auto& message : outbox_messages) {
+            if (obindex_header.message_num >= message_ids.size())
+                break;
+            std::memcpy(&message_ids[obindex_header.message_num++],
+                        message.header.message_id.data(), 8);
         }
 
         if (obindex_header.message_num > 0) {
@@ -1364,6 +1293,145 @@ void Module::CheckAndUpdateFile(const CecDataPathType path_type, const u32 ncch_
     }
 }
 
+const std::vector<std::string>& Module::GetCecBoxList() {
+    if (cec_box_list)
+        return *cec_box_list;
+
+    cec_box_list.emplace();
+
+    FileSys::Path root_path(GetCecDataPathTypeAsString(CecDataPathType::RootDir, 0).data());
+
+    auto dir_result = cecd_system_save_data_archive->OpenDirectory(root_path);
+    if (dir_result.Succeeded()) {
+        constexpr u32 max_entries = 25; // 24 boxes + 1 mboxlist
+        auto root_dir = std::move(dir_result).Unwrap();
+        std::vector<FileSys::Entry> entries(max_entries);
+        const u32 entry_count = root_dir->Read(max_entries, entries.data());
+        root_dir->Close();
+
+        LOG_DEBUG(Service_CECD, "Number of entries found in /CEC: {}", entry_count);
+
+        const std::string mbox_list_name("MBoxList____");
+        for (u32 i = 0; i < entry_count; i++) {
+            const std::string file_name =
+                Common::UTF16ToUTF8(std::u16string(entries[i].filename));
+            if (mbox_list_name.compare(file_name) != 0)
+                cec_box_list->push_back(file_name);
+        }
+    }
+    return *cec_box_list;
+}
+
+std::vector<Module::MboxMessage>& Module::GetOutboxMessages(const u32 ncch_program_id) {
+    const auto found = outbox_index.find(ncch_program_id);
+    if (found != outbox_index.end())
+        return found->second;
+
+    auto& messages = outbox_index[ncch_program_id];
+
+    FileSys::Path outbox_path(
+        GetCecDataPathTypeAsString(CecDataPathType::OutboxDir, ncch_program_id).data());
+
+    auto dir_result = cecd_system_save_data_archive->OpenDirectory(outbox_path);
+    if (dir_result.Failed())
+        return messages;
+
+    constexpr u32 max_entries = 101; // 99 max messages + BoxInfo_____ + OBIndex_____
+    auto outbox_dir = std::move(dir_result).Unwrap();
+    std::vector<FileSys::Entry> entries(max_entries);
+    const u32 entry_count = outbox_dir->Read(max_entries, entries.data());
+    outbox_dir->Close();
+
+    LOG_DEBUG(Service_CECD, "Number of entries found in /OutBox: {}", entry_count);
+
+    const std::string boxinfo_name("BoxInfo_____");
+    const std::string obindex_name("OBIndex_____");
+
+    for (u32 i = 0; i < entry_count; i++) {
+        const std::string file_name = Common::UTF16ToUTF8(std::u16string(entries[i].filename));
+
+        if (boxinfo_name.compare(file_name) == 0 || obindex_name.compare(file_name) == 0)
+            continue;
+
+        FileSys::Path message_path(
+            (GetCecDataPathTypeAsString(CecDataPathType::OutboxDir, ncch_program_id) + "/" +
+             file_name)
+                .data());
+
+        FileSys::Mode mode;
+        mode.read_flag.Assign(1);
+
+        auto message_result = cecd_system_save_data_archive->OpenFile(message_path, mode);
+        if (message_result.Failed())
+            continue;
+
+        auto message = std::move(message_result).Unwrap();
+
+        MboxMessage indexed_message;
+        indexed_message.name = file_name;
+        message->Read(0, sizeof(CecMessageHeader),
+                      reinterpret_cast<u8*>(&indexed_message.header))
+            .Unwrap();
+        message->Close();
+
+        messages.push_back(std::move(indexed_message));
+    }
+    return messages;
+}
+
+void Module::IndexOutboxMessage(const u32 ncch_program_id, const std::vector<u8>& msg_id,
+                                const std::vector<u8>& msg_buffer) {
+    if (msg_buffer.size() < sizeof(CecMessageHeader))
+        return;
+
+    auto& messages = GetOutboxMessages(ncch_program_id);
+    const std::string name = "_" + EncodeBase64(msg_id);
+
+    CecMessageHeader header;
+    std::memcpy(&header, msg_buffer.data(), sizeof(CecMessageHeader));
+
+    for (auto& message : messages) {
+        if (message.name == name) {
+            message.header = header;
+            return;
+        }
+    }
+    messages.push_back({name, header});
+}
+
+void Module::DiscardOutboxMessage(const u32 ncch_program_id, const std::vector<u8>& msg_id) {
+    const auto found = outbox_index.find(ncch_program_id);
+    if (found == outbox_index.end())
+        return;
+
+    const std::string name = "_" + EncodeBase64(msg_id);
+    auto& messages = found->second;
+    messages.erase(std::remove_if(messages.begin(), messages.end(),
+                                  [&name](const MboxMessage& message) {
+                                      return message.name == name;
+                                  }),
+                   messages.end());
+}
+
+void Module::InvalidateMboxIndex(const CecDataPathType path_type, const u32 ncch_program_id) {
+    switch (path_type) {
+    case CecDataPathType::RootDir:
+        cec_box_list.reset();
+        outbox_index.clear();
+        break;
+    case CecDataPathType::MboxDir:
+        cec_box_list.reset();
+        outbox_index.erase(ncch_program_id);
+        break;
+    case CecDataPathType::InboxDir:
+    case CecDataPathType::OutboxDir:
+        outbox_index.erase(ncch_program_id);
+        break;
+    default:
+        break;
+    }
+}
+
 Module::SessionData::SessionData() {}
 
 Module::SessionData::~SessionData() {
@@ -5,6 +5,10 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include "common/bit_field.h"
 #include "common/common_funcs.h"
 #include "core/hle/kernel/event.h"
@@ -620,6 +624,35 @@ private:
     void CheckAndUpdateFile(const CecDataPathType path_type, const u32 ncch_program_id,
                             std::vector<u8>& file_buffer);
 
+    /// One message file inside a box directory, as known to the in-memory index
+    struct MboxMessage {
+        std::string name; ///< Host file name within the box directory, "_<base64 message id>"
+        CecMessageHeader header;
+    };
+
+    /// In-memory index of the message-box layout on disk. The box list and each
+    /// title's outbox contents are scanned from the archive once and then kept up
+    /// to date write-through as messages and boxes are created or deleted, so box
+    /// operations don't have to re-walk the savedata directories on every call.
+    std::optional<std::vector<std::string>> cec_box_list;
+    std::unordered_map<u32, std::vector<MboxMessage>> outbox_index;
+
+    /// Returns the names of the box directories under /CEC, scanning on first use
+    const std::vector<std::string>& GetCecBoxList();
+
+    /// Returns the indexed outbox messages for a title, scanning on first use
+    std::vector<MboxMessage>& GetOutboxMessages(const u32 ncch_program_id);
+
+    /// Inserts or updates an outbox message in the index after it has been written
+    void IndexOutboxMessage(const u32 ncch_program_id, const std::vector<u8>& msg_id,
+                            const std::vector<u8>& msg_buffer);
+
+    /// Removes a deleted outbox message from the index
+    void DiscardOutboxMessage(const u32 ncch_program_id, const std::vector<u8>& msg_id);
+
+    /// Drops the cached state covering a directory that was created or deleted
+    void InvalidateMboxIndex(const CecDataPathType path_type, const u32 ncch_program_id);
+
     std::unique_ptr<FileSys::ArchiveBackend> cecd_system_save_data_archive;
 
     std::shared_ptr<Kernel::Event> cecinfo_event;
@@ -36,6 +36,9 @@ void Module::serialize(Archive& ar, const unsigned int) {
     ar& cfg_config_file_buffer;
     ar& cfg_system_save_data_archive;
     ar& preferred_region_code;
+    if (Archive::is_loading::value) {
+        RebuildBlockIndex();
+    }
 }
 SERIALIZE_IMPL(Module)
 
@@ -395,20 +398,29 @@ void Module::Interface::FormatConfig(Kernel::HLERequestContext& ctx) {
     rb.Push(cfg->FormatConfig());
 }
 
+void Module::RebuildBlockIndex() {
+    const SaveFileConfig* config =
+        reinterpret_cast<const SaveFileConfig*>(cfg_config_file_buffer.data());
+
+    block_index.clear();
+    const u32 count = std::min(u32(config->total_entries), CONFIG_FILE_MAX_BLOCK_ENTRIES);
+    for (u32 i = 0; i < count; ++i) {
+        block_index.emplace(config->block_entries[i].block_id, i);
+    }
+}
+
 ResultVal<void*> Module::GetConfigInfoBlockPointer(u32 block_id, u32 size, u32 flag) {
     // Read the header
     SaveFileConfig* config = reinterpret_cast<SaveFileConfig*>(cfg_config_file_buffer.data());
 
-    auto itr =
-        std::find_if(std::begin(config->block_entries), std::end(config->block_entries),
-                     [&](const SaveConfigBlockEntry& entry) { return entry.block_id == block_id; });
-
-    if (itr == std::end(config->block_entries)) {
+    const auto index_itr = block_index.find(block_id);
+    if (index_itr == block_index.end()) {
         LOG_ERROR(Service_CFG, "Config block 0x{:X} with flags {} and size {} was not found",
                   block_id, flag, size);
         return ResultCode(ErrorDescription::NotFound, ErrorModule::Config,
                           ErrorSummary::WrongArgument, ErrorLevel::Permanent);
     }
+    SaveConfigBlockEntry* itr = &config->block_entries[index_itr->second];
 
     if ((itr->flags & flag) == 0) {
         LOG_ERROR(Service_CFG, "Invalid flag {} for config block 0x{:X} with size {}", flag,
@@ -447,6 +459,7 @@ ResultCode Module::SetConfigInfoBlock(u32 block_id, u32 size, u32 flag, const vo
     void* pointer = nullptr;
     CASCADE_RESULT(pointer, GetConfigInfoBlockPointer(block_id, size, flag));
     memcpy(pointer, input, size);
+    config_savegame_dirty = true;
     return RESULT_SUCCESS;
 }
 
@@ -478,7 +491,9 @@ ResultCode Module::CreateConfigInfoBlk(u32 block_id, u16 size, u16 flags, const
         memcpy(&config->block_entries[config->total_entries].offset_or_data, data, size);
     }
 
+    block_index.emplace(block_id, u32(config->total_entries));
     ++config->total_entries;
+    config_savegame_dirty = true;
     return RESULT_SUCCESS;
 }
 
@@ -488,6 +503,10 @@ ResultCode Module::DeleteConfigNANDSaveFile() {
 }
 
 ResultCode Module::UpdateConfigNANDSavegame() {
+    if (!config_savegame_dirty) {
+        return RESULT_SUCCESS;
+    }
+
     FileSys::Mode mode = {};
     mode.write_flag.Assign(1);
     mode.create_flag.Assign(1);
@@ -499,6 +518,7 @@ ResultCode Module::UpdateConfigNANDSavegame() {
 
     auto config = std::move(config_result).Unwrap();
     config->Write(0, CONFIG_SAVEFILE_SIZE, 1, cfg_config_file_buffer.data());
+    config_savegame_dirty = false;
 
     return RESULT_SUCCESS;
 }
@@ -511,6 +531,7 @@ ResultCode Module::FormatConfig() {
     }
     // Delete the old data
     cfg_config_file_buffer.fill(0);
+    block_index.clear();
     // Create the header
     SaveFileConfig* config = reinterpret_cast<SaveFileConfig*>(cfg_config_file_buffer.data());
     // This value is hardcoded, taken from 3dbrew, verified by hardware, it's always the same value
@@ -697,6 +718,7 @@ ResultCode Module::LoadConfigNANDSaveFile() {
     if (config_result.Succeeded()) {
         auto config = std::move(config_result).Unwrap();
         config->Read(0, CONFIG_SAVEFILE_SIZE, cfg_config_file_buffer.data());
+        RebuildBlockIndex();
         return RESULT_SUCCESS;
     }
 
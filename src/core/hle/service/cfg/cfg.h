@@ -7,6 +7,7 @@
 #include <array>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "common/common_types.h"
@@ -479,8 +480,17 @@ public:
     ResultCode UpdateConfigNANDSavegame();
 
 private:
+    /// Rebuilds the block id -> entry index map from the savegame header. Must be called
+    /// whenever the whole buffer is replaced (savegame load, format, savestate load).
+    void RebuildBlockIndex();
+
     static constexpr u32 CONFIG_SAVEFILE_SIZE = 0x8000;
     std::array<u8, CONFIG_SAVEFILE_SIZE> cfg_config_file_buffer;
+    /// Maps block ids to their entry index in the savegame header for direct lookup. Derived
+    /// from the buffer above, so it is not serialized.
+    std::unordered_map<u32, u32> block_index;
+    /// Set when a block is modified in memory, cleared when flushed to the savegame file.
+    bool config_savegame_dirty = false;
     std::unique_ptr<FileSys::ArchiveBackend> cfg_system_save_data_archive;
     u32 preferred_region_code = 0;
 
@@ -12,6 +12,7 @@
 #include "common/common_types.h"
 #include "common/file_util.h"
 #include "common/logging/log.h"
+#include "common/settings.h"
 #include "core/core.h"
 #include "core/file_sys/archive_backend.h"
 #include "core/file_sys/archive_extsavedata.h"
@@ -96,7 +97,8 @@ ArchiveManager::OpenFileFromArchive(ArchiveHandle archive_handle, const FileSys:
         return std::make_pair(FileSys::ERR_INVALID_ARCHIVE_HANDLE, std::chrono::nanoseconds{0});
     }
 
-    const std::chrono::nanoseconds open_timeout_ns{archive->GetOpenDelayNs()};
+    const std::chrono::nanoseconds open_timeout_ns{
+        Settings::values.emulate_fs_timings ? archive->GetOpenDelayNs() : 0};
     auto backend = archive->OpenFile(path, mode);
     if (backend.Failed()) {
         return std::make_pair(backend.Code(), open_timeout_ns);
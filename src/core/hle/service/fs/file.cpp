@@ -3,8 +3,12 @@
 // Refer to the license.txt file included.
 
 #include <boost/serialization/unique_ptr.hpp>
+#include <boost/serialization/vector.hpp>
 #include "common/archives.h"
 #include "common/logging/log.h"
+#include "common/settings.h"
+#include "common/thread.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/errors.h"
 #include "core/file_sys/file_backend.h"
@@ -20,8 +24,85 @@ SERIALIZE_EXPORT_IMPL(Service::FS::FileSessionSlot)
 
 namespace Service::FS {
 
+/// Delivers the result of a read that was handed to the I/O worker. The worker fills in the
+/// result fields and signals completion; WakeUp runs on the service thread at the modeled
+/// deadline and stalls only for whatever host latency the delay window could not hide.
+class File::ReadCallback : public Kernel::HLERequestContext::WakeupCallback {
+public:
+    explicit ReadCallback(u32 buffer_id) : buffer_id(buffer_id) {}
+
+    void WakeUp([[maybe_unused]] std::shared_ptr<Kernel::Thread> thread,
+                Kernel::HLERequestContext& ctx,
+                [[maybe_unused]] Kernel::ThreadWakeupReason reason) override {
+        WaitDone();
+
+        IPC::RequestBuilder rb(ctx, 0x0802, 2, 2);
+        Kernel::MappedBuffer& buffer = ctx.GetMappedBuffer(buffer_id);
+        if (failed) {
+            rb.Push(ResultCode(error_code));
+            rb.Push<u32>(0);
+        } else {
+            buffer.Write(data.data(), 0, bytes_read);
+            rb.Push(RESULT_SUCCESS);
+            rb.Push<u32>(static_cast<u32>(bytes_read));
+        }
+        rb.PushMappedBuffer(buffer);
+    }
+
+    /// Called from the I/O worker with the outcome of the host read.
+    void Complete(const ResultVal<std::size_t>& read) {
+        if (read.Failed()) {
+            failed = true;
+            error_code = read.Code().raw;
+        } else {
+            bytes_read = static_cast<u64>(*read);
+        }
+        done_event.Set();
+    }
+
+    std::vector<u8> data; ///< Destination buffer handed to the backend on the worker
+
+private:
+    void WaitDone() {
+        if (!done) {
+            done_event.Wait();
+            done = true;
+        }
+    }
+
+    u32 buffer_id{};
+    bool failed = false;
+    u32 error_code = 0;
+    u64 bytes_read = 0;
+    /// Whether the completion event has already been consumed; set once, never reset.
+    bool done = false;
+    Common::Event done_event;
+
+    ReadCallback() = default;
+
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int) {
+        // A read still in flight on the worker cannot be captured; finish it first.
+        if (Archive::is_saving::value) {
+            WaitDone();
+        }
+        ar& boost::serialization::base_object<Kernel::HLERequestContext::WakeupCallback>(*this);
+        ar& buffer_id;
+        ar& failed;
+        ar& error_code;
+        ar& bytes_read;
+        ar& done;
+        ar& data;
+    }
+    friend class boost::serialization::access;
+};
+
 template <class Archive>
 void File::serialize(Archive& ar, const unsigned int) {
+    // Reads queued on the I/O worker would race the backend state being written out below.
+    if (Archive::is_saving::value) {
+        SyncPendingReads();
+    }
     ar& boost::serialization::base_object<Kernel::SessionRequestHandler>(*this);
     ar& path;
     ar& backend;
@@ -70,28 +151,63 @@ void File::Read(Kernel::HLERequestContext& ctx) {
     // This file session might have a specific offset from where to start reading, apply it.
     offset += file->offset;
 
+    // An earlier asynchronous read may still own the backend.
+    SyncPendingReads();
+
     if (offset + length > backend->GetSize()) {
         LOG_ERROR(Service_FS,
                   "Reading from out of bounds offset=0x{:x} length=0x{:08X} file_size=0x{:x}",
                   offset, length, backend->GetSize());
     }
 
+    const std::chrono::nanoseconds read_timeout_ns{
+        Settings::values.emulate_fs_timings ? backend->GetReadDelayNs(length) : 0};
+
+    // When there is a modeled delay window to hide it in, run the host read on the I/O worker
+    // while the client thread sleeps through the window; the wakeup callback delivers the
+    // result at the modeled deadline, or when the read finishes, whichever is later. Without
+    // a window there is nothing to overlap with, so read synchronously below and keep the
+    // zero-copy path into the mapped buffer.
+    if (read_timeout_ns.count() > 0) {
+        auto callback = std::make_shared<ReadCallback>(buffer.GetId());
+        callback->data.resize(length);
+        if (!io_worker) {
+            io_worker = std::make_unique<Common::ThreadWorker>(1, "FS:IOWorker");
+        }
+        io_worker->QueueWork([this, offset, length, callback] {
+            callback->Complete(backend->Read(offset, length, callback->data.data()));
+        });
+        ctx.SleepClientThread("file::read", read_timeout_ns, std::move(callback));
+        return;
+    }
+
     IPC::RequestBuilder rb = rp.MakeBuilder(2, 2);
 
-    std::vector<u8> data(length);
-    ResultVal<std::size_t> read = backend->Read(offset, data.size(), data.data());
+    // Read directly into the mapped buffer when it is backed by contiguous host memory,
+    // avoiding an intermediate copy of the whole block.
+    ResultVal<std::size_t> read = [&] {
+        if (u8* dest = buffer.GetWritePointer(0, length)) {
+            return backend->Read(offset, length, dest);
+        }
+        std::vector<u8> data(length);
+        ResultVal<std::size_t> result = backend->Read(offset, data.size(), data.data());
+        if (result.Succeeded()) {
+            buffer.Write(data.data(), 0, *result);
+        }
+        return result;
+    }();
     if (read.Failed()) {
         rb.Push(read.Code());
         rb.Push<u32>(0);
     } else {
-        buffer.Write(data.data(), 0, *read);
         rb.Push(RESULT_SUCCESS);
         rb.Push<u32>(static_cast<u32>(*read));
     }
     rb.PushMappedBuffer(buffer);
 
-    std::chrono::nanoseconds read_timeout_ns{backend->GetReadDelayNs(length)};
-    ctx.SleepClientThread("file::read", read_timeout_ns, nullptr);
+    // The host read has already completed at this point, so the result can be delivered on the
+    // next core timing advance.
+    ctx.SleepClientThread("file::read", std::chrono::nanoseconds{0}, nullptr);
 }
 
 void File::Write(Kernel::HLERequestContext& ctx) {
@@ -115,9 +231,18 @@ void File::Write(Kernel::HLERequestContext& ctx) {
         return;
     }
 
-    std::vector<u8> data(length);
-    buffer.Read(data.data(), 0, data.size());
-    ResultVal<std::size_t> written = backend->Write(offset, data.size(), flush != 0, data.data());
+    SyncPendingReads();
+
+    // Write directly from the mapped buffer when it is backed by contiguous host memory,
+    // avoiding an intermediate copy of the whole block.
+    ResultVal<std::size_t> written = [&] {
+        if (const u8* src = buffer.GetReadPointer(0, length)) {
+            return backend->Write(offset, length, flush != 0, src);
+        }
+        std::vector<u8> data(length);
+        buffer.Read(data.data(), 0, data.size());
+        return backend->Write(offset, data.size(), flush != 0, data.data());
+    }();
 
     // Update file size
     file->size = backend->GetSize();
@@ -156,6 +281,7 @@ void File::SetSize(Kernel::HLERequestContext& ctx) {
         return;
     }
 
+    SyncPendingReads();
     file->size = size;
     backend->SetSize(size);
     rb.Push(RESULT_SUCCESS);
@@ -169,6 +295,7 @@ void File::Close(Kernel::HLERequestContext& ctx) {
         LOG_WARNING(Service_FS, "Closing File backend but {} clients still connected",
                     connected_sessions.size());
 
+    SyncPendingReads();
     backend->Close();
     IPC::RequestBuilder rb = rp.MakeBuilder(1, 0);
     rb.Push(RESULT_SUCCESS);
@@ -187,6 +314,7 @@ void File::Flush(Kernel::HLERequestContext& ctx) {
         return;
     }
 
+    SyncPendingReads();
     backend->Flush();
     rb.Push(RESULT_SUCCESS);
 }
@@ -275,6 +403,17 @@ void File::OpenSubFile(Kernel::HLERequestContext& ctx) {
     rb.PushMoveObjects(client);
 }
 
+File::~File() {
+    // Leave no worker task behind that would touch the backend after it is destroyed
+    SyncPendingReads();
+}
+
+void File::SyncPendingReads() {
+    if (io_worker) {
+        io_worker->WaitForRequests();
+    }
+}
+
 std::shared_ptr<Kernel::ClientSession> File::Connect() {
     auto [server, client] = kernel.CreateSessionPair(GetName());
     ClientConnected(server);
@@ -301,3 +440,5 @@ std::size_t File::GetSessionFileSize(std::shared_ptr<Kernel::ServerSession> sess
 }
 
 } // namespace Service::FS
+
+SERIALIZE_EXPORT_IMPL(Service::FS::File::ReadCallback)
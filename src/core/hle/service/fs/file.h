@@ -10,6 +10,12 @@
 #include "core/global.h"
 #include "core/hle/service/service.h"
 
+namespace Common {
+template <class StateType>
+class StatefulThreadWorker;
+using ThreadWorker = StatefulThreadWorker<void>;
+} // namespace Common
+
 namespace Core {
 class System;
 }
@@ -41,7 +47,9 @@ class File final : public ServiceFramework<File, FileSessionSlot> {
 public:
     File(Kernel::KernelSystem& kernel, std::unique_ptr<FileSys::FileBackend>&& backend,
          const FileSys::Path& path);
-    ~File() = default;
+    ~File();
+
+    class ReadCallback;
 
     std::string GetName() const {
         return "Path: " + path.DebugStr();
@@ -73,8 +81,16 @@ private:
     void OpenLinkFile(Kernel::HLERequestContext& ctx);
     void OpenSubFile(Kernel::HLERequestContext& ctx);
 
+    /// Blocks until every read queued on the I/O worker has completed, making it safe to
+    /// access the backend from the service thread again.
+    void SyncPendingReads();
+
     Kernel::KernelSystem& kernel;
 
+    /// Runs host reads while the requesting thread sleeps through the modeled delay; created
+    /// on first use. A single thread per file keeps backend accesses ordered.
+    std::unique_ptr<Common::ThreadWorker> io_worker;
+
     File(Kernel::KernelSystem& kernel);
     File();
 
@@ -87,3 +103,4 @@ private:
 
 BOOST_CLASS_EXPORT_KEY(Service::FS::FileSessionSlot)
 BOOST_CLASS_EXPORT_KEY(Service::FS::File)
+BOOST_CLASS_EXPORT_KEY(Service::FS::File::ReadCallback)
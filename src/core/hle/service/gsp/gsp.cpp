@@ -13,8 +13,12 @@ namespace Service::GSP {
 static std::weak_ptr<GSP_GPU> gsp_gpu;
 
 void SignalInterrupt(InterruptId interrupt_id) {
+    // Standalone tools like citra-gpu-replay drive the GPU without any HLE services; there
+    // is nobody to deliver the interrupt to in that case.
     auto gpu = gsp_gpu.lock();
-    ASSERT(gpu != nullptr);
+    if (gpu == nullptr) {
+        return;
+    }
     return gpu->SignalInterrupt(interrupt_id);
 }
 
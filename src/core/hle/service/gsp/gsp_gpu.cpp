@@ -92,9 +92,9 @@ u32 GSP_GPU::GetUnusedThreadId() const {
 }
 
 /// Gets a pointer to a thread command buffer in GSP shared memory
-static inline u8* GetCommandBuffer(std::shared_ptr<Kernel::SharedMemory> shared_memory,
-                                   u32 thread_id) {
-    return shared_memory->GetPointer(0x800 + (thread_id * sizeof(CommandBuffer)));
+static inline CommandBuffer* GetCommandBuffer(u8* shared_memory_base, u32 thread_id) {
+    return reinterpret_cast<CommandBuffer*>(shared_memory_base + 0x800 +
+                                            (thread_id * sizeof(CommandBuffer)));
 }
 
 FrameBufferUpdate* GSP_GPU::GetFrameBufferInfo(u32 thread_id, u32 screen_index) {
@@ -102,15 +102,13 @@ FrameBufferUpdate* GSP_GPU::GetFrameBufferInfo(u32 thread_id, u32 screen_index)
 
     // For each thread there are two FrameBufferUpdate fields
     u32 offset = 0x200 + (2 * thread_id + screen_index) * sizeof(FrameBufferUpdate);
-    u8* ptr = shared_memory->GetPointer(offset);
-    return reinterpret_cast<FrameBufferUpdate*>(ptr);
+    return reinterpret_cast<FrameBufferUpdate*>(shared_memory_base + offset);
 }
 
 /// Gets a pointer to the interrupt relay queue for a given thread index
-static inline InterruptRelayQueue* GetInterruptRelayQueue(
-    std::shared_ptr<Kernel::SharedMemory> shared_memory, u32 thread_id) {
-    u8* ptr = shared_memory->GetPointer(sizeof(InterruptRelayQueue) * thread_id);
-    return reinterpret_cast<InterruptRelayQueue*>(ptr);
+static inline InterruptRelayQueue* GetInterruptRelayQueue(u8* shared_memory_base, u32 thread_id) {
+    return reinterpret_cast<InterruptRelayQueue*>(shared_memory_base +
+                                                  sizeof(InterruptRelayQueue) * thread_id);
 }
 
 void GSP_GPU::ClientDisconnected(std::shared_ptr<Kernel::ServerSession> server_session) {
@@ -426,7 +424,8 @@ void GSP_GPU::SignalInterruptForThread(InterruptId interrupt_id, u32 thread_id)
         LOG_WARNING(Service_GSP, "cannot synchronize until GSP event has been created!");
         return;
     }
-    InterruptRelayQueue* interrupt_relay_queue = GetInterruptRelayQueue(shared_memory, thread_id);
+    InterruptRelayQueue* interrupt_relay_queue =
+        GetInterruptRelayQueue(shared_memory_base, thread_id);
     u8 next = interrupt_relay_queue->index;
     next += interrupt_relay_queue->number_interrupts;
     next = next % 0x34; // 0x34 is the number of interrupt slots
@@ -451,6 +450,13 @@ void GSP_GPU::SignalInterruptForThread(InterruptId interrupt_id, u32 thread_id)
             info->is_dirty.Assign(false);
         }
     }
+
+    if (deferring_interrupts) {
+        // The relay queue slot above is still pushed per interrupt; only the event wakeup is
+        // batched, since the guest consumes every queued interrupt on a single wakeup.
+        deferred_interrupt_threads |= 1u << thread_id;
+        return;
+    }
     interrupt_event->Signal();
 }
 
@@ -493,6 +499,17 @@ static void ExecuteCommand(const Command& command, u32 thread_id) {
         GPU::Write<u32>(0x1EF00000 + 4 * id, data);
     };
 
+    // Configuration registers have no write side effects (only the trigger registers do), so
+    // without an attached debugger or tracer they are staged straight into the register file
+    // instead of taking the full MMIO write dispatch per register.
+    static auto StageGPURegister = [](u32 id, u32 data) {
+        if (Pica::g_debug_context) {
+            WriteGPURegister(id, data);
+        } else {
+            GPU::g_regs[id] = data;
+        }
+    };
+
     switch (command.id) {
 
     // GX request DMA - typically used for copying memory from GSP heap to VRAM
@@ -526,9 +543,9 @@ static void ExecuteCommand(const Command& command, u32 thread_id) {
             // actually flush them in Citra.
         }
 
-        WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(command_processor_config.address)),
+        StageGPURegister(static_cast<u32>(GPU_REG_INDEX(command_processor_config.address)),
                          VirtualToPhysicalAddress(params.address) >> 3);
-        WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(command_processor_config.size)),
+        StageGPURegister(static_cast<u32>(GPU_REG_INDEX(command_processor_config.size)),
                          params.size);
 
         // TODO: Not sure if we are supposed to always write this .. seems to trigger processing
@@ -546,22 +563,23 @@ static void ExecuteCommand(const Command& command, u32 thread_id) {
         auto& params = command.memory_fill;
 
         if (params.start1 != 0) {
-            WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[0].address_start)),
+            StageGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[0].address_start)),
                              VirtualToPhysicalAddress(params.start1) >> 3);
-            WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[0].address_end)),
+            StageGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[0].address_end)),
                              VirtualToPhysicalAddress(params.end1) >> 3);
-            WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[0].value_32bit)),
+            StageGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[0].value_32bit)),
                              params.value1);
+            // The control word holds the trigger bit, so it has to take the real write path
             WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[0].control)),
                              params.control1);
         }
 
         if (params.start2 != 0) {
-            WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[1].address_start)),
+            StageGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[1].address_start)),
                              VirtualToPhysicalAddress(params.start2) >> 3);
-            WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[1].address_end)),
+            StageGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[1].address_end)),
                              VirtualToPhysicalAddress(params.end2) >> 3);
-            WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[1].value_32bit)),
+            StageGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[1].value_32bit)),
                              params.value2);
             WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(memory_fill_config[1].control)),
                              params.control2);
@@ -571,15 +589,15 @@ static void ExecuteCommand(const Command& command, u32 thread_id) {
 
     case CommandId::SET_DISPLAY_TRANSFER: {
         auto& params = command.display_transfer;
-        WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.input_address)),
+        StageGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.input_address)),
                          VirtualToPhysicalAddress(params.in_buffer_address) >> 3);
-        WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.output_address)),
+        StageGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.output_address)),
                          VirtualToPhysicalAddress(params.out_buffer_address) >> 3);
-        WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.input_size)),
+        StageGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.input_size)),
                          params.in_buffer_size);
-        WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.output_size)),
+        StageGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.output_size)),
                          params.out_buffer_size);
-        WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.flags)),
+        StageGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.flags)),
                          params.flags);
         WriteGPURegister(static_cast<u32>(GPU_REG_INDEX(display_transfer_config.trigger)), 1);
         break;
@@ -587,17 +605,17 @@ static void ExecuteCommand(const Command& command, u32 thread_id) {
 
     case CommandId::SET_TEXTURE_COPY: {
         auto& params = command.texture_copy;
-        WriteGPURegister((u32)GPU_REG_INDEX(display_transfer_config.input_address),
+        StageGPURegister((u32)GPU_REG_INDEX(display_transfer_config.input_address),
                          VirtualToPhysicalAddress(params.in_buffer_address) >> 3);
-        WriteGPURegister((u32)GPU_REG_INDEX(display_transfer_config.output_address),
+        StageGPURegister((u32)GPU_REG_INDEX(display_transfer_config.output_address),
                          VirtualToPhysicalAddress(params.out_buffer_address) >> 3);
-        WriteGPURegister((u32)GPU_REG_INDEX(display_transfer_config.texture_copy.size),
+        StageGPURegister((u32)GPU_REG_INDEX(display_transfer_config.texture_copy.size),
                          params.size);
-        WriteGPURegister((u32)GPU_REG_INDEX(display_transfer_config.texture_copy.input_size),
+        StageGPURegister((u32)GPU_REG_INDEX(display_transfer_config.texture_copy.input_size),
                          params.in_width_gap);
-        WriteGPURegister((u32)GPU_REG_INDEX(display_transfer_config.texture_copy.output_size),
+        StageGPURegister((u32)GPU_REG_INDEX(display_transfer_config.texture_copy.output_size),
                          params.out_width_gap);
-        WriteGPURegister((u32)GPU_REG_INDEX(display_transfer_config.flags), params.flags);
+        StageGPURegister((u32)GPU_REG_INDEX(display_transfer_config.flags), params.flags);
 
         // NOTE: Actual GSP ORs 1 with current register instead of overwriting. Doesn't seem to
         // matter.
@@ -640,13 +658,23 @@ void GSP_GPU::SetLcdForceBlack(Kernel::HLERequestContext& ctx) {
 void GSP_GPU::TriggerCmdReqQueue(Kernel::HLERequestContext& ctx) {
     IPC::RequestParser rp(ctx, 0xC, 0, 0);
 
+    // Drain every queue as one batch, deferring the interrupt event wakeups the executed
+    // commands produce until the whole batch has completed.
+    deferring_interrupts = true;
+
+    // Checked once per command list rather than per command, so that without an attached
+    // debugger the submission loop pays a single flag load
+    const bool debugger_active = g_debugger.IsActive();
+
     // Iterate through each thread's command queue...
-    for (unsigned thread_id = 0; thread_id < 0x4; ++thread_id) {
-        CommandBuffer* command_buffer = (CommandBuffer*)GetCommandBuffer(shared_memory, thread_id);
+    for (unsigned thread_id = 0; thread_id < MaxGSPThreads; ++thread_id) {
+        CommandBuffer* command_buffer = GetCommandBuffer(shared_memory_base, thread_id);
 
         // Iterate through each command...
         for (unsigned i = 0; i < command_buffer->number_commands; ++i) {
-            g_debugger.GXCommandProcessed((u8*)&command_buffer->commands[i]);
+            if (debugger_active) {
+                g_debugger.GXCommandProcessed(command_buffer->commands[i]);
+            }
 
             // Decode and execute command
             ExecuteCommand(command_buffer->commands[i], thread_id);
@@ -656,6 +684,18 @@ void GSP_GPU::TriggerCmdReqQueue(Kernel::HLERequestContext& ctx) {
         }
     }
 
+    deferring_interrupts = false;
+    for (u32 thread_id = 0; thread_id < MaxGSPThreads; ++thread_id) {
+        if ((deferred_interrupt_threads & (1u << thread_id)) == 0) {
+            continue;
+        }
+        SessionData* session_data = FindRegisteredThreadData(thread_id);
+        if (session_data != nullptr && session_data->interrupt_event != nullptr) {
+            session_data->interrupt_event->Signal();
+        }
+    }
+    deferred_interrupt_threads = 0;
+
     IPC::RequestBuilder rb = rp.MakeBuilder(1, 0);
     rb.Push(RESULT_SUCCESS);
 }
@@ -862,6 +902,7 @@ GSP_GPU::GSP_GPU(Core::System& system) : ServiceFramework("gsp::Gpu", 2), system
                                             MemoryPermission::ReadWrite, 0,
                                             Kernel::MemoryRegion::BASE, "GSP:SharedMemory")
                         .Unwrap();
+    shared_memory_base = shared_memory->GetPointer();
 
     first_initialization = true;
 };
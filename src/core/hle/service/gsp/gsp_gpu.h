@@ -14,6 +14,7 @@
 #include "common/common_types.h"
 #include "core/hle/kernel/event.h"
 #include "core/hle/kernel/hle_ipc.h"
+#include "core/hle/kernel/shared_memory.h"
 #include "core/hle/result.h"
 #include "core/hle/service/service.h"
 
@@ -21,10 +22,6 @@ namespace Core {
 class System;
 }
 
-namespace Kernel {
-class SharedMemory;
-} // namespace Kernel
-
 namespace Service::GSP {
 
 /// GSP interrupt ID
@@ -481,6 +478,16 @@ private:
     /// Thread ids currently in use by the sessions connected to the GSPGPU service.
     std::array<bool, MaxGSPThreads> used_thread_ids = {false, false, false, false};
 
+    /// Resolved base of the GSP shared memory, to avoid re-translating it for every command.
+    u8* shared_memory_base = nullptr;
+
+    /// When true, interrupt events are collected in `deferred_interrupt_threads` instead of
+    /// being signaled immediately, until the current GX command batch completes.
+    bool deferring_interrupts = false;
+
+    /// Bitmask of GSP threads with an interrupt signal deferred until the end of the batch.
+    u32 deferred_interrupt_threads = 0;
+
     friend class SessionData;
 
     template <class Archive>
@@ -491,6 +498,9 @@ private:
         ar& first_initialization;
         ar& used_thread_ids;
         ar& saved_vram;
+        if (Archive::is_loading::value) {
+            shared_memory_base = shared_memory->GetPointer();
+        }
     }
 
     friend class boost::serialization::access;
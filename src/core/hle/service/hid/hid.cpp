@@ -49,6 +49,9 @@ void Module::serialize(Archive& ar, const unsigned int file_version) {
     if (file_version >= 1) {
         ar& state.hex;
     }
+    if (file_version >= 2) {
+        ar& force_update;
+    }
     // Update events are set in the constructor
     // Devices are set from the implementation (and are stateless afaik)
 }
@@ -158,6 +161,43 @@ void Module::UpdatePadCallback(std::uintptr_t user_data, s64 cycles_late) {
     state.circle_left.Assign(direction.left);
     state.circle_right.Assign(direction.right);
 
+    // Sample the touch screen in the same pass, so pad and touch can share one changed-state
+    // check below
+    TouchDataEntry touch_entry{};
+    bool pressed = false;
+    float x, y;
+    std::tie(x, y, pressed) = touch_device->GetStatus();
+    if (!pressed && touch_btn_device) {
+        std::tie(x, y, pressed) = touch_btn_device->GetStatus();
+    }
+    touch_entry.x = static_cast<u16>(x * Core::kScreenBottomWidth);
+    touch_entry.y = static_cast<u16>(y * Core::kScreenBottomHeight);
+    touch_entry.valid.Assign(pressed ? 1 : 0);
+
+    Core::Movie::GetInstance().HandleTouchStatus(touch_entry);
+
+    // TODO(xperia64): How the 3D Slider is updated by the HID module needs to be RE'd
+    // and possibly moved to its own Core::Timing event.
+    mem->pad.sliderstate_3d = (Settings::values.factor_3d.GetValue() / 100.0f);
+    system.Kernel().GetSharedPageHandler().Set3DSlider(Settings::values.factor_3d.GetValue() /
+                                                       100.0f);
+
+    // Only publish new entries (and wake waiters) when the input actually changed; the buffer
+    // contents a polling title sees are identical either way.
+    const PadDataEntry& last_pad_entry = mem->pad.entries[mem->pad.index];
+    const TouchDataEntry& last_touch_entry = mem->touch.entries[mem->touch.index];
+    const bool pad_changed = state.hex != last_pad_entry.current_state.hex ||
+                             circle_pad_x != last_pad_entry.circle_pad_x ||
+                             circle_pad_y != last_pad_entry.circle_pad_y;
+    const bool touch_changed = touch_entry.x != last_touch_entry.x ||
+                               touch_entry.y != last_touch_entry.y ||
+                               touch_entry.valid.Value() != last_touch_entry.valid.Value();
+    if (!force_update && !pad_changed && !touch_changed) {
+        system.CoreTiming().ScheduleEvent(pad_update_ticks - cycles_late, pad_update_event);
+        return;
+    }
+    force_update = false;
+
     mem->pad.current_state.hex = state.hex;
     mem->pad.index = next_pad_index;
     next_pad_index = (next_pad_index + 1) % mem->pad.entries.size();
@@ -188,19 +228,7 @@ void Module::UpdatePadCallback(std::uintptr_t user_data, s64 cycles_late) {
     mem->touch.index = next_touch_index;
     next_touch_index = (next_touch_index + 1) % mem->touch.entries.size();
 
-    // Get the current touch entry
-    TouchDataEntry& touch_entry = mem->touch.entries[mem->touch.index];
-    bool pressed = false;
-    float x, y;
-    std::tie(x, y, pressed) = touch_device->GetStatus();
-    if (!pressed && touch_btn_device) {
-        std::tie(x, y, pressed) = touch_btn_device->GetStatus();
-    }
-    touch_entry.x = static_cast<u16>(x * Core::kScreenBottomWidth);
-    touch_entry.y = static_cast<u16>(y * Core::kScreenBottomHeight);
-    touch_entry.valid.Assign(pressed ? 1 : 0);
-
-    Core::Movie::GetInstance().HandleTouchStatus(touch_entry);
+    mem->touch.entries[mem->touch.index] = touch_entry;
 
     // TODO(bunnei): We're not doing anything with offset 0xA8 + 0x18 of HID SharedMemory, which
     // supposedly is "Touch-screen entry, which contains the raw coordinate data prior to being
@@ -216,12 +244,6 @@ void Module::UpdatePadCallback(std::uintptr_t user_data, s64 cycles_late) {
     event_pad_or_touch_1->Signal();
     event_pad_or_touch_2->Signal();
 
-    // TODO(xperia64): How the 3D Slider is updated by the HID module needs to be RE'd
-    // and possibly moved to its own Core::Timing event.
-    mem->pad.sliderstate_3d = (Settings::values.factor_3d.GetValue() / 100.0f);
-    system.Kernel().GetSharedPageHandler().Set3DSlider(Settings::values.factor_3d.GetValue() /
-                                                       100.0f);
-
     // Reschedule recurrent event
     system.CoreTiming().ScheduleEvent(pad_update_ticks - cycles_late, pad_update_event);
 }
@@ -343,6 +343,10 @@ private:
     int enable_accelerometer_count = 0; // positive means enabled
     int enable_gyroscope_count = 0;     // positive means enabled
 
+    /// Forces the next update to publish pad/touch entries even if the input did not change,
+    /// so that titles waiting on the update events right after startup get their first sample.
+    bool force_update = true;
+
     Core::TimingEventType* pad_update_event;
     Core::TimingEventType* accelerometer_update_event;
     Core::TimingEventType* gyroscope_update_event;
@@ -367,4 +371,4 @@ void InstallInterfaces(Core::System& system);
 
 SERVICE_CONSTRUCT(Service::HID::Module)
 BOOST_CLASS_EXPORT_KEY(Service::HID::Module)
-BOOST_CLASS_VERSION(Service::HID::Module, 1)
+BOOST_CLASS_VERSION(Service::HID::Module, 2)
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <atomic>
+#include <mutex>
 #include <unordered_map>
 #include <cryptopp/aes.h>
 #include <cryptopp/modes.h>
@@ -55,24 +56,88 @@ const ResultCode ERROR_WRONG_CERT_HANDLE = // 0xD8A0A0C9
 const ResultCode ERROR_CERT_ALREADY_SET = // 0xD8A0A03D
     ResultCode(61, ErrorModule::HTTP, ErrorSummary::InvalidState, ErrorLevel::Permanent);
 
+#ifdef ENABLE_WEB_SERVICE
+namespace {
+
+/// Returns the scheme://host[:port] prefix of a URL, which identifies the connection a
+/// request needs.
+std::string SchemeHostPort(const std::string& url) {
+    const std::size_t scheme_end = url.find("://");
+    if (scheme_end == std::string::npos) {
+        return url;
+    }
+    return url.substr(0, url.find('/', scheme_end + 3));
+}
+
+/// Keeps the keep-alive clients of finished requests around so that consecutive requests to
+/// the same host reuse the established connection instead of re-resolving DNS and redoing
+/// the TLS handshake. Clients are keyed by host and client certificate, and a client is
+/// removed from the pool while a request uses it since httplib clients are not thread-safe.
+class ClientPool {
+public:
+    std::unique_ptr<httplib::Client> Acquire(const std::string& key) {
+        std::lock_guard lock(mutex);
+        const auto it = pool.find(key);
+        if (it == pool.end()) {
+            return nullptr;
+        }
+        auto client = std::move(it->second);
+        pool.erase(it);
+        return client;
+    }
+
+    void Release(const std::string& key, std::unique_ptr<httplib::Client> client) {
+        std::lock_guard lock(mutex);
+        // When the pool is full the client is simply dropped, closing its connection.
+        if (pool.size() < MaxIdleClients) {
+            pool.emplace(key, std::move(client));
+        }
+    }
+
+private:
+    /// The maximum number of idle connections kept open across all hosts.
+    static constexpr std::size_t MaxIdleClients = 8;
+
+    std::mutex mutex;
+    std::unordered_multimap<std::string, std::unique_ptr<httplib::Client>> pool;
+};
+
+ClientPool& GetClientPool() {
+    static ClientPool pool;
+    return pool;
+}
+
+} // namespace
+#endif
+
 void Context::MakeRequest() {
     ASSERT(state == RequestState::NotStarted);
 
 #ifdef ENABLE_WEB_SERVICE
-    std::unique_ptr<httplib::Client> client = std::make_unique<httplib::Client>(url.c_str());
-    SSL_CTX* ctx = client->ssl_context();
-    if (ctx) {
-        if (auto client_cert = ssl_config.client_cert_ctx.lock()) {
-            SSL_CTX_use_certificate_ASN1(ctx, static_cast<int>(client_cert->certificate.size()),
-                                         client_cert->certificate.data());
-            SSL_CTX_use_PrivateKey_ASN1(EVP_PKEY_RSA, ctx, client_cert->private_key.data(),
-                                        static_cast<long>(client_cert->private_key.size()));
+    std::string pool_key = SchemeHostPort(url);
+    if (auto client_cert = ssl_config.client_cert_ctx.lock()) {
+        pool_key += '|' + std::to_string(client_cert->handle);
+    }
+
+    std::unique_ptr<httplib::Client> client = GetClientPool().Acquire(pool_key);
+    if (!client) {
+        client = std::make_unique<httplib::Client>(url.c_str());
+        client->set_keep_alive(true);
+        SSL_CTX* ctx = client->ssl_context();
+        if (ctx) {
+            if (auto client_cert = ssl_config.client_cert_ctx.lock()) {
+                SSL_CTX_use_certificate_ASN1(ctx,
+                                             static_cast<int>(client_cert->certificate.size()),
+                                             client_cert->certificate.data());
+                SSL_CTX_use_PrivateKey_ASN1(EVP_PKEY_RSA, ctx, client_cert->private_key.data(),
+                                            static_cast<long>(client_cert->private_key.size()));
+            }
+
+            // TODO(B3N30): Check for SSLOptions-Bits and set the verify method accordingly
+            // https://www.3dbrew.org/wiki/SSL_Services#SSLOpt
+            // Hack: Since for now RootCerts are not implemented we set the VerifyMode to None.
+            SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, NULL);
         }
-
-        // TODO(B3N30): Check for SSLOptions-Bits and set the verify method accordingly
-        // https://www.3dbrew.org/wiki/SSL_Services#SSLOpt
-        // Hack: Since for now RootCerts are not implemented we set the VerifyMode to None.
-        SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, NULL);
     }
 
     state = RequestState::InProgress;
@@ -101,12 +166,14 @@ void Context::MakeRequest() {
     }
 
     if (!client->send(request, response, error)) {
+        // The client is dropped here, so the next request opens a fresh connection.
         LOG_ERROR(Service_HTTP, "Request failed: {}", error);
         state = RequestState::TimedOut;
     } else {
         LOG_DEBUG(Service_HTTP, "Request successful");
         // TODO(B3N30): Verify this state on HW
         state = RequestState::ReadyToDownloadContent;
+        GetClientPool().Release(pool_key, std::move(client));
     }
 #else
     LOG_ERROR(Service_HTTP, "Tried to make request but WebServices is not enabled in this build");
@@ -21,13 +21,16 @@ SERVICE_CONSTRUCT_IMPL(Service::IR::IR_RST)
 namespace Service::IR {
 
 template <class Archive>
-void IR_RST::serialize(Archive& ar, const unsigned int) {
+void IR_RST::serialize(Archive& ar, const unsigned int file_version) {
     ar& boost::serialization::base_object<Kernel::SessionRequestHandler>(*this);
     ar& update_event;
     ar& shared_memory;
     ar& next_pad_index;
     ar& raw_c_stick;
     ar& update_period;
+    if (file_version >= 1) {
+        ar& force_update;
+    }
     // update_callback_id and input devices are set separately
     ReloadInputDevices();
 }
@@ -96,6 +99,18 @@ void IR_RST::UpdateCallback(std::uintptr_t user_data, s64 cycles_late) {
     // TODO (wwylele): implement raw C-stick data for raw_c_stick = true
 
     const u32 last_entry_index = mem->index;
+
+    // Only publish a new entry (and wake waiters) when the input actually changed; the
+    // buffer content a polling title sees is identical either way.
+    const PadDataEntry& last_entry = mem->entries[last_entry_index];
+    if (!force_update && state.hex == last_entry.current_state.hex &&
+        c_stick_x == last_entry.c_stick_x && c_stick_y == last_entry.c_stick_y) {
+        system.CoreTiming().ScheduleEvent(msToCycles(update_period) - cycles_late,
+                                          update_callback_id);
+        return;
+    }
+    force_update = false;
+
     mem->index = next_pad_index;
     next_pad_index = (next_pad_index + 1) % mem->entries.size();
 
@@ -144,6 +159,7 @@ void IR_RST::Initialize(Kernel::HLERequestContext& ctx) {
 
     next_pad_index = 0;
     is_device_reload_pending.store(true);
+    force_update = true;
     system.CoreTiming().ScheduleEvent(msToCycles(update_period), update_callback_id);
 
     IPC::RequestBuilder rb = rp.MakeBuilder(1, 0);
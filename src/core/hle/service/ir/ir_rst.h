@@ -6,6 +6,7 @@
 
 #include <atomic>
 #include <memory>
+#include <boost/serialization/version.hpp>
 #include "common/bit_field.h"
 #include "common/common_types.h"
 #include "common/swap.h"
@@ -87,6 +88,9 @@ private:
     std::atomic<bool> is_device_reload_pending{false};
     bool raw_c_stick{false};
     int update_period{0};
+    /// Forces the next update to publish an entry even if the input did not change, so that
+    /// titles waiting on the update event right after Initialize get their first sample.
+    bool force_update{true};
 
     template <class Archive>
     void serialize(Archive& ar, const unsigned int);
@@ -96,4 +100,5 @@ private:
 } // namespace Service::IR
 
 BOOST_CLASS_EXPORT_KEY(Service::IR::IR_RST)
+BOOST_CLASS_VERSION(Service::IR::IR_RST, 1)
 SERVICE_CONSTRUCT(Service::IR::IR_RST)
@@ -265,23 +265,38 @@ void Cipher(const DerivedKeys& keys, const NTAG215File& in_data, NTAG215File& ou
 }
 
 bool LoadKeys(InternalKey& locked_secret, InternalKey& unfixed_info) {
-    const auto citra_keys_dir = FileUtil::GetUserPath(FileUtil::UserPath::SysDataDir);
-    auto keys_file = FileUtil::IOFile(citra_keys_dir + "key_retail.bin", "rb");
-
-    if (!keys_file.IsOpen()) {
-        LOG_ERROR(Service_NFC, "No keys detected");
-        return false;
-    }
-
-    if (keys_file.ReadBytes(&unfixed_info, sizeof(InternalKey)) != sizeof(InternalKey)) {
-        LOG_ERROR(Service_NFC, "Failed to read unfixed_info");
-        return false;
-    }
-    if (keys_file.ReadBytes(&locked_secret, sizeof(InternalKey)) != sizeof(InternalKey)) {
-        LOG_ERROR(Service_NFC, "Failed to read locked-secret");
-        return false;
+    // DecodeAmiibo/EncodeAmiibo call this on every mount and flush, so cache the file
+    // contents after the first successful read. Failed reads are not cached so that a key
+    // file dropped in mid-session is still picked up.
+    static bool keys_cached = false;
+    static InternalKey cached_locked_secret{};
+    static InternalKey cached_unfixed_info{};
+
+    if (!keys_cached) {
+        const auto citra_keys_dir = FileUtil::GetUserPath(FileUtil::UserPath::SysDataDir);
+        auto keys_file = FileUtil::IOFile(citra_keys_dir + "key_retail.bin", "rb");
+
+        if (!keys_file.IsOpen()) {
+            LOG_ERROR(Service_NFC, "No keys detected");
+            return false;
+        }
+
+        if (keys_file.ReadBytes(&cached_unfixed_info, sizeof(InternalKey)) !=
+            sizeof(InternalKey)) {
+            LOG_ERROR(Service_NFC, "Failed to read unfixed_info");
+            return false;
+        }
+        if (keys_file.ReadBytes(&cached_locked_secret, sizeof(InternalKey)) !=
+            sizeof(InternalKey)) {
+            LOG_ERROR(Service_NFC, "Failed to read locked-secret");
+            return false;
+        }
+
+        keys_cached = true;
     }
 
+    locked_secret = cached_locked_secret;
+    unfixed_info = cached_unfixed_info;
     return true;
 }
 
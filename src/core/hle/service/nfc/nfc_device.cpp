@@ -4,6 +4,7 @@
 
 #include <array>
 #include <chrono>
+#include <cstring>
 #include <boost/crc.hpp>
 #include <cryptopp/osrng.h>
 
@@ -318,6 +319,14 @@ ResultCode NfcDevice::Flush() {
 
     is_data_moddified = false;
 
+    // Keep the decryption cache in sync with the data just written back so the next mount of
+    // this image is also served from the cache.
+    if (!is_plain_amiibo) {
+        decoded_cache_source = encrypted_tag.file;
+        decoded_cache = tag.file;
+        decoded_cache_valid = true;
+    }
+
     return RESULT_SUCCESS;
 }
 
@@ -342,11 +351,24 @@ ResultCode NfcDevice::Mount() {
         return RESULT_SUCCESS;
     }
 
+    // Games poll the reader by repeatedly mounting the tag. Reuse the previous decryption
+    // when the encrypted image hasn't changed instead of re-running the crypto pipeline.
+    if (decoded_cache_valid && std::memcmp(&decoded_cache_source, &encrypted_tag.file,
+                                           sizeof(EncryptedNTAG215File)) == 0) {
+        tag.file = decoded_cache;
+        device_state = DeviceState::TagMounted;
+        return RESULT_SUCCESS;
+    }
+
     if (!AmiiboCrypto::DecodeAmiibo(encrypted_tag.file, tag.file)) {
         LOG_ERROR(Service_NFC, "Can't decode amiibo {}", device_state);
         return ResultCorruptedData;
     }
 
+    decoded_cache_source = encrypted_tag.file;
+    decoded_cache = tag.file;
+    decoded_cache_valid = true;
+
     device_state = DeviceState::TagMounted;
     return RESULT_SUCCESS;
 }
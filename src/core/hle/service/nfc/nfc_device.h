@@ -99,6 +99,12 @@ private:
     SerializableAmiiboFile tag{};
     SerializableEncryptedAmiiboFile encrypted_tag{};
 
+    /// Caches the last successful decryption so that remounting an unchanged tag image skips
+    /// the HMAC/AES work. Not serialized; a cache miss after loading a state is harmless.
+    bool decoded_cache_valid{};
+    EncryptedNTAG215File decoded_cache_source{};
+    NTAG215File decoded_cache{};
+
     template <class Archive>
     void serialize(Archive& ar, const unsigned int);
     friend class boost::serialization::access;
@@ -229,6 +229,7 @@ void NWM_UDS::HandleEAPoLPacket(const Network::WifiPacket& packet) {
 
         node_info[node_id - 1] = node;
         network_info.total_nodes++;
+        beacon_frame_dirty = true;
 
         node_map[packet.transmitter_address].node_id = node.network_node_id;
         node_map[packet.transmitter_address].connected = true;
@@ -324,43 +325,66 @@ void NWM_UDS::HandleEAPoLPacket(const Network::WifiPacket& packet) {
 
 void NWM_UDS::HandleSecureDataPacket(const Network::WifiPacket& packet) {
     auto secure_data = ParseSecureDataHeader(packet.data);
-    std::unique_lock hle_lock(HLE::g_hle_lock, std::defer_lock);
-    std::unique_lock lock(connection_status_mutex, std::defer_lock);
-    std::lock(hle_lock, lock);
 
-    if (connection_status.status != NetworkStatus::ConnectedAsHost &&
-        connection_status.status != NetworkStatus::ConnectedAsClient) {
-        // TODO(B3N30): Handle spectators
-        LOG_DEBUG(Service_NWM, "Ignored SecureDataPacket, because connection status is {}",
-                  static_cast<u32>(connection_status.status));
-        return;
-    }
+    // Filtering and routing only need the connection status, so decide what to do with the
+    // frame without taking the HLE lock. Dropped and forwarded frames then never contend
+    // with the emulated core, and frames for a bound channel reach their event with the HLE
+    // lock held only for the queue insertion and signal.
+    bool route_packet = false;
+    {
+        std::lock_guard lock(connection_status_mutex);
 
-    if (secure_data.src_node_id == connection_status.network_node_id) {
-        // Ignore packets that came from ourselves.
-        return;
-    }
+        if (connection_status.status != NetworkStatus::ConnectedAsHost &&
+            connection_status.status != NetworkStatus::ConnectedAsClient) {
+            // TODO(B3N30): Handle spectators
+            LOG_DEBUG(Service_NWM, "Ignored SecureDataPacket, because connection status is {}",
+                      static_cast<u32>(connection_status.status));
+            return;
+        }
 
-    if (secure_data.dest_node_id != connection_status.network_node_id &&
-        secure_data.dest_node_id != BroadcastNetworkNodeId) {
-        // The packet wasn't addressed to us, we can only act as a router if we're the host.
-        // However, we might have received this packet due to a broadcast from the host, in that
-        // case just ignore it.
-        if (packet.destination_address != Network::BroadcastMac &&
-            connection_status.status != NetworkStatus::ConnectedAsHost) {
-            LOG_ERROR(Service_NWM, "Received packet addressed to others but we're not a host");
+        if (secure_data.src_node_id == connection_status.network_node_id) {
+            // Ignore packets that came from ourselves.
             return;
         }
 
-        if (connection_status.status == NetworkStatus::ConnectedAsHost &&
+        if (secure_data.dest_node_id != connection_status.network_node_id &&
             secure_data.dest_node_id != BroadcastNetworkNodeId) {
-            // Broadcast the packet so the right receiver can get it.
-            // TODO(B3N30): Is there a flag that makes this kind of routing be unicast instead of
-            // multicast? Perhaps this is a way to allow spectators to see some of the packets.
-            Network::WifiPacket out_packet = packet;
-            out_packet.destination_address = Network::BroadcastMac;
-            SendPacket(out_packet);
+            // The packet wasn't addressed to us, we can only act as a router if we're the host.
+            // However, we might have received this packet due to a broadcast from the host, in
+            // that case just ignore it.
+            if (packet.destination_address != Network::BroadcastMac &&
+                connection_status.status != NetworkStatus::ConnectedAsHost) {
+                LOG_ERROR(Service_NWM, "Received packet addressed to others but we're not a host");
+                return;
+            }
+
+            route_packet = connection_status.status == NetworkStatus::ConnectedAsHost &&
+                           secure_data.dest_node_id != BroadcastNetworkNodeId;
+            if (!route_packet) {
+                return;
+            }
+        }
+
+        if (!route_packet) {
+            // TODO(B3N30): Allow more than one bind node per channel.
+            auto channel_info = channel_data.find(secure_data.data_channel);
+            // Ignore packets from channels we're not interested in.
+            if (channel_info == channel_data.end())
+                return;
+
+            if (channel_info->second.network_node_id != BroadcastNetworkNodeId &&
+                channel_info->second.network_node_id != secure_data.src_node_id)
+                return;
         }
+    }
+
+    if (route_packet) {
+        // Broadcast the packet so the right receiver can get it.
+        // TODO(B3N30): Is there a flag that makes this kind of routing be unicast instead of
+        // multicast? Perhaps this is a way to allow spectators to see some of the packets.
+        Network::WifiPacket out_packet = packet;
+        out_packet.destination_address = Network::BroadcastMac;
+        SendPacket(out_packet);
         return;
     }
 
@@ -368,9 +392,12 @@ void NWM_UDS::HandleSecureDataPacket(const Network::WifiPacket& packet) {
     // TODO(B3N30): We don't currently send nor handle management frames.
     ASSERT(!secure_data.is_management);
 
-    // TODO(B3N30): Allow more than one bind node per channel.
+    std::unique_lock hle_lock(HLE::g_hle_lock, std::defer_lock);
+    std::unique_lock lock(connection_status_mutex, std::defer_lock);
+    std::lock(hle_lock, lock);
+
+    // Re-check the channel: it may have been unbound between the two locked sections.
     auto channel_info = channel_data.find(secure_data.data_channel);
-    // Ignore packets from channels we're not interested in.
     if (channel_info == channel_data.end())
         return;
 
@@ -506,6 +533,7 @@ void NWM_UDS::HandleDeauthenticationFrame(const Network::WifiPacket& packet) {
     // TODO(B3N30): broadcast new connection_status to clients
 
     node_it->Reset();
+    beacon_frame_dirty = true;
 
     connection_status_event->Signal();
 }
@@ -609,8 +637,6 @@ void NWM_UDS::RecvBeaconBroadcastData(Kernel::HLERequestContext& ctx) {
     Kernel::MappedBuffer out_buffer = rp.PopMappedBuffer();
     ASSERT(out_buffer.GetSize() == out_buffer_size);
 
-    std::size_t cur_buffer_size = sizeof(BeaconDataReplyHeader);
-
     // Retrieve all beacon frames that were received from the desired mac address.
     auto beacons = GetReceivedBeacons(mac_address);
 
@@ -618,7 +644,17 @@ void NWM_UDS::RecvBeaconBroadcastData(Kernel::HLERequestContext& ctx) {
     data_reply_header.total_entries = static_cast<u32>(beacons.size());
     data_reply_header.max_output_size = out_buffer_size;
 
-    // Write each of the received beacons into the buffer
+    // Stage the reply in one contiguous buffer and hand it to the guest with a single
+    // mapped-buffer write instead of a pair of writes per beacon.
+    std::size_t total_size = sizeof(BeaconDataReplyHeader);
+    for (const auto& beacon : beacons) {
+        total_size += sizeof(BeaconEntryHeader) + beacon.data.size();
+    }
+    ASSERT(total_size <= out_buffer_size);
+
+    std::vector<u8> reply(total_size);
+    std::size_t cur_buffer_size = sizeof(BeaconDataReplyHeader);
+
     for (const auto& beacon : beacons) {
         BeaconEntryHeader entry{};
         // TODO(Subv): Figure out what this size is used for.
@@ -628,18 +664,17 @@ void NWM_UDS::RecvBeaconBroadcastData(Kernel::HLERequestContext& ctx) {
         entry.header_size = sizeof(BeaconEntryHeader);
         entry.mac_address = beacon.transmitter_address;
 
-        ASSERT(cur_buffer_size < out_buffer_size);
-
-        out_buffer.Write(&entry, cur_buffer_size, sizeof(BeaconEntryHeader));
+        std::memcpy(reply.data() + cur_buffer_size, &entry, sizeof(BeaconEntryHeader));
         cur_buffer_size += sizeof(BeaconEntryHeader);
-        const unsigned char* beacon_data = beacon.data.data();
-        out_buffer.Write(beacon_data, cur_buffer_size, beacon.data.size());
+        std::memcpy(reply.data() + cur_buffer_size, beacon.data.data(), beacon.data.size());
         cur_buffer_size += beacon.data.size();
     }
 
-    // Update the total size in the structure and write it to the buffer again.
+    // Update the total size in the structure before the staged reply is written out.
     data_reply_header.total_size = static_cast<u32>(cur_buffer_size);
-    out_buffer.Write(&data_reply_header, 0, sizeof(BeaconDataReplyHeader));
+    std::memcpy(reply.data(), &data_reply_header, sizeof(BeaconDataReplyHeader));
+
+    out_buffer.Write(reply.data(), 0, reply.size());
 
     IPC::RequestBuilder rb = rp.MakeBuilder(1, 2);
     rb.Push(RESULT_SUCCESS);
@@ -899,6 +934,8 @@ ResultCode NWM_UDS::BeginHostingNetwork(const u8* network_info_buffer,
             network_channel = network_info.channel;
         else
             network_info.channel = DefaultNetworkChannel;
+
+        beacon_frame_dirty = true;
     }
 
     connection_status_event->Signal();
@@ -1348,6 +1385,7 @@ void NWM_UDS::SetApplicationData(Kernel::HLERequestContext& ctx) {
 
     network_info.application_data_size = static_cast<u8>(size);
     std::memcpy(network_info.application_data.data(), application_data.data(), size);
+    beacon_frame_dirty = true;
 
     rb.Push(RESULT_SUCCESS);
 }
@@ -1448,12 +1486,17 @@ void NWM_UDS::BeaconBroadcastCallback(std::uintptr_t user_data, s64 cycles_late)
     if (connection_status.status != NetworkStatus::ConnectedAsHost)
         return;
 
-    std::vector<u8> frame = GenerateBeaconFrame(network_info, node_info);
+    // Building the frame parses tags and encrypts the network info, so only do it when the
+    // network state changed since the last broadcast.
+    if (beacon_frame_dirty) {
+        cached_beacon_frame = GenerateBeaconFrame(network_info, node_info);
+        beacon_frame_dirty = false;
+    }
 
     using Network::WifiPacket;
     WifiPacket packet;
     packet.type = WifiPacket::PacketType::Beacon;
-    packet.data = std::move(frame);
+    packet.data = cached_beacon_frame;
     packet.destination_address = Network::BroadcastMac;
     packet.channel = network_channel;
 
@@ -549,6 +549,12 @@ private:
     // Information about the network that we're currently connected to.
     NetworkInfo network_info;
 
+    // Cached 802.11 beacon frame for the network we're hosting. Building the frame encrypts the
+    // network info, so it's regenerated only when the network state changes and the broadcast
+    // callback otherwise reuses it as-is. Not serialized; rebuilt on first broadcast after load.
+    std::vector<u8> cached_beacon_frame;
+    bool beacon_frame_dirty = true;
+
     // Mapping of mac addresses to their respective node_ids.
     struct Node {
         bool connected;
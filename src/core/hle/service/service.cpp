@@ -145,6 +145,14 @@ void ServiceFrameworkBase::RegisterHandlersBase(const FunctionInfoBase* function
         // Usually this array is sorted by id already, so hint to insert at the end
         handlers.emplace_hint(handlers.cend(), functions[i].expected_header, functions[i]);
     }
+
+    // Rebuild the direct-mapped dispatch table. The map is keyed by the full header, which has
+    // the command id in its upper halfword, so the last entry determines the table size. This
+    // has to be redone from scratch because the insertions above may have reallocated the map.
+    fast_handlers.assign((handlers.crbegin()->first >> 16) + 1, nullptr);
+    for (const auto& [expected_header, info] : handlers) {
+        fast_handlers[expected_header >> 16] = &info;
+    }
 }
 
 void ServiceFrameworkBase::ReportUnimplementedFunction(u32* cmd_buf, const FunctionInfoBase* info) {
@@ -172,8 +180,16 @@ void ServiceFrameworkBase::ReportUnimplementedFunction(u32* cmd_buf, const Funct
 
 void ServiceFrameworkBase::HandleSyncRequest(Kernel::HLERequestContext& context) {
     u32 header_code = context.CommandBuffer()[0];
-    auto itr = handlers.find(header_code);
-    const FunctionInfoBase* info = itr == handlers.end() ? nullptr : &itr->second;
+    // Index the dispatch table by command id, then verify the full header (which also encodes
+    // the parameter counts) before dispatching. Anything the table cannot answer goes through
+    // the map so that it is reported with the proper name if it was registered.
+    const u32 command_id = header_code >> 16;
+    const FunctionInfoBase* info =
+        command_id < fast_handlers.size() ? fast_handlers[command_id] : nullptr;
+    if (info == nullptr || info->expected_header != header_code) {
+        auto itr = handlers.find(header_code);
+        info = itr == handlers.end() ? nullptr : &itr->second;
+    }
     if (info == nullptr || info->handler_callback == nullptr) {
         context.ReportUnimplemented();
         return ReportUnimplementedFunction(context.CommandBuffer(), info);
@@ -9,6 +9,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 #include <boost/container/flat_map.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/shared_ptr.hpp>
@@ -103,6 +104,9 @@ private:
     /// Function used to safely up-cast pointers to the derived class before invoking a handler.
     InvokerFn* handler_invoker;
     boost::container::flat_map<u32, FunctionInfoBase> handlers;
+    /// Dispatch table indexed directly by command id, rebuilt whenever handlers are registered.
+    /// Entries point into `handlers`; a null entry or full-header mismatch falls back to the map.
+    std::vector<const FunctionInfoBase*> fast_handlers;
 };
 
 /**
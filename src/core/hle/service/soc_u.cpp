@@ -15,7 +15,9 @@
 #include "common/scope_exit.h"
 #include "common/swap.h"
 #include "core/core.h"
+#include "core/core_timing.h"
 #include "core/hle/ipc_helpers.h"
+#include "core/hle/kernel/event.h"
 #include "core/hle/kernel/shared_memory.h"
 #include "core/hle/result.h"
 #include "core/hle/service/soc_u.h"
@@ -64,6 +66,7 @@
 #define MSGCUSTOM_HANDLE_DONTWAIT 0x80000000
 
 SERIALIZE_EXPORT_IMPL(Service::SOC::SOC_U)
+SERVICE_CONSTRUCT_IMPL(Service::SOC::SOC_U)
 
 namespace Service::SOC {
 
@@ -545,6 +548,71 @@ struct CTRPollFD {
 static_assert(std::is_trivially_copyable_v<CTRPollFD>,
               "CTRPollFD is used with std::memcpy and must be trivially copyable");
 
+class SOC_U::PollCallback : public Kernel::HLERequestContext::WakeupCallback {
+public:
+    PollCallback(SOC_U& socu_, std::vector<u8> input_fds_)
+        : socu(&socu_), input_fds(std::move(input_fds_)) {}
+
+    void WakeUp([[maybe_unused]] std::shared_ptr<Kernel::Thread> thread,
+                Kernel::HLERequestContext& ctx, Kernel::ThreadWakeupReason reason) override {
+        if (reason == Kernel::ThreadWakeupReason::Timeout) {
+            // Nothing became ready within the guest timeout: return the input set with all
+            // revents cleared.
+            const std::size_t nfds = input_fds.size() / sizeof(CTRPollFD);
+            std::vector<CTRPollFD> ctr_fds(nfds);
+            std::memcpy(ctr_fds.data(), input_fds.data(), input_fds.size());
+            for (auto& fd : ctr_fds) {
+                fd.revents.hex = 0;
+            }
+            output_fds.resize(input_fds.size());
+            std::memcpy(output_fds.data(), ctr_fds.data(), output_fds.size());
+            ready_count = 0;
+        }
+
+        IPC::RequestBuilder rb(ctx, 0x14, 2, 2);
+        rb.Push(RESULT_SUCCESS);
+        rb.Push(ready_count);
+        rb.PushStaticBuffer(std::move(output_fds), 0);
+
+        if (socu) {
+            socu->RemovePendingPoll(this);
+        }
+    }
+
+    SOC_U* socu = nullptr;      ///< Not serialized; restored by SOC_U::serialize on load
+    std::vector<u8> input_fds;  ///< Guest CTRPollFD array as received
+    std::vector<u8> output_fds; ///< Guest CTRPollFD array to return, filled when ready
+    s32 ready_count = 0;        ///< Poll return value to report to the guest
+    std::shared_ptr<Kernel::Event> wake_event;
+
+private:
+    PollCallback() = default;
+
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int) {
+        ar& boost::serialization::base_object<Kernel::HLERequestContext::WakeupCallback>(*this);
+        ar& input_fds;
+        ar& output_fds;
+        ar& ready_count;
+        ar& wake_event;
+    }
+    friend class boost::serialization::access;
+};
+
+template <class Archive>
+void SOC_U::serialize(Archive& ar, const unsigned int file_version) {
+    ar& boost::serialization::base_object<Kernel::SessionRequestHandler>(*this);
+    ar& open_sockets;
+    if (file_version >= 1) {
+        ar& pending_polls;
+    }
+    if (Archive::is_loading::value) {
+        for (auto& pending : pending_polls) {
+            pending->socu = this;
+        }
+    }
+}
+
 /// Union to represent the 3ds' sockaddr structure
 union CTRSockAddr {
     /// Structure to represent a raw sockaddr
@@ -1224,12 +1292,25 @@ void SOC_U::Poll(Kernel::HLERequestContext& ctx) {
         platform_pollfd[i] = CTRPollFD::ToPlatform(*this, ctr_fds[i], has_libctru_bug[i]);
     }
 
-    if (timeout) {
-        PreTimerAdjust();
-    }
-    s32 ret = ::poll(platform_pollfd.data(), nfds, timeout);
-    if (timeout) {
-        PostTimerAdjust(ctx, "Poll");
+    // Check for readiness without blocking; blocking on the host call here would stall the
+    // whole emulated system for up to the guest timeout.
+    s32 ret = ::poll(platform_pollfd.data(), nfds, 0);
+
+    if (ret == 0 && timeout != 0) {
+        // Nothing ready yet. Put the guest thread to sleep and re-check the host sockets
+        // periodically while the rest of the system keeps running. A negative guest
+        // timeout means wait forever.
+        auto callback = std::make_shared<PollCallback>(*this, std::move(input_fds));
+        const auto timeout_ns = timeout < 0
+                                    ? std::chrono::nanoseconds(-1)
+                                    : std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::milliseconds(timeout));
+        callback->wake_event = ctx.SleepClientThread("soc_u::Poll", timeout_ns, callback);
+        if (pending_polls.empty()) {
+            system.CoreTiming().ScheduleEvent(msToCycles(1), pending_poll_event);
+        }
+        pending_polls.emplace_back(std::move(callback));
+        return;
     }
 
     // Now update the output 3ds_pollfd structure
@@ -1253,6 +1334,58 @@ void SOC_U::Poll(Kernel::HLERequestContext& ctx) {
     rb.PushStaticBuffer(std::move(output_fds), 0);
 }
 
+void SOC_U::CheckPendingPolls() {
+    for (std::size_t i = 0; i < pending_polls.size();) {
+        const auto& pending = pending_polls[i];
+        const u32 nfds = static_cast<u32>(pending->input_fds.size() / sizeof(CTRPollFD));
+
+        std::vector<CTRPollFD> ctr_fds(nfds);
+        std::memcpy(ctr_fds.data(), pending->input_fds.data(), nfds * sizeof(CTRPollFD));
+
+        std::vector<pollfd> platform_pollfd(nfds);
+        std::vector<u8> has_libctru_bug(nfds, false);
+        for (u32 j = 0; j < nfds; j++) {
+            platform_pollfd[j] = CTRPollFD::ToPlatform(*this, ctr_fds[j], has_libctru_bug[j]);
+        }
+
+        s32 ret = ::poll(platform_pollfd.data(), nfds, 0);
+        if (ret == 0) {
+            ++i;
+            continue;
+        }
+
+        if (ret == SOCKET_ERROR_VALUE) {
+            int err = GET_ERRNO;
+            LOG_ERROR(Service_SOC, "Socket error: {}", err);
+            ret = TranslateError(err);
+        }
+
+        for (u32 j = 0; j < nfds; j++) {
+            ctr_fds[j] = CTRPollFD::FromPlatform(*this, platform_pollfd[j], has_libctru_bug[j]);
+        }
+        pending->output_fds.resize(nfds * sizeof(CTRPollFD));
+        std::memcpy(pending->output_fds.data(), ctr_fds.data(), nfds * sizeof(CTRPollFD));
+        pending->ready_count = ret;
+
+        // Detach the poll before signaling: waking the thread reenters RemovePendingPoll.
+        auto callback = std::move(pending_polls[i]);
+        pending_polls.erase(pending_polls.begin() + i);
+        callback->wake_event->Signal();
+    }
+
+    if (!pending_polls.empty()) {
+        system.CoreTiming().ScheduleEvent(msToCycles(1), pending_poll_event);
+    }
+}
+
+void SOC_U::RemovePendingPoll(const PollCallback* callback) {
+    pending_polls.erase(std::remove_if(pending_polls.begin(), pending_polls.end(),
+                                       [callback](const std::shared_ptr<PollCallback>& pending) {
+                                           return pending.get() == callback;
+                                       }),
+                        pending_polls.end());
+}
+
 void SOC_U::GetSockName(Kernel::HLERequestContext& ctx) {
     IPC::RequestParser rp(ctx, 0x17, 2, 2);
     const auto socket_handle = rp.Pop<u32>();
@@ -1673,7 +1806,7 @@ void SOC_U::GetNameInfoImpl(Kernel::HLERequestContext& ctx) {
     rb.PushStaticBuffer(std::move(serv), 1);
 }
 
-SOC_U::SOC_U() : ServiceFramework("soc:U") {
+SOC_U::SOC_U(Core::System& system) : ServiceFramework("soc:U"), system(system) {
     static const FunctionInfo functions[] = {
         // clang-format off
         {IPC::MakeHeader(0x0001, 1, 4), &SOC_U::InitializeSockets, "InitializeSockets"},
@@ -1714,6 +1847,12 @@ SOC_U::SOC_U() : ServiceFramework("soc:U") {
 
     RegisterHandlers(functions);
 
+    pending_poll_event = system.CoreTiming().RegisterEvent(
+        "SOC_U::pending_poll_event",
+        [this]([[maybe_unused]] std::uintptr_t user_data, [[maybe_unused]] int cycles_late) {
+            CheckPendingPolls();
+        });
+
 #ifdef _WIN32
     WSADATA data;
     WSAStartup(MAKEWORD(2, 2), &data);
@@ -1721,6 +1860,9 @@ SOC_U::SOC_U() : ServiceFramework("soc:U") {
 }
 
 SOC_U::~SOC_U() {
+    if (system.IsPoweredOn() && pending_poll_event) {
+        system.CoreTiming().UnscheduleEvent(pending_poll_event, 0);
+    }
     CleanupSockets();
 #ifdef _WIN32
     WSACleanup();
@@ -1851,7 +1993,9 @@ std::shared_ptr<SOC_U> GetService(Core::System& system) {
 
 void InstallInterfaces(Core::System& system) {
     auto& service_manager = system.ServiceManager();
-    std::make_shared<SOC_U>()->InstallAsService(service_manager);
+    std::make_shared<SOC_U>(system)->InstallAsService(service_manager);
 }
 
 } // namespace Service::SOC
+
+SERIALIZE_EXPORT_IMPL(Service::SOC::SOC_U::PollCallback)
@@ -4,15 +4,21 @@
 
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+#include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/unordered_map.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 #include "core/hle/result.h"
 #include "core/hle/service/service.h"
 
 namespace Core {
 class System;
-}
+struct TimingEventType;
+} // namespace Core
 
 namespace Service::SOC {
 
@@ -38,7 +44,7 @@ private:
 
 class SOC_U final : public ServiceFramework<SOC_U> {
 public:
-    SOC_U();
+    explicit SOC_U(Core::System& system);
     ~SOC_U();
 
     struct InterfaceInfo {
@@ -50,6 +56,8 @@ public:
     // Gets the interface info that is able to reach the internet.
     std::optional<InterfaceInfo> GetDefaultInterfaceInfo();
 
+    class PollCallback;
+
 private:
     static constexpr ResultCode ERR_INVALID_HANDLE =
         ResultCode(ErrorDescription::InvalidHandle, ErrorModule::SOC, ErrorSummary::InvalidArgument,
@@ -134,6 +142,18 @@ private:
     void PreTimerAdjust();
     void PostTimerAdjust(Kernel::HLERequestContext& ctx, const std::string& caller_method);
 
+    /// Re-checks the host sockets of all pending polls and wakes up the ones that became
+    /// ready; reschedules itself while any poll is still pending.
+    void CheckPendingPolls();
+
+    /// Removes a pending poll after its guest thread has been woken up (e.g. on timeout).
+    void RemovePendingPoll(const PollCallback* callback);
+
+    /// Polls whose guest thread is sleeping until a socket becomes ready or the guest
+    /// timeout expires.
+    std::vector<std::shared_ptr<PollCallback>> pending_polls;
+    Core::TimingEventType* pending_poll_event = nullptr;
+
     /// Close all open sockets
     void CleanupSockets();
 
@@ -148,11 +168,10 @@ private:
     bool interface_info_cached = false;
     InterfaceInfo interface_info;
 
+    Core::System& system;
+
     template <class Archive>
-    void serialize(Archive& ar, const unsigned int) {
-        ar& boost::serialization::base_object<Kernel::SessionRequestHandler>(*this);
-        ar& open_sockets;
-    }
+    void serialize(Archive& ar, const unsigned int);
     friend class boost::serialization::access;
 };
 
@@ -163,3 +182,6 @@ void InstallInterfaces(Core::System& system);
 } // namespace Service::SOC
 
 BOOST_CLASS_EXPORT_KEY(Service::SOC::SOC_U)
+BOOST_CLASS_EXPORT_KEY(Service::SOC::SOC_U::PollCallback)
+BOOST_CLASS_VERSION(Service::SOC::SOC_U, 1)
+SERVICE_CONSTRUCT(Service::SOC::SOC_U)
@@ -2,6 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
 #include "common/archives.h"
 #include "common/common_types.h"
 #include "core/core.h"
@@ -30,28 +33,18 @@ void SSL_C::GenerateRandomData(Kernel::HLERequestContext& ctx) {
     u32 size = rp.Pop<u32>();
     auto buffer = rp.PopMappedBuffer();
 
-    // Fill the output buffer with random data.
-    u32 data = 0;
-    u32 i = 0;
-    while (i < size) {
-        if ((i % 4) == 0) {
-            // The random number generator returns 4 bytes worth of data, so generate new random
-            // data when i == 0 and when i is divisible by 4
-            data = rand_gen();
-        }
-
-        if (size > 4) {
-            // Use up the entire 4 bytes of the random data for as long as possible
-            buffer.Write(&data, i, 4);
-            i += 4;
-        } else if (size == 2) {
-            buffer.Write(&data, i, 2);
-            i += 2;
-        } else {
-            buffer.Write(&data, i, 1);
-            i++;
-        }
+    // Generate the random data locally and hand it to guest memory in one write instead of
+    // one write per generator word.
+    std::vector<u8> data(size);
+    std::size_t i = 0;
+    while (i < data.size()) {
+        // The random number generator returns 4 bytes worth of data
+        const u32 word = rand_gen();
+        const std::size_t chunk = std::min<std::size_t>(sizeof(word), data.size() - i);
+        std::memcpy(data.data() + i, &word, chunk);
+        i += chunk;
     }
+    buffer.Write(data.data(), 0, data.size());
 
     // Stub, return success
     IPC::RequestBuilder rb = rp.MakeBuilder(1, 2);
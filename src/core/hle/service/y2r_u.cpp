@@ -8,6 +8,7 @@
 #include "common/common_funcs.h"
 #include "common/logging/log.h"
 #include "core/core.h"
+#include "core/core_timing.h"
 #include "core/hle/ipc_helpers.h"
 #include "core/hle/kernel/event.h"
 #include "core/hle/kernel/process.h"
@@ -21,6 +22,11 @@ namespace Service::Y2R {
 
 template <class Archive>
 void Y2R_U::serialize(Archive& ar, const unsigned int) {
+    if (Archive::is_saving::value) {
+        // Make sure an in-flight conversion has finished writing guest memory before the state
+        // is captured. The pending completion event is saved along with the core timing state.
+        FinishConversion();
+    }
     ar& boost::serialization::base_object<Kernel::SessionRequestHandler>(*this);
     ar& completion_event;
     ar& conversion;
@@ -512,6 +518,12 @@ void Y2R_U::GetDitheringWeightParams(Kernel::HLERequestContext& ctx) {
     LOG_DEBUG(Service_Y2R, "called");
 }
 
+void Y2R_U::FinishConversion() {
+    if (conversion_future.valid()) {
+        conversion = conversion_future.get();
+    }
+}
+
 void Y2R_U::StartConversion(Kernel::HLERequestContext& ctx) {
     IPC::RequestParser rp(ctx, 0x26, 0, 0);
 
@@ -521,9 +533,21 @@ void Y2R_U::StartConversion(Kernel::HLERequestContext& ctx) {
     Memory::RasterizerFlushVirtualRegion(conversion.dst.address, total_output_size,
                                          Memory::FlushMode::FlushAndInvalidate);
 
-    HW::Y2R::PerformConversion(system.Memory(), conversion);
-
-    completion_event->Signal();
+    // The conversion runs on a worker thread while the guest continues executing, and the
+    // completion event fires once the estimated hardware conversion time has elapsed. The worker
+    // receives its own copy of the configuration; the buffer state it consumes is folded back
+    // into `conversion` before the event is signaled, matching the synchronous behavior.
+    FinishConversion();
+    conversion_future =
+        std::async(std::launch::async, [&memory = system.Memory(), cvt = conversion]() mutable {
+            HW::Y2R::PerformConversion(memory, cvt);
+            return cvt;
+        });
+
+    // The hardware converts in the ballpark of one pixel per cycle; this only needs to be a
+    // plausible busy interval, as the worker finishes well before the event fires.
+    const s64 estimated_cycles = s64(conversion.input_lines) * conversion.input_line_width;
+    system.CoreTiming().ScheduleEvent(estimated_cycles, conversion_complete_event);
 
     IPC::RequestBuilder rb = rp.MakeBuilder(1, 0);
     rb.Push(RESULT_SUCCESS);
@@ -534,6 +558,11 @@ void Y2R_U::StartConversion(Kernel::HLERequestContext& ctx) {
 void Y2R_U::StopConversion(Kernel::HLERequestContext& ctx) {
     IPC::RequestParser rp(ctx, 0x27, 0, 0);
 
+    // Drain any conversion in flight and drop its pending completion signal; hardware does not
+    // fire the interrupt for stopped conversions.
+    FinishConversion();
+    system.CoreTiming().UnscheduleEvent(conversion_complete_event, 0);
+
     IPC::RequestBuilder rb = rp.MakeBuilder(1, 0);
     rb.Push(RESULT_SUCCESS);
 
@@ -545,7 +574,7 @@ void Y2R_U::IsBusyConversion(Kernel::HLERequestContext& ctx) {
 
     IPC::RequestBuilder rb = rp.MakeBuilder(2, 0);
     rb.Push(RESULT_SUCCESS);
-    rb.Push<u8>(0); // StartConversion always finishes immediately
+    rb.Push<u8>(conversion_future.valid() ? 1 : 0); // Busy until the completion event fires
 
     LOG_DEBUG(Service_Y2R, "called");
 }
@@ -698,6 +727,11 @@ Y2R_U::Y2R_U(Core::System& system) : ServiceFramework("y2r:u", 1), system(system
     RegisterHandlers(functions);
 
     completion_event = system.Kernel().CreateEvent(Kernel::ResetType::OneShot, "Y2R:Completed");
+    conversion_complete_event = system.CoreTiming().RegisterEvent(
+        "Y2R_U::ConversionComplete", [this](std::uintptr_t, s64) {
+            FinishConversion();
+            completion_event->Signal();
+        });
 }
 
 Y2R_U::~Y2R_U() = default;
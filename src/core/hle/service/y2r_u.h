@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <future>
 #include <memory>
 #include <string>
 #include <boost/serialization/array.hpp>
@@ -14,7 +15,8 @@
 
 namespace Core {
 class System;
-}
+struct TimingEventType;
+} // namespace Core
 
 namespace Kernel {
 class Event;
@@ -346,9 +348,15 @@ private:
     void DriverFinalize(Kernel::HLERequestContext& ctx);
     void GetPackageParameter(Kernel::HLERequestContext& ctx);
 
+    /// Waits for any in-flight conversion worker and folds its buffer state back into
+    /// `conversion`. No-op when no conversion is in flight.
+    void FinishConversion();
+
     Core::System& system;
 
     std::shared_ptr<Kernel::Event> completion_event;
+    Core::TimingEventType* conversion_complete_event;
+    std::future<ConversionConfiguration> conversion_future;
     ConversionConfiguration conversion{};
     DitheringWeightParams dithering_weight_params{};
     bool temporal_dithering_enabled = false;
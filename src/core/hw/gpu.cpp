@@ -47,32 +47,34 @@ inline void Read(T& var, const u32 raw_addr) {
     var = g_regs[addr / 4];
 }
 
-static Common::Vec4<u8> DecodePixel(Regs::PixelFormat input_format, const u8* src_pixel) {
-    switch (input_format) {
-    case Regs::PixelFormat::RGBA8:
-        return Common::Color::DecodeRGBA8(src_pixel);
-
-    case Regs::PixelFormat::RGB8:
-        return Common::Color::DecodeRGB8(src_pixel);
-
-    case Regs::PixelFormat::RGB565:
-        return Common::Color::DecodeRGB565(src_pixel);
-
-    case Regs::PixelFormat::RGB5A1:
-        return Common::Color::DecodeRGB5A1(src_pixel);
-
-    case Regs::PixelFormat::RGBA4:
-        return Common::Color::DecodeRGBA4(src_pixel);
+MICROPROFILE_DEFINE(GPU_DisplayTransfer, "GPU", "DisplayTransfer", MP_RGB(100, 100, 255));
+MICROPROFILE_DEFINE(GPU_CmdlistProcessing, "GPU", "Cmdlist Processing", MP_RGB(100, 255, 100));
 
-    default:
-        LOG_ERROR(HW_GPU, "Unknown source framebuffer format {:x}", input_format);
-        return {0, 0, 0, 0};
+// Running totals of operations the rasterizer could not accelerate. Each occurrence is logged
+// with its config so frame-time cliffs can be tied to the transfers that fell off the
+// accelerated path.
+static u64 software_fill_count;
+static u64 software_transfer_count;
+static u64 software_copy_count;
+
+/// Fills [start, end) by repeating the given pattern unit, doubling the copied span each step.
+/// Like the hardware, a range that is not a multiple of the unit size is rounded up to whole
+/// units.
+static void FillMemoryWithPattern(u8* start, u8* end, const u8* pattern,
+                                  std::size_t pattern_size) {
+    const std::size_t unit_count =
+        (static_cast<std::size_t>(end - start) + pattern_size - 1) / pattern_size;
+    const std::size_t total = unit_count * pattern_size;
+
+    std::memcpy(start, pattern, pattern_size);
+    std::size_t filled = pattern_size;
+    while (filled < total) {
+        const std::size_t chunk = std::min(filled, total - filled);
+        std::memcpy(start + filled, start, chunk);
+        filled += chunk;
     }
 }
 
-MICROPROFILE_DEFINE(GPU_DisplayTransfer, "GPU", "DisplayTransfer", MP_RGB(100, 100, 255));
-MICROPROFILE_DEFINE(GPU_CmdlistProcessing, "GPU", "Cmdlist Processing", MP_RGB(100, 255, 100));
-
 static void MemoryFill(const Regs::MemoryFillConfig& config) {
     const PAddr start_addr = config.GetStartAddress();
     const PAddr end_addr = config.GetEndAddress();
@@ -103,26 +105,28 @@ static void MemoryFill(const Regs::MemoryFillConfig& config) {
     Memory::RasterizerInvalidateRegion(config.GetStartAddress(),
                                        config.GetEndAddress() - config.GetStartAddress());
 
+    ++software_fill_count;
+    LOG_DEBUG(HW_GPU, "software fill #{}: {:#010X} to {:#010X}, {}-bit", software_fill_count,
+              start_addr, end_addr, config.fill_24bit ? 24 : (config.fill_32bit ? 32 : 16));
+
     if (config.fill_24bit) {
         // fill with 24-bit values
-        for (u8* ptr = start; ptr < end; ptr += 3) {
-            ptr[0] = config.value_24bit_r;
-            ptr[1] = config.value_24bit_g;
-            ptr[2] = config.value_24bit_b;
-        }
+        const u8 pattern[] = {static_cast<u8>(config.value_24bit_r),
+                              static_cast<u8>(config.value_24bit_g),
+                              static_cast<u8>(config.value_24bit_b)};
+        FillMemoryWithPattern(start, end, pattern, sizeof(pattern));
     } else if (config.fill_32bit) {
         // fill with 32-bit values
-        if (end > start) {
-            u32 value = config.value_32bit;
-            std::size_t len = (end - start) / sizeof(u32);
-            for (std::size_t i = 0; i < len; ++i)
-                memcpy(&start[i * sizeof(u32)], &value, sizeof(u32));
-        }
+        const u32 value = config.value_32bit;
+        u8 pattern[sizeof(u32)];
+        std::memcpy(pattern, &value, sizeof(pattern));
+        FillMemoryWithPattern(start, end, pattern, sizeof(pattern));
     } else {
         // fill with 16-bit values
-        u16 value_16bit = config.value_16bit.Value();
-        for (u8* ptr = start; ptr < end; ptr += sizeof(u16))
-            memcpy(ptr, &value_16bit, sizeof(u16));
+        const u16 value_16bit = config.value_16bit.Value();
+        u8 pattern[sizeof(u16)];
+        std::memcpy(pattern, &value_16bit, sizeof(pattern));
+        FillMemoryWithPattern(start, end, pattern, sizeof(pattern));
     }
 }
 
@@ -164,6 +168,15 @@ static void DisplayTransfer(const Regs::DisplayTransferConfig& config) {
     if (VideoCore::g_renderer->Rasterizer()->AccelerateDisplayTransfer(config))
         return;
 
+    ++software_transfer_count;
+    LOG_DEBUG(HW_GPU,
+              "software display transfer #{}: {:#010X}({}x{}, format {:x})-> "
+              "{:#010X}({}x{}, format {:x}), flags {:#010X}",
+              software_transfer_count, src_addr, config.input_width.Value(),
+              config.input_height.Value(), static_cast<u32>(config.input_format.Value()), dst_addr,
+              config.output_width.Value(), config.output_height.Value(),
+              static_cast<u32>(config.output_format.Value()), config.flags);
+
     u8* src_pointer = g_memory->GetPhysicalPointer(src_addr);
     u8* dst_pointer = g_memory->GetPhysicalPointer(dst_addr);
 
@@ -180,6 +193,56 @@ static void DisplayTransfer(const Regs::DisplayTransferConfig& config) {
         return;
     }
 
+    // The pixel formats are dispatched once per transfer here, rather than switching on them
+    // for every pixel in the loop below.
+    using DecodeFunc = Common::Vec4<u8> (*)(const u8*);
+    DecodeFunc decode_pixel;
+    switch (config.input_format) {
+    case Regs::PixelFormat::RGBA8:
+        decode_pixel = Common::Color::DecodeRGBA8;
+        break;
+    case Regs::PixelFormat::RGB8:
+        decode_pixel = Common::Color::DecodeRGB8;
+        break;
+    case Regs::PixelFormat::RGB565:
+        decode_pixel = Common::Color::DecodeRGB565;
+        break;
+    case Regs::PixelFormat::RGB5A1:
+        decode_pixel = Common::Color::DecodeRGB5A1;
+        break;
+    case Regs::PixelFormat::RGBA4:
+        decode_pixel = Common::Color::DecodeRGBA4;
+        break;
+    default:
+        LOG_ERROR(HW_GPU, "Unknown source framebuffer format {:x}",
+                  static_cast<u32>(config.input_format.Value()));
+        return;
+    }
+
+    using EncodeFunc = void (*)(const Common::Vec4<u8>&, u8*);
+    EncodeFunc encode_pixel;
+    switch (config.output_format) {
+    case Regs::PixelFormat::RGBA8:
+        encode_pixel = Common::Color::EncodeRGBA8;
+        break;
+    case Regs::PixelFormat::RGB8:
+        encode_pixel = Common::Color::EncodeRGB8;
+        break;
+    case Regs::PixelFormat::RGB565:
+        encode_pixel = Common::Color::EncodeRGB565;
+        break;
+    case Regs::PixelFormat::RGB5A1:
+        encode_pixel = Common::Color::EncodeRGB5A1;
+        break;
+    case Regs::PixelFormat::RGBA4:
+        encode_pixel = Common::Color::EncodeRGBA4;
+        break;
+    default:
+        LOG_ERROR(HW_GPU, "Unknown destination framebuffer format {:x}",
+                  static_cast<u32>(config.output_format.Value()));
+        return;
+    }
+
     int horizontal_scale = config.scaling != config.NoScale ? 1 : 0;
     int vertical_scale = config.scaling == config.ScaleXY ? 1 : 0;
 
@@ -193,27 +256,19 @@ static void DisplayTransfer(const Regs::DisplayTransferConfig& config) {
     Memory::RasterizerFlushRegion(config.GetPhysicalInputAddress(), input_size);
     Memory::RasterizerInvalidateRegion(config.GetPhysicalOutputAddress(), output_size);
 
+    const u32 dst_bytes_per_pixel = GPU::Regs::BytesPerPixel(config.output_format);
+    const u32 src_bytes_per_pixel = GPU::Regs::BytesPerPixel(config.input_format);
+
     for (u32 y = 0; y < output_height; ++y) {
+        // Calculate the input row based on the current output row and the scale. The y value of
+        // the output data is flipped after that calculation to account for the scaling options.
+        const u32 input_y = y << vertical_scale;
+        const u32 output_y = config.flip_vertically ? output_height - y - 1 : y;
+
         for (u32 x = 0; x < output_width; ++x) {
-            Common::Vec4<u8> src_color;
-
-            // Calculate the [x,y] position of the input image
-            // based on the current output position and the scale
-            u32 input_x = x << horizontal_scale;
-            u32 input_y = y << vertical_scale;
-
-            u32 output_y;
-            if (config.flip_vertically) {
-                // Flip the y value of the output data,
-                // we do this after calculating the [x,y] position of the input image
-                // to account for the scaling options.
-                output_y = output_height - y - 1;
-            } else {
-                output_y = y;
-            }
+            // Calculate the input column based on the current output position and the scale
+            const u32 input_x = x << horizontal_scale;
 
-            u32 dst_bytes_per_pixel = GPU::Regs::BytesPerPixel(config.output_format);
-            u32 src_bytes_per_pixel = GPU::Regs::BytesPerPixel(config.input_format);
             u32 src_offset;
             u32 dst_offset;
 
@@ -256,48 +311,18 @@ static void DisplayTransfer(const Regs::DisplayTransferConfig& config) {
             }
 
             const u8* src_pixel = src_pointer + src_offset;
-            src_color = DecodePixel(config.input_format, src_pixel);
+            Common::Vec4<u8> src_color = decode_pixel(src_pixel);
             if (config.scaling == config.ScaleX) {
-                Common::Vec4<u8> pixel =
-                    DecodePixel(config.input_format, src_pixel + src_bytes_per_pixel);
+                Common::Vec4<u8> pixel = decode_pixel(src_pixel + src_bytes_per_pixel);
                 src_color = ((src_color + pixel) / 2).Cast<u8>();
             } else if (config.scaling == config.ScaleXY) {
-                Common::Vec4<u8> pixel1 =
-                    DecodePixel(config.input_format, src_pixel + 1 * src_bytes_per_pixel);
-                Common::Vec4<u8> pixel2 =
-                    DecodePixel(config.input_format, src_pixel + 2 * src_bytes_per_pixel);
-                Common::Vec4<u8> pixel3 =
-                    DecodePixel(config.input_format, src_pixel + 3 * src_bytes_per_pixel);
+                Common::Vec4<u8> pixel1 = decode_pixel(src_pixel + 1 * src_bytes_per_pixel);
+                Common::Vec4<u8> pixel2 = decode_pixel(src_pixel + 2 * src_bytes_per_pixel);
+                Common::Vec4<u8> pixel3 = decode_pixel(src_pixel + 3 * src_bytes_per_pixel);
                 src_color = (((src_color + pixel1) + (pixel2 + pixel3)) / 4).Cast<u8>();
             }
 
-            u8* dst_pixel = dst_pointer + dst_offset;
-            switch (config.output_format) {
-            case Regs::PixelFormat::RGBA8:
-                Common::Color::EncodeRGBA8(src_color, dst_pixel);
-                break;
-
-            case Regs::PixelFormat::RGB8:
-                Common::Color::EncodeRGB8(src_color, dst_pixel);
-                break;
-
-            case Regs::PixelFormat::RGB565:
-                Common::Color::EncodeRGB565(src_color, dst_pixel);
-                break;
-
-            case Regs::PixelFormat::RGB5A1:
-                Common::Color::EncodeRGB5A1(src_color, dst_pixel);
-                break;
-
-            case Regs::PixelFormat::RGBA4:
-                Common::Color::EncodeRGBA4(src_color, dst_pixel);
-                break;
-
-            default:
-                LOG_ERROR(HW_GPU, "Unknown destination framebuffer format {:x}",
-                          static_cast<u32>(config.output_format.Value()));
-                break;
-            }
+            encode_pixel(src_color, dst_pointer + dst_offset);
         }
     }
 }
@@ -320,6 +345,13 @@ static void TextureCopy(const Regs::DisplayTransferConfig& config) {
     if (VideoCore::g_renderer->Rasterizer()->AccelerateTextureCopy(config))
         return;
 
+    ++software_copy_count;
+    LOG_DEBUG(HW_GPU,
+              "software texture copy #{}: {:#X} bytes from {:#010X}({}+{})-> {:#010X}({}+{})",
+              software_copy_count, config.texture_copy.size, src_addr,
+              config.texture_copy.input_width * 16, config.texture_copy.input_gap * 16, dst_addr,
+              config.texture_copy.output_width * 16, config.texture_copy.output_gap * 16);
+
     u8* src_pointer = g_memory->GetPhysicalPointer(src_addr);
     u8* dst_pointer = g_memory->GetPhysicalPointer(dst_addr);
 
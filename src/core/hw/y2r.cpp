@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include "common/assert.h"
 #include "common/color.h"
@@ -24,33 +25,35 @@ static const std::size_t TILE_SIZE = 8 * 8;
 using ImageTile = std::array<u32, TILE_SIZE>;
 
 /// Converts a image strip from the source YUV format into individual 8x8 RGB32 tiles.
-static void ConvertYUVToRGB(InputFormat input_format, const u8* input_Y, const u8* input_U,
-                            const u8* input_V, ImageTile output[], unsigned int width,
-                            unsigned int height, const CoefficientSet& coefficients) {
+template <InputFormat input_format>
+static void ConvertYUVToRGB(const u8* input_Y, const u8* input_U, const u8* input_V,
+                            ImageTile output[], unsigned int width, unsigned int height,
+                            const CoefficientSet& coefficients) {
+    // Each row is decoded into a contiguous buffer first. With the input format fixed at compile
+    // time the loop body is branch-free, so the compiler can vectorize the fixed-point math. The
+    // row is then scattered into the tiles, where each tile row is a contiguous 8-pixel run.
+    std::array<u32, MAX_TILES * 8> row_buffer;
 
     for (unsigned int y = 0; y < height; ++y) {
         for (unsigned int x = 0; x < width; ++x) {
             s32 Y = 0;
             s32 U = 0;
             s32 V = 0;
-            switch (input_format) {
-            case InputFormat::YUV422_Indiv8:
-            case InputFormat::YUV422_Indiv16:
+            if constexpr (input_format == InputFormat::YUV422_Indiv8 ||
+                          input_format == InputFormat::YUV422_Indiv16) {
                 Y = input_Y[y * width + x];
                 U = input_U[(y * width + x) / 2];
                 V = input_V[(y * width + x) / 2];
-                break;
-            case InputFormat::YUV420_Indiv8:
-            case InputFormat::YUV420_Indiv16:
+            } else if constexpr (input_format == InputFormat::YUV420_Indiv8 ||
+                                 input_format == InputFormat::YUV420_Indiv16) {
                 Y = input_Y[y * width + x];
                 U = input_U[((y / 2) * width + x) / 2];
                 V = input_V[((y / 2) * width + x) / 2];
-                break;
-            case InputFormat::YUYV422_Interleaved:
+            } else {
+                static_assert(input_format == InputFormat::YUYV422_Interleaved);
                 Y = input_Y[(y * width + x) * 2];
                 U = input_Y[(y * width + (x / 2) * 2) * 2 + 1];
                 V = input_Y[(y * width + (x / 2) * 2) * 2 + 3];
-                break;
             }
 
             // This conversion process is bit-exact with hardware, as far as could be tested.
@@ -66,12 +69,13 @@ static void ConvertYUVToRGB(InputFormat input_format, const u8* input_Y, const u
             g = (g >> 3) + c[6] + rounding_offset;
             b = (b >> 3) + c[7] + rounding_offset;
 
-            unsigned int tile = x / 8;
-            unsigned int tile_x = x % 8;
-            u32* out = &output[tile][y * 8 + tile_x];
-            *out = ((u32)std::clamp(r >> 5, 0, 0xFF) << 24) |
-                   ((u32)std::clamp(g >> 5, 0, 0xFF) << 16) |
-                   ((u32)std::clamp(b >> 5, 0, 0xFF) << 8);
+            row_buffer[x] = ((u32)std::clamp(r >> 5, 0, 0xFF) << 24) |
+                            ((u32)std::clamp(g >> 5, 0, 0xFF) << 16) |
+                            ((u32)std::clamp(b >> 5, 0, 0xFF) << 8);
+        }
+
+        for (unsigned int tile = 0; tile < width / 8; ++tile) {
+            std::memcpy(&output[tile][y * 8], &row_buffer[tile * 8], 8 * sizeof(u32));
         }
     }
 }
@@ -102,8 +106,9 @@ static void ReceiveData(Memory::MemorySystem& memory, u8* output, ConversionBuff
 
 /// Convert intermediate RGB32 format to the final output format while simulating an outgoing CDMA
 /// transfer.
+template <OutputFormat output_format>
 static void SendData(Memory::MemorySystem& memory, const u32* input, ConversionBuffer& buf,
-                     int amount_of_data, OutputFormat output_format, u8 alpha) {
+                     int amount_of_data, u8 alpha) {
 
     u8* output = memory.GetPointer(buf.address);
 
@@ -113,23 +118,19 @@ static void SendData(Memory::MemorySystem& memory, const u32* input, ConversionB
             u32 color = *input++;
             Common::Vec4<u8> col_vec{(u8)(color >> 24), (u8)(color >> 16), (u8)(color >> 8), alpha};
 
-            switch (output_format) {
-            case OutputFormat::RGBA8:
+            if constexpr (output_format == OutputFormat::RGBA8) {
                 Common::Color::EncodeRGBA8(col_vec, output);
                 output += 4;
-                break;
-            case OutputFormat::RGB8:
+            } else if constexpr (output_format == OutputFormat::RGB8) {
                 Common::Color::EncodeRGB8(col_vec, output);
                 output += 3;
-                break;
-            case OutputFormat::RGB5A1:
+            } else if constexpr (output_format == OutputFormat::RGB5A1) {
                 Common::Color::EncodeRGB5A1(col_vec, output);
                 output += 2;
-                break;
-            case OutputFormat::RGB565:
+            } else {
+                static_assert(output_format == OutputFormat::RGB565);
                 Common::Color::EncodeRGB565(col_vec, output);
                 output += 2;
-                break;
             }
 
             amount_of_data -= 1;
@@ -285,6 +286,43 @@ void PerformConversion(Memory::MemorySystem& memory, ConversionConfiguration& cv
         break;
     }
 
+    // The input and output formats are dispatched once per conversion by selecting specialized
+    // kernels here, instead of switching on them for every pixel. The 16-bit input variants share
+    // the 8-bit kernels since ReceiveData has already narrowed their data before conversion.
+    using ConvertFunc = void (*)(const u8*, const u8*, const u8*, ImageTile[], unsigned int,
+                                 unsigned int, const CoefficientSet&);
+    ConvertFunc convert_yuv_to_rgb = nullptr;
+    switch (cvt.input_format) {
+    case InputFormat::YUV422_Indiv8:
+    case InputFormat::YUV422_Indiv16:
+        convert_yuv_to_rgb = ConvertYUVToRGB<InputFormat::YUV422_Indiv8>;
+        break;
+    case InputFormat::YUV420_Indiv8:
+    case InputFormat::YUV420_Indiv16:
+        convert_yuv_to_rgb = ConvertYUVToRGB<InputFormat::YUV420_Indiv8>;
+        break;
+    case InputFormat::YUYV422_Interleaved:
+        convert_yuv_to_rgb = ConvertYUVToRGB<InputFormat::YUYV422_Interleaved>;
+        break;
+    }
+
+    using SendFunc = void (*)(Memory::MemorySystem&, const u32*, ConversionBuffer&, int, u8);
+    SendFunc send_data = nullptr;
+    switch (cvt.output_format) {
+    case OutputFormat::RGBA8:
+        send_data = SendData<OutputFormat::RGBA8>;
+        break;
+    case OutputFormat::RGB8:
+        send_data = SendData<OutputFormat::RGB8>;
+        break;
+    case OutputFormat::RGB5A1:
+        send_data = SendData<OutputFormat::RGB5A1>;
+        break;
+    case OutputFormat::RGB565:
+        send_data = SendData<OutputFormat::RGB565>;
+        break;
+    }
+
     for (unsigned int y = 0; y < cvt.input_lines; y += 8) {
         unsigned int row_height = std::min(cvt.input_lines - y, 8u);
 
@@ -323,10 +361,8 @@ void PerformConversion(Memory::MemorySystem& memory, ConversionConfiguration& cv
             break;
         }
 
-        // Note(yuriks): If additional optimization is required, input_format can be moved to a
-        // template parameter, so that its dispatch can be moved to outside the inner loop.
-        ConvertYUVToRGB(cvt.input_format, input_Y, input_U, input_V, tiles.get(),
-                        cvt.input_line_width, row_height, cvt.coefficients);
+        convert_yuv_to_rgb(input_Y, input_U, input_V, tiles.get(), cvt.input_line_width,
+                           row_height, cvt.coefficients);
 
         u32* output_buffer = reinterpret_cast<u32*>(data_buffer.get());
 
@@ -371,10 +407,8 @@ void PerformConversion(Memory::MemorySystem& memory, ConversionConfiguration& cv
             }
         }
 
-        // Note(yuriks): If additional optimization is required, output_format can be moved to a
-        // template parameter, so that its dispatch can be moved to outside the inner loop.
-        SendData(memory, reinterpret_cast<u32*>(data_buffer.get()), cvt.dst, (int)row_data_size,
-                 cvt.output_format, (u8)cvt.alpha);
+        send_data(memory, reinterpret_cast<u32*>(data_buffer.get()), cvt.dst, (int)row_data_size,
+                  (u8)cvt.alpha);
     }
 }
 } // namespace HW::Y2R
@@ -4,6 +4,7 @@
 
 #include <array>
 #include <cstring>
+#include <optional>
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/binary_object.hpp>
 #include "audio_core/dsp_interface.h"
@@ -11,6 +12,7 @@
 #include "common/assert.h"
 #include "common/atomic_ops.h"
 #include "common/common_types.h"
+#include "common/host_memory.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
 #include "common/swap.h"
@@ -87,16 +89,177 @@ private:
     }
 };
 
+/**
+ * Two-level dirty bitmap over a physical memory region: one bit per page in the leaf array,
+ * plus one summary bit per 64-page leaf word. The summary layer lets a query spanning
+ * several megabytes conclude "nothing changed" in a handful of word scans.
+ */
+template <u32 NumPages>
+class DirtyPageBitmap {
+public:
+    void Mark(u32 page) {
+        words[page / PAGES_PER_WORD] |= u64{1} << (page % PAGES_PER_WORD);
+        summary[page / PAGES_PER_WORD / BITS_PER_WORD] |=
+            u64{1} << ((page / PAGES_PER_WORD) % BITS_PER_WORD);
+    }
+
+    void MarkAll() {
+        words.fill(~u64{0});
+        summary.fill(~u64{0});
+    }
+
+    bool IsDirty(u32 first_page, u32 last_page) const {
+        for (u32 word = first_page / PAGES_PER_WORD; word <= last_page / PAGES_PER_WORD; ++word) {
+            if ((summary[word / BITS_PER_WORD] & (u64{1} << (word % BITS_PER_WORD))) == 0) {
+                continue;
+            }
+            if ((words[word] & RangeMask(word, first_page, last_page)) != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Reset(u32 first_page, u32 last_page) {
+        for (u32 word = first_page / PAGES_PER_WORD; word <= last_page / PAGES_PER_WORD; ++word) {
+            words[word] &= ~RangeMask(word, first_page, last_page);
+            if (words[word] == 0) {
+                summary[word / BITS_PER_WORD] &= ~(u64{1} << (word % BITS_PER_WORD));
+            }
+        }
+    }
+
+private:
+    static constexpr u32 PAGES_PER_WORD = 64;
+    static constexpr u32 BITS_PER_WORD = 64;
+    static constexpr u32 NUM_WORDS = (NumPages + PAGES_PER_WORD - 1) / PAGES_PER_WORD;
+    static constexpr u32 NUM_SUMMARY_WORDS = (NUM_WORDS + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+    /// Mask of the bits of `word` that fall within [first_page, last_page].
+    static constexpr u64 RangeMask(u32 word, u32 first_page, u32 last_page) {
+        u64 mask = ~u64{0};
+        if (word == first_page / PAGES_PER_WORD) {
+            mask &= mask << (first_page % PAGES_PER_WORD);
+        }
+        if (word == last_page / PAGES_PER_WORD) {
+            mask &= ~u64{0} >> (PAGES_PER_WORD - 1 - last_page % PAGES_PER_WORD);
+        }
+        return mask;
+    }
+
+    std::array<u64, NUM_WORDS> words{};
+    std::array<u64, NUM_SUMMARY_WORDS> summary{};
+};
+
+/**
+ * Tracks CPU writes into rasterizer-cached pages. The write paths already intercept every
+ * store into a `PageType::RasterizerCachedMemory` page, so setting a bit here is nearly free;
+ * the renderer can then ask whether a physical region changed since it last reset its flags
+ * instead of reacting to each store individually.
+ */
+class RasterizerDirtyMarker {
+public:
+    void Mark(VAddr addr, u32 size) {
+        // Same virtual windows as RasterizerFlushVirtualRegion().
+        if (addr >= LINEAR_HEAP_VADDR && addr < LINEAR_HEAP_VADDR_END) {
+            MarkPhysical(FCRAM_PADDR + (addr - LINEAR_HEAP_VADDR), size);
+        } else if (addr >= NEW_LINEAR_HEAP_VADDR && addr < NEW_LINEAR_HEAP_VADDR_END) {
+            MarkPhysical(FCRAM_PADDR + (addr - NEW_LINEAR_HEAP_VADDR), size);
+        } else if (addr >= VRAM_VADDR && addr < VRAM_VADDR_END) {
+            MarkPhysical(VRAM_PADDR + (addr - VRAM_VADDR), size);
+        } else if (addr >= PLUGIN_3GX_FB_VADDR && addr < PLUGIN_3GX_FB_VADDR_END) {
+            if (const PAddr fb_addr = Service::PLGLDR::PLG_LDR::GetPluginFBAddr()) {
+                MarkPhysical(fb_addr + (addr - PLUGIN_3GX_FB_VADDR), size);
+            }
+        }
+    }
+
+    void MarkAll() {
+        fcram.MarkAll();
+        vram.MarkAll();
+    }
+
+    void MarkPhysical(PAddr start, u32 size) {
+        if (const auto range = PageRange(start, size, FCRAM_PADDR, FCRAM_N3DS_SIZE)) {
+            for (u32 page = range->first; page <= range->second; ++page) {
+                fcram.Mark(page);
+            }
+        }
+        if (const auto range = PageRange(start, size, VRAM_PADDR, VRAM_SIZE)) {
+            for (u32 page = range->first; page <= range->second; ++page) {
+                vram.Mark(page);
+            }
+        }
+    }
+
+    bool IsDirty(PAddr start, u32 size) const {
+        if (const auto range = PageRange(start, size, FCRAM_PADDR, FCRAM_N3DS_SIZE)) {
+            if (fcram.IsDirty(range->first, range->second)) {
+                return true;
+            }
+        }
+        if (const auto range = PageRange(start, size, VRAM_PADDR, VRAM_SIZE)) {
+            if (vram.IsDirty(range->first, range->second)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Reset(PAddr start, u32 size) {
+        if (const auto range = PageRange(start, size, FCRAM_PADDR, FCRAM_N3DS_SIZE)) {
+            fcram.Reset(range->first, range->second);
+        }
+        if (const auto range = PageRange(start, size, VRAM_PADDR, VRAM_SIZE)) {
+            vram.Reset(range->first, range->second);
+        }
+    }
+
+private:
+    /// First and last page index of the overlap of [start, start + size) with the region.
+    static std::optional<std::pair<u32, u32>> PageRange(PAddr start, u32 size, PAddr region_base,
+                                                        u32 region_size) {
+        const u64 end = static_cast<u64>(start) + size;
+        const u64 overlap_start = std::max<u64>(start, region_base);
+        const u64 overlap_end = std::min<u64>(end, static_cast<u64>(region_base) + region_size);
+        if (overlap_start >= overlap_end) {
+            return std::nullopt;
+        }
+        return std::make_pair(static_cast<u32>((overlap_start - region_base) >> CITRA_PAGE_BITS),
+                              static_cast<u32>((overlap_end - 1 - region_base) >> CITRA_PAGE_BITS));
+    }
+
+    DirtyPageBitmap<FCRAM_N3DS_SIZE / CITRA_PAGE_SIZE> fcram;
+    DirtyPageBitmap<VRAM_SIZE / CITRA_PAGE_SIZE> vram;
+};
+
+/// Layout of the physical memory regions within the fastmem backing store.
+constexpr u64 FCRAM_BACKING_OFFSET = 0;
+constexpr u64 VRAM_BACKING_OFFSET = FCRAM_BACKING_OFFSET + FCRAM_N3DS_SIZE;
+constexpr u64 N3DS_EXTRA_RAM_BACKING_OFFSET = VRAM_BACKING_OFFSET + VRAM_SIZE;
+constexpr u64 FASTMEM_BACKING_SIZE = N3DS_EXTRA_RAM_BACKING_OFFSET + N3DS_EXTRA_RAM_SIZE;
+
+/// The arena covers the full 32-bit emulated address space.
+constexpr u64 FASTMEM_ARENA_SIZE = 1ULL << 32;
+
 class MemorySystem::Impl {
 public:
-    // Visual Studio would try to allocate these on compile time if they are std::array, which would
-    // exceed the memory limit.
-    std::unique_ptr<u8[]> fcram = std::make_unique<u8[]>(Memory::FCRAM_N3DS_SIZE);
-    std::unique_ptr<u8[]> vram = std::make_unique<u8[]>(Memory::VRAM_SIZE);
-    std::unique_ptr<u8[]> n3ds_extra_ram = std::make_unique<u8[]>(Memory::N3DS_EXTRA_RAM_SIZE);
+    /**
+     * Shared host memory backing FCRAM, VRAM and N3DS extra RAM, so that mapped pages can be
+     * mirrored into the fastmem arena. DSP memory is owned by the DSP core and is not part of the
+     * backing store; accesses to it always take the software page-table path.
+     */
+    Common::HostMemory host_memory{FASTMEM_BACKING_SIZE, Settings::values.use_fastmem.GetValue()
+                                                             ? FASTMEM_ARENA_SIZE
+                                                             : 0};
+
+    u8* const fcram = host_memory.BackingBasePointer() + FCRAM_BACKING_OFFSET;
+    u8* const vram = host_memory.BackingBasePointer() + VRAM_BACKING_OFFSET;
+    u8* const n3ds_extra_ram = host_memory.BackingBasePointer() + N3DS_EXTRA_RAM_BACKING_OFFSET;
 
     std::shared_ptr<PageTable> current_page_table = nullptr;
     RasterizerCacheMarker cache_marker;
+    RasterizerDirtyMarker dirty_marker;
     std::vector<std::shared_ptr<PageTable>> page_table_list;
 
     AudioCore::DspInterface* dsp = nullptr;
@@ -106,18 +269,47 @@ public:
     std::shared_ptr<BackingMem> n3ds_extra_ram_mem;
     std::shared_ptr<BackingMem> dsp_mem;
 
+    /// A physical region span with its host backing, precomputed for GetPhysicalPointer so the
+    /// hot GPU path resolves addresses without constructing a serializable MemoryRef.
+    struct PhysicalRegion {
+        PAddr base;
+        u32 size;
+        u8* host_base;
+    };
+
+    /**
+     * Physical regions ordered by lookup frequency (most guest buffers live in FCRAM). The host
+     * base pointers are fixed for the lifetime of this object, except for DSP memory which is
+     * filled in once the DSP core is attached.
+     */
+    std::array<PhysicalRegion, 4> physical_regions{};
+
+    /// Index into `physical_regions` of the last region that satisfied a physical lookup; checked
+    /// first on the next lookup since consecutive GPU accesses rarely change region.
+    std::size_t last_physical_region = 0;
+
     Impl();
 
+    void BuildPhysicalRegionTable() {
+        physical_regions = {{
+            {FCRAM_PADDR, FCRAM_N3DS_SIZE, fcram},
+            {VRAM_PADDR, VRAM_SIZE, vram},
+            {DSP_RAM_PADDR, DSP_RAM_SIZE, dsp ? dsp->GetDspMemory().data() : nullptr},
+            {N3DS_EXTRA_RAM_PADDR, N3DS_EXTRA_RAM_SIZE, n3ds_extra_ram},
+        }};
+        last_physical_region = 0;
+    }
+
     const u8* GetPtr(Region r) const {
         switch (r) {
         case Region::VRAM:
-            return vram.get();
+            return vram;
         case Region::DSP:
             return dsp->GetDspMemory().data();
         case Region::FCRAM:
-            return fcram.get();
+            return fcram;
         case Region::N3DS:
-            return n3ds_extra_ram.get();
+            return n3ds_extra_ram;
         default:
             UNREACHABLE();
         }
@@ -126,13 +318,13 @@ public:
     u8* GetPtr(Region r) {
         switch (r) {
         case Region::VRAM:
-            return vram.get();
+            return vram;
         case Region::DSP:
             return dsp->GetDspMemory().data();
         case Region::FCRAM:
-            return fcram.get();
+            return fcram;
         case Region::N3DS:
-            return n3ds_extra_ram.get();
+            return n3ds_extra_ram;
         default:
             UNREACHABLE();
         }
@@ -167,6 +359,43 @@ public:
         return nullptr; // Should never happen
     }
 
+    /**
+     * Returns the number of bytes starting at `addr` (at most `max_size`) that can be serviced
+     * with a single wide operation: runs of `Memory` pages with contiguous host pointers, runs
+     * of `RasterizerCachedMemory` pages with contiguous backing, or runs of `Unmapped` pages.
+     * `Special` (MMIO) pages never coalesce since the handlers are per-region.
+     */
+    std::size_t CoalescedSpan(PageTable& page_table, const VAddr addr,
+                              const std::size_t max_size) const {
+        std::size_t page_index = addr >> CITRA_PAGE_BITS;
+        const PageType type = page_table.attributes[page_index];
+        std::size_t span = std::min<std::size_t>(CITRA_PAGE_SIZE - (addr & CITRA_PAGE_MASK),
+                                                 max_size);
+        if (type == PageType::Special) {
+            return span;
+        }
+
+        while (span < max_size) {
+            const std::size_t next_page = page_index + 1;
+            if (page_table.attributes[next_page] != type) {
+                break;
+            }
+            if (type == PageType::Memory &&
+                page_table.pointers[next_page] !=
+                    page_table.pointers[page_index] + CITRA_PAGE_SIZE) {
+                break;
+            }
+            if (type == PageType::RasterizerCachedMemory &&
+                GetPointerForRasterizerCache(static_cast<VAddr>(next_page << CITRA_PAGE_BITS))
+                        .GetPtr() != GetPointerForRasterizerCache(addr).GetPtr() + span) {
+                break;
+            }
+            span += std::min<std::size_t>(CITRA_PAGE_SIZE, max_size - span);
+            page_index = next_page;
+        }
+        return span;
+    }
+
     template <bool UNSAFE>
     void ReadBlockImpl(const Kernel::Process& process, const VAddr src_addr, void* dest_buffer,
                        const std::size_t size) {
@@ -177,9 +406,12 @@ public:
         std::size_t page_offset = src_addr & CITRA_PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount = std::min(CITRA_PAGE_SIZE - page_offset, remaining_size);
             const VAddr current_vaddr =
                 static_cast<VAddr>((page_index << CITRA_PAGE_BITS) + page_offset);
+            // Spans of contiguous same-type pages are serviced with one wide copy (and, for
+            // rasterizer-cached memory, one flush) instead of page-by-page
+            const std::size_t copy_amount =
+                CoalescedSpan(page_table, current_vaddr, remaining_size);
 
             switch (page_table.attributes[page_index]) {
             case PageType::Unmapped: {
@@ -216,8 +448,8 @@ public:
                 UNREACHABLE();
             }
 
-            page_index++;
-            page_offset = 0;
+            page_index = (current_vaddr + copy_amount) >> CITRA_PAGE_BITS;
+            page_offset = (current_vaddr + copy_amount) & CITRA_PAGE_MASK;
             dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
             remaining_size -= copy_amount;
         }
@@ -232,9 +464,10 @@ public:
         std::size_t page_offset = dest_addr & CITRA_PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount = std::min(CITRA_PAGE_SIZE - page_offset, remaining_size);
             const VAddr current_vaddr =
                 static_cast<VAddr>((page_index << CITRA_PAGE_BITS) + page_offset);
+            const std::size_t copy_amount =
+                CoalescedSpan(page_table, current_vaddr, remaining_size);
 
             switch (page_table.attributes[page_index]) {
             case PageType::Unmapped: {
@@ -263,6 +496,7 @@ public:
                     RasterizerFlushVirtualRegion(current_vaddr, static_cast<u32>(copy_amount),
                                                  FlushMode::Invalidate);
                 }
+                dirty_marker.Mark(current_vaddr, static_cast<u32>(copy_amount));
                 std::memcpy(GetPointerForRasterizerCache(current_vaddr), src_buffer, copy_amount);
                 break;
             }
@@ -270,13 +504,73 @@ public:
                 UNREACHABLE();
             }
 
-            page_index++;
-            page_offset = 0;
+            page_index = (current_vaddr + copy_amount) >> CITRA_PAGE_BITS;
+            page_offset = (current_vaddr + copy_amount) & CITRA_PAGE_MASK;
             src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
             remaining_size -= copy_amount;
         }
     }
 
+    /**
+     * Returns the offset into the fastmem backing store for a pointer into one of the backed
+     * physical regions, or no value for memory that is not part of the store (e.g. DSP RAM).
+     */
+    std::optional<u64> GetBackingOffset(const u8* pointer) const {
+        const u8* base = host_memory.BackingBasePointer();
+        if (pointer >= base && pointer < base + FASTMEM_BACKING_SIZE) {
+            return static_cast<u64>(pointer - base);
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Re-mirrors a range of pages of the given page table into the fastmem arena. Only pages of
+     * type `Memory` whose backing lies within the backing store are mapped; everything else is
+     * left unmapped so that accesses fault on the host and fall back to the software page table.
+     * Does nothing unless the table is the currently active one.
+     */
+    void SyncFastmemRegion(PageTable& page_table, u32 page_base, u32 num_pages) {
+        if (!host_memory.VirtualBasePointer() || &page_table != current_page_table.get()) {
+            return;
+        }
+
+        host_memory.Unmap(static_cast<u64>(page_base) << CITRA_PAGE_BITS,
+                          static_cast<u64>(num_pages) << CITRA_PAGE_BITS);
+
+        // Coalesce contiguous pages into single host mappings.
+        auto& pointers = page_table.GetPointerArray();
+        u64 run_vaddr = 0;
+        u64 run_host = 0;
+        u64 run_size = 0;
+        const auto flush_run = [&] {
+            if (run_size != 0) {
+                host_memory.Map(run_vaddr, run_host, run_size);
+                run_size = 0;
+            }
+        };
+        for (u32 page = page_base; page < page_base + num_pages; ++page) {
+            std::optional<u64> host_offset;
+            if (page_table.attributes[page] == PageType::Memory) {
+                host_offset = GetBackingOffset(pointers[page]);
+            }
+            if (!host_offset) {
+                flush_run();
+                continue;
+            }
+            const u64 page_vaddr = static_cast<u64>(page) << CITRA_PAGE_BITS;
+            if (run_size != 0 && run_vaddr + run_size == page_vaddr &&
+                run_host + run_size == *host_offset) {
+                run_size += CITRA_PAGE_SIZE;
+            } else {
+                flush_run();
+                run_vaddr = page_vaddr;
+                run_host = *host_offset;
+                run_size = CITRA_PAGE_SIZE;
+            }
+        }
+        flush_run();
+    }
+
     MemoryRef GetPointerForRasterizerCache(VAddr addr) const {
         if (addr >= LINEAR_HEAP_VADDR && addr < LINEAR_HEAP_VADDR_END) {
             return {fcram_mem, addr - LINEAR_HEAP_VADDR};
@@ -302,11 +596,11 @@ private:
     void serialize(Archive& ar, const unsigned int file_version) {
         bool save_n3ds_ram = Settings::values.is_new_3ds.GetValue();
         ar& save_n3ds_ram;
-        ar& boost::serialization::make_binary_object(vram.get(), Memory::VRAM_SIZE);
+        ar& boost::serialization::make_binary_object(vram, Memory::VRAM_SIZE);
         ar& boost::serialization::make_binary_object(
-            fcram.get(), save_n3ds_ram ? Memory::FCRAM_N3DS_SIZE : Memory::FCRAM_SIZE);
+            fcram, save_n3ds_ram ? Memory::FCRAM_N3DS_SIZE : Memory::FCRAM_SIZE);
         ar& boost::serialization::make_binary_object(
-            n3ds_extra_ram.get(), save_n3ds_ram ? Memory::N3DS_EXTRA_RAM_SIZE : 0);
+            n3ds_extra_ram, save_n3ds_ram ? Memory::N3DS_EXTRA_RAM_SIZE : 0);
         ar& cache_marker;
         ar& page_table_list;
         // dsp is set from Core::System at startup
@@ -315,6 +609,14 @@ private:
         ar& vram_mem;
         ar& n3ds_extra_ram_mem;
         ar& dsp_mem;
+        if constexpr (Archive::is_loading::value) {
+            // The loaded page tables no longer match the arena contents.
+            if (current_page_table) {
+                SyncFastmemRegion(*current_page_table, 0, static_cast<u32>(PAGE_TABLE_NUM_ENTRIES));
+            }
+            // Dirty flags are not saved; assume everything changed across a load.
+            dirty_marker.MarkAll();
+        }
     }
 };
 
@@ -349,7 +651,9 @@ MemorySystem::Impl::Impl()
     : fcram_mem(std::make_shared<BackingMemImpl<Region::FCRAM>>(*this)),
       vram_mem(std::make_shared<BackingMemImpl<Region::VRAM>>(*this)),
       n3ds_extra_ram_mem(std::make_shared<BackingMemImpl<Region::N3DS>>(*this)),
-      dsp_mem(std::make_shared<BackingMemImpl<Region::DSP>>(*this)) {}
+      dsp_mem(std::make_shared<BackingMemImpl<Region::DSP>>(*this)) {
+    BuildPhysicalRegionTable();
+}
 
 MemorySystem::MemorySystem() : impl(std::make_unique<Impl>()) {}
 MemorySystem::~MemorySystem() = default;
@@ -363,6 +667,9 @@ SERIALIZE_IMPL(MemorySystem)
 
 void MemorySystem::SetCurrentPageTable(std::shared_ptr<PageTable> page_table) {
     impl->current_page_table = page_table;
+    if (page_table) {
+        impl->SyncFastmemRegion(*page_table, 0, static_cast<u32>(PAGE_TABLE_NUM_ENTRIES));
+    }
 }
 
 std::shared_ptr<PageTable> MemorySystem::GetCurrentPageTable() const {
@@ -377,6 +684,7 @@ void MemorySystem::MapPages(PageTable& page_table, u32 base, u32 size, MemoryRef
     RasterizerFlushVirtualRegion(base << CITRA_PAGE_BITS, size * CITRA_PAGE_SIZE,
                                  FlushMode::FlushAndInvalidate);
 
+    const u32 first_page = base;
     u32 end = base + size;
     while (base != end) {
         ASSERT_MSG(base < PAGE_TABLE_NUM_ENTRIES, "out of range mapping at {:08X}", base);
@@ -394,6 +702,8 @@ void MemorySystem::MapPages(PageTable& page_table, u32 base, u32 size, MemoryRef
         if (memory != nullptr && memory.GetSize() > CITRA_PAGE_SIZE)
             memory += CITRA_PAGE_SIZE;
     }
+
+    impl->SyncFastmemRegion(page_table, first_page, size);
 }
 
 void MemorySystem::MapMemoryRegion(PageTable& page_table, VAddr base, u32 size, MemoryRef target) {
@@ -423,6 +733,10 @@ MemoryRef MemorySystem::GetPointerForRasterizerCache(VAddr addr) const {
     return impl->GetPointerForRasterizerCache(addr);
 }
 
+u8* MemorySystem::GetFastmemArenaBase() {
+    return impl->host_memory.VirtualBasePointer();
+}
+
 void MemorySystem::RegisterPageTable(std::shared_ptr<PageTable> page_table) {
     impl->page_table_list.push_back(page_table);
 }
@@ -525,6 +839,7 @@ void MemorySystem::Write(const VAddr vaddr, const T data) {
         break;
     case PageType::RasterizerCachedMemory: {
         RasterizerFlushVirtualRegion(vaddr, sizeof(T), FlushMode::Invalidate);
+        impl->dirty_marker.Mark(vaddr, sizeof(T));
         std::memcpy(GetPointerForRasterizerCache(vaddr), &data, sizeof(T));
         break;
     }
@@ -557,6 +872,7 @@ bool MemorySystem::WriteExclusive(const VAddr vaddr, const T data, const T expec
         return true;
     case PageType::RasterizerCachedMemory: {
         RasterizerFlushVirtualRegion(vaddr, sizeof(T), FlushMode::Invalidate);
+        impl->dirty_marker.Mark(vaddr, sizeof(T));
         const auto volatile_pointer =
             reinterpret_cast<volatile T*>(GetPointerForRasterizerCache(vaddr).GetPtr());
         return Common::AtomicCompareAndSwap(volatile_pointer, data, expected);
@@ -626,6 +942,33 @@ const u8* MemorySystem::GetPointer(const VAddr vaddr) const {
     return nullptr;
 }
 
+u8* MemorySystem::GetPointerForRange(const Kernel::Process& process, VAddr vaddr,
+                                     std::size_t size) {
+    if (size == 0) {
+        return nullptr;
+    }
+
+    auto& page_table = *process.vm_manager.page_table;
+    const std::size_t first_page = vaddr >> CITRA_PAGE_BITS;
+    const std::size_t last_page = (vaddr + size - 1) >> CITRA_PAGE_BITS;
+
+    // A non-null entry guarantees the page is of type `Memory`, so rasterizer-cached and MMIO
+    // pages (which need flushes or handlers) fail the lookup and callers fall back to block
+    // copies. Every subsequent page must be host-contiguous with the first.
+    u8* const first_pointer = page_table.pointers[first_page];
+    if (first_pointer == nullptr) {
+        return nullptr;
+    }
+    for (std::size_t page = first_page + 1; page <= last_page; ++page) {
+        if (page_table.pointers[page] !=
+            first_pointer + (page - first_page) * CITRA_PAGE_SIZE) {
+            return nullptr;
+        }
+    }
+
+    return first_pointer + (vaddr & CITRA_PAGE_MASK);
+}
+
 std::string MemorySystem::ReadCString(VAddr vaddr, std::size_t max_length) {
     std::string string;
     string.reserve(max_length);
@@ -644,7 +987,26 @@ std::string MemorySystem::ReadCString(VAddr vaddr, std::size_t max_length) {
 }
 
 u8* MemorySystem::GetPhysicalPointer(PAddr address) {
-    return GetPhysicalRef(address);
+    // This is called per buffer access on the GPU path, so the region is resolved against the
+    // precomputed table instead of going through GetPhysicalRef and its shared_ptr traffic. The
+    // bounds check is inclusive and relies on unsigned wrap-around for addresses below the base,
+    // matching GetPhysicalRef.
+    const auto& regions = impl->physical_regions;
+    std::size_t region = impl->last_physical_region;
+    if (address - regions[region].base > regions[region].size) {
+        region = 0;
+        while (region < regions.size() && address - regions[region].base > regions[region].size) {
+            ++region;
+        }
+        if (region == regions.size()) {
+            LOG_ERROR(HW_Memory, "Unknown GetPhysicalPointer @ {:#08X} at PC {:#08X}", address,
+                      Core::GetRunningCore().GetPC());
+            return nullptr;
+        }
+        impl->last_physical_region = region;
+    }
+    u8* const host_base = regions[region].host_base;
+    return host_base ? host_base + (address - regions[region].base) : nullptr;
 }
 
 MemoryRef MemorySystem::GetPhysicalRef(PAddr address) const {
@@ -723,6 +1085,12 @@ void MemorySystem::RasterizerMarkRegionCached(PAddr start, u32 size, bool cached
         return;
     }
 
+    if (!cached) {
+        // Writes to uncached pages are not tracked, so conservatively leave the region dirty
+        // once it drops out of the cache.
+        impl->dirty_marker.MarkPhysical(start, size);
+    }
+
     u32 num_pages = ((start + size - 1) >> CITRA_PAGE_BITS) - (start >> CITRA_PAGE_BITS) + 1;
     PAddr paddr = start;
 
@@ -763,11 +1131,27 @@ void MemorySystem::RasterizerMarkRegionCached(PAddr start, u32 size, bool cached
                         UNREACHABLE();
                     }
                 }
+
+                impl->SyncFastmemRegion(*page_table, vaddr >> CITRA_PAGE_BITS, 1);
             }
         }
     }
 }
 
+bool MemorySystem::RasterizerIsRegionDirty(PAddr start, u32 size) const {
+    if (size == 0) {
+        return false;
+    }
+    return impl->dirty_marker.IsDirty(start, size);
+}
+
+void MemorySystem::RasterizerResetDirtyRegion(PAddr start, u32 size) {
+    if (size == 0) {
+        return;
+    }
+    impl->dirty_marker.Reset(start, size);
+}
+
 void RasterizerFlushRegion(PAddr start, u32 size) {
     if (VideoCore::g_renderer == nullptr) {
         return;
@@ -953,6 +1337,7 @@ void MemorySystem::ZeroBlock(const Kernel::Process& process, const VAddr dest_ad
         case PageType::RasterizerCachedMemory: {
             RasterizerFlushVirtualRegion(current_vaddr, static_cast<u32>(copy_amount),
                                          FlushMode::Invalidate);
+            impl->dirty_marker.Mark(current_vaddr, static_cast<u32>(copy_amount));
             std::memset(GetPointerForRasterizerCache(current_vaddr), 0, copy_amount);
             break;
         }
@@ -1067,18 +1452,18 @@ void WriteMMIO<u64>(MMIORegionPointer mmio_handler, VAddr addr, const u64 data)
 }
 
 u32 MemorySystem::GetFCRAMOffset(const u8* pointer) const {
-    ASSERT(pointer >= impl->fcram.get() && pointer <= impl->fcram.get() + Memory::FCRAM_N3DS_SIZE);
-    return static_cast<u32>(pointer - impl->fcram.get());
+    ASSERT(pointer >= impl->fcram && pointer <= impl->fcram + Memory::FCRAM_N3DS_SIZE);
+    return static_cast<u32>(pointer - impl->fcram);
 }
 
 u8* MemorySystem::GetFCRAMPointer(std::size_t offset) {
     ASSERT(offset <= Memory::FCRAM_N3DS_SIZE);
-    return impl->fcram.get() + offset;
+    return impl->fcram + offset;
 }
 
 const u8* MemorySystem::GetFCRAMPointer(std::size_t offset) const {
     ASSERT(offset <= Memory::FCRAM_N3DS_SIZE);
-    return impl->fcram.get() + offset;
+    return impl->fcram + offset;
 }
 
 MemoryRef MemorySystem::GetFCRAMRef(std::size_t offset) const {
@@ -1088,6 +1473,8 @@ MemoryRef MemorySystem::GetFCRAMRef(std::size_t offset) const {
 
 void MemorySystem::SetDSP(AudioCore::DspInterface& dsp) {
     impl->dsp = &dsp;
+    // DSP memory only gets a host backing once the DSP core exists
+    impl->BuildPhysicalRegionTable();
 }
 
 } // namespace Memory
@@ -335,6 +335,18 @@ public:
      */
     const u8* GetPointer(VAddr vaddr) const;
 
+    /**
+     * Gets a pointer to a range of the given process' address space, for in-place access.
+     *
+     * @param process The process whose address space is accessed.
+     * @param vaddr Virtual address of the start of the range.
+     * @param size Size of the range in bytes.
+     *
+     * @returns A host pointer covering the whole range, or nullptr if any page in the range
+     *          is not plain memory or is not contiguous in host memory with the first page.
+     */
+    u8* GetPointerForRange(const Kernel::Process& process, VAddr vaddr, std::size_t size);
+
     /**
      * Reads an 8-bit unsigned value from the current process' address space
      * at the given virtual address.
@@ -575,6 +587,25 @@ public:
      */
     void RasterizerMarkRegionCached(PAddr start, u32 size, bool cached);
 
+    /**
+     * Returns true if the CPU has written to any page of the given physical region since the
+     * dirty flags covering it were last reset. Only writes to pages marked as rasterizer-cached
+     * are tracked; scanning the two-level bitmap touches a few words per megabyte queried.
+     *
+     * @param start The physical address indicating the start of the region.
+     * @param size  The size of the region in bytes.
+     */
+    bool RasterizerIsRegionDirty(PAddr start, u32 size) const;
+
+    /**
+     * Resets the dirty flags for the given physical region, so that a later
+     * RasterizerIsRegionDirty() only reports writes made after this call.
+     *
+     * @param start The physical address indicating the start of the region.
+     * @param size  The size of the region in bytes.
+     */
+    void RasterizerResetDirtyRegion(PAddr start, u32 size);
+
     /// Gets a pointer to the memory region beginning at the specified physical address.
     u8* GetPhysicalPointer(PAddr address);
 
@@ -599,6 +630,16 @@ public:
     /// Gets a serializable ref to FCRAM with the given offset
     MemoryRef GetFCRAMRef(std::size_t offset) const;
 
+    /**
+     * Gets the base of the fastmem arena: a contiguous host virtual region mirroring the current
+     * process' address space, into which mapped pages are inserted as they are mapped. Accesses to
+     * pages that are unmapped (or that require flushing/MMIO handling) fault on the host and must
+     * be handled by falling back to the software page table.
+     *
+     * @returns The arena base, or nullptr if fastmem is disabled or unsupported on this host.
+     */
+    u8* GetFastmemArenaBase();
+
     /// Registers page table for rasterizer cache marking
     void RegisterPageTable(std::shared_ptr<PageTable> page_table);
 
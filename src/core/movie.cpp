@@ -29,6 +29,10 @@ namespace Core {
 
 /*static*/ Movie Movie::s_instance;
 
+Movie::~Movie() {
+    StopRecordFile();
+}
+
 enum class ControllerStateType : u8 {
     PadAndCircle,
     Touch,
@@ -113,6 +117,10 @@ static_assert(sizeof(ControllerState) == 7, "ControllerState should be 7 bytes")
 
 constexpr std::array<u8, 4> header_magic_bytes{{'C', 'T', 'M', 0x1B}};
 
+/// Recorded input is handed to the background writer in chunks of this size, so a crash or
+/// power loss during recording loses at most one chunk (a few seconds of input).
+constexpr std::size_t FLUSH_CHUNK_SIZE = 16 * 1024;
+
 #pragma pack(push, 1)
 struct CTMHeader {
     std::array<u8, 4> filetype;  /// Unique Identifier to check the file type (always "CTM"0x1B)
@@ -189,6 +197,7 @@ void Movie::serialize(Archive& ar, const unsigned int file_version) {
         }
 
         if (post_movie) {
+            StopRecordFile();
             play_mode = PlayMode::MovieFinished;
             return;
         }
@@ -212,6 +221,8 @@ void Movie::serialize(Archive& ar, const unsigned int file_version) {
         } else {
             play_mode = PlayMode::Recording;
             rerecord_count++;
+            // The loaded timeline replaces the file contents, so restart the incremental writer
+            StartRecordFile();
         }
     }
 }
@@ -365,6 +376,8 @@ void Movie::Record(const ControllerState& controller_state) {
     recorded_input.resize(current_byte + sizeof(ControllerState));
     std::memcpy(&recorded_input[current_byte], &controller_state, sizeof(ControllerState));
     current_byte += sizeof(ControllerState);
+
+    FlushRecordedInput();
 }
 
 void Movie::Record(const Service::HID::PadState& pad_state, const s16& circle_pad_x,
@@ -481,15 +494,7 @@ Movie::ValidationResult Movie::ValidateInput(const std::vector<u8>& input,
                                                   : ValidationResult::InputCountDismatch;
 }
 
-void Movie::SaveMovie() {
-    LOG_INFO(Movie, "Saving recorded movie to '{}'", record_movie_file);
-    FileUtil::IOFile save_record(record_movie_file, "wb");
-
-    if (!save_record.IsGood()) {
-        LOG_ERROR(Movie, "Unable to open file to save movie");
-        return;
-    }
-
+CTMHeader Movie::MakeHeader(u64 input_count) const {
     CTMHeader header = {};
     header.filetype = header_magic_bytes;
     header.program_id = program_id;
@@ -500,19 +505,114 @@ void Movie::SaveMovie() {
                 std::min(header.author.size(), record_movie_author.size()));
 
     header.rerecord_count = rerecord_count;
-    header.input_count = GetInputCount(recorded_input);
+    header.input_count = input_count;
 
     std::string rev_bytes;
     CryptoPP::StringSource(Common::g_scm_rev, true,
                            new CryptoPP::HexDecoder(new CryptoPP::StringSink(rev_bytes)));
     std::memcpy(header.revision.data(), rev_bytes.data(), sizeof(CTMHeader::revision));
 
-    save_record.WriteBytes(&header, sizeof(CTMHeader));
-    save_record.WriteBytes(recorded_input.data(), recorded_input.size());
+    return header;
+}
+
+void Movie::FlushThreadFunc() {
+    std::unique_lock lock{flush_mutex};
+    while (true) {
+        flush_cv.wait(lock, [this] { return flush_exit || !flush_buffer.empty(); });
+        if (flush_buffer.empty()) {
+            break; // Only exit once every outstanding chunk has been written
+        }
+        const std::vector<u8> chunk = std::move(flush_buffer);
+        flush_buffer.clear();
+        lock.unlock();
+        record_file->WriteBytes(chunk.data(), chunk.size());
+        record_file->Flush();
+        lock.lock();
+    }
+}
+
+void Movie::StartRecordFile() {
+    StopRecordFile();
 
-    if (!save_record.IsGood()) {
+    record_file = std::make_unique<FileUtil::IOFile>(record_movie_file, "wb");
+    if (!record_file->IsGood()) {
+        LOG_ERROR(Movie, "Unable to open file to record movie");
+        record_file.reset();
+        return;
+    }
+
+    // Write a provisional header so a crash still leaves a playable file. input_count stays
+    // zero until SaveMovie finalizes it; a zero count is already accepted as "unknown".
+    const CTMHeader header = MakeHeader(0);
+    record_file->WriteBytes(&header, sizeof(CTMHeader));
+    record_file->Flush();
+
+    flushed_byte = 0;
+    flush_exit = false;
+    flush_thread = std::thread([this] { FlushThreadFunc(); });
+}
+
+void Movie::StopFlushThread() {
+    if (!flush_thread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard lock{flush_mutex};
+        flush_exit = true;
+    }
+    flush_cv.notify_one();
+    flush_thread.join();
+}
+
+void Movie::StopRecordFile() {
+    StopFlushThread();
+    record_file.reset();
+    flushed_byte = 0;
+}
+
+void Movie::FlushRecordedInput() {
+    if (!record_file || recorded_input.size() - flushed_byte < FLUSH_CHUNK_SIZE) {
+        return;
+    }
+    {
+        std::lock_guard lock{flush_mutex};
+        flush_buffer.insert(flush_buffer.end(), recorded_input.begin() + flushed_byte,
+                            recorded_input.end());
+    }
+    flushed_byte = recorded_input.size();
+    flush_cv.notify_one();
+}
+
+void Movie::SaveMovie() {
+    LOG_INFO(Movie, "Saving recorded movie to '{}'", record_movie_file);
+    StopFlushThread();
+
+    if (!record_file) {
+        // The incremental writer never opened the file; fall back to a full rewrite
+        record_file = std::make_unique<FileUtil::IOFile>(record_movie_file, "wb");
+        if (!record_file->IsGood()) {
+            LOG_ERROR(Movie, "Unable to open file to save movie");
+            record_file.reset();
+            return;
+        }
+        const CTMHeader provisional = MakeHeader(0);
+        record_file->WriteBytes(&provisional, sizeof(CTMHeader));
+        flushed_byte = 0;
+    }
+
+    // Append whatever the background writer had not flushed yet, then finalize the header
+    record_file->WriteBytes(recorded_input.data() + flushed_byte,
+                            recorded_input.size() - flushed_byte);
+    const CTMHeader header = MakeHeader(GetInputCount(recorded_input));
+    record_file->Seek(0, SEEK_SET);
+    record_file->WriteBytes(&header, sizeof(CTMHeader));
+    record_file->Flush();
+
+    if (!record_file->IsGood()) {
         LOG_ERROR(Movie, "Error saving movie");
     }
+    record_file.reset();
+    flushed_byte = 0;
 }
 
 void Movie::SetPlaybackCompletionCallback(std::function<void()> completion_callback) {
@@ -567,6 +667,8 @@ void Movie::StartRecording(const std::string& movie_file, const std::string& aut
     program_id = 0;
     Core::System::GetInstance().GetAppLoader().ReadProgramId(program_id);
 
+    StartRecordFile();
+
     LOG_INFO(Movie, "Enabling Movie recording, ID: {:016X}", id);
 }
 
@@ -661,6 +763,7 @@ void Movie::Shutdown() {
     if (play_mode == PlayMode::Recording) {
         SaveMovie();
     }
+    StopRecordFile();
 
     play_mode = PlayMode::None;
     recorded_input.resize(0);
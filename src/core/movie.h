@@ -4,10 +4,18 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <boost/serialization/vector.hpp>
 #include "common/common_types.h"
 
+namespace FileUtil {
+class IOFile;
+}
+
 namespace Service {
 namespace HID {
 struct AccelerometerDataEntry;
@@ -42,6 +50,8 @@ public:
         return s_instance;
     }
 
+    ~Movie();
+
     void SetPlaybackCompletionCallback(std::function<void()> completion_callback);
     void StartPlayback(const std::string& movie_file);
     void StartRecording(const std::string& movie_file, const std::string& author);
@@ -158,6 +168,26 @@ private:
     ValidationResult ValidateHeader(const CTMHeader& header) const;
     ValidationResult ValidateInput(const std::vector<u8>& input, u64 expected_count) const;
 
+    CTMHeader MakeHeader(u64 input_count) const;
+
+    /**
+     * Opens the recording file, writes a provisional header and starts the background flush
+     * thread. Discards any previous writer state, so this is also used when a savestate load
+     * replaces the recorded timeline.
+     */
+    void StartRecordFile();
+
+    /// Drains the background writer and closes the recording file without finalizing the header.
+    void StopRecordFile();
+
+    /// Drains outstanding chunks and joins the background flush thread.
+    void StopFlushThread();
+
+    /// Hands newly recorded bytes to the background writer once a full chunk has accumulated.
+    void FlushRecordedInput();
+
+    void FlushThreadFunc();
+
     PlayMode play_mode;
 
     std::string record_movie_file;
@@ -176,6 +206,16 @@ private:
     u32 rerecord_count = 1;
     bool read_only = true;
 
+    // Background writer state for incremental recording flushes. The recording file always
+    // holds a header plus the first `flushed_byte` bytes of `recorded_input`.
+    std::unique_ptr<FileUtil::IOFile> record_file;
+    std::thread flush_thread;
+    std::mutex flush_mutex;
+    std::condition_variable flush_cv;
+    std::vector<u8> flush_buffer;
+    std::size_t flushed_byte = 0;
+    bool flush_exit = false;
+
     std::function<void()> playback_completion_callback = [] {};
 
     template <class Archive>
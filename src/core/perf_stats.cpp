@@ -12,6 +12,7 @@
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 #include "common/file_util.h"
+#include "common/logging/log.h"
 #include "common/settings.h"
 #include "core/hw/gpu.h"
 #include "core/perf_stats.h"
@@ -25,6 +26,14 @@ using std::chrono::microseconds;
 // booting that we shouldn't account for
 constexpr std::size_t IgnoreFrames = 5;
 
+// A frame whose busy time exceeds this is considered a stutter and triggers a flight
+// recorder dump. Three nominal frame lengths is well past anything frame pacing can hide.
+constexpr double StutterThresholdMs = 50.0;
+
+// Minimum walltime between two flight recorder dumps, so a title that is simply too slow
+// for the host does not fill the log directory with one file per frame
+constexpr std::chrono::seconds StutterDumpCooldown{30};
+
 namespace Core {
 
 PerfStats::PerfStats(u64 title_id) : title_id(title_id) {}
@@ -44,6 +53,17 @@ PerfStats::~PerfStats() {
         fmt::format("{}/{:%F-%H-%M}_{:016X}.csv", path, *std::localtime(&t), title_id);
     FileUtil::IOFile file(filename, "w");
     file.WriteString(stream.str());
+
+    // The hot-path counter deltas are written next to the frame times, one row per
+    // stats interval, so slow titles can be diagnosed from a regular build
+    const std::string counters_filename =
+        fmt::format("{}/{:%F-%H-%M}_{:016X}_counters.csv", path, *std::localtime(&t), title_id);
+    FileUtil::IOFile counters_file(counters_filename, "w");
+    counters_file.WriteString(
+        fmt::format("{}\n", fmt::join(Common::PerfCounters::CounterNames, ",")));
+    for (const auto& row : counter_history) {
+        counters_file.WriteString(fmt::format("{}\n", fmt::join(row, ",")));
+    }
 }
 
 void PerfStats::BeginSystemFrame() {
@@ -53,19 +73,70 @@ void PerfStats::BeginSystemFrame() {
 }
 
 void PerfStats::EndSystemFrame() {
-    std::lock_guard lock{object_mutex};
+    std::string dump;
+    std::string dump_filename;
+    double stutter_ms = 0.0;
+    {
+        std::lock_guard lock{object_mutex};
+
+        auto frame_end = Clock::now();
+        const auto frame_time = frame_end - frame_begin;
+        if (current_index < perf_history.size()) {
+            perf_history[current_index++] =
+                std::chrono::duration<double, std::milli>(frame_time).count();
+        }
+        accumulated_frametime += frame_time;
+        system_frames += 1;
+
+        previous_frame_length = frame_end - previous_frame_end;
+        previous_frame_busy = frame_time;
+        previous_frame_end = frame_end;
+
+        // Record the frame in the flight recorder, attributing the counter activity since
+        // the previous frame to it
+        const auto counter_totals = Common::PerfCounters::GetTotals();
+        FrameRecord& record = flight_recorder[flight_recorder_frames % FlightRecorderFrames];
+        record.busy_ms = std::chrono::duration<double, std::milli>(frame_time).count();
+        record.frame_ms = std::chrono::duration<double, std::milli>(previous_frame_length).count();
+        for (std::size_t i = 0; i < Common::PerfCounters::NumCounters; i++) {
+            record.counters[i] = counter_totals[i] - frame_counter_totals[i];
+        }
+        frame_counter_totals = counter_totals;
+        flight_recorder_frames += 1;
+
+        if (record.busy_ms > StutterThresholdMs && flight_recorder_frames > IgnoreFrames &&
+            title_id != 0 && frame_end >= next_stutter_dump) {
+            next_stutter_dump = frame_end + StutterDumpCooldown;
+            stutter_ms = record.busy_ms;
+            dump = FormatFlightRecorder();
+            const std::time_t t = std::time(nullptr);
+            const std::string& path = FileUtil::GetUserPath(FileUtil::UserPath::LogDir);
+            dump_filename = fmt::format("{}/{:%F-%H-%M-%S}_{:016X}_stutter.csv", path,
+                                        *std::localtime(&t), title_id);
+        }
+    }
 
-    auto frame_end = Clock::now();
-    const auto frame_time = frame_end - frame_begin;
-    if (current_index < perf_history.size()) {
-        perf_history[current_index++] =
-            std::chrono::duration<double, std::milli>(frame_time).count();
+    // Write the dump outside the lock; the file is small but there is no reason to stall
+    // the other stats queries on disk I/O
+    if (!dump.empty()) {
+        FileUtil::IOFile file(dump_filename, "w");
+        file.WriteString(dump);
+        LOG_INFO(Core, "Frame took {:.1f} ms, flight recorder dumped to {}", stutter_ms,
+                 dump_filename);
     }
-    accumulated_frametime += frame_time;
-    system_frames += 1;
+}
 
-    previous_frame_length = frame_end - previous_frame_end;
-    previous_frame_end = frame_end;
+std::string PerfStats::FormatFlightRecorder() const {
+    const u64 recorded = std::min<u64>(flight_recorder_frames, FlightRecorderFrames);
+    std::string csv = fmt::format("frame,busy_ms,frame_ms,{},flagged\n",
+                                  fmt::join(Common::PerfCounters::CounterNames, ","));
+    for (u64 frame = flight_recorder_frames - recorded; frame < flight_recorder_frames; frame++) {
+        const FrameRecord& record = flight_recorder[frame % FlightRecorderFrames];
+        const int flagged = frame == flight_recorder_frames - 1 ? 1 : 0;
+        csv += fmt::format("{},{:.3f},{:.3f},{},{}\n", frame, record.busy_ms, record.frame_ms,
+                           fmt::join(record.counters, ","), flagged);
+    }
+    return csv;
 }
 
 void PerfStats::EndGameFrame() {
@@ -74,6 +145,12 @@ void PerfStats::EndGameFrame() {
     game_frames += 1;
 }
 
+void PerfStats::AddDroppedFrames(u32 frames) {
+    std::lock_guard lock{object_mutex};
+
+    dropped_frames += frames;
+}
+
 double PerfStats::GetMeanFrametime() const {
     std::lock_guard lock{object_mutex};
 
@@ -86,6 +163,23 @@ double PerfStats::GetMeanFrametime() const {
     return sum / static_cast<double>(current_index - IgnoreFrames);
 }
 
+std::size_t PerfStats::GetRecordedFrameCount() const {
+    std::lock_guard lock{object_mutex};
+
+    return current_index;
+}
+
+std::vector<double> PerfStats::GetFrameTimeHistory() const {
+    std::lock_guard lock{object_mutex};
+
+    if (current_index <= IgnoreFrames) {
+        return {};
+    }
+
+    return std::vector<double>(perf_history.begin() + IgnoreFrames,
+                               perf_history.begin() + current_index);
+}
+
 PerfStats::Results PerfStats::GetAndResetStats(microseconds current_system_time_us) {
     std::lock_guard lock(object_mutex);
 
@@ -101,6 +195,16 @@ PerfStats::Results PerfStats::GetAndResetStats(microseconds current_system_time_
     results.frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                         static_cast<double>(system_frames);
     results.emulation_speed = system_us_per_second.count() / 1'000'000.0;
+    results.dropped_frames = dropped_frames;
+
+    const auto counter_totals = Common::PerfCounters::GetTotals();
+    for (std::size_t i = 0; i < Common::PerfCounters::NumCounters; i++) {
+        results.counters[i] = counter_totals[i] - counter_reset_totals[i];
+    }
+    counter_reset_totals = counter_totals;
+    if (Settings::values.record_frame_times && title_id != 0) {
+        counter_history.push_back(results.counters);
+    }
 
     // Reset counters
     reset_point = now;
@@ -108,6 +212,7 @@ PerfStats::Results PerfStats::GetAndResetStats(microseconds current_system_time_
     accumulated_frametime = Clock::duration::zero();
     system_frames = 0;
     game_frames = 0;
+    dropped_frames = 0;
 
     return results;
 }
@@ -119,6 +224,13 @@ double PerfStats::GetLastFrameTimeScale() const {
     return duration_cast<DoubleSecs>(previous_frame_length).count() / FRAME_LENGTH;
 }
 
+double PerfStats::GetLastFrameBusyScale() const {
+    std::lock_guard lock{object_mutex};
+
+    constexpr double FRAME_LENGTH = 1.0 / GPU::SCREEN_REFRESH_RATE;
+    return duration_cast<DoubleSecs>(previous_frame_busy).count() / FRAME_LENGTH;
+}
+
 void FrameLimiter::WaitOnce() {
     if (frame_advancing_enabled) {
         // Frame advancing is enabled: wait on event instead of doing framelimiting
@@ -136,9 +248,10 @@ void FrameLimiter::DoFrameLimiting(microseconds current_system_time_us) {
     }
 
     auto now = Clock::now();
-    double sleep_scale = Settings::values.frame_limit.GetValue() / 100.0;
+    const u16 frame_limit = Settings::GetFrameSettings()->frame_limit;
+    const double sleep_scale = frame_limit / 100.0;
 
-    if (Settings::values.frame_limit.GetValue() == 0) {
+    if (frame_limit == 0) {
         return;
     }
 
@@ -147,24 +260,63 @@ void FrameLimiter::DoFrameLimiting(microseconds current_system_time_us) {
     // percent. High values means it'll take longer after a slow frame to recover and start limiting
     const microseconds max_lag_time_us = duration_cast<microseconds>(
         std::chrono::duration<double, std::chrono::microseconds::period>(25ms / sleep_scale));
-    frame_limiting_delta_err += duration_cast<microseconds>(
+    const microseconds target_frame_interval = duration_cast<microseconds>(
         std::chrono::duration<double, std::chrono::microseconds::period>(
             (current_system_time_us - previous_system_time_us) / sleep_scale));
+    frame_limiting_delta_err += target_frame_interval;
     frame_limiting_delta_err -= duration_cast<microseconds>(now - previous_walltime);
     frame_limiting_delta_err =
         std::clamp(frame_limiting_delta_err, -max_lag_time_us, max_lag_time_us);
 
     if (frame_limiting_delta_err > microseconds::zero()) {
-        std::this_thread::sleep_for(frame_limiting_delta_err);
-        auto now_after_sleep = Clock::now();
-        frame_limiting_delta_err -= duration_cast<microseconds>(now_after_sleep - now);
-        now = now_after_sleep;
+        // Sleeping for the whole wait leaves the frame deadline at the mercy of the host timer
+        // granularity, which can be over a millisecond. Sleep coarsely, stopping early by both
+        // a fixed spin window and the measured oversleep of previous frames, then spin-wait the
+        // final stretch up to the deadline.
+        constexpr microseconds spin_window_us{1000};
+        const auto wake_start = now;
+        const auto deadline = now + frame_limiting_delta_err;
+        const microseconds coarse_sleep =
+            frame_limiting_delta_err - spin_window_us - sleep_overshoot_estimate;
+        if (coarse_sleep > microseconds::zero()) {
+            std::this_thread::sleep_for(coarse_sleep);
+            const auto overshoot =
+                duration_cast<microseconds>(Clock::now() - wake_start) - coarse_sleep;
+            // Exponential moving average of the oversleep, adapting to the host timer
+            sleep_overshoot_estimate = std::clamp(
+                (sleep_overshoot_estimate * 7 + std::max(overshoot, microseconds::zero())) / 8,
+                microseconds::zero(), duration_cast<microseconds>(4ms));
+        }
+        while (Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        now = Clock::now();
+        frame_limiting_delta_err -= duration_cast<microseconds>(now - wake_start);
+    }
+
+    // The deviation between the scheduled cadence and the point we actually resumed at is
+    // what the player perceives as judder, so track it in the jitter histogram
+    const microseconds deviation =
+        duration_cast<microseconds>(now - previous_walltime) - target_frame_interval;
+    const auto abs_deviation = deviation < microseconds::zero() ? -deviation : deviation;
+    const std::size_t bucket =
+        std::min<std::size_t>(abs_deviation / JitterBucketWidth, NumJitterBuckets - 1);
+    {
+        std::lock_guard lock{jitter_mutex};
+        jitter_histogram[bucket]++;
     }
 
     previous_system_time_us = current_system_time_us;
     previous_walltime = now;
 }
 
+FrameLimiter::JitterHistogram FrameLimiter::GetAndResetJitterHistogram() {
+    std::lock_guard lock{jitter_mutex};
+    const JitterHistogram histogram = jitter_histogram;
+    jitter_histogram.fill(0);
+    return histogram;
+}
+
 bool FrameLimiter::IsFrameAdvancing() const {
     return frame_advancing_enabled;
 }
@@ -9,7 +9,10 @@
 #include <chrono>
 #include <cstddef>
 #include <mutex>
+#include <string>
+#include <vector>
 #include "common/common_types.h"
+#include "common/perf_counters.h"
 #include "common/thread.h"
 
 namespace Core {
@@ -34,26 +37,66 @@ public:
         double frametime;
         /// Ratio of walltime / emulated time elapsed
         double emulation_speed;
+        /// Number of rendered frames the presentation mailbox discarded since the last query
+        u32 dropped_frames;
+        /// Hot-path counter deltas since the last query, in Common::PerfCounters enum order
+        std::array<u64, Common::PerfCounters::NumCounters> counters;
     };
 
     void BeginSystemFrame();
     void EndSystemFrame();
     void EndGameFrame();
+    void AddDroppedFrames(u32 frames);
 
     Results GetAndResetStats(std::chrono::microseconds current_system_time_us);
 
+    /// Number of frames of per-frame history kept by the stutter flight recorder
+    static constexpr std::size_t FlightRecorderFrames = 600;
+
+    /// One frame of flight recorder data
+    struct FrameRecord {
+        /// Walltime spent emulating the frame, excluding limiter waits, in milliseconds
+        double busy_ms;
+        /// Total visible frame duration, including limiter waits, in milliseconds
+        double frame_ms;
+        /// Hot-path counter deltas accumulated while the frame was emulated
+        std::array<u64, Common::PerfCounters::NumCounters> counters;
+    };
+
     /**
      * Returns the arithmetic mean of all frametime values stored in the performance history.
      */
     double GetMeanFrametime() const;
 
+    /**
+     * Returns the number of system frames recorded in the performance history so far.
+     */
+    std::size_t GetRecordedFrameCount() const;
+
+    /**
+     * Returns a copy of the per-frame busy times stored in the performance history, oldest
+     * first, in milliseconds. The boot overhead frames are excluded like in GetMeanFrametime().
+     */
+    std::vector<double> GetFrameTimeHistory() const;
+
     /**
      * Gets the ratio between walltime and the emulated time of the previous system frame. This is
      * useful for scaling inputs or outputs moving between the two time domains.
      */
     double GetLastFrameTimeScale() const;
 
+    /**
+     * Gets the ratio between the walltime spent emulating the previous system frame (excluding
+     * v-sync/frame-limiting waits) and the frame's nominal length. Values approaching 1 mean the
+     * host can barely keep up; values above 1 mean it cannot.
+     */
+    double GetLastFrameBusyScale() const;
+
 private:
+    /// Formats the flight recorder contents as CSV, oldest frame first, with the most recent
+    /// (offending) frame flagged in the last column. object_mutex must be held.
+    std::string FormatFlightRecorder() const;
+
     mutable std::mutex object_mutex;
 
     /// Title ID for the game that is running. 0 if there is no game running yet
@@ -69,12 +112,32 @@ private:
     /// System time when the cumulative counters were reset
     std::chrono::microseconds reset_point_system_us{0};
 
+    /// Hot-path counter totals at the last reset, used to compute per-interval deltas
+    std::array<u64, Common::PerfCounters::NumCounters> counter_reset_totals =
+        Common::PerfCounters::GetTotals();
+    /// Per-interval counter deltas recorded for the CSV export when frame-time recording
+    /// is enabled
+    std::vector<std::array<u64, Common::PerfCounters::NumCounters>> counter_history;
+
+    /// Always-on flight recorder holding the most recent frames, indexed modulo
+    /// FlightRecorderFrames; dumped to a file when a frame exceeds the stutter threshold
+    std::array<FrameRecord, FlightRecorderFrames> flight_recorder{};
+    /// Total number of frames written to the flight recorder
+    u64 flight_recorder_frames = 0;
+    /// Hot-path counter totals at the end of the previous frame, used for per-frame deltas
+    std::array<u64, Common::PerfCounters::NumCounters> frame_counter_totals =
+        Common::PerfCounters::GetTotals();
+    /// Walltime before which no stutter dump is written, rate-limiting the file output
+    Clock::time_point next_stutter_dump = Clock::now();
+
     /// Cumulative duration (excluding v-sync/frame-limiting) of frames since last reset
     Clock::duration accumulated_frametime = Clock::duration::zero();
     /// Cumulative number of system frames (LCD VBlanks) presented since last reset
     u32 system_frames = 0;
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     u32 game_frames = 0;
+    /// Cumulative number of rendered frames dropped before presentation since last reset
+    u32 dropped_frames = 0;
 
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
@@ -82,14 +145,28 @@ private:
     Clock::time_point frame_begin = reset_point;
     /// Total visible duration (including frame-limiting, etc.) of the previous system frame
     Clock::duration previous_frame_length = Clock::duration::zero();
+    /// Busy duration (excluding frame-limiting, etc.) of the previous system frame
+    Clock::duration previous_frame_busy = Clock::duration::zero();
 };
 
 class FrameLimiter {
 public:
     using Clock = std::chrono::high_resolution_clock;
 
+    /// Number of buckets in the frame pacing jitter histogram
+    static constexpr std::size_t NumJitterBuckets = 16;
+    /// Width of one jitter histogram bucket
+    static constexpr std::chrono::microseconds JitterBucketWidth{250};
+    /// Histogram of the absolute deviation between the scheduled and the measured frame
+    /// cadence; bucket i counts deviations within [i, i + 1) * JitterBucketWidth, with the
+    /// last bucket collecting everything larger
+    using JitterHistogram = std::array<u64, NumJitterBuckets>;
+
     void DoFrameLimiting(std::chrono::microseconds current_system_time_us);
 
+    /// Returns the pacing jitter histogram accumulated since the last call and resets it
+    JitterHistogram GetAndResetJitterHistogram();
+
     bool IsFrameAdvancing() const;
     /**
      * Sets whether frame advancing is enabled or not.
@@ -109,6 +186,14 @@ private:
     /// Accumulated difference between walltime and emulated time
     std::chrono::microseconds frame_limiting_delta_err{0};
 
+    /// Smoothed estimate of how much the host overshoots a requested sleep, used to cut
+    /// coarse sleeps short so the final stretch of a frame wait can be spin-waited
+    std::chrono::microseconds sleep_overshoot_estimate{0};
+
+    /// Guards the jitter histogram, which frontends may query from another thread
+    std::mutex jitter_mutex;
+    JitterHistogram jitter_histogram{};
+
     /// Whether to use frame advancing (i.e. frame by frame)
     std::atomic_bool frame_advancing_enabled;
 
@@ -14,6 +14,8 @@ enum class PacketType {
     Undefined = 0,
     ReadMemory,
     WriteMemory,
+    BatchReadMemory,
+    BatchWriteMemory,
 };
 
 struct PacketHeader {
@@ -23,11 +25,15 @@ struct PacketHeader {
     u32 packet_size;
 };
 
-constexpr u32 CURRENT_VERSION = 1;
+constexpr u32 CURRENT_VERSION = 2;
 constexpr u32 MIN_PACKET_SIZE = sizeof(PacketHeader);
-constexpr u32 MAX_PACKET_DATA_SIZE = 32;
+/// Large enough for a batch of about a hundred scattered reads in a single datagram
+constexpr u32 MAX_PACKET_DATA_SIZE = 1024;
 constexpr u32 MAX_PACKET_SIZE = MIN_PACKET_SIZE + MAX_PACKET_DATA_SIZE;
-constexpr u32 MAX_READ_SIZE = MAX_PACKET_DATA_SIZE;
+/// Maximum size of a single (non-batched) memory read
+constexpr u32 MAX_READ_SIZE = 32;
+/// Maximum number of (address, size) entries in a batched read request
+constexpr u32 MAX_BATCH_ENTRIES = (MAX_PACKET_DATA_SIZE - sizeof(u32)) / (2 * sizeof(u32));
 
 class Packet {
 public:
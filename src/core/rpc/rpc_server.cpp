@@ -1,3 +1,5 @@
+#include <cstring>
+#include <vector>
 #include "common/logging/log.h"
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
@@ -24,6 +26,13 @@ RPCServer::~RPCServer() {
     LOG_INFO(RPC_Server, "RPC stopped.");
 }
 
+/// Writes to anything outside these regions are silently dropped
+static bool IsValidWriteAddress(u32 address) {
+    return (address >= Memory::PROCESS_IMAGE_VADDR && address <= Memory::PROCESS_IMAGE_VADDR_END) ||
+           (address >= Memory::HEAP_VADDR && address <= Memory::HEAP_VADDR_END) ||
+           (address >= Memory::N3DS_EXTRA_RAM_VADDR && address <= Memory::N3DS_EXTRA_RAM_VADDR_END);
+}
+
 void RPCServer::HandleReadMemory(Packet& packet, u32 address, u32 data_size) {
     if (data_size > MAX_READ_SIZE) {
         return;
@@ -39,9 +48,7 @@ void RPCServer::HandleReadMemory(Packet& packet, u32 address, u32 data_size) {
 
 void RPCServer::HandleWriteMemory(Packet& packet, u32 address, const u8* data, u32 data_size) {
     // Only allow writing to certain memory regions
-    if ((address >= Memory::PROCESS_IMAGE_VADDR && address <= Memory::PROCESS_IMAGE_VADDR_END) ||
-        (address >= Memory::HEAP_VADDR && address <= Memory::HEAP_VADDR_END) ||
-        (address >= Memory::N3DS_EXTRA_RAM_VADDR && address <= Memory::N3DS_EXTRA_RAM_VADDR_END)) {
+    if (IsValidWriteAddress(address)) {
         // Note: Memory write occurs asynchronously from the state of the emulator
         Core::System::GetInstance().Memory().WriteBlock(
             *Core::System::GetInstance().Kernel().GetCurrentProcess(), address, data, data_size);
@@ -54,6 +61,99 @@ void RPCServer::HandleWriteMemory(Packet& packet, u32 address, const u8* data, u
     packet.SendReply();
 }
 
+bool RPCServer::HandleBatchReadMemory(Packet& packet) {
+    // Wire format: u32 count, then count * (u32 address, u32 size). The reply is the
+    // concatenation of the results of the individual reads, in request order.
+    struct Entry {
+        u32 address;
+        u32 size;
+    };
+
+    u32 count = 0;
+    std::memcpy(&count, packet.GetPacketData().data(), sizeof(count));
+    if (count == 0 || count > MAX_BATCH_ENTRIES ||
+        packet.GetPacketDataSize() != sizeof(u32) + count * sizeof(Entry)) {
+        return false;
+    }
+
+    std::vector<Entry> entries(count);
+    std::memcpy(entries.data(), packet.GetPacketData().data() + sizeof(u32),
+                count * sizeof(Entry));
+
+    // Validate everything up front: the reply is written over the request data in place
+    u32 total_size = 0;
+    for (const Entry& entry : entries) {
+        if (entry.size == 0 || entry.size > MAX_PACKET_DATA_SIZE - total_size) {
+            return false;
+        }
+        total_size += entry.size;
+    }
+
+    // Note: Memory reads occur asynchronously from the state of the emulator
+    auto& memory = Core::System::GetInstance().Memory();
+    auto& process = *Core::System::GetInstance().Kernel().GetCurrentProcess();
+    u8* dest = packet.GetPacketData().data();
+    for (const Entry& entry : entries) {
+        memory.ReadBlock(process, entry.address, dest, entry.size);
+        dest += entry.size;
+    }
+    packet.SetPacketDataSize(total_size);
+    packet.SendReply();
+    return true;
+}
+
+bool RPCServer::HandleBatchWriteMemory(Packet& packet) {
+    // Wire format: u32 count, then count * (u32 address, u32 size, `size` bytes of data)
+    struct Entry {
+        u32 address;
+        u32 size;
+        u32 data_offset;
+    };
+
+    const u8* data = packet.GetPacketData().data();
+    const u32 packet_size = packet.GetPacketDataSize();
+    u32 count = 0;
+    std::memcpy(&count, data, sizeof(count));
+    if (count == 0 || count > MAX_BATCH_ENTRIES) {
+        return false;
+    }
+
+    // Validate the whole request before applying any of the writes, so a malformed
+    // request is rejected atomically
+    std::vector<Entry> entries(count);
+    u32 offset = sizeof(u32);
+    for (Entry& entry : entries) {
+        if (packet_size - offset < 2 * sizeof(u32)) {
+            return false;
+        }
+        std::memcpy(&entry.address, data + offset, sizeof(u32));
+        std::memcpy(&entry.size, data + offset + sizeof(u32), sizeof(u32));
+        offset += 2 * sizeof(u32);
+        if (entry.size == 0 || entry.size > packet_size - offset) {
+            return false;
+        }
+        entry.data_offset = offset;
+        offset += entry.size;
+    }
+    if (offset != packet_size) {
+        return false;
+    }
+
+    // Note: Memory writes occur asynchronously from the state of the emulator
+    auto& memory = Core::System::GetInstance().Memory();
+    auto& process = *Core::System::GetInstance().Kernel().GetCurrentProcess();
+    for (const Entry& entry : entries) {
+        // Invalid destinations are dropped, matching the single-write behaviour
+        if (IsValidWriteAddress(entry.address)) {
+            memory.WriteBlock(process, entry.address, data + entry.data_offset, entry.size);
+            Core::System::GetInstance().InvalidateCacheRange(entry.address, entry.size);
+        }
+    }
+    packet.SetPacketDataSize(0);
+    packet.SendReply();
+    return true;
+}
+
 bool RPCServer::ValidatePacket(const PacketHeader& packet_header) {
     if (packet_header.version <= CURRENT_VERSION) {
         switch (packet_header.packet_type) {
@@ -63,6 +163,13 @@ bool RPCServer::ValidatePacket(const PacketHeader& packet_header) {
                 return true;
             }
             break;
+        case PacketType::BatchReadMemory:
+        case PacketType::BatchWriteMemory:
+            // At least a count and one (address, size) entry
+            if (packet_header.packet_size >= (sizeof(u32) * 3)) {
+                return true;
+            }
+            break;
         default:
             break;
         }
@@ -74,7 +181,7 @@ void RPCServer::HandleSingleRequest(std::unique_ptr<Packet> request_packet) {
     bool success = false;
 
     if (ValidatePacket(request_packet->GetHeader())) {
-        // Currently, all request types use the address/data_size wire format
+        // The single-request types use the address/data_size wire format
         u32 address = 0;
         u32 data_size = 0;
         std::memcpy(&address, request_packet->GetPacketData().data(), sizeof(address));
@@ -95,6 +202,12 @@ void RPCServer::HandleSingleRequest(std::unique_ptr<Packet> request_packet) {
                 success = true;
             }
             break;
+        case PacketType::BatchReadMemory:
+            success = HandleBatchReadMemory(*request_packet);
+            break;
+        case PacketType::BatchWriteMemory:
+            success = HandleBatchWriteMemory(*request_packet);
+            break;
         default:
             break;
         }
@@ -28,12 +28,14 @@ private:
     void Stop();
     void HandleReadMemory(Packet& packet, u32 address, u32 data_size);
     void HandleWriteMemory(Packet& packet, u32 address, const u8* data, u32 data_size);
+    bool HandleBatchReadMemory(Packet& packet);
+    bool HandleBatchWriteMemory(Packet& packet);
     bool ValidatePacket(const PacketHeader& packet_header);
     void HandleSingleRequest(std::unique_ptr<Packet> request);
     void HandleRequestsLoop();
 
     Server server;
-    Common::SPSCQueue<std::unique_ptr<Packet>> request_queue;
+    Common::MPMCQueue<std::unique_ptr<Packet>, 0x40> request_queue;
     std::thread request_handler_thread;
 };
 
@@ -2,11 +2,24 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <thread>
 #include <cryptopp/hex.h>
 #include "common/archives.h"
 #include "common/logging/log.h"
 #include "common/scm_rev.h"
+#include "common/thread_worker.h"
 #include "common/zstd_compression.h"
 #include "core/core.h"
 #include "core/movie.h"
@@ -29,6 +42,177 @@ static_assert(sizeof(CSTHeader) == 256, "CSTHeader should be 256 bytes");
 
 constexpr std::array<u8, 4> header_magic_bytes{{'C', 'S', 'T', 0x1B}};
 
+namespace {
+
+/// Size of the uncompressed chunks the serialized stream is split into. Each chunk becomes an
+/// independent zstd frame, so larger chunks compress slightly better while smaller ones hand
+/// work to the compressor thread sooner.
+constexpr std::size_t SAVESTATE_CHUNK_SIZE = 16 * 1024 * 1024;
+
+Common::ThreadWorker& GetSaveStateWorker() {
+    static Common::ThreadWorker worker{1, "Savestate worker"};
+    return worker;
+}
+
+/**
+ * Stream buffer that collects serialized output into fixed-size chunks and hands each full
+ * chunk to the savestate worker, which compresses it and appends it to the file. The worker is
+ * single-threaded and tasks are queued in stream order, so frames land in the file in order.
+ * Failures on the worker are reported through the shared flag and logged; they cannot be
+ * thrown to the caller, which has long since returned.
+ */
+class ChunkedCompressingStreamBuf final : public std::streambuf {
+public:
+    ChunkedCompressingStreamBuf(std::shared_ptr<FileUtil::IOFile> file_,
+                                std::shared_ptr<std::atomic<bool>> failed_)
+        : file(std::move(file_)), failed(std::move(failed_)) {
+        NewChunk();
+    }
+
+    /// Queues any buffered tail data; must be called once serialization completes.
+    void Finish() {
+        QueueChunk();
+    }
+
+protected:
+    int_type overflow(int_type ch) override {
+        QueueChunk();
+        NewChunk();
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+private:
+    void NewChunk() {
+        chunk.resize(SAVESTATE_CHUNK_SIZE);
+        setp(chunk.data(), chunk.data() + chunk.size());
+    }
+
+    void QueueChunk() {
+        const auto used = static_cast<std::size_t>(pptr() - pbase());
+        if (used == 0) {
+            return;
+        }
+        chunk.resize(used);
+        GetSaveStateWorker().QueueWork([file = file, failed = failed, data = std::move(chunk)] {
+            if (failed->load()) {
+                return;
+            }
+            // The chunks are serialized through a single worker, so the parallelism for full
+            // states comes from multithreaded zstd within each chunk
+            const u32 num_workers = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+            const auto compressed = Common::Compression::CompressDataZSTDMultithreadedDefault(
+                reinterpret_cast<const u8*>(data.data()), data.size(), num_workers);
+            if (compressed.empty() ||
+                file->WriteBytes(compressed.data(), compressed.size()) != compressed.size()) {
+                LOG_ERROR(Core, "Could not compress or write savestate chunk");
+                failed->store(true);
+            }
+        });
+        chunk = {};
+        setp(nullptr, nullptr);
+    }
+
+    std::shared_ptr<FileUtil::IOFile> file;
+    std::shared_ptr<std::atomic<bool>> failed;
+    std::vector<char> chunk;
+};
+
+/**
+ * Stream buffer that decompresses the zstd frames of a savestate on the savestate worker while
+ * the archive is being deserialized from it, so decompression and deserialization overlap
+ * instead of running back to back. The queue is bounded, which also caps peak memory: the full
+ * decompressed image never has to exist at once. Old single-frame savestates still load, they
+ * just decompress as one chunk with no overlap.
+ *
+ * The archive itself has to stay on one thread: boost::serialization reconstructs a single
+ * object graph with cross-references between sections (kernel objects, memory, video core), so
+ * the stream can only ever be consumed sequentially.
+ */
+class ChunkedDecompressingStreamBuf final : public std::streambuf {
+public:
+    explicit ChunkedDecompressingStreamBuf(std::vector<u8> compressed_) {
+        GetSaveStateWorker().QueueWork([this, compressed = std::move(compressed_)] {
+            std::size_t offset = 0;
+            while (offset < compressed.size()) {
+                const std::size_t frame_size = Common::Compression::GetZSTDFrameSize(
+                    compressed.data() + offset, compressed.size() - offset);
+                if (frame_size == 0) {
+                    LOG_ERROR(Core, "Malformed zstd frame in savestate");
+                    break;
+                }
+                auto chunk = Common::Compression::DecompressDataZSTD(compressed.data() + offset,
+                                                                     frame_size);
+                if (chunk.empty()) {
+                    LOG_ERROR(Core, "Could not decompress savestate chunk");
+                    break;
+                }
+                if (!Push(std::move(chunk))) {
+                    // The consumer bailed out (e.g. a deserialization error); stop decompressing.
+                    return;
+                }
+                offset += frame_size;
+            }
+            std::scoped_lock lock{mutex};
+            done = true;
+            cv.notify_all();
+        });
+    }
+
+    ~ChunkedDecompressingStreamBuf() override {
+        {
+            std::scoped_lock lock{mutex};
+            aborted = true;
+            cv.notify_all();
+        }
+        // The worker task captures `this`, so it must have finished before we are destroyed.
+        GetSaveStateWorker().WaitForRequests();
+    }
+
+protected:
+    int_type underflow() override {
+        std::unique_lock lock{mutex};
+        cv.wait(lock, [this] { return !queue.empty() || done; });
+        if (queue.empty()) {
+            return traits_type::eof();
+        }
+        current = std::move(queue.front());
+        queue.pop_front();
+        cv.notify_all();
+
+        char* const data = reinterpret_cast<char*>(current.data());
+        setg(data, data, data + current.size());
+        return traits_type::to_int_type(*data);
+    }
+
+private:
+    /// Number of decompressed chunks the worker may run ahead of the archive.
+    static constexpr std::size_t MAX_QUEUED_CHUNKS = 4;
+
+    bool Push(std::vector<u8>&& chunk) {
+        std::unique_lock lock{mutex};
+        cv.wait(lock, [this] { return queue.size() < MAX_QUEUED_CHUNKS || aborted; });
+        if (aborted) {
+            return false;
+        }
+        queue.push_back(std::move(chunk));
+        cv.notify_all();
+        return true;
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::vector<u8>> queue;
+    std::vector<u8> current;
+    bool done = false;
+    bool aborted = false;
+};
+
+} // namespace
+
 static std::string GetSaveStatePath(u64 program_id, u32 slot) {
     const u64 movie_id = Movie::GetInstance().GetCurrentMovieID();
     if (movie_id) {
@@ -101,22 +285,16 @@ std::vector<SaveStateInfo> ListSaveStates(u64 program_id) {
 }
 
 void System::SaveState(u32 slot) const {
-    std::ostringstream sstream{std::ios_base::binary};
-    // Serialize
-    oarchive oa{sstream};
-    oa&* this;
-
-    const std::string& str{sstream.str()};
-    auto buffer = Common::Compression::CompressDataZSTDDefault(
-        reinterpret_cast<const u8*>(str.data()), str.size());
+    // Let the previous savestate finish compressing so file writes cannot interleave.
+    GetSaveStateWorker().WaitForRequests();
 
     const auto path = GetSaveStatePath(title_id, slot);
     if (!FileUtil::CreateFullPath(path)) {
         throw std::runtime_error("Could not create path " + path);
     }
 
-    FileUtil::IOFile file(path, "wb");
-    if (!file) {
+    auto file = std::make_shared<FileUtil::IOFile>(path, "wb");
+    if (!*file) {
         throw std::runtime_error("Could not open file " + path);
     }
 
@@ -131,10 +309,18 @@ void System::SaveState(u32 slot) const {
                       std::chrono::system_clock::now().time_since_epoch())
                       .count();
 
-    if (file.WriteBytes(&header, sizeof(header)) != sizeof(header) ||
-        file.WriteBytes(buffer.data(), buffer.size()) != buffer.size()) {
+    if (file->WriteBytes(&header, sizeof(header)) != sizeof(header)) {
         throw std::runtime_error("Could not write to file " + path);
     }
+
+    // Serialize on this thread; compression and file output run on the worker, so emulation
+    // only pauses for as long as serialization itself takes.
+    auto failed = std::make_shared<std::atomic<bool>>(false);
+    ChunkedCompressingStreamBuf streambuf(std::move(file), std::move(failed));
+    std::ostream stream{&streambuf};
+    oarchive oa{stream};
+    oa&* this;
+    streambuf.Finish();
 }
 
 void System::LoadState(u32 slot) {
@@ -142,12 +328,13 @@ void System::LoadState(u32 slot) {
         throw std::runtime_error("Unable to load while connected to multiplayer");
     }
 
+    // A save may still be compressing in the background; wait until it is fully on disk.
+    GetSaveStateWorker().WaitForRequests();
+
     const auto path = GetSaveStatePath(title_id, slot);
 
-    std::vector<u8> decompressed;
+    std::vector<u8> buffer(FileUtil::GetSize(path) - sizeof(CSTHeader));
     {
-        std::vector<u8> buffer(FileUtil::GetSize(path) - sizeof(CSTHeader));
-
         FileUtil::IOFile file(path, "rb");
 
         // load header
@@ -165,16 +352,102 @@ void System::LoadState(u32 slot) {
         if (file.ReadBytes(buffer.data(), buffer.size()) != buffer.size()) {
             throw std::runtime_error("Could not read from file at " + path);
         }
-        decompressed = Common::Compression::DecompressDataZSTD(buffer);
     }
+
+    // Deserialize on this thread while the worker decompresses the chunks ahead of the
+    // archive. If decompression fails mid-stream the archive hits end of stream and throws.
+    ChunkedDecompressingStreamBuf streambuf(std::move(buffer));
+    std::istream stream{&streambuf};
+    iarchive ia{stream};
+    ia&* this;
+}
+
+/// XOR of two byte vectors, padded with zeros to the size of the longer one.
+static std::vector<u8> XorPadded(const std::vector<u8>& a, const std::vector<u8>& b) {
+    const auto& shorter = a.size() <= b.size() ? a : b;
+    const auto& longer = a.size() <= b.size() ? b : a;
+
+    std::vector<u8> result(longer.size());
+    for (std::size_t i = 0; i < shorter.size(); ++i) {
+        result[i] = shorter[i] ^ longer[i];
+    }
+    std::memcpy(result.data() + shorter.size(), longer.data() + shorter.size(),
+                longer.size() - shorter.size());
+    return result;
+}
+
+/// Compression level used for rewind deltas; captures happen on the emulation thread several
+/// times per second, so speed matters much more than ratio. Negative zstd levels trade ratio
+/// for speed, and since the deltas are mostly zeros the ratio loss is small.
+constexpr s32 REWIND_COMPRESSION_LEVEL = -1;
+
+RewindBuffer::RewindBuffer(std::size_t max_points) : max_points(max_points) {}
+
+RewindBuffer::~RewindBuffer() = default;
+
+void RewindBuffer::Capture(const System& system) {
+    std::ostringstream sstream{std::ios_base::binary};
+    oarchive oa{sstream};
+    oa& system;
+
+    const std::string& str{sstream.str()};
+    std::vector<u8> image(str.size());
+    std::memcpy(image.data(), str.data(), str.size());
+
+    // The delta of the first point is against an empty image, i.e. the image itself; it still
+    // compresses well since most of FCRAM is usually untouched zeros early on.
+    std::vector<u8> delta = XorPadded(newest_image, image);
+    points.push_back(Point{Common::Compression::CompressDataZSTD(delta.data(), delta.size(),
+                                                                 REWIND_COMPRESSION_LEVEL),
+                           newest_image.size()});
+    newest_image = std::move(image);
+
+    if (points.size() > max_points) {
+        // Deltas are only ever applied walking backwards from the newest image, so dropping
+        // the oldest point just shortens how far back we can rewind.
+        points.pop_front();
+    }
+}
+
+bool RewindBuffer::Restore(System& system) {
+    if (points.empty()) {
+        return false;
+    }
+
     std::istringstream sstream{
-        std::string{reinterpret_cast<char*>(decompressed.data()), decompressed.size()},
+        std::string{reinterpret_cast<const char*>(newest_image.data()), newest_image.size()},
         std::ios_base::binary};
-    decompressed.clear();
-
-    // Deserialize
     iarchive ia{sstream};
-    ia&* this;
+    ia& system;
+
+    // Step the retained image back to the previous point.
+    const Point& point = points.back();
+    std::vector<u8> delta = Common::Compression::DecompressDataZSTD(point.compressed_delta);
+    std::vector<u8> previous = XorPadded(newest_image, delta);
+    previous.resize(point.previous_size);
+    newest_image = std::move(previous);
+    points.pop_back();
+    return true;
+}
+
+void RewindBuffer::Clear() {
+    points.clear();
+    newest_image.clear();
+    newest_image.shrink_to_fit();
+}
+
+void System::CaptureRewindPoint() {
+    if (!rewind_buffer) {
+        rewind_buffer = std::make_unique<RewindBuffer>();
+    }
+    rewind_buffer->Capture(*this);
+}
+
+bool System::Rewind() {
+    if (Network::GetRoomMember().lock()->IsConnected()) {
+        throw std::runtime_error("Unable to rewind while connected to multiplayer");
+    }
+    return rewind_buffer && rewind_buffer->Restore(*this);
 }
 
 } // namespace Core
@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include <deque>
 #include <vector>
 #include "common/common_types.h"
 
 namespace Core {
 
+class System;
+
 struct SaveStateInfo {
     u32 slot;
     u64 time;
@@ -20,6 +23,45 @@ struct SaveStateInfo {
 
 constexpr u32 SaveStateSlotCount = 10; // Maximum count of savestate slots
 
+constexpr std::size_t DefaultRewindPointCount = 20; // Default capacity of the rewind ring
+
 std::vector<SaveStateInfo> ListSaveStates(u64 program_id);
 
+/**
+ * In-memory ring of delta-compressed machine snapshots backing the rewind feature. The newest
+ * snapshot's serialized image is kept whole; every stored point holds a zstd-compressed XOR
+ * delta against the image that followed it, so unchanged memory costs almost nothing per
+ * point. Restoring pops the newest point and steps the retained image backwards through the
+ * delta chain, which also makes evicting the oldest point trivially safe.
+ */
+class RewindBuffer {
+public:
+    explicit RewindBuffer(std::size_t max_points = DefaultRewindPointCount);
+    ~RewindBuffer();
+
+    /// Serializes the system and stores it as a new rewind point, evicting the oldest point
+    /// when the ring is full.
+    void Capture(const System& system);
+
+    /// Restores the newest rewind point into the system and drops it from the ring.
+    /// Returns false when no rewind points are available.
+    bool Restore(System& system);
+
+    std::size_t Size() const {
+        return points.size();
+    }
+
+    void Clear();
+
+private:
+    struct Point {
+        std::vector<u8> compressed_delta; ///< zstd(previous image XOR this point's image)
+        std::size_t previous_size;        ///< Size of the previous point's serialized image
+    };
+
+    std::size_t max_points;
+    std::vector<u8> newest_image; ///< Uncompressed serialized image of the newest point
+    std::deque<Point> points;     ///< Oldest point first
+};
+
 } // namespace Core
@@ -102,6 +102,13 @@ TelemetrySession::~TelemetrySession() {
 }
 
 void TelemetrySession::AddInitialInfo(Loader::AppLoader& app_loader) {
+#ifdef ENABLE_WEB_SERVICE
+    // Retry any payloads a previous session spooled to disk but could not deliver in time
+    if (NetSettings::values.enable_telemetry) {
+        WebService::PostQueuedTelemetry(NetSettings::values.web_api_url);
+    }
+#endif
+
     // Log one-time top-level information
     AddField(Telemetry::FieldType::None, "TelemetryId", GetTelemetryId());
 
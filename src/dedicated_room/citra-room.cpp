@@ -2,12 +2,14 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 #include <cryptopp/base64.h>
 
 #ifdef _WIN32
@@ -47,6 +49,7 @@ static void PrintHelp(const char* argv0) {
                  "--room-name         The name of the room\n"
                  "--room-description  The room description\n"
                  "--port              The port used for the room\n"
+                 "--num-rooms         Host this many independent rooms on consecutive ports\n"
                  "--max_members       The maximum number of players for this room\n"
                  "--password          The password for the room\n"
                  "--preferred-game    The preferred game for this room\n"
@@ -125,6 +128,20 @@ static Network::Room::BanList LoadBanList(const std::string& path) {
     return {username_ban_list, ip_ban_list};
 }
 
+/// Appends the entries of one ban list to another, skipping duplicates.
+static void MergeBanList(Network::Room::BanList& target, const Network::Room::BanList& source) {
+    for (const auto& username : source.first) {
+        if (std::find(target.first.begin(), target.first.end(), username) == target.first.end()) {
+            target.first.emplace_back(username);
+        }
+    }
+    for (const auto& ip : source.second) {
+        if (std::find(target.second.begin(), target.second.end(), ip) == target.second.end()) {
+            target.second.emplace_back(ip);
+        }
+    }
+}
+
 static void SaveBanList(const Network::Room::BanList& ban_list, const std::string& path) {
     std::ofstream file;
     OpenFStream(file, path, std::ios_base::out);
@@ -178,6 +195,7 @@ int main(int argc, char** argv) {
     std::string log_file = "citra-room.log";
     u64 preferred_game_id = 0;
     u16 port = Network::DefaultRoomPort;
+    u32 num_rooms = 1;
     u32 max_members = 16;
     bool enable_citra_mods = false;
 
@@ -185,6 +203,7 @@ int main(int argc, char** argv) {
         {"room-name", required_argument, 0, 'n'},
         {"room-description", required_argument, 0, 'd'},
         {"port", required_argument, 0, 'p'},
+        {"num-rooms", required_argument, 0, 'r'},
         {"max_members", required_argument, 0, 'm'},
         {"password", required_argument, 0, 'w'},
         {"preferred-game", required_argument, 0, 'g'},
@@ -201,7 +220,8 @@ int main(int argc, char** argv) {
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "n:d:p:m:w:g:u:t:a:i:l:hv", long_options, &option_index);
+        int arg =
+            getopt_long(argc, argv, "n:d:p:r:m:w:g:u:t:a:i:l:hv", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
             case 'n':
@@ -213,6 +233,9 @@ int main(int argc, char** argv) {
             case 'p':
                 port = static_cast<u16>(strtoul(optarg, &endarg, 0));
                 break;
+            case 'r':
+                num_rooms = strtoul(optarg, &endarg, 0);
+                break;
             case 'm':
                 max_members = strtoul(optarg, &endarg, 0);
                 break;
@@ -278,6 +301,17 @@ int main(int argc, char** argv) {
         PrintHelp(argv[0]);
         return -1;
     }
+    if (num_rooms < 1 || num_rooms > 64) {
+        std::cout << "num-rooms needs to be in the range 1 - 64!\n\n";
+        PrintHelp(argv[0]);
+        return -1;
+    }
+    if (static_cast<u32>(port) + num_rooms - 1 > 65535) {
+        std::cout << "num-rooms hosts one room per port starting at --port, which would exceed "
+                     "port 65535!\n\n";
+        PrintHelp(argv[0]);
+        return -1;
+    }
     if (ban_list_file.empty()) {
         std::cout << "Ban list file not set!\nThis should get set to load and save room ban "
                      "list.\nSet with --ban-list-file <file>\n\n";
@@ -318,50 +352,99 @@ int main(int argc, char** argv) {
         ban_list = LoadBanList(ban_list_file);
     }
 
-    std::unique_ptr<Network::VerifyUser::Backend> verify_backend;
-    if (announce) {
+    // Each room verifies its members independently, so every room gets its own backend.
+    const auto MakeVerifyBackend = [announce]() -> std::unique_ptr<Network::VerifyUser::Backend> {
+        if (announce) {
 #ifdef ENABLE_WEB_SERVICE
-        verify_backend =
-            std::make_unique<WebService::VerifyUserJWT>(NetSettings::values.web_api_url);
+            return std::make_unique<WebService::VerifyUserJWT>(NetSettings::values.web_api_url);
 #else
-        std::cout
-            << "Citra Web Services is not available with this build: validation is disabled.\n\n";
-        verify_backend = std::make_unique<Network::VerifyUser::NullBackend>();
+            std::cout
+                << "Citra Web Services is not available with this build: validation is disabled."
+                << "\n\n";
+            return std::make_unique<Network::VerifyUser::NullBackend>();
 #endif
-    } else {
-        verify_backend = std::make_unique<Network::VerifyUser::NullBackend>();
-    }
+        }
+        return std::make_unique<Network::VerifyUser::NullBackend>();
+    };
 
     Network::Init();
     if (std::shared_ptr<Network::Room> room = Network::GetRoom().lock()) {
-        if (!room->Create(room_name, room_description, "", port, password, max_members, username,
-                          preferred_game, preferred_game_id, std::move(verify_backend), ban_list,
-                          enable_citra_mods)) {
-            std::cout << "Failed to create room: \n\n";
-            return -1;
+        // Each Room services its clients on its own worker thread, so one process can host
+        // several rooms and use multiple cores. The first room is the global one; additional
+        // rooms get a numbered name and the next port.
+        std::vector<std::shared_ptr<Network::Room>> rooms{room};
+        for (u32 i = 1; i < num_rooms; ++i) {
+            rooms.emplace_back(std::make_shared<Network::Room>());
+        }
+
+        for (u32 i = 0; i < num_rooms; ++i) {
+            std::string name = room_name;
+            if (num_rooms > 1) {
+                name += " #" + std::to_string(i + 1);
+            }
+            const u16 room_port = static_cast<u16>(port + i);
+            if (!rooms[i]->Create(name, room_description, "", room_port, password, max_members,
+                                  username, preferred_game, preferred_game_id, MakeVerifyBackend(),
+                                  ban_list, enable_citra_mods)) {
+                std::cout << "Failed to create room on port " << room_port << "!\n\n";
+                return -1;
+            }
+        }
+
+        if (num_rooms > 1) {
+            std::cout << num_rooms << " rooms are open on ports " << port << " - "
+                      << (port + num_rooms - 1)
+                      << ". Show member counts with S+Enter, close with Q+Enter...\n\n";
+        } else {
+            std::cout << "Room is open. Close with Q+Enter...\n\n";
         }
-        std::cout << "Room is open. Close with Q+Enter...\n\n";
-        auto announce_session = std::make_unique<Network::AnnounceMultiplayerSession>();
+
+        // The announce web service tracks one room per session, so each room announces
+        // through its own session; they all share the host's credentials.
+        std::vector<std::unique_ptr<Network::AnnounceMultiplayerSession>> announce_sessions;
         if (announce) {
-            announce_session->Start();
+            for (const auto& open_room : rooms) {
+                auto session = std::make_unique<Network::AnnounceMultiplayerSession>(open_room);
+                session->Start();
+                announce_sessions.emplace_back(std::move(session));
+            }
         }
-        while (room->GetState() == Network::Room::State::Open) {
+
+        while (std::any_of(rooms.begin(), rooms.end(), [](const auto& open_room) {
+            return open_room->GetState() == Network::Room::State::Open;
+        })) {
             std::string in;
             std::cin >> in;
+            if (in == "s" || in == "S") {
+                for (const auto& open_room : rooms) {
+                    const auto& information = open_room->GetRoomInformation();
+                    std::cout << information.name << " (port " << information.port
+                              << "): " << open_room->GetRoomMemberList().size() << "/"
+                              << information.member_slots << " members\n";
+                }
+                std::cout << std::endl;
+                continue;
+            }
             if (in.size() > 0) {
                 break;
             }
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
-        if (announce) {
-            announce_session->Stop();
+        for (auto& session : announce_sessions) {
+            session->Stop();
         }
-        announce_session.reset();
-        // Save the ban list
+        announce_sessions.clear();
+        // Save the ban list, merged across all rooms
         if (!ban_list_file.empty()) {
-            SaveBanList(room->GetBanList(), ban_list_file);
+            Network::Room::BanList merged_ban_list;
+            for (const auto& open_room : rooms) {
+                MergeBanList(merged_ban_list, open_room->GetBanList());
+            }
+            SaveBanList(merged_ban_list, ban_list_file);
+        }
+        for (auto& open_room : rooms) {
+            open_room->Destroy();
         }
-        room->Destroy();
     }
     Network::Shutdown();
     detached_tasks.WaitForAllTasks();
@@ -0,0 +1,322 @@
+// Copyright 2024 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+// windows.h needs to be included before shellapi.h
+#include <windows.h>
+
+#include <shellapi.h>
+#endif
+
+#include "common/common_types.h"
+#include "common/file_util.h"
+#include "common/logging/backend.h"
+#include "common/logging/filter.h"
+#include "common/logging/log.h"
+#include "common/scm_rev.h"
+#include "common/settings.h"
+#include "core/core.h"
+#include "core/frontend/emu_window.h"
+#include "core/hw/gpu.h"
+#include "core/hw/hw.h"
+#include "core/hw/lcd.h"
+#include "core/memory.h"
+#include "core/tracer/citrace.h"
+#include "video_core/pica.h"
+#include "video_core/pica_state.h"
+#include "video_core/renderer_software/renderer_software.h"
+#include "video_core/video_core.h"
+
+#undef _UNICODE
+#include <getopt.h>
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+namespace {
+
+/// Headless window; the software renderer never needs to present anything.
+class ReplayWindow final : public Frontend::EmuWindow {
+public:
+    void PollEvents() override {}
+};
+
+/// Base of the IO register region in the physical address space, as stored by the recorder.
+constexpr u32 IO_AREA_PADDR = 0x10100000;
+/// Base of the IO register region in the virtual address space used by HW::Write.
+constexpr u32 IO_AREA_VADDR = 0x1EC00000;
+
+void PrintHelp(const char* argv0) {
+    std::cout << "Usage: " << argv0
+              << " [options] <citrace file>\n"
+                 "--loops  Replay the stream this many times (default 1)\n"
+                 "-h, --help     Display this help and exit\n"
+                 "-v, --version  Output version information and exit\n";
+}
+
+void PrintVersion() {
+    std::cout << "Citra GPU replay " << Common::g_scm_branch << " " << Common::g_scm_desc
+              << std::endl;
+}
+
+bool LoadTrace(const std::string& path, std::vector<u8>& data) {
+    FileUtil::IOFile file(path, "rb");
+    if (!file.IsOpen()) {
+        std::cout << "Could not open \"" << path << "\"" << std::endl;
+        return false;
+    }
+
+    data.resize(file.GetSize());
+    if (file.ReadBytes(data.data(), data.size()) != data.size()) {
+        std::cout << "Could not read \"" << path << "\"" << std::endl;
+        return false;
+    }
+
+    if (data.size() < sizeof(CiTrace::CTHeader)) {
+        std::cout << "File too small to be a CiTrace" << std::endl;
+        return false;
+    }
+
+    const auto* header = reinterpret_cast<const CiTrace::CTHeader*>(data.data());
+    if (std::memcmp(header->magic, CiTrace::CTHeader::ExpectedMagicWord(), 4) != 0) {
+        std::cout << "Invalid magic word" << std::endl;
+        return false;
+    }
+    if (header->version != CiTrace::CTHeader::ExpectedVersion()) {
+        std::cout << "Unsupported CiTrace version " << header->version << std::endl;
+        return false;
+    }
+    if (header->stream_offset + u64(header->stream_size) * sizeof(CiTrace::CTStreamElement) >
+        data.size()) {
+        std::cout << "Command stream exceeds file size" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/// Restores the register and shader state captured at the start of the recording.
+void ApplyInitialState(const std::vector<u8>& data) {
+    const auto* header = reinterpret_cast<const CiTrace::CTHeader*>(data.data());
+    const auto& offsets = header->initial_state_offsets;
+
+    const auto copy_regs = [&data](u32 offset, u32 size_in_words, void* dest,
+                                   std::size_t dest_size) {
+        const std::size_t size = std::min<std::size_t>(size_in_words * sizeof(u32), dest_size);
+        if (u64(offset) + size <= data.size()) {
+            std::memcpy(dest, data.data() + offset, size);
+        }
+    };
+
+    copy_regs(offsets.gpu_registers, offsets.gpu_registers_size, &GPU::g_regs,
+              sizeof(GPU::g_regs));
+    copy_regs(offsets.lcd_registers, offsets.lcd_registers_size, &LCD::g_regs,
+              sizeof(LCD::g_regs));
+    copy_regs(offsets.pica_registers, offsets.pica_registers_size, &Pica::g_state.regs,
+              sizeof(Pica::g_state.regs));
+    copy_regs(offsets.vs_program_binary, offsets.vs_program_binary_size,
+              Pica::g_state.vs.program_code.data(), sizeof(Pica::g_state.vs.program_code));
+    copy_regs(offsets.vs_swizzle_data, offsets.vs_swizzle_data_size,
+              Pica::g_state.vs.swizzle_data.data(), sizeof(Pica::g_state.vs.swizzle_data));
+
+    // Default attributes and float uniforms are stored as 24-bit encodings, mirroring the
+    // conversion the recorder performs. Only xyz are recorded.
+    const auto* words = reinterpret_cast<const u32*>(data.data() + offsets.default_attributes);
+    if (u64(offsets.default_attributes) + offsets.default_attributes_size * sizeof(u32) <=
+        data.size()) {
+        const u32 count = std::min<u32>(offsets.default_attributes_size / 4, 16);
+        for (u32 i = 0; i < count; i++) {
+            for (u32 comp = 0; comp < 3; comp++) {
+                Pica::g_state.input_default_attributes.attr[i][comp] =
+                    Pica::float24::FromRaw(words[4 * i + comp]);
+            }
+        }
+    }
+
+    words = reinterpret_cast<const u32*>(data.data() + offsets.vs_float_uniforms);
+    if (u64(offsets.vs_float_uniforms) + offsets.vs_float_uniforms_size * sizeof(u32) <=
+        data.size()) {
+        const u32 count = std::min<u32>(offsets.vs_float_uniforms_size / 4, 96);
+        for (u32 i = 0; i < count; i++) {
+            for (u32 comp = 0; comp < 3; comp++) {
+                Pica::g_state.vs.uniforms.f[i][comp] = Pica::float24::FromRaw(words[4 * i + comp]);
+            }
+        }
+    }
+}
+
+void ReplayRegisterWrite(const CiTrace::CTRegisterWrite& write) {
+    // The recorder stores IO physical addresses; HW::Write expects the virtual mapping.
+    const u32 vaddr = write.physical_address - IO_AREA_PADDR + IO_AREA_VADDR;
+    switch (write.size) {
+    case CiTrace::CTRegisterWrite::SIZE_8:
+        HW::Write<u8>(vaddr, static_cast<u8>(write.value));
+        break;
+    case CiTrace::CTRegisterWrite::SIZE_16:
+        HW::Write<u16>(vaddr, static_cast<u16>(write.value));
+        break;
+    case CiTrace::CTRegisterWrite::SIZE_32:
+        HW::Write<u32>(vaddr, static_cast<u32>(write.value));
+        break;
+    case CiTrace::CTRegisterWrite::SIZE_64:
+        HW::Write<u64>(vaddr, write.value);
+        break;
+    default:
+        LOG_ERROR(HW_GPU, "Unknown register write size {}", write.size);
+        break;
+    }
+}
+
+struct FrameStats {
+    u32 frames = 0;
+    double total_ms = 0.0;
+    double min_ms = std::numeric_limits<double>::max();
+    double max_ms = 0.0;
+
+    void AddFrame(double ms) {
+        frames++;
+        total_ms += ms;
+        min_ms = std::min(min_ms, ms);
+        max_ms = std::max(max_ms, ms);
+    }
+};
+
+void ReplayStream(Memory::MemorySystem& memory, const std::vector<u8>& data, FrameStats& stats) {
+    const auto* header = reinterpret_cast<const CiTrace::CTHeader*>(data.data());
+    const auto* stream =
+        reinterpret_cast<const CiTrace::CTStreamElement*>(data.data() + header->stream_offset);
+
+    auto frame_start = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < header->stream_size; i++) {
+        const auto& element = stream[i];
+        switch (element.type) {
+        case CiTrace::FrameMarker: {
+            const auto now = std::chrono::steady_clock::now();
+            stats.AddFrame(std::chrono::duration<double, std::milli>(now - frame_start).count());
+            frame_start = now;
+            break;
+        }
+        case CiTrace::MemoryLoad: {
+            const auto& load = element.memory_load;
+            if (u64(load.file_offset) + load.size > data.size() ||
+                !memory.IsValidPhysicalAddress(load.physical_address)) {
+                LOG_ERROR(HW_GPU, "Invalid memory load to {:#010X}", load.physical_address);
+                break;
+            }
+            std::memcpy(memory.GetPhysicalPointer(load.physical_address),
+                        data.data() + load.file_offset, load.size);
+            break;
+        }
+        case CiTrace::RegisterWrite:
+            ReplayRegisterWrite(element.register_write);
+            break;
+        default:
+            LOG_ERROR(HW_GPU, "Unknown stream element type {:#x}", element.type);
+            break;
+        }
+    }
+}
+
+void InitializeLogging() {
+    Log::Filter log_filter(Log::Level::Info);
+    log_filter.ParseFilterString(Settings::values.log_filter.GetValue());
+    Log::SetGlobalFilter(log_filter);
+
+    Log::AddBackend(std::make_unique<Log::ColorConsoleBackend>());
+}
+
+} // Anonymous namespace
+
+/// Application entry point
+int main(int argc, char** argv) {
+    InitializeLogging();
+
+    int option_index = 0;
+    u32 loops = 1;
+    std::string filepath;
+
+    static struct option long_options[] = {
+        {"loops", required_argument, 0, 'l'},
+        {"help", no_argument, 0, 'h'},
+        {"version", no_argument, 0, 'v'},
+        {0, 0, 0, 0},
+    };
+
+    while (optind < argc) {
+        int arg = getopt_long(argc, argv, "l:hv", long_options, &option_index);
+        if (arg != -1) {
+            switch (static_cast<char>(arg)) {
+            case 'l':
+                loops = static_cast<u32>(std::max(1, std::atoi(optarg)));
+                break;
+            case 'h':
+                PrintHelp(argv[0]);
+                return 0;
+            case 'v':
+                PrintVersion();
+                return 0;
+            }
+        } else {
+            filepath = argv[optind];
+            optind++;
+        }
+    }
+
+    if (filepath.empty()) {
+        PrintHelp(argv[0]);
+        return -1;
+    }
+
+    std::vector<u8> data;
+    if (!LoadTrace(filepath, data)) {
+        return -1;
+    }
+
+    // Stand up just enough machinery to drive the GPU: backing memory, the Pica state and the
+    // software renderer. No kernel, CPU or HLE services are involved, which is what keeps
+    // replay fast and deterministic. The GSP interrupt hooks tolerate the missing service.
+    Memory::MemorySystem memory;
+    VideoCore::g_memory = &memory;
+    Pica::Init();
+
+    Settings::values.graphics_api = Settings::GraphicsAPI::Software;
+    VideoCore::g_shader_jit_enabled = Settings::values.use_shader_jit.GetValue();
+    ReplayWindow window;
+    VideoCore::g_renderer = std::make_unique<VideoCore::RendererSoftware>(
+        Core::System::GetInstance(), window);
+
+    ApplyInitialState(data);
+
+    FrameStats stats;
+    const auto replay_start = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < loops; i++) {
+        ReplayStream(memory, data, stats);
+    }
+    const double wall_ms = std::chrono::duration<double, std::milli>(
+                               std::chrono::steady_clock::now() - replay_start)
+                               .count();
+
+    if (stats.frames > 0) {
+        std::cout << "Replayed " << stats.frames << " frame(s) in " << wall_ms << " ms\n"
+                  << "Frame time: avg " << stats.total_ms / stats.frames << " ms, min "
+                  << stats.min_ms << " ms, max " << stats.max_ms << " ms" << std::endl;
+    } else {
+        std::cout << "Replayed stream without frame markers in " << wall_ms << " ms" << std::endl;
+    }
+
+    VideoCore::g_renderer.reset();
+    Pica::Shutdown();
+    VideoCore::g_memory = nullptr;
+
+    return 0;
+}
@@ -366,11 +366,11 @@ void Adapter::EndConfiguration() {
     configuring = false;
 }
 
-Common::SPSCQueue<GCPadStatus>& Adapter::GetPadQueue() {
+Common::MPMCQueue<GCPadStatus, 0x100>& Adapter::GetPadQueue() {
     return pad_queue;
 }
 
-const Common::SPSCQueue<GCPadStatus>& Adapter::GetPadQueue() const {
+const Common::MPMCQueue<GCPadStatus, 0x100>& Adapter::GetPadQueue() const {
     return pad_queue;
 }
 
@@ -84,8 +84,8 @@ public:
     void BeginConfiguration();
     void EndConfiguration();
 
-    Common::SPSCQueue<GCPadStatus>& GetPadQueue();
-    const Common::SPSCQueue<GCPadStatus>& GetPadQueue() const;
+    Common::MPMCQueue<GCPadStatus, 0x100>& GetPadQueue();
+    const Common::MPMCQueue<GCPadStatus, 0x100>& GetPadQueue() const;
 
     GCController& GetPadState(std::size_t port);
     const GCController& GetPadState(std::size_t port) const;
@@ -134,7 +134,7 @@ private:
 
     libusb_device_handle* usb_adapter_handle = nullptr;
     std::array<GCController, 4> pads;
-    Common::SPSCQueue<GCPadStatus> pad_queue;
+    Common::MPMCQueue<GCPadStatus, 0x100> pad_queue;
 
     std::thread adapter_input_thread;
     std::thread adapter_scan_thread;
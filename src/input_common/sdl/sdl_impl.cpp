@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <functional>
@@ -16,6 +17,7 @@
 #include <vector>
 #include <SDL.h>
 #include "common/assert.h"
+#include "common/common_types.h"
 #include "common/logging/log.h"
 #include "common/math_util.h"
 #include "common/param_package.h"
@@ -182,28 +184,39 @@ public:
     }
 
     void SetButton(int button, bool value) {
-        std::lock_guard lock{mutex};
-        state.buttons[button] = value;
+        if (button < 0 || static_cast<std::size_t>(button) >= state.buttons.size())
+            return;
+        WriteState([button, value](State& s) { s.buttons[button] = value; });
     }
 
     bool GetButton(int button) const {
-        std::lock_guard lock{mutex};
-        return state.buttons.at(button);
+        if (button < 0 || static_cast<std::size_t>(button) >= state.buttons.size())
+            return false;
+        return ReadState().buttons[button];
     }
 
     void SetAxis(int axis, Sint16 value) {
-        std::lock_guard lock{mutex};
-        state.axes[axis] = value;
+        if (axis < 0 || static_cast<std::size_t>(axis) >= state.axes.size())
+            return;
+        WriteState([axis, value](State& s) { s.axes[axis] = value; });
     }
 
     float GetAxis(int axis) const {
-        std::lock_guard lock{mutex};
-        return state.axes.at(axis) / 32767.0f;
+        if (axis < 0 || static_cast<std::size_t>(axis) >= state.axes.size())
+            return 0.0f;
+        return ReadState().axes[axis] / 32767.0f;
     }
 
     std::tuple<float, float> GetAnalog(int axis_x, int axis_y) const {
-        float x = GetAxis(axis_x);
-        float y = GetAxis(axis_y);
+        if (axis_x < 0 || static_cast<std::size_t>(axis_x) >= state.axes.size() || axis_y < 0 ||
+            static_cast<std::size_t>(axis_y) >= state.axes.size()) {
+            return std::make_tuple(0.0f, 0.0f);
+        }
+
+        // Both axes come from the same snapshot, so they are consistent with each other
+        const State snapshot = ReadState();
+        float x = snapshot.axes[axis_x] / 32767.0f;
+        float y = snapshot.axes[axis_y] / 32767.0f;
         y = -y; // 3DS uses an y-axis inverse from SDL
 
         // Make sure the coordinates are in the unit circle,
@@ -219,30 +232,34 @@ public:
     }
 
     void SetHat(int hat, Uint8 direction) {
-        std::lock_guard lock{mutex};
-        state.hats[hat] = direction;
+        if (hat < 0 || static_cast<std::size_t>(hat) >= state.hats.size())
+            return;
+        WriteState([hat, direction](State& s) { s.hats[hat] = direction; });
     }
 
     bool GetHatDirection(int hat, Uint8 direction) const {
-        std::lock_guard lock{mutex};
-        return (state.hats.at(hat) & direction) != 0;
+        if (hat < 0 || static_cast<std::size_t>(hat) >= state.hats.size())
+            return false;
+        return (ReadState().hats[hat] & direction) != 0;
     }
 
     void SetAccel(const float x, const float y, const float z) {
-        std::lock_guard lock{mutex};
-        state.accel.x = x;
-        state.accel.y = y;
-        state.accel.z = z;
+        WriteState([x, y, z](State& s) {
+            s.accel.x = x;
+            s.accel.y = y;
+            s.accel.z = z;
+        });
     }
     void SetGyro(const float pitch, const float yaw, const float roll) {
-        std::lock_guard lock{mutex};
-        state.gyro.x = pitch;
-        state.gyro.y = yaw;
-        state.gyro.z = roll;
+        WriteState([pitch, yaw, roll](State& s) {
+            s.gyro.x = pitch;
+            s.gyro.y = yaw;
+            s.gyro.z = roll;
+        });
     }
     std::tuple<Common::Vec3<float>, Common::Vec3<float>> GetMotion() const {
-        std::lock_guard lock{mutex};
-        return std::make_tuple(state.accel, state.gyro);
+        const State snapshot = ReadState();
+        return std::make_tuple(snapshot.accel, snapshot.gyro);
     }
 
     /**
@@ -273,20 +290,54 @@ public:
     }
 
 private:
+    /// Trivially-copyable state block so readers can take a consistent snapshot of the
+    /// whole device without locking. The sizes are generous upper bounds for real
+    /// devices; out-of-range indices are rejected by the accessors above.
     struct State {
-        std::unordered_map<int, bool> buttons;
-        std::unordered_map<int, Sint16> axes;
-        std::unordered_map<int, Uint8> hats;
+        std::array<bool, 64> buttons{};
+        std::array<Sint16, 32> axes{};
+        std::array<Uint8, 8> hats{};
         Common::Vec3<float> accel;
         Common::Vec3<float> gyro;
     } state;
+
+    /**
+     * Takes a snapshot of the published state without blocking the event thread.
+     * The version counter is odd while a write is in flight; readers simply retry
+     * until they copied the state under a stable even version.
+     */
+    State ReadState() const {
+        while (true) {
+            const u32 version_before = state_version.load(std::memory_order_acquire);
+            if (version_before % 2 == 0) {
+                State snapshot = state;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (state_version.load(std::memory_order_relaxed) == version_before) {
+                    return snapshot;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    /// Publishes a state mutation; writers (the SDL event thread and device creation)
+    /// serialize against each other, never against readers
+    template <typename Mutator>
+    void WriteState(Mutator&& mutate) {
+        std::lock_guard lock{writer_mutex};
+        state_version.fetch_add(1, std::memory_order_acquire);
+        mutate(state);
+        state_version.fetch_add(1, std::memory_order_release);
+    }
+
     std::string guid;
     int port;
     bool has_gyro{false};
     bool has_accel{false};
     std::unique_ptr<SDL_Joystick, decltype(&SDL_JoystickClose)> sdl_joystick;
     std::unique_ptr<SDL_GameController, decltype(&SDL_GameControllerClose)> sdl_controller;
-    mutable std::mutex mutex;
+    mutable std::atomic<u32> state_version{0};
+    std::mutex writer_mutex;
 };
 
 struct SDLGameControllerDeleter {
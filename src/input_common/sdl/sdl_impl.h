@@ -49,7 +49,7 @@ public:
 
     /// Used by the Pollers during config
     std::atomic<bool> polling = false;
-    Common::SPSCQueue<SDL_Event> event_queue;
+    Common::MPMCQueue<SDL_Event, 0x400> event_queue;
 
 private:
     void InitJoystick(int joystick_index);
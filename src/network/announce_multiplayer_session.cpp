@@ -20,7 +20,8 @@ namespace Network {
 // Time between room is announced to web_service
 static constexpr std::chrono::seconds announce_time_interval(15);
 
-AnnounceMultiplayerSession::AnnounceMultiplayerSession() {
+AnnounceMultiplayerSession::AnnounceMultiplayerSession(std::weak_ptr<Room> room)
+    : bound_room(std::move(room)), room_bound(bound_room.lock() != nullptr) {
 #ifdef ENABLE_WEB_SERVICE
     backend = std::make_unique<WebService::RoomJson>(NetSettings::values.web_api_url,
                                                      NetSettings::values.citra_username,
@@ -30,8 +31,12 @@ AnnounceMultiplayerSession::AnnounceMultiplayerSession() {
 #endif
 }
 
+std::shared_ptr<Network::Room> AnnounceMultiplayerSession::GetTargetRoom() const {
+    return room_bound ? bound_room.lock() : Network::GetRoom().lock();
+}
+
 Common::WebResult AnnounceMultiplayerSession::Register() {
-    std::shared_ptr<Network::Room> room = Network::GetRoom().lock();
+    std::shared_ptr<Network::Room> room = GetTargetRoom();
     if (!room) {
         return Common::WebResult{Common::WebResult::Code::LibError, "Network is not initialized"};
     }
@@ -120,7 +125,7 @@ void AnnounceMultiplayerSession::AnnounceMultiplayerLoop() {
     std::future<Common::WebResult> future;
     while (!shutdown_event.WaitUntil(update_time)) {
         update_time += announce_time_interval;
-        std::shared_ptr<Network::Room> room = Network::GetRoom().lock();
+        std::shared_ptr<Network::Room> room = GetTargetRoom();
         if (!room) {
             break;
         }
@@ -26,7 +26,13 @@ class Room;
 class AnnounceMultiplayerSession : NonCopyable {
 public:
     using CallbackHandle = std::shared_ptr<std::function<void(const Common::WebResult&)>>;
-    AnnounceMultiplayerSession();
+
+    /**
+     * @param room The room this session announces. When empty, the global room from
+     * Network::GetRoom is announced; passing a room explicitly allows announcing several
+     * independently hosted rooms from one process.
+     */
+    explicit AnnounceMultiplayerSession(std::weak_ptr<Room> room = {});
     ~AnnounceMultiplayerSession();
 
     /**
@@ -87,6 +93,12 @@ private:
 
     std::atomic_bool registered = false; ///< Whether the room has been registered
 
+    std::weak_ptr<Room> bound_room; ///< The room to announce; empty to use the global room
+    bool room_bound = false;        ///< Whether a room was passed at construction
+
+    /// Returns the room this session announces, or nullptr if it no longer exists.
+    std::shared_ptr<Network::Room> GetTargetRoom() const;
+
     void UpdateBackendData(std::shared_ptr<Network::Room> room);
     void AnnounceMultiplayerLoop();
 };
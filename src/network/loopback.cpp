@@ -0,0 +1,89 @@
+// Copyright 2026 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <unordered_map>
+#include <utility>
+#include "network/loopback.h"
+
+namespace Network {
+
+void LoopbackConnection::SendToRoom(std::shared_ptr<Packet> packet) {
+    std::lock_guard lock(mutex);
+    if (!open) {
+        return;
+    }
+    to_room.push_back(std::move(packet));
+}
+
+void LoopbackConnection::SendToMember(std::shared_ptr<Packet> packet) {
+    {
+        std::lock_guard lock(mutex);
+        if (!open) {
+            return;
+        }
+        to_member.push_back(std::move(packet));
+    }
+    member_cv.notify_one();
+}
+
+LoopbackConnection::PacketList LoopbackConnection::TakeRoomPackets() {
+    std::lock_guard lock(mutex);
+    PacketList packets;
+    packets.swap(to_room);
+    return packets;
+}
+
+LoopbackConnection::PacketList LoopbackConnection::WaitMemberPackets(u32 timeout_ms) {
+    std::unique_lock lock(mutex);
+    member_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                       [this] { return !to_member.empty() || !open; });
+    PacketList packets;
+    packets.swap(to_member);
+    return packets;
+}
+
+void LoopbackConnection::Disconnect() {
+    {
+        std::lock_guard lock(mutex);
+        open = false;
+    }
+    member_cv.notify_one();
+}
+
+bool LoopbackConnection::IsOpen() const {
+    std::lock_guard lock(mutex);
+    return open;
+}
+
+/// Rooms of this process that accept loopback connections, keyed by their ENet port.
+static std::mutex room_registry_mutex;
+static std::unordered_map<u16, std::function<std::shared_ptr<LoopbackConnection>()>> room_registry;
+
+void RegisterLoopbackRoom(u16 port,
+                          std::function<std::shared_ptr<LoopbackConnection>()> acceptor) {
+    std::lock_guard lock(room_registry_mutex);
+    room_registry[port] = std::move(acceptor);
+}
+
+void UnregisterLoopbackRoom(u16 port) {
+    std::lock_guard lock(room_registry_mutex);
+    room_registry.erase(port);
+}
+
+std::shared_ptr<LoopbackConnection> ConnectLoopback(u16 port) {
+    std::function<std::shared_ptr<LoopbackConnection>()> acceptor;
+    {
+        std::lock_guard lock(room_registry_mutex);
+        const auto room = room_registry.find(port);
+        if (room == room_registry.end()) {
+            return nullptr;
+        }
+        acceptor = room->second;
+    }
+    // Accept outside the registry lock: the acceptor synchronizes with the room on its own.
+    return acceptor();
+}
+
+} // namespace Network
@@ -0,0 +1,72 @@
+// Copyright 2026 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "common/common_types.h"
+#include "network/packet.h"
+
+namespace Network {
+
+/**
+ * A direct connection between a Room and a RoomMember living in the same process. Packets are
+ * handed over as refcounted buffers through two in-memory queues, skipping ENet framing and the
+ * UDP stack entirely, which takes local multiplayer latency from milliseconds to microseconds.
+ */
+class LoopbackConnection {
+public:
+    using PacketList = std::vector<std::shared_ptr<Packet>>;
+
+    /// Queues a packet for the room. Called from the member side; thread-safe.
+    void SendToRoom(std::shared_ptr<Packet> packet);
+
+    /// Queues a packet for the member. Called from the room side; thread-safe.
+    void SendToMember(std::shared_ptr<Packet> packet);
+
+    /// Takes every packet the member has sent since the last call, without blocking.
+    PacketList TakeRoomPackets();
+
+    /**
+     * Waits until the room has sent packets or the connection was closed and takes them.
+     * @param timeout_ms The maximum time to wait, in milliseconds.
+     */
+    PacketList WaitMemberPackets(u32 timeout_ms);
+
+    /// Closes the connection. Queued packets can still be taken; new sends are dropped.
+    void Disconnect();
+
+    bool IsOpen() const;
+
+private:
+    mutable std::mutex mutex;
+    std::condition_variable member_cv; ///< Signals the member side about packets or the close.
+    PacketList to_room;
+    PacketList to_member;
+    bool open = true;
+};
+
+/**
+ * Registers a room that accepts loopback connections on the given port.
+ * @param port The port the room also listens on over ENet.
+ * @param acceptor Callback creating a connection the room will service; called from the
+ *        connecting member's thread and must therefore be thread-safe.
+ */
+void RegisterLoopbackRoom(u16 port,
+                          std::function<std::shared_ptr<LoopbackConnection>()> acceptor);
+
+/// Unregisters the room on the given port. Established connections are not affected.
+void UnregisterLoopbackRoom(u16 port);
+
+/**
+ * Connects to a room hosted by this process on the given port.
+ * @return The established connection, or nullptr when this process hosts no such room.
+ */
+std::shared_ptr<LoopbackConnection> ConnectLoopback(u16 port);
+
+} // namespace Network
@@ -33,6 +33,10 @@ void Packet::Append(const void* in_data, std::size_t size_in_bytes) {
     }
 }
 
+void Packet::Reserve(std::size_t size_in_bytes) {
+    data.reserve(size_in_bytes);
+}
+
 void Packet::Read(void* out_data, std::size_t size_in_bytes) {
     if (out_data && CheckSize(size_in_bytes)) {
         std::memcpy(out_data, &data[read_pos], size_in_bytes);
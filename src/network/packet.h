@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <type_traits>
 #include <vector>
 #include "common/common_types.h"
 
@@ -23,6 +24,13 @@ public:
      */
     void Append(const void* data, std::size_t size_in_bytes);
 
+    /**
+     * Reserve storage for a message whose serialized size is known up front, so that the
+     * following field writes do not reallocate the internal buffer.
+     * @param size_in_bytes Expected total size of the packet, in bytes
+     */
+    void Reserve(std::size_t size_in_bytes);
+
     /**
      * Reads data from the current read position of the packet
      * @param out_data        Pointer where the data should get written to
@@ -117,6 +125,12 @@ private:
     bool is_valid = true;     ///< Reading state of the packet
 };
 
+/// Byte-sized integers have no endianess and can be copied in bulk instead of per element.
+/// std::vector<bool> is excluded as it does not store its elements contiguously.
+template <typename T>
+constexpr bool is_packet_byte_type =
+    std::is_integral_v<T> && sizeof(T) == 1 && !std::is_same_v<T, bool>;
+
 template <typename T>
 Packet& Packet::operator>>(std::vector<T>& out_data) {
     // First extract the size
@@ -125,20 +139,28 @@ Packet& Packet::operator>>(std::vector<T>& out_data) {
     out_data.resize(size);
 
     // Then extract the data
-    for (std::size_t i = 0; i < out_data.size(); ++i) {
-        T character;
-        *this >> character;
-        out_data[i] = character;
+    if constexpr (is_packet_byte_type<T>) {
+        Read(out_data.data(), size);
+    } else {
+        for (std::size_t i = 0; i < out_data.size(); ++i) {
+            T character;
+            *this >> character;
+            out_data[i] = character;
+        }
     }
     return *this;
 }
 
 template <typename T, std::size_t S>
 Packet& Packet::operator>>(std::array<T, S>& out_data) {
-    for (std::size_t i = 0; i < out_data.size(); ++i) {
-        T character;
-        *this >> character;
-        out_data[i] = character;
+    if constexpr (is_packet_byte_type<T>) {
+        Read(out_data.data(), S);
+    } else {
+        for (std::size_t i = 0; i < out_data.size(); ++i) {
+            T character;
+            *this >> character;
+            out_data[i] = character;
+        }
     }
     return *this;
 }
@@ -149,16 +171,24 @@ Packet& Packet::operator<<(const std::vector<T>& in_data) {
     *this << static_cast<u32>(in_data.size());
 
     // Then insert the data
-    for (std::size_t i = 0; i < in_data.size(); ++i) {
-        *this << in_data[i];
+    if constexpr (is_packet_byte_type<T>) {
+        Append(in_data.data(), in_data.size());
+    } else {
+        for (std::size_t i = 0; i < in_data.size(); ++i) {
+            *this << in_data[i];
+        }
     }
     return *this;
 }
 
 template <typename T, std::size_t S>
 Packet& Packet::operator<<(const std::array<T, S>& in_data) {
-    for (std::size_t i = 0; i < in_data.size(); ++i) {
-        *this << in_data[i];
+    if constexpr (is_packet_byte_type<T>) {
+        Append(in_data.data(), S);
+    } else {
+        for (std::size_t i = 0; i < in_data.size(); ++i) {
+            *this << in_data[i];
+        }
     }
     return *this;
 }
@@ -4,13 +4,20 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
 #include <mutex>
 #include <random>
 #include <regex>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
+#include "common/hash.h"
 #include "common/logging/log.h"
+#include "common/thread_worker.h"
 #include "enet/enet.h"
+#include "network/loopback.h"
 #include "network/packet.h"
 #include "network/room.h"
 #include "network/verify_user.h"
@@ -60,10 +67,68 @@ public:
     /// Verification backend of the room
     std::unique_ptr<VerifyUser::Backend> verify_backend;
 
+    /// A token verification running on the worker. The worker fills in user_data and then
+    /// sets done; everything else is only touched by the room thread.
+    struct PendingVerification {
+        Member member; ///< The join request, complete except for the verified user data.
+        u64 token_hash;
+        VerifyUser::UserData user_data;
+        std::atomic<bool> done{false};
+    };
+    /// Join requests whose token is still being verified. Room thread only.
+    std::vector<std::shared_ptr<PendingVerification>> pending_verifications;
+
+    /// An already verified token, so a member reconnecting shortly after (e.g. the whole room
+    /// rejoining after a restart) skips the signature check entirely.
+    struct VerifiedToken {
+        VerifyUser::UserData user_data;
+        std::chrono::steady_clock::time_point expiry;
+    };
+    /// Cache of verified tokens keyed by a hash of (verify_UID, token). Room thread only.
+    std::unordered_map<u64, VerifiedToken> verified_tokens;
+    static constexpr std::chrono::seconds VerifiedTokenTTL{60};
+
+    /// Lazily created worker thread that runs token verification off the packet loop.
+    std::unique_ptr<Common::ThreadWorker> verify_worker;
+
+    /// A member connected through the in-process loopback transport. The dummy peer gives the
+    /// member an identity and an address in the structures shared with ENet members; it is
+    /// never handed to ENet itself.
+    struct LoopbackPeer {
+        std::shared_ptr<ENetPeer> peer;
+        std::shared_ptr<LoopbackConnection> connection;
+    };
+    std::vector<LoopbackPeer> loopback_peers; ///< Loopback members. Room thread only.
+
+    std::mutex pending_loopback_mutex; ///< Protects pending_loopback_connections.
+    /// Loopback connections accepted from members but not yet adopted by the room thread.
+    std::vector<std::shared_ptr<LoopbackConnection>> pending_loopback_connections;
+
     /// Thread function that will receive and dispatch messages until the room is destroyed.
     void ServerLoop();
     void StartLoop();
 
+    /// Dispatches one received message to the matching handler and releases the packet.
+    void DispatchMessage(const ENetEvent* event);
+
+    /// Returns the loopback connection behind a peer, or nullptr for an ENet peer.
+    LoopbackConnection* GetLoopbackConnection(const ENetPeer* peer) const;
+
+    /// Sends a packet to one client over whichever transport it is connected through.
+    void SendToPeer(ENetPeer* client, const Packet& packet);
+
+    /// Sends a packet to every member over its transport. The caller holds member_mutex.
+    void BroadcastToMembers(const Packet& packet);
+
+    /// Disconnects a client over whichever transport it is connected through.
+    void DisconnectPeer(ENetPeer* client);
+
+    /// Adopts loopback connections accepted from RoomMembers of this process.
+    void AcceptLoopbackConnections();
+
+    /// Dispatches the packets the loopback members have sent since the last call.
+    void ServiceLoopbackPeers();
+
     /**
      * Parses and answers a room join request from a client.
      * Validates the uniqueness of the username and assigns the MAC address
@@ -71,6 +136,16 @@ public:
      */
     void HandleJoinRequest(const ENetEvent* event);
 
+    /**
+     * Finishes a join whose user data is known: assigns or validates the MAC address,
+     * applies the ban lists and announces the new member. Validations that could have been
+     * invalidated while the token was on the worker are performed (again) here.
+     */
+    void CompleteJoin(Member& member);
+
+    /// Joins the members whose token verification has finished on the worker.
+    void ProcessPendingVerifications();
+
     /**
      * Parses and answers a kick request from a client.
      * Validates the permissions and that the given user exists and then kicks the member.
@@ -250,37 +325,13 @@ public:
 void Room::RoomImpl::ServerLoop() {
     while (state != State::Closed) {
         ENetEvent event;
-        if (enet_host_service(server, &event, 16) > 0) {
+        // Tick faster while loopback members are connected: their packets arrive through
+        // in-memory queues that cannot interrupt enet_host_service.
+        const u32 timeout_ms = loopback_peers.empty() ? 16 : 1;
+        if (enet_host_service(server, &event, timeout_ms) > 0) {
             switch (event.type) {
             case ENET_EVENT_TYPE_RECEIVE:
-                switch (event.packet->data[0]) {
-                case IdJoinRequest:
-                    HandleJoinRequest(&event);
-                    break;
-                case IdSetGameInfo:
-                    HandleGameNamePacket(&event);
-                    break;
-                case IdWifiPacket:
-                    HandleWifiPacket(&event);
-                    break;
-                case IdChatMessage:
-                    HandleChatPacket(&event);
-                    break;
-                // Moderation
-                case IdModKick:
-                    HandleModKickPacket(&event);
-                    break;
-                case IdModBan:
-                    HandleModBanPacket(&event);
-                    break;
-                case IdModUnban:
-                    HandleModUnbanPacket(&event);
-                    break;
-                case IdModGetBanList:
-                    HandleModGetBanListPacket(&event);
-                    break;
-                }
-                enet_packet_destroy(event.packet);
+                DispatchMessage(&event);
                 break;
             case ENET_EVENT_TYPE_DISCONNECT:
                 HandleClientDisconnection(event.peer);
@@ -290,11 +341,120 @@ void Room::RoomImpl::ServerLoop() {
                 break;
             }
         }
+        AcceptLoopbackConnections();
+        ServiceLoopbackPeers();
+        ProcessPendingVerifications();
     }
     // Close the connection to all members:
     SendCloseMessage();
 }
 
+void Room::RoomImpl::DispatchMessage(const ENetEvent* event) {
+    switch (event->packet->data[0]) {
+    case IdJoinRequest:
+        HandleJoinRequest(event);
+        break;
+    case IdSetGameInfo:
+        HandleGameNamePacket(event);
+        break;
+    case IdWifiPacket:
+        HandleWifiPacket(event);
+        break;
+    case IdChatMessage:
+        HandleChatPacket(event);
+        break;
+    // Moderation
+    case IdModKick:
+        HandleModKickPacket(event);
+        break;
+    case IdModBan:
+        HandleModBanPacket(event);
+        break;
+    case IdModUnban:
+        HandleModUnbanPacket(event);
+        break;
+    case IdModGetBanList:
+        HandleModGetBanListPacket(event);
+        break;
+    }
+    // Forwarded packets (wifi data) are reference-counted by the send queues of
+    // the target peers and freed by ENet once the last send completes; only
+    // destroy the packet here if no handler enqueued it anywhere.
+    if (event->packet->referenceCount == 0) {
+        enet_packet_destroy(event->packet);
+    }
+}
+
+LoopbackConnection* Room::RoomImpl::GetLoopbackConnection(const ENetPeer* peer) const {
+    const auto loopback =
+        std::find_if(loopback_peers.begin(), loopback_peers.end(),
+                     [peer](const auto& loopback) { return loopback.peer.get() == peer; });
+    return loopback != loopback_peers.end() ? loopback->connection.get() : nullptr;
+}
+
+void Room::RoomImpl::SendToPeer(ENetPeer* client, const Packet& packet) {
+    if (auto* connection = GetLoopbackConnection(client)) {
+        connection->SendToMember(std::make_shared<Packet>(packet));
+        return;
+    }
+    ENetPacket* enet_packet =
+        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
+    enet_peer_send(client, 0, enet_packet);
+    enet_host_flush(server);
+}
+
+void Room::RoomImpl::DisconnectPeer(ENetPeer* client) {
+    const auto loopback =
+        std::find_if(loopback_peers.begin(), loopback_peers.end(),
+                     [client](const auto& loopback) { return loopback.peer.get() == client; });
+    if (loopback == loopback_peers.end()) {
+        enet_peer_disconnect(client, 0);
+        return;
+    }
+    loopback->connection->Disconnect();
+    loopback_peers.erase(loopback);
+}
+
+void Room::RoomImpl::AcceptLoopbackConnections() {
+    std::vector<std::shared_ptr<LoopbackConnection>> new_connections;
+    {
+        std::lock_guard lock(pending_loopback_mutex);
+        new_connections.swap(pending_loopback_connections);
+    }
+    for (auto& connection : new_connections) {
+        LoopbackPeer loopback{};
+        loopback.peer = std::make_shared<ENetPeer>();
+        // 127.0.0.1 in network byte order, so the ban check sees the loopback address.
+        loopback.peer->address.host = 0x0100007F;
+        loopback.connection = std::move(connection);
+        loopback_peers.push_back(std::move(loopback));
+    }
+}
+
+void Room::RoomImpl::ServiceLoopbackPeers() {
+    // Work on a snapshot: a dispatched message can remove loopback members, e.g. a mod kick.
+    std::vector<LoopbackPeer> peers{loopback_peers};
+    for (auto& [peer, connection] : peers) {
+        for (const auto& loopback_packet : connection->TakeRoomPackets()) {
+            if (!GetLoopbackConnection(peer.get())) {
+                break; // The member was removed while dispatching; drop its leftover packets
+            }
+            // Repackage into an ENet packet, so the dispatch and the wifi relay, which hand
+            // the received packet itself to ENet members, work unchanged on both transports.
+            ENetEvent event{};
+            event.type = ENET_EVENT_TYPE_RECEIVE;
+            event.peer = peer.get();
+            event.packet = enet_packet_create(loopback_packet->GetData(),
+                                              loopback_packet->GetDataSize(),
+                                              ENET_PACKET_FLAG_RELIABLE);
+            DispatchMessage(&event);
+        }
+        if (GetLoopbackConnection(peer.get()) && !connection->IsOpen()) {
+            HandleClientDisconnection(peer.get());
+        }
+    }
+}
+
 void Room::RoomImpl::StartLoop() {
     room_thread = std::make_unique<std::thread>(&Room::RoomImpl::ServerLoop, this);
 }
@@ -338,17 +498,6 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
         return;
     }
 
-    if (preferred_mac != NoPreferredMac) {
-        // Verify if the preferred mac is available
-        if (!IsValidMacAddress(preferred_mac)) {
-            SendMacCollision(event->peer);
-            return;
-        }
-    } else {
-        // Assign a MAC address of this client automatically
-        preferred_mac = GenerateMacAddress();
-    }
-
     if (!IsValidConsoleId(console_id_hash)) {
         SendConsoleIdCollision(event->peer);
         return;
@@ -359,7 +508,9 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
         return;
     }
 
-    // At this point the client is ready to be added to the room.
+    // At this point the client is ready to be added to the room once its token is verified.
+    // The MAC address is assigned or validated in CompleteJoin since another join finishing
+    // first could take it while the token sits on the worker.
     Member member{};
     member.mac_address = preferred_mac;
     member.console_id_hash = console_id_hash;
@@ -371,7 +522,80 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
         std::lock_guard lock(verify_UID_mutex);
         uid = verify_UID;
     }
-    member.user_data = verify_backend->LoadUserData(uid, token);
+
+    if (token.empty()) {
+        // Nothing to verify, join right away.
+        member.user_data = verify_backend->LoadUserData(uid, token);
+        CompleteJoin(member);
+        return;
+    }
+
+    // Drop cached verifications that are too old to trust.
+    const auto now = std::chrono::steady_clock::now();
+    for (auto it = verified_tokens.begin(); it != verified_tokens.end();) {
+        if (it->second.expiry <= now) {
+            it = verified_tokens.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    const u64 token_hash = Common::HashCombine(Common::ComputeHash64(uid.data(), uid.size()),
+                                               Common::ComputeHash64(token.data(), token.size()));
+    if (const auto verified = verified_tokens.find(token_hash);
+        verified != verified_tokens.end()) {
+        member.user_data = verified->second.user_data;
+        CompleteJoin(member);
+        return;
+    }
+
+    // Check the token signature on the worker thread. A burst of joins, e.g. a whole room
+    // reconnecting after the host restarts, would otherwise stall the packet loop for
+    // everyone already in the room.
+    auto pending = std::make_shared<PendingVerification>();
+    pending->member = std::move(member);
+    pending->token_hash = token_hash;
+    if (!verify_worker) {
+        verify_worker = std::make_unique<Common::ThreadWorker>(1, "RoomVerifyUser");
+    }
+    verify_worker->QueueWork([this, pending, uid, token] {
+        pending->user_data = verify_backend->LoadUserData(uid, token);
+        pending->done.store(true, std::memory_order_release);
+    });
+    pending_verifications.push_back(std::move(pending));
+}
+
+void Room::RoomImpl::CompleteJoin(Member& member) {
+    // The room may have changed while the token was on the worker, so redo the checks that
+    // depend on the current member list.
+    {
+        std::lock_guard lock(member_mutex);
+        if (members.size() >= room_information.member_slots) {
+            SendRoomIsFull(member.peer);
+            return;
+        }
+    }
+
+    if (!IsValidNickname(member.nickname)) {
+        SendNameCollision(member.peer);
+        return;
+    }
+
+    if (member.mac_address != NoPreferredMac) {
+        // Verify if the preferred mac is available
+        if (!IsValidMacAddress(member.mac_address)) {
+            SendMacCollision(member.peer);
+            return;
+        }
+    } else {
+        // Assign a MAC address of this client automatically
+        member.mac_address = GenerateMacAddress();
+    }
+
+    if (!IsValidConsoleId(member.console_id_hash)) {
+        SendConsoleIdCollision(member.peer);
+        return;
+    }
 
     std::string ip;
     {
@@ -382,17 +606,17 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
             std::find(username_ban_list.begin(), username_ban_list.end(),
                       member.user_data.username) != username_ban_list.end()) {
 
-            SendUserBanned(event->peer);
+            SendUserBanned(member.peer);
             return;
         }
 
         // Check IP ban
         char ip_raw[256];
-        enet_address_get_host_ip(&event->peer->address, ip_raw, sizeof(ip_raw) - 1);
+        enet_address_get_host_ip(&member.peer->address, ip_raw, sizeof(ip_raw) - 1);
         ip = ip_raw;
 
         if (std::find(ip_ban_list.begin(), ip_ban_list.end(), ip) != ip_ban_list.end()) {
-            SendUserBanned(event->peer);
+            SendUserBanned(member.peer);
             return;
         }
     }
@@ -400,6 +624,8 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
     // Notify everyone that the user has joined.
     SendStatusMessage(IdMemberJoin, member.nickname, member.user_data.username, ip);
 
+    ENetPeer* peer = member.peer;
+    const MacAddress mac_address = member.mac_address;
     {
         std::lock_guard lock(member_mutex);
         members.push_back(std::move(member));
@@ -407,10 +633,29 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
 
     // Notify everyone that the room information has changed.
     BroadcastRoomInformation();
-    if (HasModPermission(event->peer)) {
-        SendJoinSuccessAsMod(event->peer, preferred_mac);
+    if (HasModPermission(peer)) {
+        SendJoinSuccessAsMod(peer, mac_address);
     } else {
-        SendJoinSuccess(event->peer, preferred_mac);
+        SendJoinSuccess(peer, mac_address);
+    }
+}
+
+void Room::RoomImpl::ProcessPendingVerifications() {
+    for (auto it = pending_verifications.begin(); it != pending_verifications.end();) {
+        auto& pending = *it;
+        if (!pending->done.load(std::memory_order_acquire)) {
+            ++it;
+            continue;
+        }
+        // Failed verifications are not cached, so a retry with a fresh token gets verified.
+        if (!pending->user_data.username.empty()) {
+            verified_tokens[pending->token_hash] = {
+                pending->user_data, std::chrono::steady_clock::now() + VerifiedTokenTTL};
+        }
+        Member member = std::move(pending->member);
+        member.user_data = std::move(pending->user_data);
+        it = pending_verifications.erase(it);
+        CompleteJoin(member);
     }
 }
 
@@ -447,7 +692,7 @@ void Room::RoomImpl::HandleModKickPacket(const ENetEvent* event) {
         enet_address_get_host_ip(&target_member->peer->address, ip_raw, sizeof(ip_raw) - 1);
         ip = ip_raw;
 
-        enet_peer_disconnect(target_member->peer, 0);
+        DisconnectPeer(target_member->peer);
         members.erase(target_member);
     }
 
@@ -490,7 +735,7 @@ void Room::RoomImpl::HandleModBanPacket(const ENetEvent* event) {
         enet_address_get_host_ip(&target_member->peer->address, ip_raw, sizeof(ip_raw) - 1);
         ip = ip_raw;
 
-        enet_peer_disconnect(target_member->peer, 0);
+        DisconnectPeer(target_member->peer);
         members.erase(target_member);
     }
 
@@ -615,50 +860,35 @@ void Room::RoomImpl::SendNameCollision(ENetPeer* client) {
     Packet packet;
     packet << static_cast<u8>(IdNameCollision);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendMacCollision(ENetPeer* client) {
     Packet packet;
     packet << static_cast<u8>(IdMacCollision);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendConsoleIdCollision(ENetPeer* client) {
     Packet packet;
     packet << static_cast<u8>(IdConsoleIdCollision);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendWrongPassword(ENetPeer* client) {
     Packet packet;
     packet << static_cast<u8>(IdWrongPassword);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendRoomIsFull(ENetPeer* client) {
     Packet packet;
     packet << static_cast<u8>(IdRoomIsFull);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendVersionMismatch(ENetPeer* client) {
@@ -666,70 +896,49 @@ void Room::RoomImpl::SendVersionMismatch(ENetPeer* client) {
     packet << static_cast<u8>(IdVersionMismatch);
     packet << network_version;
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendJoinSuccess(ENetPeer* client, MacAddress mac_address) {
     Packet packet;
     packet << static_cast<u8>(IdJoinSuccess);
     packet << mac_address;
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendJoinSuccessAsMod(ENetPeer* client, MacAddress mac_address) {
     Packet packet;
     packet << static_cast<u8>(IdJoinSuccessAsMod);
     packet << mac_address;
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendUserKicked(ENetPeer* client) {
     Packet packet;
     packet << static_cast<u8>(IdHostKicked);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendUserBanned(ENetPeer* client) {
     Packet packet;
     packet << static_cast<u8>(IdHostBanned);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendModPermissionDenied(ENetPeer* client) {
     Packet packet;
     packet << static_cast<u8>(IdModPermissionDenied);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendModNoSuchUser(ENetPeer* client) {
     Packet packet;
     packet << static_cast<u8>(IdModNoSuchUser);
 
-    ENetPacket* enet_packet =
-        enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
-    enet_host_flush(server);
+    SendToPeer(client, packet);
 }
 
 void Room::RoomImpl::SendModBanListResponse(ENetPeer* client) {
@@ -741,9 +950,30 @@ void Room::RoomImpl::SendModBanListResponse(ENetPeer* client) {
         packet << ip_ban_list;
     }
 
+    SendToPeer(client, packet);
+}
+
+void Room::RoomImpl::BroadcastToMembers(const Packet& packet) {
+    // One ENet packet is shared by the send queues of all ENet members and one refcounted
+    // buffer by all loopback members, so nothing is serialized or copied per member.
     ENetPacket* enet_packet =
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-    enet_peer_send(client, 0, enet_packet);
+    bool sent_packet = false;
+    std::shared_ptr<Packet> loopback_packet;
+    for (auto& member : members) {
+        if (auto* connection = GetLoopbackConnection(member.peer)) {
+            if (!loopback_packet) {
+                loopback_packet = std::make_shared<Packet>(packet);
+            }
+            connection->SendToMember(loopback_packet);
+        } else {
+            sent_packet = true;
+            enet_peer_send(member.peer, 0, enet_packet);
+        }
+    }
+    if (!sent_packet) {
+        enet_packet_destroy(enet_packet);
+    }
     enet_host_flush(server);
 }
 
@@ -752,15 +982,10 @@ void Room::RoomImpl::SendCloseMessage() {
     packet << static_cast<u8>(IdCloseRoom);
     std::lock_guard lock(member_mutex);
     if (!members.empty()) {
-        ENetPacket* enet_packet =
-            enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-        for (auto& member : members) {
-            enet_peer_send(member.peer, 0, enet_packet);
-        }
+        BroadcastToMembers(packet);
     }
-    enet_host_flush(server);
     for (auto& member : members) {
-        enet_peer_disconnect(member.peer, 0);
+        DisconnectPeer(member.peer);
     }
 }
 
@@ -773,13 +998,8 @@ void Room::RoomImpl::SendStatusMessage(StatusMessageTypes type, const std::strin
     packet << username;
     std::lock_guard lock(member_mutex);
     if (!members.empty()) {
-        ENetPacket* enet_packet =
-            enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
-        for (auto& member : members) {
-            enet_peer_send(member.peer, 0, enet_packet);
-        }
+        BroadcastToMembers(packet);
     }
-    enet_host_flush(server);
 
     const std::string display_name =
         username.empty() ? nickname : fmt::format("{} ({})", nickname, username);
@@ -831,6 +1051,15 @@ void Room::RoomImpl::BroadcastRoomInformation() {
         enet_packet_create(packet.GetData(), packet.GetDataSize(), ENET_PACKET_FLAG_RELIABLE);
     enet_host_broadcast(server, 0, enet_packet);
     enet_host_flush(server);
+
+    // enet_host_broadcast reaches every connected peer, so include every loopback
+    // connection too, joined or not, through one shared buffer.
+    if (!loopback_peers.empty()) {
+        auto loopback_packet = std::make_shared<Packet>(packet);
+        for (auto& loopback : loopback_peers) {
+            loopback.connection->SendToMember(loopback_packet);
+        }
+    }
 }
 
 MacAddress Room::RoomImpl::GenerateMacAddress() {
@@ -846,33 +1075,48 @@ MacAddress Room::RoomImpl::GenerateMacAddress() {
 }
 
 void Room::RoomImpl::HandleWifiPacket(const ENetEvent* event) {
-    Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
-    in_packet.IgnoreBytes(sizeof(u8));         // Message type
-    in_packet.IgnoreBytes(sizeof(u8));         // WifiPacket Type
-    in_packet.IgnoreBytes(sizeof(u8));         // WifiPacket Channel
-    in_packet.IgnoreBytes(sizeof(MacAddress)); // WifiPacket Transmitter Address
+    // Relayed as-is, so read the destination straight out of the raw buffer instead of
+    // copying the whole payload into a Packet first. The layout is: message type (u8),
+    // WifiPacket type (u8), WifiPacket channel (u8), transmitter address, destination
+    // address, followed by the frame data.
+    constexpr std::size_t destination_offset = 3 * sizeof(u8) + sizeof(MacAddress);
+    if (event->packet->dataLength < destination_offset + sizeof(MacAddress)) {
+        LOG_ERROR(Network, "Received a malformed wifi packet ({} bytes)",
+                  event->packet->dataLength);
+        return;
+    }
     MacAddress destination_address;
-    in_packet >> destination_address;
-
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
+    std::memcpy(destination_address.data(), event->packet->data + destination_offset,
+                sizeof(MacAddress));
+
+    // Forward the received ENet packet itself: every enet_peer_send adds a reference to it,
+    // so one buffer is shared across the send queues of all target peers and no
+    // re-serialization or per-member copy happens. ServerLoop destroys the packet only if
+    // it was not enqueued to anyone.
+    ENetPacket* enet_packet = event->packet;
+
+    // Loopback members get the frame as one refcounted buffer shared across their queues,
+    // created lazily since most frames have no loopback target.
+    std::shared_ptr<Packet> loopback_packet;
+    const auto SendToTarget = [&](const Member& member) {
+        if (auto* connection = GetLoopbackConnection(member.peer)) {
+            if (!loopback_packet) {
+                loopback_packet = std::make_shared<Packet>();
+                loopback_packet->Append(event->packet->data, event->packet->dataLength);
+            }
+            connection->SendToMember(loopback_packet);
+        } else {
+            enet_peer_send(member.peer, 0, enet_packet);
+        }
+    };
 
     if (destination_address == BroadcastMac) { // Send the data to everyone except the sender
         std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
         for (const auto& member : members) {
             if (member.peer != event->peer) {
-                sent_packet = true;
-                enet_peer_send(member.peer, 0, enet_packet);
+                SendToTarget(member);
             }
         }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
     } else { // Send the data only to the destination client
         std::lock_guard lock(member_mutex);
         auto member = std::find_if(members.begin(), members.end(),
@@ -880,17 +1124,18 @@ void Room::RoomImpl::HandleWifiPacket(const ENetEvent* event) {
                                        return member.mac_address == destination_address;
                                    });
         if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
+            SendToTarget(*member);
         } else {
             LOG_ERROR(Network,
                       "Attempting to send to unknown MAC address: "
                       "{:02X}:{:02X}:{:02X}:{:02X}:{:02X}:{:02X}",
                       destination_address[0], destination_address[1], destination_address[2],
                       destination_address[3], destination_address[4], destination_address[5]);
-            enet_packet_destroy(enet_packet);
         }
     }
-    enet_host_flush(server);
+    // No explicit flush: the queued sends go out with the next enet_host_service call in
+    // ServerLoop, which batches a frame's burst of wifi packets into as few datagrams per
+    // peer as the MTU allows instead of one UDP packet each.
 }
 
 void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
@@ -922,10 +1167,18 @@ void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
     ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
                                                  ENET_PACKET_FLAG_RELIABLE);
     bool sent_packet = false;
+    std::shared_ptr<Packet> loopback_packet;
     for (const auto& member : members) {
         if (member.peer != event->peer) {
-            sent_packet = true;
-            enet_peer_send(member.peer, 0, enet_packet);
+            if (auto* connection = GetLoopbackConnection(member.peer)) {
+                if (!loopback_packet) {
+                    loopback_packet = std::make_shared<Packet>(out_packet);
+                }
+                connection->SendToMember(loopback_packet);
+            } else {
+                sent_packet = true;
+                enet_peer_send(member.peer, 0, enet_packet);
+            }
         }
     }
 
@@ -977,6 +1230,13 @@ void Room::RoomImpl::HandleGameNamePacket(const ENetEvent* event) {
 }
 
 void Room::RoomImpl::HandleClientDisconnection(ENetPeer* client) {
+    // Forget any join of this client that is still being verified. The worker may still hold a
+    // reference to the entry; it is dropped once the verification finishes.
+    pending_verifications.erase(
+        std::remove_if(pending_verifications.begin(), pending_verifications.end(),
+                       [client](const auto& pending) { return pending->member.peer == client; }),
+        pending_verifications.end());
+
     // Remove the client from the members list.
     std::string nickname, username, ip;
     {
@@ -997,7 +1257,7 @@ void Room::RoomImpl::HandleClientDisconnection(ENetPeer* client) {
     }
 
     // Announce the change to all clients.
-    enet_peer_disconnect(client, 0);
+    DisconnectPeer(client);
     if (!nickname.empty())
         SendStatusMessage(IdMemberLeave, nickname, username, ip);
     BroadcastRoomInformation();
@@ -1042,6 +1302,16 @@ bool Room::Create(const std::string& name, const std::string& description,
     room_impl->username_ban_list = ban_list.first;
     room_impl->ip_ban_list = ban_list.second;
 
+    // Accept direct connections from RoomMembers living in this process.
+    RegisterLoopbackRoom(server_port, [impl = room_impl.get()] {
+        auto connection = std::make_shared<LoopbackConnection>();
+        {
+            std::lock_guard lock(impl->pending_loopback_mutex);
+            impl->pending_loopback_connections.push_back(connection);
+        }
+        return connection;
+    });
+
     room_impl->StartLoop();
     return true;
 }
@@ -1090,10 +1360,25 @@ void Room::SetVerifyUID(const std::string& uid) {
 }
 
 void Room::Destroy() {
+    UnregisterLoopbackRoom(room_impl->room_information.port);
     room_impl->state = State::Closed;
     room_impl->room_thread->join();
     room_impl->room_thread.reset();
 
+    // Close connections that were never adopted by the room thread, and the loopback side of
+    // the members SendCloseMessage already disconnected.
+    {
+        std::lock_guard lock(room_impl->pending_loopback_mutex);
+        for (auto& connection : room_impl->pending_loopback_connections) {
+            connection->Disconnect();
+        }
+        room_impl->pending_loopback_connections.clear();
+    }
+    for (auto& loopback : room_impl->loopback_peers) {
+        loopback.connection->Disconnect();
+    }
+    room_impl->loopback_peers.clear();
+
     if (room_impl->server) {
         enet_host_destroy(room_impl->server);
     }
@@ -4,12 +4,14 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstring>
 #include <list>
 #include <mutex>
 #include <set>
 #include <thread>
 #include "common/assert.h"
 #include "enet/enet.h"
+#include "network/loopback.h"
 #include "network/packet.h"
 #include "network/room_member.h"
 
@@ -22,6 +24,9 @@ public:
     ENetHost* client = nullptr; ///< ENet network interface.
     ENetPeer* server = nullptr; ///< The server peer the client is connected to
 
+    /// Direct connection to a room hosted by this process; replaces ENet when set.
+    std::shared_ptr<LoopbackConnection> loopback;
+
     /// Information about the clients connected to the same room as us.
     MemberList member_information;
     /// Information about the room we're connected to.
@@ -70,6 +75,12 @@ public:
 
     void MemberLoop();
 
+    /// Receives and dispatches packets from the loopback transport until the member leaves.
+    void LoopbackMemberLoop();
+
+    /// Dispatches a single message received from the room to the matching handler.
+    void DispatchMessage(const ENetEvent* event);
+
     void StartLoop();
 
     /**
@@ -155,7 +166,85 @@ bool RoomMember::RoomMemberImpl::IsConnected() const {
     return state == State::Joining || state == State::Joined || state == State::Moderator;
 }
 
+void RoomMember::RoomMemberImpl::DispatchMessage(const ENetEvent* event) {
+    switch (event->packet->data[0]) {
+    case IdWifiPacket:
+        HandleWifiPackets(event);
+        break;
+    case IdChatMessage:
+        HandleChatPacket(event);
+        break;
+    case IdStatusMessage:
+        HandleStatusMessagePacket(event);
+        break;
+    case IdRoomInformation:
+        HandleRoomInformationPacket(event);
+        break;
+    case IdJoinSuccess:
+    case IdJoinSuccessAsMod:
+        // The join request was successful, we are now in the room.
+        // If we joined successfully, there must be at least one client in the room: us.
+        ASSERT_MSG(member_information.size() > 0, "We have not yet received member information.");
+        HandleJoinPacket(event); // Get the MAC Address for the client
+        if (event->packet->data[0] == IdJoinSuccessAsMod) {
+            SetState(State::Moderator);
+        } else {
+            SetState(State::Joined);
+        }
+        break;
+    case IdModBanListResponse:
+        HandleModBanListResponsePacket(event);
+        break;
+    case IdRoomIsFull:
+        SetState(State::Idle);
+        SetError(Error::RoomIsFull);
+        break;
+    case IdNameCollision:
+        SetState(State::Idle);
+        SetError(Error::NameCollision);
+        break;
+    case IdMacCollision:
+        SetState(State::Idle);
+        SetError(Error::MacCollision);
+        break;
+    case IdConsoleIdCollision:
+        SetState(State::Idle);
+        SetError(Error::ConsoleIdCollision);
+        break;
+    case IdVersionMismatch:
+        SetState(State::Idle);
+        SetError(Error::WrongVersion);
+        break;
+    case IdWrongPassword:
+        SetState(State::Idle);
+        SetError(Error::WrongPassword);
+        break;
+    case IdCloseRoom:
+        SetState(State::Idle);
+        SetError(Error::LostConnection);
+        break;
+    case IdHostKicked:
+        SetState(State::Idle);
+        SetError(Error::HostKicked);
+        break;
+    case IdHostBanned:
+        SetState(State::Idle);
+        SetError(Error::HostBanned);
+        break;
+    case IdModPermissionDenied:
+        SetError(Error::PermissionDenied);
+        break;
+    case IdModNoSuchUser:
+        SetError(Error::NoSuchUser);
+        break;
+    }
+}
+
 void RoomMember::RoomMemberImpl::MemberLoop() {
+    if (loopback) {
+        LoopbackMemberLoop();
+        return;
+    }
     // Receive packets while the connection is open
     while (IsConnected()) {
         std::lock_guard network_lock(network_mutex);
@@ -163,78 +252,7 @@ void RoomMember::RoomMemberImpl::MemberLoop() {
         if (enet_host_service(client, &event, 16) > 0) {
             switch (event.type) {
             case ENET_EVENT_TYPE_RECEIVE:
-                switch (event.packet->data[0]) {
-                case IdWifiPacket:
-                    HandleWifiPackets(&event);
-                    break;
-                case IdChatMessage:
-                    HandleChatPacket(&event);
-                    break;
-                case IdStatusMessage:
-                    HandleStatusMessagePacket(&event);
-                    break;
-                case IdRoomInformation:
-                    HandleRoomInformationPacket(&event);
-                    break;
-                case IdJoinSuccess:
-                case IdJoinSuccessAsMod:
-                    // The join request was successful, we are now in the room.
-                    // If we joined successfully, there must be at least one client in the room: us.
-                    ASSERT_MSG(member_information.size() > 0,
-                               "We have not yet received member information.");
-                    HandleJoinPacket(&event); // Get the MAC Address for the client
-                    if (event.packet->data[0] == IdJoinSuccessAsMod) {
-                        SetState(State::Moderator);
-                    } else {
-                        SetState(State::Joined);
-                    }
-                    break;
-                case IdModBanListResponse:
-                    HandleModBanListResponsePacket(&event);
-                    break;
-                case IdRoomIsFull:
-                    SetState(State::Idle);
-                    SetError(Error::RoomIsFull);
-                    break;
-                case IdNameCollision:
-                    SetState(State::Idle);
-                    SetError(Error::NameCollision);
-                    break;
-                case IdMacCollision:
-                    SetState(State::Idle);
-                    SetError(Error::MacCollision);
-                    break;
-                case IdConsoleIdCollision:
-                    SetState(State::Idle);
-                    SetError(Error::ConsoleIdCollision);
-                    break;
-                case IdVersionMismatch:
-                    SetState(State::Idle);
-                    SetError(Error::WrongVersion);
-                    break;
-                case IdWrongPassword:
-                    SetState(State::Idle);
-                    SetError(Error::WrongPassword);
-                    break;
-                case IdCloseRoom:
-                    SetState(State::Idle);
-                    SetError(Error::LostConnection);
-                    break;
-                case IdHostKicked:
-                    SetState(State::Idle);
-                    SetError(Error::HostKicked);
-                    break;
-                case IdHostBanned:
-                    SetState(State::Idle);
-                    SetError(Error::HostBanned);
-                    break;
-                case IdModPermissionDenied:
-                    SetError(Error::PermissionDenied);
-                    break;
-                case IdModNoSuchUser:
-                    SetError(Error::NoSuchUser);
-                    break;
-                }
+                DispatchMessage(&event);
                 enet_packet_destroy(event.packet);
                 break;
             case ENET_EVENT_TYPE_DISCONNECT:
@@ -268,11 +286,37 @@ void RoomMember::RoomMemberImpl::MemberLoop() {
     Disconnect();
 };
 
+void RoomMember::RoomMemberImpl::LoopbackMemberLoop() {
+    while (IsConnected()) {
+        for (const auto& loopback_packet : loopback->WaitMemberPackets(16)) {
+            // Wrap the buffer in ENet structures so the one dispatch path and the handlers
+            // work unchanged on both transports; nothing is copied.
+            ENetPacket packet{};
+            packet.data = static_cast<u8*>(const_cast<void*>(loopback_packet->GetData()));
+            packet.dataLength = loopback_packet->GetDataSize();
+            ENetEvent event{};
+            event.type = ENET_EVENT_TYPE_RECEIVE;
+            event.packet = &packet;
+            DispatchMessage(&event);
+        }
+        if (!loopback->IsOpen() && IsConnected()) {
+            SetState(State::Idle);
+            SetError(Error::LostConnection);
+        }
+    }
+    Disconnect();
+}
+
 void RoomMember::RoomMemberImpl::StartLoop() {
     loop_thread = std::make_unique<std::thread>(&RoomMember::RoomMemberImpl::MemberLoop, this);
 }
 
 void RoomMember::RoomMemberImpl::Send(Packet&& packet) {
+    if (loopback) {
+        // Hand the buffer straight to the room's queue: no framing and no send-loop latency.
+        loopback->SendToRoom(std::make_shared<Packet>(std::move(packet)));
+        return;
+    }
     std::lock_guard lock(send_list_mutex);
     send_list.push_back(std::move(packet));
 }
@@ -419,6 +463,13 @@ void RoomMember::RoomMemberImpl::Disconnect() {
     room_information.member_slots = 0;
     room_information.name.clear();
 
+    if (loopback) {
+        // Keep the pointer so sends from other threads stay safe; the closed connection
+        // drops them. Join() resets it before reconnecting.
+        loopback->Disconnect();
+        return;
+    }
+
     if (!server)
         return;
     enet_peer_disconnect(server, 0);
@@ -549,6 +600,22 @@ void RoomMember::Join(const std::string& nick, const std::string& console_id_has
         room_member_impl->loop_thread.reset();
     }
 
+    // A room hosted by this very process is reached directly through the loopback transport
+    // instead of ENet/UDP.
+    room_member_impl->loopback.reset();
+    if (std::strcmp(server_addr, "127.0.0.1") == 0 || std::strcmp(server_addr, "localhost") == 0 ||
+        std::strcmp(server_addr, "::1") == 0) {
+        room_member_impl->loopback = ConnectLoopback(server_port);
+    }
+    if (room_member_impl->loopback) {
+        room_member_impl->SetState(State::Joining);
+        room_member_impl->nickname = nick;
+        room_member_impl->StartLoop();
+        room_member_impl->SendJoinRequest(nick, console_id_hash, preferred_mac, password, token);
+        SendGameInfo(room_member_impl->current_game_info);
+        return;
+    }
+
     if (!room_member_impl->client) {
         room_member_impl->client = enet_host_create(nullptr, 1, NumChannels, 0, 0);
         ASSERT_MSG(room_member_impl->client != nullptr, "Could not create client");
@@ -588,6 +655,11 @@ bool RoomMember::IsConnected() const {
 
 void RoomMember::SendWifiPacket(const WifiPacket& wifi_packet) {
     Packet packet;
+    // Fixed-layout message: message type, frame type, channel, the two MAC addresses and
+    // the length-prefixed frame data. Reserving up front keeps the field writes from
+    // reallocating the buffer.
+    packet.Reserve(3 * sizeof(u8) + 2 * sizeof(MacAddress) + sizeof(u32) +
+                   wifi_packet.data.size());
     packet << static_cast<u8>(IdWifiPacket);
     packet << static_cast<u8>(wifi_packet.type);
     packet << wifi_packet.channel;
@@ -683,8 +755,11 @@ void RoomMember::Leave() {
     room_member_impl->loop_thread->join();
     room_member_impl->loop_thread.reset();
 
-    enet_host_destroy(room_member_impl->client);
-    room_member_impl->client = nullptr;
+    // A loopback member never created an ENet host.
+    if (room_member_impl->client) {
+        enet_host_destroy(room_member_impl->client);
+        room_member_impl->client = nullptr;
+    }
 }
 
 template void RoomMember::Unbind(CallbackHandle<WifiPacket>);
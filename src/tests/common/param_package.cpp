@@ -24,4 +24,24 @@ TEST_CASE("ParamPackage", "[common]") {
     REQUIRE(copy.Get("abc", 42) == 42);
 }
 
+TEST_CASE("ParamPackage equality", "[common]") {
+    ParamPackage a{{"engine", "sdl"}, {"port", "0"}};
+
+    // Insertion order must not affect equality or the hash
+    ParamPackage b;
+    b.Set("port", 0);
+    b.Set("engine", "sdl");
+    REQUIRE(a == b);
+    REQUIRE(a.Hash() == b.Hash());
+
+    b.Set("port", 1);
+    REQUIRE(a != b);
+
+    b.Set("port", 0);
+    REQUIRE(a == b);
+
+    b.Erase("engine");
+    REQUIRE(a != b);
+}
+
 } // namespace Common
@@ -0,0 +1,49 @@
+// Copyright 2025 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include "common/string_util.h"
+
+namespace Common {
+
+TEST_CASE("UTF16 conversion round trip", "[common]") {
+    // ASCII, two-byte, three-byte and astral (surrogate pair) codepoints
+    const std::string utf8 = "sdmc:/Nintendo 3DS/\xC3\xA9\xE3\x81\x82\xF0\x9F\x8E\xAE";
+    const std::u16string utf16 = u"sdmc:/Nintendo 3DS/éあ\U0001F3AE";
+
+    REQUIRE(UTF8ToUTF16(utf8) == utf16);
+    REQUIRE(UTF16ToUTF8(utf16) == utf8);
+    REQUIRE(UTF16ToUTF8(UTF8ToUTF16(utf8)) == utf8);
+}
+
+TEST_CASE("UTF16 conversion error handling", "[common]") {
+    // An unpaired lead surrogate becomes the replacement character
+    const std::u16string unpaired{u'a', char16_t{0xD800}, u'b'};
+    REQUIRE(UTF16ToUTF8(unpaired) == "a\xEF\xBF\xBD"
+                                     "b");
+
+    // Truncated and overlong UTF-8 sequences become the replacement character
+    REQUIRE(UTF8ToUTF16("a\xE3\x81") == u"a��");
+    REQUIRE(UTF8ToUTF16("\xC0\xAF") == u"�");
+}
+
+TEST_CASE("UTF16 conversion into caller buffers", "[common]") {
+    const std::u16string utf16 = u"abcあ";
+
+    std::array<char, 16> buffer{};
+    REQUIRE(UTF16ToUTF8(utf16, buffer) == 6);
+    REQUIRE(std::string_view(buffer.data(), 6) == "abc\xE3\x81\x82");
+
+    // A too-small buffer truncates at a codepoint boundary
+    std::array<char, 4> small{};
+    REQUIRE(UTF16ToUTF8(utf16, small) == 3);
+    REQUIRE(std::string_view(small.data(), 3) == "abc");
+
+    std::array<char16_t, 8> wide{};
+    REQUIRE(UTF8ToUTF16("abc\xE3\x81\x82", wide) == 4);
+    REQUIRE(std::u16string_view(wide.data(), 4) == utf16);
+}
+
+} // namespace Common
@@ -0,0 +1,93 @@
+// Copyright 2024 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <memory>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <nihstro/inline_assembly.h>
+#include "common/arch.h"
+#include "video_core/shader/shader_interpreter.h"
+#if CITRA_ARCH(x86_64)
+#include "video_core/shader/shader_jit_x64_compiler.h"
+#endif
+
+using float24 = Pica::float24;
+using ShaderInterpreter = Pica::Shader::InterpreterEngine;
+#if CITRA_ARCH(x86_64)
+using JitShader = Pica::Shader::JitShader;
+#endif
+
+using DestRegister = nihstro::DestRegister;
+using OpCode = nihstro::OpCode;
+using SourceRegister = nihstro::SourceRegister;
+using Type = nihstro::InlineAsm::Type;
+
+static std::unique_ptr<Pica::Shader::ShaderSetup> CompileShaderSetup(
+    std::initializer_list<nihstro::InlineAsm> code) {
+    const auto shbin = nihstro::InlineAsm::CompileToRawBinary(code);
+
+    auto shader = std::make_unique<Pica::Shader::ShaderSetup>();
+
+    std::transform(shbin.program.begin(), shbin.program.end(), shader->program_code.begin(),
+                   [](const auto& x) { return x.hex; });
+    std::transform(shbin.swizzle_table.begin(), shbin.swizzle_table.end(),
+                   shader->swizzle_data.begin(), [](const auto& x) { return x.hex; });
+
+    return shader;
+}
+
+TEST_CASE("Vertex shader throughput", "[video_core][shader][!benchmark]") {
+    const auto sh_input0 = SourceRegister::MakeInput(0);
+    const auto sh_input1 = SourceRegister::MakeInput(1);
+    const auto sh_temp0 = SourceRegister::MakeTemporary(0);
+    const auto sh_temp1 = SourceRegister::MakeTemporary(1);
+    const auto sh_output = DestRegister::MakeOutput(0);
+
+    // A short arithmetic body repeated by a loop approximates the per-vertex mix of
+    // transform and lighting accumulation work found in game vertex programs, without
+    // needing a captured shader dump checked into the repository.
+    auto shader_setup = CompileShaderSetup({
+        // clang-format off
+        {OpCode::Id::MOV, sh_temp0, sh_input0},
+        {OpCode::Id::MOV, sh_temp1, sh_input1},
+        {OpCode::Id::LOOP, 0},
+            {OpCode::Id::MUL, sh_temp1, sh_temp1, sh_input0},
+            {OpCode::Id::ADD, sh_temp0, sh_temp0, sh_temp1},
+            {OpCode::Id::MAX, sh_temp1, sh_temp1, sh_input1},
+        {Type::EndLoop},
+        {OpCode::Id::ADD, sh_output, sh_temp0, sh_temp1},
+        {OpCode::Id::END},
+        // clang-format on
+    });
+    shader_setup->uniforms.i[0] = {15, 0, 1, 0};
+
+    const auto set_inputs = [](Pica::Shader::UnitState& unit) {
+        for (std::size_t i = 0; i < 4; i++) {
+            unit.registers.input[0][i] = float24::FromFloat32(0.9f);
+            unit.registers.input[1][i] = float24::FromFloat32(0.25f);
+        }
+    };
+
+    ShaderInterpreter shader_interpreter;
+    shader_interpreter.SetupBatch(*shader_setup, 0);
+
+    Pica::Shader::UnitState shader_unit;
+    set_inputs(shader_unit);
+
+    BENCHMARK("InterpreterEngine") {
+        shader_interpreter.Run(*shader_setup, shader_unit);
+        return shader_unit.registers.output[0].x.ToFloat32();
+    };
+
+#if CITRA_ARCH(x86_64)
+    JitShader shader_jit;
+    shader_jit.Compile(&shader_setup->program_code, &shader_setup->swizzle_data);
+
+    BENCHMARK("JitShader") {
+        shader_jit.Run(*shader_setup, shader_unit, 0);
+        return shader_unit.registers.output[0].x.ToFloat32();
+    };
+#endif
+}
@@ -0,0 +1,45 @@
+// Copyright 2024 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <numeric>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "video_core/rasterizer_cache/texture_codec.h"
+
+using VideoCore::PixelFormat;
+
+TEST_CASE("Texture codec throughput", "[video_core][!benchmark]") {
+    // 256x256 is a common size for game texture uploads and large enough to exceed L1.
+    constexpr u32 width = 256;
+    constexpr u32 height = 256;
+
+    constexpr u32 rgba8_size = width * height * 4;
+    std::vector<u8> rgba8_tiled(rgba8_size);
+    std::vector<u8> rgba8_linear(rgba8_size);
+    std::iota(rgba8_tiled.begin(), rgba8_tiled.end(), u8{0});
+
+    BENCHMARK("MortonCopy RGBA8 unswizzle") {
+        VideoCore::MortonCopy<true, PixelFormat::RGBA8>(width, height, 0, rgba8_size, rgba8_linear,
+                                                        rgba8_tiled);
+        return rgba8_linear[0];
+    };
+
+    BENCHMARK("MortonCopy RGBA8 swizzle") {
+        VideoCore::MortonCopy<false, PixelFormat::RGBA8>(width, height, 0, rgba8_size,
+                                                         rgba8_linear, rgba8_tiled);
+        return rgba8_tiled[0];
+    };
+
+    constexpr u32 rgb565_size = width * height * 2;
+    std::vector<u8> rgb565_tiled(rgb565_size);
+    std::vector<u8> rgb565_linear(rgb565_size);
+    std::iota(rgb565_tiled.begin(), rgb565_tiled.end(), u8{0});
+
+    BENCHMARK("MortonCopy RGB565 unswizzle") {
+        VideoCore::MortonCopy<true, PixelFormat::RGB565>(width, height, 0, rgb565_size,
+                                                         rgb565_linear, rgb565_tiled);
+        return rgb565_linear[0];
+    };
+}
@@ -113,6 +113,254 @@ static void WriteUniformFloatReg(ShaderRegs& config, Shader::ShaderSetup& setup,
     }
 }
 
+/**
+ * Checks whether a run of register writes stays within one of the data-FIFO mirror ranges
+ * games use for uniform, shader program and LUT uploads. The handlers of these registers
+ * depend only on their own internal write counter and treat all mirrors identically, so such
+ * a run can be dispatched as one batch by WritePicaRegRun, whether it auto-increments through
+ * the mirrors or hammers a single one.
+ */
+static bool IsBurstRange(u32 first_id, u32 last_id) {
+    const auto within = [first_id, last_id](u32 base) {
+        return first_id >= base && last_id < base + 8;
+    };
+    return within(PICA_REG_INDEX(gs.uniform_setup.set_value[0])) ||
+           within(PICA_REG_INDEX(gs.program.set_word[0])) ||
+           within(PICA_REG_INDEX(gs.swizzle_patterns.set_word[0])) ||
+           within(PICA_REG_INDEX(vs.uniform_setup.set_value[0])) ||
+           within(PICA_REG_INDEX(vs.program.set_word[0])) ||
+           within(PICA_REG_INDEX(vs.swizzle_patterns.set_word[0])) ||
+           within(PICA_REG_INDEX(lighting.lut_data[0])) ||
+           within(PICA_REG_INDEX(texturing.fog_lut_data[0])) ||
+           within(PICA_REG_INDEX(texturing.proctex_lut_data[0]));
+}
+
+/**
+ * Writes a full-mask run of values to one of the data-FIFO register ranges accepted by
+ * IsBurstRange, bypassing the per-word dispatch in WritePicaReg: the register id is decoded
+ * once for the whole run and the rasterizer is notified once at the end, which is equivalent
+ * because the dirty state these registers feed does not depend on the individual values.
+ * Must not be called while a debug context is attached or Pica tracing is active, since it
+ * skips the per-write debugger hooks.
+ */
+static void WritePicaRegRun(u32 first_id, bool grouped, u32 first_value, const u32* extra,
+                            u32 extra_count) {
+    auto& regs = g_state.regs;
+
+    // Keep the register file in the same state individual writes would leave it in.
+    if (grouped) {
+        regs.reg_array[first_id] = first_value;
+        for (u32 i = 0; i < extra_count; ++i) {
+            regs.reg_array[first_id + i + 1] = extra[i];
+        }
+    } else {
+        regs.reg_array[first_id] = extra_count > 0 ? extra[extra_count - 1] : first_value;
+    }
+
+    const auto for_each_value = [first_value, extra, extra_count](auto&& write) {
+        write(first_value);
+        for (u32 i = 0; i < extra_count; ++i) {
+            write(extra[i]);
+        }
+    };
+
+    switch (first_id) {
+    case PICA_REG_INDEX(gs.uniform_setup.set_value[0]):
+    case PICA_REG_INDEX(gs.uniform_setup.set_value[1]):
+    case PICA_REG_INDEX(gs.uniform_setup.set_value[2]):
+    case PICA_REG_INDEX(gs.uniform_setup.set_value[3]):
+    case PICA_REG_INDEX(gs.uniform_setup.set_value[4]):
+    case PICA_REG_INDEX(gs.uniform_setup.set_value[5]):
+    case PICA_REG_INDEX(gs.uniform_setup.set_value[6]):
+    case PICA_REG_INDEX(gs.uniform_setup.set_value[7]):
+        for_each_value([](u32 value) {
+            WriteUniformFloatReg(g_state.regs.gs, g_state.gs, g_state.gs_float_regs_counter,
+                                 g_state.gs_uniform_write_buffer, value);
+        });
+        break;
+
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[0]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[1]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[2]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[3]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[4]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[5]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[6]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[7]):
+        for_each_value([](u32 value) {
+            WriteUniformFloatReg(g_state.regs.vs, g_state.vs, g_state.vs_float_regs_counter,
+                                 g_state.vs_uniform_write_buffer, value);
+        });
+        break;
+
+    case PICA_REG_INDEX(gs.program.set_word[0]):
+    case PICA_REG_INDEX(gs.program.set_word[1]):
+    case PICA_REG_INDEX(gs.program.set_word[2]):
+    case PICA_REG_INDEX(gs.program.set_word[3]):
+    case PICA_REG_INDEX(gs.program.set_word[4]):
+    case PICA_REG_INDEX(gs.program.set_word[5]):
+    case PICA_REG_INDEX(gs.program.set_word[6]):
+    case PICA_REG_INDEX(gs.program.set_word[7]):
+        for_each_value([&regs](u32 value) {
+            u32& offset = regs.gs.program.offset;
+            if (offset >= 4096) {
+                LOG_ERROR(HW_GPU, "Invalid GS program offset {}", offset);
+            } else {
+                g_state.gs.program_code[offset] = value;
+                offset++;
+            }
+        });
+        g_state.gs.MarkProgramCodeDirty();
+        break;
+
+    case PICA_REG_INDEX(vs.program.set_word[0]):
+    case PICA_REG_INDEX(vs.program.set_word[1]):
+    case PICA_REG_INDEX(vs.program.set_word[2]):
+    case PICA_REG_INDEX(vs.program.set_word[3]):
+    case PICA_REG_INDEX(vs.program.set_word[4]):
+    case PICA_REG_INDEX(vs.program.set_word[5]):
+    case PICA_REG_INDEX(vs.program.set_word[6]):
+    case PICA_REG_INDEX(vs.program.set_word[7]):
+        for_each_value([&regs](u32 value) {
+            u32& offset = regs.vs.program.offset;
+            if (offset >= 512) {
+                LOG_ERROR(HW_GPU, "Invalid VS program offset {}", offset);
+            } else {
+                g_state.vs.program_code[offset] = value;
+                if (!regs.pipeline.gs_unit_exclusive_configuration) {
+                    g_state.gs.program_code[offset] = value;
+                }
+                offset++;
+            }
+        });
+        g_state.vs.MarkProgramCodeDirty();
+        if (!regs.pipeline.gs_unit_exclusive_configuration) {
+            g_state.gs.MarkProgramCodeDirty();
+        }
+        break;
+
+    case PICA_REG_INDEX(gs.swizzle_patterns.set_word[0]):
+    case PICA_REG_INDEX(gs.swizzle_patterns.set_word[1]):
+    case PICA_REG_INDEX(gs.swizzle_patterns.set_word[2]):
+    case PICA_REG_INDEX(gs.swizzle_patterns.set_word[3]):
+    case PICA_REG_INDEX(gs.swizzle_patterns.set_word[4]):
+    case PICA_REG_INDEX(gs.swizzle_patterns.set_word[5]):
+    case PICA_REG_INDEX(gs.swizzle_patterns.set_word[6]):
+    case PICA_REG_INDEX(gs.swizzle_patterns.set_word[7]):
+        for_each_value([&regs](u32 value) {
+            u32& offset = regs.gs.swizzle_patterns.offset;
+            if (offset >= g_state.gs.swizzle_data.size()) {
+                LOG_ERROR(HW_GPU, "Invalid GS swizzle pattern offset {}", offset);
+            } else {
+                g_state.gs.swizzle_data[offset] = value;
+                offset++;
+            }
+        });
+        g_state.gs.MarkSwizzleDataDirty();
+        break;
+
+    case PICA_REG_INDEX(vs.swizzle_patterns.set_word[0]):
+    case PICA_REG_INDEX(vs.swizzle_patterns.set_word[1]):
+    case PICA_REG_INDEX(vs.swizzle_patterns.set_word[2]):
+    case PICA_REG_INDEX(vs.swizzle_patterns.set_word[3]):
+    case PICA_REG_INDEX(vs.swizzle_patterns.set_word[4]):
+    case PICA_REG_INDEX(vs.swizzle_patterns.set_word[5]):
+    case PICA_REG_INDEX(vs.swizzle_patterns.set_word[6]):
+    case PICA_REG_INDEX(vs.swizzle_patterns.set_word[7]):
+        for_each_value([&regs](u32 value) {
+            u32& offset = regs.vs.swizzle_patterns.offset;
+            if (offset >= g_state.vs.swizzle_data.size()) {
+                LOG_ERROR(HW_GPU, "Invalid VS swizzle pattern offset {}", offset);
+            } else {
+                g_state.vs.swizzle_data[offset] = value;
+                if (!regs.pipeline.gs_unit_exclusive_configuration) {
+                    g_state.gs.swizzle_data[offset] = value;
+                }
+                offset++;
+            }
+        });
+        g_state.vs.MarkSwizzleDataDirty();
+        if (!regs.pipeline.gs_unit_exclusive_configuration) {
+            g_state.gs.MarkSwizzleDataDirty();
+        }
+        break;
+
+    case PICA_REG_INDEX(lighting.lut_data[0]):
+    case PICA_REG_INDEX(lighting.lut_data[1]):
+    case PICA_REG_INDEX(lighting.lut_data[2]):
+    case PICA_REG_INDEX(lighting.lut_data[3]):
+    case PICA_REG_INDEX(lighting.lut_data[4]):
+    case PICA_REG_INDEX(lighting.lut_data[5]):
+    case PICA_REG_INDEX(lighting.lut_data[6]):
+    case PICA_REG_INDEX(lighting.lut_data[7]): {
+        auto& lut_config = regs.lighting.lut_config;
+        for_each_value([&lut_config](u32 value) {
+            ASSERT_MSG(lut_config.index < 256, "lut_config.index exceeded maximum value of 255!");
+            g_state.lighting.SetLutEntry(lut_config.type, lut_config.index, value);
+            lut_config.index.Assign(lut_config.index + 1);
+        });
+        break;
+    }
+
+    case PICA_REG_INDEX(texturing.fog_lut_data[0]):
+    case PICA_REG_INDEX(texturing.fog_lut_data[1]):
+    case PICA_REG_INDEX(texturing.fog_lut_data[2]):
+    case PICA_REG_INDEX(texturing.fog_lut_data[3]):
+    case PICA_REG_INDEX(texturing.fog_lut_data[4]):
+    case PICA_REG_INDEX(texturing.fog_lut_data[5]):
+    case PICA_REG_INDEX(texturing.fog_lut_data[6]):
+    case PICA_REG_INDEX(texturing.fog_lut_data[7]):
+        for_each_value([&regs](u32 value) {
+            g_state.fog.lut[regs.texturing.fog_lut_offset % 128].raw = value;
+            regs.texturing.fog_lut_offset.Assign(regs.texturing.fog_lut_offset + 1);
+        });
+        break;
+
+    case PICA_REG_INDEX(texturing.proctex_lut_data[0]):
+    case PICA_REG_INDEX(texturing.proctex_lut_data[1]):
+    case PICA_REG_INDEX(texturing.proctex_lut_data[2]):
+    case PICA_REG_INDEX(texturing.proctex_lut_data[3]):
+    case PICA_REG_INDEX(texturing.proctex_lut_data[4]):
+    case PICA_REG_INDEX(texturing.proctex_lut_data[5]):
+    case PICA_REG_INDEX(texturing.proctex_lut_data[6]):
+    case PICA_REG_INDEX(texturing.proctex_lut_data[7]): {
+        auto& index = regs.texturing.proctex_lut_config.index;
+        auto& pt = g_state.proctex;
+
+        // The referenced table cannot change mid-run, so resolve it once.
+        const auto write_table = [&index, &for_each_value](auto& table) {
+            for_each_value([&index, &table](u32 value) {
+                table[index % table.size()].raw = value;
+                index.Assign(index + 1);
+            });
+        };
+        switch (regs.texturing.proctex_lut_config.ref_table.Value()) {
+        case TexturingRegs::ProcTexLutTable::Noise:
+            write_table(pt.noise_table);
+            break;
+        case TexturingRegs::ProcTexLutTable::ColorMap:
+            write_table(pt.color_map_table);
+            break;
+        case TexturingRegs::ProcTexLutTable::AlphaMap:
+            write_table(pt.alpha_map_table);
+            break;
+        case TexturingRegs::ProcTexLutTable::Color:
+            write_table(pt.color_table);
+            break;
+        case TexturingRegs::ProcTexLutTable::ColorDiff:
+            write_table(pt.color_diff_table);
+            break;
+        }
+        break;
+    }
+
+    default:
+        UNREACHABLE_MSG("Unhandled burst register 0x{:03X}", first_id);
+    }
+
+    VideoCore::g_renderer->Rasterizer()->NotifyPicaRegisterChanged(first_id);
+}
+
 static void WritePicaReg(u32 id, u32 value, u32 mask) {
     auto& regs = g_state.regs;
 
@@ -343,16 +591,16 @@ static void WritePicaReg(u32 id, u32 value, u32 mask) {
 
         DebugUtils::MemoryAccessTracker memory_accesses;
 
-        // Simple circular-replacement vertex cache
-        // The size has been tuned for optimal balance between hit-rate and the cost of lookup
-        const std::size_t VERTEX_CACHE_SIZE = 32;
+        // Post-transform vertex cache, direct-mapped by the low bits of the index value.
+        // Strip-order meshes reference each vertex two or three times with nearby indices,
+        // which land in distinct slots, so the hit rate matches the old scanning cache while
+        // the lookup is a single compare instead of a walk over every entry.
+        const std::size_t VERTEX_CACHE_SIZE = 64;
         std::array<bool, VERTEX_CACHE_SIZE> vertex_cache_valid{};
         std::array<u16, VERTEX_CACHE_SIZE> vertex_cache_ids;
         std::array<Shader::AttributeBuffer, VERTEX_CACHE_SIZE> vertex_cache;
         Shader::AttributeBuffer vs_output;
 
-        unsigned int vertex_cache_pos = 0;
-
         auto* shader_engine = Shader::GetEngine();
         Shader::UnitState shader_unit;
 
@@ -383,12 +631,10 @@ static void WritePicaReg(u32 id, u32 value, u32 mask) {
                                               size);
                 }
 
-                for (unsigned int i = 0; i < VERTEX_CACHE_SIZE; ++i) {
-                    if (vertex_cache_valid[i] && vertex == vertex_cache_ids[i]) {
-                        vs_output = vertex_cache[i];
-                        vertex_cache_hit = true;
-                        break;
-                    }
+                const std::size_t slot = vertex & (VERTEX_CACHE_SIZE - 1);
+                if (vertex_cache_valid[slot] && vertex == vertex_cache_ids[slot]) {
+                    vs_output = vertex_cache[slot];
+                    vertex_cache_hit = true;
                 }
             }
 
@@ -406,10 +652,10 @@ static void WritePicaReg(u32 id, u32 value, u32 mask) {
                 shader_unit.WriteOutput(regs.vs, vs_output);
 
                 if (is_indexed) {
-                    vertex_cache[vertex_cache_pos] = vs_output;
-                    vertex_cache_valid[vertex_cache_pos] = true;
-                    vertex_cache_ids[vertex_cache_pos] = vertex;
-                    vertex_cache_pos = (vertex_cache_pos + 1) % VERTEX_CACHE_SIZE;
+                    const std::size_t slot = vertex & (VERTEX_CACHE_SIZE - 1);
+                    vertex_cache[slot] = vs_output;
+                    vertex_cache_valid[slot] = true;
+                    vertex_cache_ids[slot] = static_cast<u16>(vertex);
                 }
             }
 
@@ -585,7 +831,7 @@ static void WritePicaReg(u32 id, u32 value, u32 mask) {
 
         ASSERT_MSG(lut_config.index < 256, "lut_config.index exceeded maximum value of 255!");
 
-        g_state.lighting.luts[lut_config.type][lut_config.index].raw = value;
+        g_state.lighting.SetLutEntry(lut_config.type, lut_config.index, value);
         lut_config.index.Assign(lut_config.index + 1);
         break;
     }
@@ -666,6 +912,20 @@ void ProcessCommandList(PAddr list, u32 size) {
         u32 value = *g_state.cmd_list.current_ptr++;
         const CommandHeader header = {*g_state.cmd_list.current_ptr++};
 
+        // Take the batch path for full-mask runs into the data-FIFO registers (uniform,
+        // shader program and LUT uploads), which decodes the register once for the whole
+        // run. The debugger hooks fire per write, so fall back while one is attached.
+        const u32 last_id =
+            header.cmd_id + (header.group_commands ? header.extra_data_length : 0);
+        if (header.extra_data_length > 0 && header.parameter_mask == 0xf &&
+            IsBurstRange(header.cmd_id, last_id) && !g_debug_context &&
+            !DebugUtils::IsPicaTracing()) {
+            WritePicaRegRun(header.cmd_id, header.group_commands, value,
+                            g_state.cmd_list.current_ptr, header.extra_data_length);
+            g_state.cmd_list.current_ptr += header.extra_data_length;
+            continue;
+        }
+
         WritePicaReg(header.cmd_id, value, header.parameter_mask);
 
         for (unsigned i = 0; i < header.extra_data_length; ++i) {
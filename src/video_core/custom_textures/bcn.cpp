@@ -0,0 +1,130 @@
+// Copyright 2026 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include "common/assert.h"
+#include "video_core/custom_textures/bcn.h"
+
+namespace VideoCore {
+
+namespace {
+
+/// One 4x4 tile of RGBA8 texels gathered from the source image
+using Block = std::array<std::array<u8, 4>, 16>;
+
+u16 PackRGB565(u32 r, u32 g, u32 b) {
+    return static_cast<u16>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+/// Encodes the 8-byte BC3 alpha block: two endpoint values and 16 3-bit ramp indices.
+void EncodeAlphaBlock(const Block& block, u8* out) {
+    u8 min_a = 255;
+    u8 max_a = 0;
+    for (const auto& texel : block) {
+        min_a = std::min(min_a, texel[3]);
+        max_a = std::max(max_a, texel[3]);
+    }
+
+    // Use the 8-value ramp (a0 > a1); with equal endpoints every index decodes to the same value.
+    out[0] = max_a;
+    out[1] = min_a;
+
+    u64 indices = 0;
+    const u32 range = max_a - min_a;
+    if (range != 0) {
+        for (std::size_t i = 0; i < block.size(); i++) {
+            // Ramp position from a1 (0) to a0 (7), then mapped to the BC3 index ordering
+            // where index 0 decodes to a0, index 1 to a1 and 2-7 interpolate from a0 down.
+            const u32 pos = ((block[i][3] - min_a) * 7 + range / 2) / range;
+            const u64 index = pos == 7 ? 0 : (pos == 0 ? 1 : 8 - pos);
+            indices |= index << (3 * i);
+        }
+    }
+    for (std::size_t i = 0; i < 6; i++) {
+        out[2 + i] = static_cast<u8>(indices >> (8 * i));
+    }
+}
+
+/// Encodes the 8-byte color block: two RGB565 endpoints and 16 2-bit indices. The endpoints
+/// are the inset bounding box of the block and texels are projected onto the endpoint axis.
+void EncodeColorBlock(const Block& block, u8* out) {
+    std::array<u8, 3> min_c = {255, 255, 255};
+    std::array<u8, 3> max_c = {0, 0, 0};
+    for (const auto& texel : block) {
+        for (std::size_t c = 0; c < 3; c++) {
+            min_c[c] = std::min(min_c[c], texel[c]);
+            max_c[c] = std::max(max_c[c], texel[c]);
+        }
+    }
+
+    // Inset the bounding box to reduce the error outlier texels cause on the interior.
+    for (std::size_t c = 0; c < 3; c++) {
+        const u8 inset = static_cast<u8>((max_c[c] - min_c[c]) >> 4);
+        min_c[c] = static_cast<u8>(min_c[c] + inset);
+        max_c[c] = static_cast<u8>(max_c[c] - inset);
+    }
+
+    const u16 c0 = PackRGB565(max_c[0], max_c[1], max_c[2]);
+    const u16 c1 = PackRGB565(min_c[0], min_c[1], min_c[2]);
+    out[0] = static_cast<u8>(c0);
+    out[1] = static_cast<u8>(c0 >> 8);
+    out[2] = static_cast<u8>(c1);
+    out[3] = static_cast<u8>(c1 >> 8);
+
+    u32 indices = 0;
+    s32 len2 = 0;
+    std::array<s32, 3> dir{};
+    for (std::size_t c = 0; c < 3; c++) {
+        dir[c] = max_c[c] - min_c[c];
+        len2 += dir[c] * dir[c];
+    }
+    if (c0 != c1 && len2 != 0) {
+        for (std::size_t i = 0; i < block.size(); i++) {
+            s32 dot = 0;
+            for (std::size_t c = 0; c < 3; c++) {
+                dot += (block[i][c] - min_c[c]) * dir[c];
+            }
+            // Quantized position from c1 (0) to c0 (3), mapped to the BC index ordering
+            // 0 = c0, 1 = c1, 2 = 2/3 c0 + 1/3 c1, 3 = 1/3 c0 + 2/3 c1.
+            const s32 pos = std::clamp((dot * 3 + len2 / 2) / len2, 0, 3);
+            static constexpr std::array<u32, 4> index_map = {1, 3, 2, 0};
+            indices |= index_map[pos] << (2 * i);
+        }
+    }
+    for (std::size_t i = 0; i < 4; i++) {
+        out[4 + i] = static_cast<u8>(indices >> (8 * i));
+    }
+}
+
+} // Anonymous namespace
+
+std::vector<u8> CompressBC3(std::span<const u8> rgba, u32 width, u32 height) {
+    ASSERT(width % 4 == 0 && height % 4 == 0);
+    ASSERT(rgba.size() >= std::size_t(width) * height * 4);
+
+    const u32 blocks_x = width / 4;
+    const u32 blocks_y = height / 4;
+    std::vector<u8> output(std::size_t(blocks_x) * blocks_y * 16);
+    u8* out = output.data();
+
+    Block block;
+    for (u32 by = 0; by < blocks_y; by++) {
+        for (u32 bx = 0; bx < blocks_x; bx++) {
+            for (u32 y = 0; y < 4; y++) {
+                const u8* row = rgba.data() + ((by * 4 + y) * width + bx * 4) * 4;
+                for (u32 x = 0; x < 4; x++) {
+                    std::memcpy(block[y * 4 + x].data(), row + x * 4, 4);
+                }
+            }
+            EncodeAlphaBlock(block, out);
+            EncodeColorBlock(block, out + 8);
+            out += 16;
+        }
+    }
+    return output;
+}
+
+} // namespace VideoCore
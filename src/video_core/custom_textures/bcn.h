@@ -0,0 +1,22 @@
+// Copyright 2026 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include "common/common_types.h"
+
+namespace VideoCore {
+
+/**
+ * Compresses an RGBA8 image into BC3 blocks using a fast range-fit encoder.
+ * @param rgba The source pixel data, width * height * 4 bytes.
+ * @param width Width of the image, must be a multiple of 4.
+ * @param height Height of the image, must be a multiple of 4.
+ * @return The compressed blocks, 16 bytes per 4x4 block.
+ */
+std::vector<u8> CompressBC3(std::span<const u8> rgba, u32 width, u32 height);
+
+} // namespace VideoCore
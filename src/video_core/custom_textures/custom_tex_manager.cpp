@@ -23,6 +23,21 @@ MICROPROFILE_DEFINE(CustomTexManager_TickFrame, "CustomTexManager", "TickFrame",
                     MP_RGB(54, 16, 32));
 
 constexpr std::size_t MAX_UPLOADS_PER_TICK = 8;
+constexpr std::size_t MAX_PRELOADS_PER_TICK = 4;
+
+/// Upper bound on the pixel data held by dump requests the workers haven't written out yet.
+/// When the disk can't keep up, new surfaces are skipped (and retried later) instead of
+/// queueing frames worth of copies.
+constexpr u64 MAX_PENDING_DUMP_MEMORY = 256 * 1024 * 1024;
+
+u64 GetMaxPreloadMemory() {
+    const u64 sys_mem = Common::GetMemInfo().total_physical_memory;
+    const u64 recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
+
+    // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other
+    // cases
+    return (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+}
 
 bool IsPow2(u32 value) {
     return value != 0 && (value & (value - 1)) == 0;
@@ -60,6 +75,7 @@ void CustomTexManager::TickFrame() {
     if (!textures_loaded) {
         return;
     }
+    TickBackgroundPreload();
     std::size_t num_uploads = 0;
     for (auto it = async_uploads.begin(); it != async_uploads.end();) {
         if (num_uploads >= MAX_UPLOADS_PER_TICK) {
@@ -112,6 +128,9 @@ void CustomTexManager::FindCustomTextures() {
         if (!ParseFilename(file, texture)) {
             continue;
         }
+        if (compress_textures) {
+            texture->compress_format = compress_format;
+        }
         for (const u64 hash : texture->hashes) {
             auto& material = material_map[hash];
             if (!material) {
@@ -121,9 +140,46 @@ void CustomTexManager::FindCustomTextures() {
             material->AddMapTexture(texture);
         }
     }
+
+    // Warm the pack in the background so most materials are resident before their first use
+    if (async_custom_loading) {
+        preload_queue.reserve(material_map.size());
+        for (auto& [hash, material] : material_map) {
+            preload_queue.push_back(material.get());
+        }
+        preload_max_mem = GetMaxPreloadMemory();
+    }
+
     textures_loaded = true;
 }
 
+void CustomTexManager::TickBackgroundPreload() {
+    if (!async_custom_loading || preload_index >= preload_queue.size()) {
+        return;
+    }
+    if (preload_size_sum > preload_max_mem) {
+        LOG_WARNING(Render, "Stopping background texture preload due to insufficient memory");
+        preload_queue.clear();
+        preload_index = 0;
+        return;
+    }
+    // Trickle a few materials per frame onto the workers; on-demand decodes queued by Decode
+    // interleave with them, so a visible surface is never stuck behind the whole pack.
+    std::size_t num_queued = 0;
+    while (preload_index < preload_queue.size() && num_queued < MAX_PRELOADS_PER_TICK) {
+        Material* const material = preload_queue[preload_index++];
+        if (!material->IsUnloaded()) {
+            continue;
+        }
+        material->state = DecodeState::Pending;
+        workers->QueueWork([material, this] {
+            material->LoadFromDisk(flip_png_files);
+            preload_size_sum += material->size;
+        });
+        num_queued++;
+    }
+}
+
 bool CustomTexManager::ParseFilename(const FileUtil::FSTEntry& file, CustomTexture* texture) {
     auto parts = Common::SplitString(file.virtualName, '.');
     if (parts.size() > 3) {
@@ -192,6 +248,7 @@ void CustomTexManager::WriteConfig() {
     options["skip_mipmap"] = false;
     options["flip_png_files"] = true;
     options["use_new_hash"] = true;
+    options["compress_textures"] = false;
 
     FileUtil::IOFile file{pack_config, "w"};
     const std::string output = json.dump(4);
@@ -202,13 +259,7 @@ void CustomTexManager::PreloadTextures(const std::atomic_bool& stop_run,
                                        const VideoCore::DiskResourceLoadCallback& callback) {
     u64 size_sum = 0;
     size_t preloaded = 0;
-    const u64 sys_mem = Common::GetMemInfo().total_physical_memory;
-    const u64 recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
-
-    // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other
-    // cases
-    const u64 max_mem =
-        (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+    const u64 max_mem = GetMaxPreloadMemory();
 
     workers->QueueWork([&]() {
         for (auto& [hash, material] : material_map) {
@@ -233,25 +284,15 @@ void CustomTexManager::PreloadTextures(const std::atomic_bool& stop_run,
 
 void CustomTexManager::DumpTexture(const SurfaceParams& params, u32 level, std::span<u8> data,
                                    u64 data_hash) {
-    const u64 program_id = system.Kernel().GetCurrentProcess()->codeset->program_id;
+    if (dumped_textures.contains(data_hash)) {
+        return;
+    }
+
     const u32 data_size = static_cast<u32>(data.size());
     const u32 width = params.width;
     const u32 height = params.height;
     const PixelFormat format = params.pixel_format;
 
-    std::string dump_path = fmt::format(
-        "{}textures/{:016X}/", FileUtil::GetUserPath(FileUtil::UserPath::DumpDir), program_id);
-    if (!FileUtil::CreateFullPath(dump_path)) {
-        LOG_ERROR(Render, "Unable to create {}", dump_path);
-        return;
-    }
-
-    dump_path +=
-        fmt::format("tex1_{}x{}_{:016X}_{}_mip{}.png", width, height, data_hash, format, level);
-    if (dumped_textures.contains(data_hash) || FileUtil::Exists(dump_path)) {
-        return;
-    }
-
     // Make sure the texture size is a power of 2.
     // If not, the surface is probably a framebuffer
     if (!IsPow2(width) || !IsPow2(height)) {
@@ -260,18 +301,48 @@ void CustomTexManager::DumpTexture(const SurfaceParams& params, u32 level, std::
         return;
     }
 
+    // The dump directory is created once per session rather than stat'ed on every call;
+    // this runs on the GPU thread for each new surface during a dump session.
+    if (dump_path.empty()) {
+        const u64 program_id = system.Kernel().GetCurrentProcess()->codeset->program_id;
+        std::string path = fmt::format(
+            "{}textures/{:016X}/", FileUtil::GetUserPath(FileUtil::UserPath::DumpDir), program_id);
+        if (!FileUtil::CreateFullPath(path)) {
+            LOG_ERROR(Render, "Unable to create {}", path);
+            return;
+        }
+        dump_path = std::move(path);
+    }
+
+    // Bound the memory held by dump requests the workers haven't drained yet. Don't mark the
+    // hash as dumped, so a later upload of the same surface retries it.
     const u32 decoded_size = width * height * 4;
+    const u64 dump_bytes = data_size + decoded_size;
+    if (pending_dump_bytes.load(std::memory_order_relaxed) + dump_bytes >
+        MAX_PENDING_DUMP_MEMORY) {
+        return;
+    }
+    pending_dump_bytes.fetch_add(dump_bytes, std::memory_order_relaxed);
+
+    std::string file_path = dump_path + fmt::format("tex1_{}x{}_{:016X}_{}_mip{}.png", width,
+                                                    height, data_hash, format, level);
+
     std::vector<u8> pixels(data_size + decoded_size);
     std::memcpy(pixels.data(), data.data(), data_size);
 
-    auto dump = [this, width, height, params, data_size, decoded_size, pixels = std::move(pixels),
-                 dump_path = std::move(dump_path)]() mutable {
-        const std::span encoded = std::span{pixels}.first(data_size);
-        const std::span decoded = std::span{pixels}.last(decoded_size);
-        DecodeTexture(params, params.addr, params.end, encoded, decoded,
-                      params.type == SurfaceType::Color);
-        Common::FlipRGBA8Texture(decoded, width, height);
-        image_interface.EncodePNG(dump_path, width, height, decoded);
+    auto dump = [this, width, height, params, data_size, decoded_size, dump_bytes,
+                 pixels = std::move(pixels), file_path = std::move(file_path)]() mutable {
+        // The existence check hits the disk, so it belongs here and not on the GPU thread;
+        // it only fires for surfaces already dumped by a previous session.
+        if (!FileUtil::Exists(file_path)) {
+            const std::span encoded = std::span{pixels}.first(data_size);
+            const std::span decoded = std::span{pixels}.last(decoded_size);
+            DecodeTexture(params, params.addr, params.end, encoded, decoded,
+                          params.type == SurfaceType::Color);
+            Common::FlipRGBA8Texture(decoded, width, height);
+            image_interface.EncodePNG(file_path, width, height, decoded);
+        }
+        pending_dump_bytes.fetch_sub(dump_bytes, std::memory_order_relaxed);
     };
     if (!workers) {
         CreateWorkers();
@@ -326,6 +397,10 @@ void CustomTexManager::ReadConfig(const std::string& load_path) {
     flip_png_files = options["flip_png_files"].get<bool>();
     use_new_hash = options["use_new_hash"].get<bool>();
     refuse_dds = skip_mipmap || !use_new_hash;
+    // Optional: transcode PNG textures to a GPU block-compressed format at load. Only takes
+    // effect when the texture runtime reports a format it can sample natively.
+    compress_textures = options.value("compress_textures", false) &&
+                        compress_format != CustomPixelFormat::RGBA8;
 
     const auto& textures = json["textures"];
     for (const auto& material : textures.items()) {
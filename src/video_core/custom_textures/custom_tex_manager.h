@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <span>
 #include <unordered_map>
@@ -56,6 +57,12 @@ public:
     /// Decodes the textures in material to a consumable format and uploads it.
     bool Decode(Material* material, std::function<bool()>&& upload);
 
+    /// Sets the compressed format PNG textures are transcoded to at load, called by the
+    /// texture runtime with a format it can sample natively.
+    void EnableCompression(CustomPixelFormat format) {
+        compress_format = format;
+    }
+
     /// True when mipmap uploads should be skipped (legacy packs only)
     bool SkipMipmaps() const noexcept {
         return skip_mipmap;
@@ -66,7 +73,21 @@ public:
         return use_new_hash;
     }
 
+    /// Returns true if an upload with this sampled fingerprint has already been dumped
+    bool IsFingerprintDumped(u64 fingerprint) const noexcept {
+        return dumped_fingerprints.contains(fingerprint);
+    }
+
+    /// Records the sampled fingerprint of a dumped upload
+    void MarkFingerprintDumped(u64 fingerprint) {
+        dumped_fingerprints.insert(fingerprint);
+    }
+
 private:
+    /// Queues a few unloaded materials for background decoding, called once per frame. Keeps
+    /// first-use hitches rare without blocking boot the way PreloadTextures does.
+    void TickBackgroundPreload();
+
     /// Parses the custom texture filename (hash, material type, etc).
     bool ParseFilename(const FileUtil::FSTEntry& file, CustomTexture* texture);
 
@@ -80,11 +101,20 @@ private:
     Core::System& system;
     Frontend::ImageInterface& image_interface;
     std::unordered_set<u64> dumped_textures;
+    std::unordered_set<u64> dumped_fingerprints;
     std::unordered_map<u64, std::unique_ptr<Material>> material_map;
     std::unordered_map<std::string, std::vector<u64>> path_to_hash_map;
     std::vector<std::unique_ptr<CustomTexture>> custom_textures;
+    std::vector<Material*> preload_queue;
+    std::size_t preload_index{};
+    std::atomic<u64> preload_size_sum{};
+    u64 preload_max_mem{};
+    std::string dump_path;
+    std::atomic<u64> pending_dump_bytes{};
     std::list<AsyncUpload> async_uploads;
     std::unique_ptr<Common::ThreadWorker> workers;
+    CustomPixelFormat compress_format{CustomPixelFormat::RGBA8};
+    bool compress_textures{false};
     bool textures_loaded{false};
     bool async_custom_loading{true};
     bool skip_mipmap{true};
@@ -3,9 +3,11 @@
 // Refer to the license.txt file included.
 
 #include "common/file_util.h"
+#include "common/hash.h"
 #include "common/logging/log.h"
 #include "common/texture.h"
 #include "core/frontend/image_interface.h"
+#include "video_core/custom_textures/bcn.h"
 #include "video_core/custom_textures/material.h"
 
 namespace VideoCore {
@@ -36,6 +38,11 @@ CustomPixelFormat ToCustomPixelFormat(ddsktx_format format) {
     }
 }
 
+std::string GetCompressionCachePath(u64 input_hash) {
+    return fmt::format("{}custom_textures/{:016x}.bc3",
+                       FileUtil::GetUserPath(FileUtil::UserPath::CacheDir), input_hash);
+}
+
 std::string_view MapTypeName(MapType type) {
     switch (type) {
     case MapType::Color:
@@ -68,7 +75,11 @@ void CustomTexture::LoadFromDisk(bool flip_png) {
     }
     switch (file_format) {
     case CustomFileFormat::PNG:
-        LoadPNG(input, flip_png);
+        if (compress_format != CustomPixelFormat::RGBA8) {
+            LoadCompressedPNG(input, flip_png);
+        } else {
+            LoadPNG(input, flip_png);
+        }
         break;
     case CustomFileFormat::DDS:
     case CustomFileFormat::KTX:
@@ -90,6 +101,73 @@ void CustomTexture::LoadPNG(std::span<const u8> input, bool flip_png) {
     format = CustomPixelFormat::RGBA8;
 }
 
+void CustomTexture::LoadCompressedPNG(std::span<const u8> input, bool flip_png) {
+    // The cache is keyed by the hash of the png file itself, so edited textures never
+    // hit a stale entry.
+    const u64 input_hash = Common::ComputeHash64(input.data(), input.size());
+    if (LoadCachedCompression(input_hash)) {
+        return;
+    }
+
+    LoadPNG(input, flip_png);
+    if (format != CustomPixelFormat::RGBA8 || data.empty()) {
+        return;
+    }
+    if (width % 4 != 0 || height % 4 != 0) {
+        LOG_DEBUG(Render, "Not compressing {}, dimensions {}x{} are not block aligned", path, width,
+                  height);
+        return;
+    }
+
+    data = CompressBC3(data, width, height);
+    format = CustomPixelFormat::BC3;
+    SaveCachedCompression(input_hash);
+}
+
+bool CustomTexture::LoadCachedCompression(u64 input_hash) {
+    FileUtil::IOFile file{GetCompressionCachePath(input_hash), "rb"};
+    if (!file.IsOpen() || file.GetSize() < 2 * sizeof(u32)) {
+        return false;
+    }
+
+    u32 cached_width;
+    u32 cached_height;
+    if (file.ReadBytes(&cached_width, sizeof(u32)) != sizeof(u32) ||
+        file.ReadBytes(&cached_height, sizeof(u32)) != sizeof(u32)) {
+        return false;
+    }
+    const u64 data_size = file.GetSize() - 2 * sizeof(u32);
+    if (cached_width % 4 != 0 || cached_height % 4 != 0 ||
+        data_size != u64(cached_width / 4) * (cached_height / 4) * 16) {
+        return false;
+    }
+
+    data.resize(data_size);
+    if (file.ReadBytes(data.data(), data.size()) != data.size()) {
+        data.clear();
+        return false;
+    }
+    width = cached_width;
+    height = cached_height;
+    format = CustomPixelFormat::BC3;
+    return true;
+}
+
+void CustomTexture::SaveCachedCompression(u64 input_hash) const {
+    const std::string cache_path = GetCompressionCachePath(input_hash);
+    FileUtil::CreateFullPath(cache_path);
+
+    FileUtil::IOFile file{cache_path, "wb"};
+    if (!file.IsOpen() || file.WriteBytes(&width, sizeof(u32)) != sizeof(u32) ||
+        file.WriteBytes(&height, sizeof(u32)) != sizeof(u32) ||
+        file.WriteBytes(data.data(), data.size()) != data.size()) {
+        LOG_WARNING(Render, "Failed to write compressed texture cache entry {}", cache_path);
+        // A truncated entry would fail the size check above, but don't leave it around
+        file.Close();
+        FileUtil::Delete(cache_path);
+    }
+}
+
 void CustomTexture::LoadDDS(std::span<const u8> input) {
     ddsktx_format dds_format{};
     image_interface.DecodeDDS(data, width, height, dds_format, input);
@@ -50,8 +50,14 @@ public:
 private:
     void LoadPNG(std::span<const u8> input, bool flip_png);
 
+    void LoadCompressedPNG(std::span<const u8> input, bool flip_png);
+
     void LoadDDS(std::span<const u8> input);
 
+    bool LoadCachedCompression(u64 input_hash);
+
+    void SaveCachedCompression(u64 input_hash) const;
+
 public:
     Frontend::ImageInterface& image_interface;
     std::string path;
@@ -60,6 +66,8 @@ public:
     std::vector<u64> hashes;
     std::mutex decode_mutex;
     CustomPixelFormat format;
+    /// When not RGBA8, PNG textures are transcoded to this format after decoding
+    CustomPixelFormat compress_format{CustomPixelFormat::RGBA8};
     CustomFileFormat file_format;
     std::vector<u8> data;
     MapType type;
@@ -47,7 +47,7 @@ private:
 // shader that takes 6 inputs, and the vertex shader outputs 2 attributes, it would take 3 vertices
 // for one geometry shader invocation.
 // TODO: what happens when the input size is not divisible by the output size?
-class GeometryPipeline_Point : public GeometryPipelineBackend {
+class GeometryPipeline_Point final : public GeometryPipelineBackend {
 public:
     GeometryPipeline_Point(const Regs& regs, Shader::GSUnitState& unit) : regs(regs), unit(unit) {
         ASSERT(regs.pipeline.variable_primitive == 0);
@@ -125,7 +125,7 @@ private:
 // In VariablePrimitive mode, vertex attributes are buffered into the uniform registers in the
 // geometry shader unit. The number of vertex is variable, which is specified by the first index
 // value in the batch. This mode is usually used for subdivision.
-class GeometryPipeline_VariablePrimitive : public GeometryPipelineBackend {
+class GeometryPipeline_VariablePrimitive final : public GeometryPipelineBackend {
 public:
     GeometryPipeline_VariablePrimitive(const Regs& regs, Shader::ShaderSetup& setup)
         : regs(regs), setup(setup) {
@@ -220,7 +220,7 @@ private:
 // In FixedPrimitive mode, vertex attributes are buffered into the uniform registers in the geometry
 // shader unit. The number of vertex per shader invocation is constant. This is usually used for
 // particle system.
-class GeometryPipeline_FixedPrimitive : public GeometryPipelineBackend {
+class GeometryPipeline_FixedPrimitive final : public GeometryPipelineBackend {
 public:
     GeometryPipeline_FixedPrimitive(const Regs& regs, Shader::ShaderSetup& setup)
         : regs(regs), setup(setup) {
@@ -365,15 +365,38 @@ void GeometryPipeline::SubmitVertex(const Shader::AttributeBuffer& input) {
         // No backend means the geometry shader is disabled, so we send the vertex shader output
         // directly to the primitive assembler.
         vertex_handler(input);
-    } else {
-        if (backend->SubmitVertex(input)) {
-            shader_engine->Run(state.gs, state.gs_unit);
-
-            // The uniform b15 is set to true after every geometry shader invocation. This is useful
-            // for the shader to know if this is the first invocation in a batch, if the program set
-            // b15 to false first.
-            state.gs.uniforms.b[15] = true;
-        }
+        return;
+    }
+
+    // The backend variant is fixed by gs_config.mode for as long as the backend exists (see
+    // Reconfigure), so dispatch through the concrete final classes here. This lets the compiler
+    // devirtualize and inline the per-vertex buffer append instead of issuing a virtual call for
+    // every vertex the shader unit consumes.
+    bool batch_full;
+    switch (state.regs.pipeline.gs_config.mode) {
+    case PipelineRegs::GSMode::Point:
+        batch_full = static_cast<GeometryPipeline_Point*>(backend.get())->SubmitVertex(input);
+        break;
+    case PipelineRegs::GSMode::VariablePrimitive:
+        batch_full =
+            static_cast<GeometryPipeline_VariablePrimitive*>(backend.get())->SubmitVertex(input);
+        break;
+    case PipelineRegs::GSMode::FixedPrimitive:
+        batch_full =
+            static_cast<GeometryPipeline_FixedPrimitive*>(backend.get())->SubmitVertex(input);
+        break;
+    default:
+        UNREACHABLE();
+        return;
+    }
+
+    if (batch_full) {
+        shader_engine->Run(state.gs, state.gs_unit);
+
+        // The uniform b15 is set to true after every geometry shader invocation. This is useful
+        // for the shader to know if this is the first invocation in a batch, if the program set
+        // b15 to false first.
+        state.gs.uniforms.b[15] = true;
     }
 }
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <vector>
 #include "core/hle/service/gsp/gsp.h"
@@ -44,42 +45,64 @@ public:
         friend class GraphicsDebugger;
     };
 
-    void GXCommandProcessed(u8* command_data) {
+    /// Whether any observer is attached. Callers are expected to check this once per command
+    /// list and skip GXCommandProcessed entirely when it returns false, so the command
+    /// submission path pays a single relaxed load when no debugger widget is open.
+    bool IsActive() const {
+        return has_observers.load(std::memory_order_relaxed);
+    }
+
+    void GXCommandProcessed(const Service::GSP::Command& command) {
         if (observers.empty())
             return;
 
-        gx_command_history.emplace_back();
-        Service::GSP::Command& cmd = gx_command_history.back();
-
-        memcpy(&cmd, command_data, sizeof(Service::GSP::Command));
+        gx_command_history[history_head] = command;
+        history_head = (history_head + 1) % COMMAND_HISTORY_SIZE;
+        history_count = std::min(history_count + 1, COMMAND_HISTORY_SIZE);
 
         ForEachObserver([this](DebuggerObserver* observer) {
-            observer->GXCommandProcessed(static_cast<int>(this->gx_command_history.size()));
+            observer->GXCommandProcessed(static_cast<int>(this->history_count));
         });
     }
 
+    /// Reads the command at the given index, where 0 is the oldest retained command and
+    /// total_command_count - 1 the newest.
     const Service::GSP::Command& ReadGXCommandHistory(int index) const {
-        // TODO: Is this thread-safe?
-        return gx_command_history[index];
+        const std::size_t oldest =
+            (history_head + COMMAND_HISTORY_SIZE - history_count) % COMMAND_HISTORY_SIZE;
+        return gx_command_history[(oldest + index) % COMMAND_HISTORY_SIZE];
     }
 
     void RegisterObserver(DebuggerObserver* observer) {
+        // The history storage is only allocated once a debugger widget actually attaches
+        if (gx_command_history.empty())
+            gx_command_history.resize(COMMAND_HISTORY_SIZE);
+
         // TODO: Check for duplicates
         observers.push_back(observer);
         observer->observed = this;
+        has_observers.store(true, std::memory_order_relaxed);
     }
 
     void UnregisterObserver(DebuggerObserver* observer) {
         observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
         observer->observed = nullptr;
+        has_observers.store(!observers.empty(), std::memory_order_relaxed);
     }
 
 private:
+    /// Number of commands retained; older ones are overwritten in ring-buffer fashion
+    /// instead of growing the history without bound over a session.
+    static constexpr std::size_t COMMAND_HISTORY_SIZE = 4096;
+
     void ForEachObserver(std::function<void(DebuggerObserver*)> func) {
         std::for_each(observers.begin(), observers.end(), func);
     }
 
     std::vector<DebuggerObserver*> observers;
+    std::atomic<bool> has_observers{false};
 
     std::vector<Service::GSP::Command> gx_command_history;
+    std::size_t history_head = 0;
+    std::size_t history_count = 0;
 };
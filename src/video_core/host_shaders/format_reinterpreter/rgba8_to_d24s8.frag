@@ -0,0 +1,20 @@
+// Copyright 2023 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+//? #version 430 core
+#extension GL_ARB_shader_stencil_export : require
+
+layout(location = 0) in mediump vec2 tex_coord;
+
+layout(binding = 0) uniform lowp sampler2D color;
+
+void main() {
+    mediump vec2 coord = tex_coord * vec2(textureSize(color, 0));
+    mediump ivec2 tex_icoord = ivec2(coord);
+    highp uvec4 components =
+        uvec4(texelFetch(color, tex_icoord, 0) * (exp2(8.0) - 1.0) + 0.5);
+    highp uint depth_val = (components.g << 16u) | (components.b << 8u) | components.a;
+    gl_FragDepth = float(depth_val) / (exp2(24.0) - 1.0);
+    gl_FragStencilRefARB = int(components.r);
+}
@@ -0,0 +1,17 @@
+// Copyright 2023 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#version 450 core
+#extension GL_ARB_shader_stencil_export : require
+
+layout(binding = 0) uniform lowp sampler2D color;
+
+layout(location = 0) in vec2 texcoord;
+
+void main() {
+    highp uvec4 components = uvec4(textureLod(color, texcoord, 0) * (exp2(8.0) - 1.0) + 0.5);
+    highp uint depth_val = (components.g << 16u) | (components.b << 8u) | components.a;
+    gl_FragDepth = float(depth_val) / (exp2(24.0) - 1.0);
+    gl_FragStencilRefARB = int(components.r);
+}
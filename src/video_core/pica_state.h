@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/split_member.hpp>
@@ -137,6 +138,48 @@ struct State {
         };
 
         std::array<UnionArray<LutEntry, 256>, 24> luts;
+
+        /// Range of entries of one LUT written since the range was last reset; empty while
+        /// first > last
+        struct DirtyRange {
+            u16 first = 256;
+            u16 last = 0;
+
+            bool Empty() const {
+                return first > last;
+            }
+        };
+
+        /// LUT entries converted to host floats (value, difference) once on write, so renderers
+        /// do not reconvert entire banks on every draw. Not serialized; rebuilt from luts when a
+        /// savestate is loaded.
+        std::array<std::array<Common::Vec2f, 256>, 24> luts_converted{};
+
+        /// Per-LUT range of entries written since a renderer last reset it
+        std::array<DirtyRange, 24> luts_dirty{};
+
+        /// Stores a LUT entry written by the guest, keeping the converted mirror and the dirty
+        /// range of the bank in sync with the raw value
+        void SetLutEntry(std::size_t lut_index, std::size_t entry_index, u32 value) {
+            auto& entry = luts[lut_index][entry_index];
+            entry.raw = value;
+            luts_converted[lut_index][entry_index] = {entry.ToFloat(), entry.DiffToFloat()};
+            auto& range = luts_dirty[lut_index];
+            range.first = std::min(range.first, static_cast<u16>(entry_index));
+            range.last = std::max(range.last, static_cast<u16>(entry_index));
+        }
+
+        /// Reconverts every LUT and marks all of them fully dirty; used when the raw LUT data is
+        /// replaced wholesale, e.g. by loading a savestate
+        void RebuildLutCache() {
+            for (std::size_t lut_index = 0; lut_index < luts.size(); ++lut_index) {
+                std::transform(luts[lut_index].begin(), luts[lut_index].end(),
+                               luts_converted[lut_index].begin(), [](const LutEntry& entry) {
+                                   return Common::Vec2f{entry.ToFloat(), entry.DiffToFloat()};
+                               });
+                luts_dirty[lut_index] = {0, 255};
+            }
+        }
     } lighting;
 
     struct {
@@ -247,6 +290,7 @@ private:
         cmd_list.head_ptr =
             reinterpret_cast<u32*>(VideoCore::g_memory->GetPhysicalPointer(cmd_list.addr));
         cmd_list.current_ptr = cmd_list.head_ptr + offset;
+        lighting.RebuildLutCache();
     }
 };
 
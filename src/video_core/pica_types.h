@@ -34,21 +34,19 @@ public:
     static Float<M, E> FromRaw(u32 hex) {
         Float<M, E> res;
 
-        const int width = M + E + 1;
-        const int bias = 128 - (1 << (E - 1));
-        int exponent = (hex >> M) & ((1 << E) - 1);
-        const unsigned mantissa = hex & ((1 << M) - 1);
-        const unsigned sign = (hex >> (E + M)) << 31;
-
-        if (hex & ((1 << (width - 1)) - 1)) {
-            if (exponent == (1 << E) - 1)
-                exponent = 255;
-            else
-                exponent += bias;
-            hex = sign | (mantissa << (23 - M)) | (exponent << 23);
-        } else {
-            hex = sign;
-        }
+        constexpr u32 bias = 128 - (1 << (E - 1));
+        const u32 exponent = (hex >> M) & EXPONENT_MASK;
+        const u32 mantissa = hex & MANTISSA_MASK;
+        const u32 sign = (hex >> (E + M)) << 31;
+
+        // Branchless: a zero magnitude maps to a (signed) IEEE zero, a maximal Pica exponent
+        // maps to the IEEE inf/NaN exponent, anything else is rebiased. The ternaries compile
+        // to conditional moves, which keeps this free of unpredictable branches inside the
+        // uniform upload and shader interpreter loops.
+        const u32 ieee_exponent = exponent == EXPONENT_MASK ? 255u : exponent + bias;
+        const u32 magnitude = (mantissa << (23 - M)) | (ieee_exponent << 23);
+        const bool is_zero = (hex & (MASK >> 1)) == 0;
+        hex = sign | (is_zero ? 0u : magnitude);
 
         std::memcpy(&res.value, &hex, sizeof(float));
 
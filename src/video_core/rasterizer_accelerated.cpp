@@ -132,6 +132,11 @@ void RasterizerAccelerated::SyncEntireState() {
     // Sync renderer-specific fixed-function state
     SyncFixedState();
 
+    // The guest register state may have been replaced wholesale (e.g. by a savestate load)
+    shader_dirty = ShaderDirtyAll;
+    vs_uniforms_dirty = true;
+    draw_state_dirty = true;
+
     // Sync uniforms
     SyncClipCoef();
     SyncDepthScale();
@@ -166,6 +171,24 @@ void RasterizerAccelerated::SyncEntireState() {
 }
 
 void RasterizerAccelerated::NotifyPicaRegisterChanged(u32 id) {
+    // Draw parameters are consumed per draw by the vertex array setup; a write to any other
+    // register means the next draw can't reuse the pipeline state synced by the previous one.
+    switch (id) {
+    case PICA_REG_INDEX(pipeline.index_array):
+    case PICA_REG_INDEX(pipeline.num_vertices):
+    case PICA_REG_INDEX(pipeline.vertex_offset):
+    case PICA_REG_INDEX(pipeline.trigger_draw):
+    case PICA_REG_INDEX(pipeline.trigger_draw_indexed):
+    case PICA_REG_INDEX(pipeline.vs_default_attributes_setup.index):
+    case PICA_REG_INDEX(pipeline.vs_default_attributes_setup.set_value[0]):
+    case PICA_REG_INDEX(pipeline.vs_default_attributes_setup.set_value[1]):
+    case PICA_REG_INDEX(pipeline.vs_default_attributes_setup.set_value[2]):
+        break;
+    default:
+        draw_state_dirty = true;
+        break;
+    }
+
     switch (id) {
     // Depth modifiers
     case PICA_REG_INDEX(rasterizer.viewport_depth_range):
@@ -177,12 +200,13 @@ void RasterizerAccelerated::NotifyPicaRegisterChanged(u32 id) {
 
     // Depth buffering
     case PICA_REG_INDEX(rasterizer.depthmap_enable):
-        shader_dirty = true;
+        shader_dirty |= ShaderDirtyOutput;
         break;
 
     // Shadow texture
     case PICA_REG_INDEX(texturing.shadow):
         SyncShadowTextureBias();
+        shader_dirty |= ShaderDirtyOutput;
         break;
 
     // Fog state
@@ -205,7 +229,7 @@ void RasterizerAccelerated::NotifyPicaRegisterChanged(u32 id) {
     case PICA_REG_INDEX(texturing.proctex_lut):
     case PICA_REG_INDEX(texturing.proctex_lut_offset):
         SyncProcTexBias();
-        shader_dirty = true;
+        shader_dirty |= ShaderDirtyProcTex;
         break;
 
     case PICA_REG_INDEX(texturing.proctex_noise_u):
@@ -245,7 +269,7 @@ void RasterizerAccelerated::NotifyPicaRegisterChanged(u32 id) {
     // Alpha test
     case PICA_REG_INDEX(framebuffer.output_merger.alpha_test):
         SyncAlphaTest();
-        shader_dirty = true;
+        shader_dirty |= ShaderDirtyOutput;
         break;
 
     case PICA_REG_INDEX(framebuffer.shadow):
@@ -254,16 +278,18 @@ void RasterizerAccelerated::NotifyPicaRegisterChanged(u32 id) {
 
     // Scissor test
     case PICA_REG_INDEX(rasterizer.scissor_test.mode):
-        shader_dirty = true;
+        shader_dirty |= ShaderDirtyOutput;
         break;
 
+    // Texture unit main config
+    // (Carries both the texture 2 coordinate source and the procedural texture unit enable)
     case PICA_REG_INDEX(texturing.main_config):
-        shader_dirty = true;
+        shader_dirty |= ShaderDirtyTev | ShaderDirtyProcTex;
         break;
 
     // Texture 0 type
     case PICA_REG_INDEX(texturing.texture0.type):
-        shader_dirty = true;
+        shader_dirty |= ShaderDirtyTev;
         break;
 
     // TEV stages
@@ -293,7 +319,7 @@ void RasterizerAccelerated::NotifyPicaRegisterChanged(u32 id) {
     case PICA_REG_INDEX(texturing.tev_stage5.color_op):
     case PICA_REG_INDEX(texturing.tev_stage5.color_scale):
     case PICA_REG_INDEX(texturing.tev_combiner_buffer_input):
-        shader_dirty = true;
+        shader_dirty |= ShaderDirtyTev;
         break;
     case PICA_REG_INDEX(texturing.tev_stage0.const_r):
         SyncTevConstColor(0, regs.texturing.tev_stage0);
@@ -328,6 +354,7 @@ void RasterizerAccelerated::NotifyPicaRegisterChanged(u32 id) {
     case PICA_REG_INDEX(lighting.lut_input):
     case PICA_REG_INDEX(lighting.lut_scale):
     case PICA_REG_INDEX(lighting.light_enable):
+        shader_dirty |= ShaderDirtyLighting;
         break;
 
     // Fragment lighting specular 0 color
@@ -511,7 +538,7 @@ void RasterizerAccelerated::NotifyPicaRegisterChanged(u32 id) {
     case PICA_REG_INDEX(lighting.light[5].config):
     case PICA_REG_INDEX(lighting.light[6].config):
     case PICA_REG_INDEX(lighting.light[7].config):
-        shader_dirty = true;
+        shader_dirty |= ShaderDirtyLighting;
         break;
 
     // Fragment lighting distance attenuation bias
@@ -605,6 +632,24 @@ void RasterizerAccelerated::NotifyPicaRegisterChanged(u32 id) {
         SyncClipCoef();
         break;
 
+    // Vertex shader uniforms. Batched FIFO runs notify once with the first register of the
+    // run, which still lands in the set_value range below.
+    case PICA_REG_INDEX(vs.bool_uniforms):
+    case PICA_REG_INDEX(vs.int_uniforms[0]):
+    case PICA_REG_INDEX(vs.int_uniforms[1]):
+    case PICA_REG_INDEX(vs.int_uniforms[2]):
+    case PICA_REG_INDEX(vs.int_uniforms[3]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[0]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[1]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[2]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[3]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[4]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[5]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[6]):
+    case PICA_REG_INDEX(vs.uniform_setup.set_value[7]):
+        vs_uniforms_dirty = true;
+        break;
+
     default:
         // Forward registers that map to fixed function API features to the video backend
         NotifyFixedFunctionPicaRegisterChanged(id);
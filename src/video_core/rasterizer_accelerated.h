@@ -19,6 +19,19 @@ struct Regs;
 
 namespace VideoCore {
 
+/**
+ * Segments of the generated fragment shader cache key. Register writes mark only the segment
+ * they affect, so backends can re-read just that part of the Pica state the next time they
+ * build a shader lookup key instead of reconstructing the entire key.
+ */
+enum ShaderDirtyFlags : u32 {
+    ShaderDirtyOutput = 1 << 0,   ///< Alpha test, scissor mode, depth mapping and shadows
+    ShaderDirtyTev = 1 << 1,      ///< TEV stages, combiner buffer, fog and texture unit types
+    ShaderDirtyLighting = 1 << 2, ///< Fragment lighting configuration
+    ShaderDirtyProcTex = 1 << 3,  ///< Procedural texture unit configuration
+    ShaderDirtyAll = (1 << 4) - 1,
+};
+
 class RasterizerAccelerated : public RasterizerInterface {
 public:
     RasterizerAccelerated(Memory::MemorySystem& memory);
@@ -144,7 +157,18 @@ protected:
     Pica::Regs& regs;
 
     std::vector<HardwareVertex> vertex_batch;
-    bool shader_dirty = true;
+    /// Mask of ShaderDirtyFlags segments that changed since the shader was last looked up
+    u32 shader_dirty = ShaderDirtyAll;
+
+    /// True when a vertex shader uniform was written since the last upload; lets UploadUniforms
+    /// keep the previously uploaded VS block bound instead of converting and shipping all 96
+    /// float registers on every accelerated draw
+    bool vs_uniforms_dirty = true;
+
+    /// True when anything other than plain draw parameters changed since the last accelerated
+    /// draw. While clear, consecutive draws reuse the framebuffer, viewport and texture state
+    /// synced by the previous draw instead of re-deriving it per draw.
+    bool draw_state_dirty = true;
 
     UniformBlockData uniform_block_data{};
     std::array<std::array<Common::Vec2f, 256>, Pica::LightingRegs::NumLightingSampler>
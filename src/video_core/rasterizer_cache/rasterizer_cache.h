@@ -4,12 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <type_traits>
 #include <boost/container/small_vector.hpp>
 #include <boost/range/iterator_range.hpp>
 #include "common/alignment.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/perf_counters.h"
 #include "common/settings.h"
 #include "core/memory.h"
 #include "video_core/custom_textures/custom_tex_manager.h"
@@ -40,6 +42,12 @@ RasterizerCache<T>::RasterizerCache(Memory::MemorySystem& memory_,
       use_custom_textures{Settings::values.custom_textures.GetValue()} {
     using TextureConfig = Pica::TexturingRegs::TextureConfig;
 
+    // Let the custom texture manager transcode PNG textures to a block-compressed format
+    // the runtime can sample, cutting their VRAM footprint and upload bandwidth by 4x.
+    if (runtime.IsCustomFormatSupported(CustomPixelFormat::BC3)) {
+        custom_tex_manager.EnableCompression(CustomPixelFormat::BC3);
+    }
+
     // Create null handles for all cached resources
     void(slot_surfaces.insert(runtime, SurfaceParams{
                                            .width = 1,
@@ -73,6 +81,9 @@ RasterizerCache<T>::~RasterizerCache() {
 
 template <class T>
 void RasterizerCache<T>::TickFrame() {
+    frame_tick++;
+    FlushDeferred();
+    RunEvictions();
     custom_tex_manager.TickFrame();
     runtime.TickFrame();
 
@@ -347,8 +358,11 @@ SurfaceId RasterizerCache<T>::GetSurface(const SurfaceParams& params, ScaleMatch
     ASSERT(params.width == params.stride);
     ASSERT(!params.is_tiled || (params.width % 8 == 0 && params.height % 8 == 0));
 
-    // Check for an exact match in existing surfaces
-    SurfaceId surface_id = FindMatch<MatchFlags::Exact>(params, match_res_scale);
+    // Check for an exact match in existing surfaces, trying the recency list first
+    SurfaceId surface_id = FindRecentMatch<MatchFlags::Exact>(params);
+    if (!surface_id) {
+        surface_id = FindMatch<MatchFlags::Exact>(params, match_res_scale);
+    }
 
     if (!surface_id) {
         u16 target_res_scale = params.res_scale;
@@ -385,6 +399,7 @@ SurfaceId RasterizerCache<T>::GetSurface(const SurfaceParams& params, ScaleMatch
         ValidateSurface(surface_id, params.addr, params.size);
     }
 
+    TouchRecentSurface(surface_id);
     return surface_id;
 }
 
@@ -395,8 +410,11 @@ typename RasterizerCache<T>::SurfaceRect_Tuple RasterizerCache<T>::GetSurfaceSub
         return std::make_pair(SurfaceId{}, Common::Rectangle<u32>{});
     }
 
-    // Attempt to find encompassing surface
-    SurfaceId surface_id = FindMatch<MatchFlags::SubRect>(params, match_res_scale);
+    // Attempt to find encompassing surface, trying the recency list first
+    SurfaceId surface_id = FindRecentMatch<MatchFlags::SubRect>(params);
+    if (!surface_id) {
+        surface_id = FindMatch<MatchFlags::SubRect>(params, match_res_scale);
+    }
 
     // Check if FindMatch failed because of res scaling. If that's the case create a new surface
     // with the dimensions of the lower res_scale surface to suggest it should not be used again.
@@ -456,6 +474,7 @@ typename RasterizerCache<T>::SurfaceRect_Tuple RasterizerCache<T>::GetSurfaceSub
         ValidateSurface(surface_id, aligned_params.addr, aligned_params.size);
     }
 
+    TouchRecentSurface(surface_id);
     return std::make_pair(surface_id, slot_surfaces[surface_id].GetScaledSubRect(params));
 }
 
@@ -875,6 +894,44 @@ SurfaceId RasterizerCache<T>::FindMatch(const SurfaceParams& params, ScaleMatch
     return match_id;
 }
 
+template <class T>
+template <MatchFlags find_flags>
+SurfaceId RasterizerCache<T>::FindRecentMatch(const SurfaceParams& params) {
+    static_assert(find_flags == MatchFlags::Exact || find_flags == MatchFlags::SubRect,
+                  "Only exact and subrect queries can be answered from the recency list");
+    for (const SurfaceId surface_id : recent_surfaces) {
+        if (!surface_id) {
+            continue;
+        }
+        Surface& surface = slot_surfaces[surface_id];
+        // Only trust the recency list when the hit is unambiguously the best match FindMatch
+        // could return: same resolution scale and fully valid over the queried interval.
+        if (surface.res_scale != params.res_scale) {
+            continue;
+        }
+        const bool matched = True(find_flags & MatchFlags::Exact) ? surface.ExactMatch(params)
+                                                                  : surface.CanSubRect(params);
+        if (!matched || !surface.IsRegionValid(params.GetInterval())) {
+            continue;
+        }
+        TouchRecentSurface(surface_id);
+        return surface_id;
+    }
+    return SurfaceId{};
+}
+
+template <class T>
+void RasterizerCache<T>::TouchRecentSurface(SurfaceId surface_id) {
+    slot_surfaces[surface_id].last_used_frame = frame_tick;
+    auto it = std::find(recent_surfaces.begin(), recent_surfaces.end(), surface_id);
+    if (it == recent_surfaces.end()) {
+        // Not present; evict the least recently used entry
+        it = recent_surfaces.end() - 1;
+        *it = surface_id;
+    }
+    std::rotate(recent_surfaces.begin(), it, it + 1);
+}
+
 template <class T>
 void RasterizerCache<T>::DuplicateSurface(SurfaceId src_id, SurfaceId dst_id) {
     Surface& src_surface = slot_surfaces[src_id];
@@ -961,6 +1018,26 @@ void RasterizerCache<T>::ValidateSurface(SurfaceId surface_id, PAddr addr, u32 s
             continue;
         }
 
+        // Fine-grained guest writes often dirty a narrow column of tile rows, such as a game
+        // updating a small HUD region of a larger texture atlas. Upload the column as a single
+        // rectangle instead of issuing a separate upload per tile row.
+        const u32 num_rows =
+            use_custom_textures || dump_textures
+                ? 1
+                : CountDirtyColumnRows(surface, params, validate_regions, level_interval);
+        if (num_rows > 1) {
+            const u32 row_pitch = surface.BytesInPixels((surface.stride >> level) * 8);
+            for (u32 row = 0; row < num_rows; row++) {
+                FlushRegion(params.addr + row * row_pitch, params.size);
+            }
+            UploadSurfaceColumn(surface, params, num_rows);
+            for (u32 row = 0; row < num_rows; row++) {
+                const u32 offset = row * row_pitch;
+                notify_validated(SurfaceInterval{params.addr + offset, params.end + offset});
+            }
+            continue;
+        }
+
         FlushRegion(params.addr, params.size);
         if (!use_custom_textures || !UploadCustomSurface(surface_id, interval)) {
             UploadSurface(surface, interval);
@@ -978,6 +1055,7 @@ void RasterizerCache<T>::ValidateSurface(SurfaceId surface_id, PAddr addr, u32 s
 template <class T>
 void RasterizerCache<T>::UploadSurface(Surface& surface, SurfaceInterval interval) {
     MICROPROFILE_SCOPE(RasterizerCache_UploadSurface);
+    Common::PerfCounters::Add(Common::PerfCounters::Counter::SurfaceUploads);
 
     const SurfaceParams load_info = surface.FromInterval(interval);
     ASSERT(load_info.addr >= surface.addr && load_info.end <= surface.end);
@@ -991,13 +1069,21 @@ void RasterizerCache<T>::UploadSurface(Surface& surface, SurfaceInterval interva
     }
 
     const auto upload_data = source_ptr.GetWriteBytes(load_info.end - load_info.addr);
-    DecodeTexture(load_info, load_info.addr, load_info.end, upload_data, staging.mapped,
-                  runtime.NeedsConversion(surface.pixel_format));
+    DecodeTextureParallel(load_info, load_info.addr, load_info.end, upload_data, staging.mapped,
+                          runtime.NeedsConversion(surface.pixel_format));
 
     if (dump_textures && False(surface.flags & SurfaceFlagBits::Custom)) {
-        const u64 hash = Common::ComputeHash64(upload_data.data(), upload_data.size());
-        const u32 level = surface.LevelOf(load_info.addr);
-        custom_tex_manager.DumpTexture(load_info, level, upload_data, hash);
+        // A sampled fingerprint cheaply filters out uploads that were already dumped, so only
+        // new content pays for the full-rate hash that names the dump file. A fingerprint
+        // collision can at worst skip dumping one texture.
+        const u64 fingerprint =
+            Common::ComputeSampledHash64(upload_data.data(), upload_data.size());
+        if (!custom_tex_manager.IsFingerprintDumped(fingerprint)) {
+            const u64 hash = Common::ComputeHash64(upload_data.data(), upload_data.size());
+            const u32 level = surface.LevelOf(load_info.addr);
+            custom_tex_manager.DumpTexture(load_info, level, upload_data, hash);
+            custom_tex_manager.MarkFingerprintDumped(fingerprint);
+        }
     }
 
     const BufferTextureCopy upload = {
@@ -1009,6 +1095,71 @@ void RasterizerCache<T>::UploadSurface(Surface& surface, SurfaceInterval interva
     surface.Upload(upload, staging);
 }
 
+template <class T>
+u32 RasterizerCache<T>::CountDirtyColumnRows(const Surface& surface, const SurfaceParams& params,
+                                             const SurfaceRegions& validate_regions,
+                                             SurfaceInterval level_interval) const {
+    const u32 level = surface.LevelOf(params.addr);
+    const u32 level_stride = surface.stride >> level;
+
+    // Only partial tile rows benefit from batching; full width intervals are already
+    // contiguous in guest memory and validated with a single upload.
+    if (!surface.is_tiled || params.height != 8 || params.width >= level_stride) {
+        return 1;
+    }
+
+    const u32 row_pitch = surface.BytesInPixels(level_stride * 8);
+    u32 num_rows = 1;
+    SurfaceInterval next{params.addr + row_pitch, params.end + row_pitch};
+    while (boost::icl::contains(level_interval, next) &&
+           boost::icl::contains(validate_regions, next)) {
+        num_rows++;
+        next = SurfaceInterval{next.lower() + row_pitch, next.upper() + row_pitch};
+    }
+
+    return num_rows;
+}
+
+template <class T>
+void RasterizerCache<T>::UploadSurfaceColumn(Surface& surface, const SurfaceParams& row_info,
+                                             u32 num_rows) {
+    MICROPROFILE_SCOPE(RasterizerCache_UploadSurface);
+
+    const u32 level = surface.LevelOf(row_info.addr);
+    const u32 row_pitch = surface.BytesInPixels((surface.stride >> level) * 8);
+    const bool convert = runtime.NeedsConversion(surface.pixel_format);
+    const u32 decoded_bpp = convert ? 4 : GetFormatBytesPerPixel(surface.pixel_format);
+    const u32 strip_size = row_info.width * row_info.height * decoded_bpp;
+
+    const auto staging = runtime.FindStaging(
+        row_info.width * row_info.height * num_rows * surface.GetInternalBytesPerPixel(), true);
+
+    // Decode each tile row strip separately; the offsets passed to the decoder are relative
+    // to the provided source span so row_info describes every strip of the column. The
+    // decoded linear image is laid out bottom up, which places the strip with the lowest
+    // guest address at the end of the staging buffer.
+    for (u32 row = 0; row < num_rows; row++) {
+        const PAddr row_addr = row_info.addr + row * row_pitch;
+        MemoryRef source_ptr = memory.GetPhysicalRef(row_addr);
+        if (!source_ptr) [[unlikely]] {
+            return;
+        }
+        const auto upload_data = source_ptr.GetWriteBytes(row_info.end - row_info.addr);
+        const auto dest = staging.mapped.subspan((num_rows - 1 - row) * strip_size, strip_size);
+        DecodeTexture(row_info, row_info.addr, row_info.end, upload_data, dest, convert);
+    }
+
+    SurfaceParams column_info = row_info;
+    column_info.height = row_info.height * num_rows;
+    const BufferTextureCopy upload = {
+        .buffer_offset = staging.offset,
+        .buffer_size = staging.size,
+        .texture_rect = surface.GetSubRect(column_info),
+        .texture_level = level,
+    };
+    surface.Upload(upload, staging);
+}
+
 template <class T>
 bool RasterizerCache<T>::UploadCustomSurface(SurfaceId surface_id, SurfaceInterval interval) {
     MICROPROFILE_SCOPE(RasterizerCache_UploadSurface);
@@ -1199,6 +1350,7 @@ void RasterizerCache<T>::ClearAll(bool flush) {
     dirty_regions -= SurfaceInterval(0x0, 0xFFFFFFFF);
     page_table.clear();
     remove_surfaces.clear();
+    deferred_flushes.clear();
 }
 
 template <class T>
@@ -1241,6 +1393,84 @@ void RasterizerCache<T>::FlushAll() {
     FlushRegion(0, 0xFFFFFFFF);
 }
 
+template <class T>
+u64 RasterizerCache<T>::ScaledFootprint(const Surface& surface) const {
+    u64 footprint = static_cast<u64>(surface.GetScaledWidth()) * surface.GetScaledHeight() *
+                    surface.GetInternalBytesPerPixel();
+    if (surface.levels > 1) {
+        // Approximate the overhead of the mip chain
+        footprint += footprint / 3;
+    }
+    return footprint;
+}
+
+template <class T>
+void RasterizerCache<T>::RunEvictions() {
+    /// Number of frames a surface must go unused before it becomes an eviction candidate
+    constexpr u64 EVICT_AGE_FRAMES = 60;
+
+    const u64 budget = static_cast<u64>(Settings::values.scaled_surface_budget_mb.GetValue()) << 20;
+    if (budget == 0 || total_scaled_footprint <= budget) {
+        return;
+    }
+
+    LOG_DEBUG(HW_GPU, "Scaled surface footprint {} MB (peak {} MB) exceeds budget {} MB",
+              total_scaled_footprint >> 20, peak_scaled_footprint >> 20, budget >> 20);
+
+    // Collect the cold scaled surfaces by scanning the packed live array of the slot vector,
+    // which visits every surface exactly once instead of hopping the page table per entry.
+    // Fill surfaces have no host allocation and texture cube faces are managed by the cube
+    // cache, so neither participates in the budget.
+    std::vector<SurfaceId> candidates;
+    candidates.reserve(slot_surfaces.size());
+    slot_surfaces.each([&](SurfaceId surface_id, const Surface& surface) {
+        if (surface.res_scale > 1 && surface.type != SurfaceType::Fill &&
+            True(surface.flags & SurfaceFlagBits::Registered) &&
+            False(surface.flags & SurfaceFlagBits::Tracked) &&
+            frame_tick - surface.last_used_frame >= EVICT_AGE_FRAMES &&
+            surface_id != render_targets.color_id && surface_id != render_targets.depth_id) {
+            candidates.push_back(surface_id);
+        }
+    });
+
+    std::sort(candidates.begin(), candidates.end(), [this](SurfaceId lhs, SurfaceId rhs) {
+        return slot_surfaces[lhs].last_used_frame < slot_surfaces[rhs].last_used_frame;
+    });
+
+    // Guest memory keeps the unscaled data, so an eviction only costs a re-upscale
+    // if the surface ever becomes hot again.
+    for (const SurfaceId surface_id : candidates) {
+        if (total_scaled_footprint <= budget) {
+            break;
+        }
+        Surface& surface = slot_surfaces[surface_id];
+        FlushRegion(surface.addr, surface.size, surface_id);
+        UnregisterSurface(surface_id);
+    }
+}
+
+template <class T>
+void RasterizerCache<T>::FlushDeferred() {
+    if (deferred_flushes.empty()) {
+        return;
+    }
+
+    // By the time the frame ends the GPU has typically finished producing these surfaces,
+    // so the writeback no longer needs a mid-frame synchronization. Any region that was
+    // demanded by a CPU read in the meantime has already left dirty_regions and is skipped.
+    for (const SurfaceId surface_id : deferred_flushes) {
+        Surface& surface = slot_surfaces[surface_id];
+        FlushRegion(surface.addr, surface.size, surface_id);
+        remove_surfaces.push_back(surface_id);
+    }
+    deferred_flushes.clear();
+
+    for (const SurfaceId remove_surface_id : remove_surfaces) {
+        UnregisterSurface(remove_surface_id);
+    }
+    remove_surfaces.clear();
+}
+
 template <class T>
 void RasterizerCache<T>::InvalidateRegion(PAddr addr, u32 size, SurfaceId region_owner_id) {
     if (size == 0) [[unlikely]] {
@@ -1263,10 +1493,18 @@ void RasterizerCache<T>::InvalidateRegion(PAddr addr, u32 size, SurfaceId region
         }
 
         // If the CPU is invalidating this region we want to remove it
-        // to (likely) mark the memory pages as uncached
+        // to (likely) mark the memory pages as uncached. Most titles never read the flushed
+        // bytes back however, so stalling the GPU for the writeback mid-frame is wasted
+        // work. Keep the surface registered and defer the flush and removal to the end of
+        // the frame; the interval the CPU is writing is erased from dirty_regions below and
+        // marked invalid here, so the deferred writeback cannot clobber it and any GPU use
+        // in the meantime revalidates it from memory.
         if (!region_owner_id && size <= 8) {
-            FlushRegion(surface.addr, surface.size, surface_id);
-            remove_surfaces.push_back(surface_id);
+            if (std::find(deferred_flushes.begin(), deferred_flushes.end(), surface_id) ==
+                deferred_flushes.end()) {
+                deferred_flushes.push_back(surface_id);
+            }
+            surface.MarkInvalid(surface.GetInterval() & invalid_interval);
             return;
         }
 
@@ -1306,6 +1544,10 @@ void RasterizerCache<T>::RegisterSurface(SurfaceId surface_id) {
                "Trying to register an already registered surface");
 
     surface.flags |= SurfaceFlagBits::Registered;
+    if (surface.res_scale > 1 && surface.type != SurfaceType::Fill) {
+        total_scaled_footprint += ScaledFootprint(surface);
+        peak_scaled_footprint = std::max(peak_scaled_footprint, total_scaled_footprint);
+    }
     UpdatePagesCachedCount(surface.addr, surface.size, 1);
     ForEachPage(surface.addr, surface.size,
                 [this, surface_id](u64 page) { page_table[page].push_back(surface_id); });
@@ -1318,6 +1560,11 @@ void RasterizerCache<T>::UnregisterSurface(SurfaceId surface_id) {
                "Trying to unregister an already unregistered surface");
 
     surface.flags &= ~SurfaceFlagBits::Registered;
+    if (surface.res_scale > 1 && surface.type != SurfaceType::Fill) {
+        total_scaled_footprint -= ScaledFootprint(surface);
+    }
+    std::replace(recent_surfaces.begin(), recent_surfaces.end(), surface_id, SurfaceId{});
+    std::erase(deferred_flushes, surface_id);
     UpdatePagesCachedCount(surface.addr, surface.size, -1);
     ForEachPage(surface.addr, surface.size, [this, surface_id](u64 page) {
         const auto page_it = page_table.find(page);
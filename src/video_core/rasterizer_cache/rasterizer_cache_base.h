@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <optional>
 #include <unordered_map>
@@ -136,6 +137,9 @@ public:
     /// Flush all cached resources tracked by this cache manager
     void FlushAll();
 
+    /// Writes back surfaces whose CPU-write eviction was deferred to the end of the frame
+    void FlushDeferred();
+
     /// Clear all cached resources tracked by this cache manager
     void ClearAll(bool flush);
 
@@ -165,6 +169,14 @@ private:
     SurfaceId FindMatch(const SurfaceParams& params, ScaleMatch match_scale_type,
                         std::optional<SurfaceInterval> validate_interval = std::nullopt);
 
+    /// Check the recently returned surfaces for an unambiguous match before walking the page
+    /// table; returns a null id when the query must go through FindMatch
+    template <MatchFlags find_flags>
+    SurfaceId FindRecentMatch(const SurfaceParams& params);
+
+    /// Move the surface to the front of the recently returned surface list
+    void TouchRecentSurface(SurfaceId surface_id);
+
     /// Transfers ownership of a memory region from src_surface to dest_surface
     void DuplicateSurface(SurfaceId src_id, SurfaceId dst_id);
 
@@ -174,6 +186,15 @@ private:
     /// Copies pixel data in interval from the guest VRAM to the host GPU surface
     void UploadSurface(Surface& surface, SurfaceInterval interval);
 
+    /// Returns how many consecutive tile rows of validate_regions repeat the column strip
+    /// described by params, including the row covered by params itself
+    u32 CountDirtyColumnRows(const Surface& surface, const SurfaceParams& params,
+                             const SurfaceRegions& validate_regions,
+                             SurfaceInterval level_interval) const;
+
+    /// Uploads a column of num_rows equally sized tile row strips as a single rectangle
+    void UploadSurfaceColumn(Surface& surface, const SurfaceParams& row_info, u32 num_rows);
+
     /// Uploads a custom texture identified with hash to the target surface
     bool UploadCustomSurface(SurfaceId surface_id, SurfaceInterval interval);
 
@@ -205,6 +226,12 @@ private:
     /// Increase/decrease the number of surface in pages touching the specified region
     void UpdatePagesCachedCount(PAddr addr, u32 size, int delta);
 
+    /// Returns the estimated host memory footprint of a scaled surface
+    u64 ScaledFootprint(const Surface& surface) const;
+
+    /// Evicts cold scaled surfaces until the tracked footprint fits the configured budget
+    void RunEvictions();
+
 private:
     Memory::MemorySystem& memory;
     CustomTexManager& custom_tex_manager;
@@ -218,7 +245,16 @@ private:
     Common::SlotVector<Sampler> slot_samplers;
     SurfaceMap dirty_regions;
     PageMap cached_pages;
+    /// Most recently returned surfaces, kept in recency order. Titles commonly rebind the same
+    /// few render targets and textures every draw, so these resolve most queries without a
+    /// page table walk.
+    std::array<SurfaceId, 4> recent_surfaces{};
     std::vector<SurfaceId> remove_surfaces;
+    /// Surfaces evicted by a CPU write whose writeback is postponed until the frame ends
+    std::vector<SurfaceId> deferred_flushes;
+    u64 frame_tick = 0;
+    u64 total_scaled_footprint = 0;
+    u64 peak_scaled_footprint = 0;
     u32 resolution_scale_factor;
     RenderTargets render_targets;
     bool use_filter;
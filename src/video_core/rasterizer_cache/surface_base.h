@@ -89,6 +89,7 @@ public:
     u32 fill_size = 0;
     std::array<u8, 4> fill_data;
     u64 modification_tick = 1;
+    u64 last_used_frame = 0; ///< Frame tick of the most recent cache hit, used for LRU eviction.
 };
 
 } // namespace VideoCore
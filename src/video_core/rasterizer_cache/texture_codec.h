@@ -69,8 +69,7 @@ constexpr void DecodePixel(const u8* source, u8* dest) {
 }
 
 template <PixelFormat format>
-constexpr void DecodePixel4(u32 x, u32 y, const u8* source_tile, u8* dest_pixel) {
-    const u32 morton_offset = VideoCore::MortonInterleave(x, y);
+constexpr void DecodePixel4(u32 morton_offset, const u8* source_tile, u8* dest_pixel) {
     const u8 value = source_tile[morton_offset >> 1];
     const u8 pixel = Common::Color::Convert4To8((morton_offset % 2) ? (value >> 4) : (value & 0xF));
 
@@ -83,34 +82,43 @@ constexpr void DecodePixel4(u32 x, u32 y, const u8* source_tile, u8* dest_pixel)
     }
 }
 
+/**
+ * Decodes a full 8x8 ETC1/ETC1A4 tile to the linear buffer. Each of the four 4x4 subtiles is
+ * expanded in one pass, so the base colors and modifier tables are derived once per subtile
+ * instead of once per texel.
+ */
 template <PixelFormat format>
-constexpr void DecodePixelETC1(u32 x, u32 y, const u8* source_tile, u8* dest_pixel) {
-    constexpr u32 subtile_width = 4;
-    constexpr u32 subtile_height = 4;
+constexpr void DecodeTileETC1(u32 stride, std::span<u8> tile_buffer,
+                              std::span<u8> linear_buffer) {
     constexpr bool has_alpha = format == PixelFormat::ETC1A4;
     constexpr std::size_t subtile_size = has_alpha ? 16 : 8;
+    constexpr u32 linear_bytes_per_pixel = GetFormatBytesPerPixel(format);
 
-    const u32 subtile_index = (x / subtile_width) + 2 * (y / subtile_height);
-    x %= subtile_width;
-    y %= subtile_height;
+    for (u32 subtile_index = 0; subtile_index < 4; subtile_index++) {
+        const u32 x0 = (subtile_index % 2) * 4;
+        const u32 y0 = (subtile_index / 2) * 4;
+        const u8* subtile_ptr = tile_buffer.data() + subtile_index * subtile_size;
 
-    const u8* subtile_ptr = source_tile + subtile_index * subtile_size;
+        u64_le packed_alpha = ~0ULL;
+        if constexpr (has_alpha) {
+            std::memcpy(&packed_alpha, subtile_ptr, sizeof(u64));
+            subtile_ptr += sizeof(u64);
+        }
 
-    u8 alpha = 255;
-    if constexpr (has_alpha) {
-        u64_le packed_alpha;
-        std::memcpy(&packed_alpha, subtile_ptr, sizeof(u64));
-        subtile_ptr += sizeof(u64);
+        const u64_le subtile_data = MakeInt<u64_le>(subtile_ptr);
+        std::array<Common::Vec3<u8>, 16> rgb;
+        Pica::Texture::DecodeETC1Subtile(subtile_data, rgb);
 
-        alpha = Common::Color::Convert4To8((packed_alpha >> (4 * (x * subtile_width + y))) & 0xF);
+        for (u32 texel = 0; texel < 16; texel++) {
+            const u32 x = texel / 4;
+            const u32 y = texel % 4;
+            const auto linear_pixel = linear_buffer.subspan(
+                ((7 - (y0 + y)) * stride + x0 + x) * linear_bytes_per_pixel,
+                linear_bytes_per_pixel);
+            std::memcpy(linear_pixel.data(), rgb[texel].AsArray(), 3);
+            linear_pixel[3] = Common::Color::Convert4To8((packed_alpha >> (4 * texel)) & 0xF);
+        }
     }
-
-    const u64_le subtile_data = MakeInt<u64_le>(subtile_ptr);
-    const auto rgb = Pica::Texture::SampleETC1Subtile(subtile_data, x, y);
-
-    // Copy the uncompressed pixel to the destination
-    std::memcpy(dest_pixel, rgb.AsArray(), 3);
-    dest_pixel[3] = alpha;
 }
 
 template <PixelFormat format, bool converted>
@@ -171,7 +179,7 @@ constexpr void EncodePixel(const u8* source, u8* dest) {
 }
 
 template <PixelFormat format>
-constexpr void EncodePixel4(u32 x, u32 y, const u8* source_pixel, u8* dest_tile_buffer) {
+constexpr void EncodePixel4(u32 morton_offset, const u8* source_pixel, u8* dest_tile_buffer) {
     Common::Vec4<u8> rgba;
     std::memcpy(rgba.AsArray(), source_pixel, 4);
 
@@ -182,7 +190,6 @@ constexpr void EncodePixel4(u32 x, u32 y, const u8* source_pixel, u8* dest_tile_
         pixel = rgba.a();
     }
 
-    const u32 morton_offset = VideoCore::MortonInterleave(x, y);
     const u32 byte_offset = morton_offset >> 1;
 
     const u8 current_values = dest_tile_buffer[byte_offset];
@@ -202,23 +209,31 @@ constexpr void MortonCopyTile(u32 stride, std::span<u8> tile_buffer, std::span<u
     constexpr bool is_compressed = format == PixelFormat::ETC1 || format == PixelFormat::ETC1A4;
     constexpr bool is_4bit = format == PixelFormat::I4 || format == PixelFormat::A4;
 
+    if constexpr (morton_to_linear && is_compressed) {
+        // Compressed tiles are expanded a whole subtile at a time instead of texel-by-texel
+        DecodeTileETC1<format>(stride, tile_buffer, linear_buffer);
+        return;
+    }
+
     for (u32 y = 0; y < 8; y++) {
+        // Each tile row occupies eight consecutive entries of the morton table, so the inner
+        // loop is a straight run of byte loads instead of a per-texel coordinate interleave.
+        const u8* morton_row = MORTON_LUT.data() + y * 8;
         for (u32 x = 0; x < 8; x++) {
-            const auto tiled_pixel = tile_buffer.subspan(
-                VideoCore::MortonInterleave(x, y) * bytes_per_pixel, bytes_per_pixel);
+            const u32 morton_offset = morton_row[x];
+            const auto tiled_pixel =
+                tile_buffer.subspan(morton_offset * bytes_per_pixel, bytes_per_pixel);
             const auto linear_pixel = linear_buffer.subspan(
                 ((7 - y) * stride + x) * linear_bytes_per_pixel, linear_bytes_per_pixel);
             if constexpr (morton_to_linear) {
-                if constexpr (is_compressed) {
-                    DecodePixelETC1<format>(x, y, tile_buffer.data(), linear_pixel.data());
-                } else if constexpr (is_4bit) {
-                    DecodePixel4<format>(x, y, tile_buffer.data(), linear_pixel.data());
+                if constexpr (is_4bit) {
+                    DecodePixel4<format>(morton_offset, tile_buffer.data(), linear_pixel.data());
                 } else {
                     DecodePixel<format, converted>(tiled_pixel.data(), linear_pixel.data());
                 }
             } else {
                 if constexpr (is_4bit) {
-                    EncodePixel4<format>(x, y, linear_pixel.data(), tile_buffer.data());
+                    EncodePixel4<format>(morton_offset, linear_pixel.data(), tile_buffer.data());
                 } else {
                     EncodePixel<format, converted>(linear_pixel.data(), tiled_pixel.data());
                 }
@@ -2,12 +2,31 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <thread>
+#include "common/thread_worker.h"
 #include "video_core/rasterizer_cache/surface_params.h"
 #include "video_core/rasterizer_cache/texture_codec.h"
 #include "video_core/rasterizer_cache/utils.h"
 
 namespace VideoCore {
 
+namespace {
+
+/// Tiled uploads below this size are decoded inline; the hand-off cost dominates otherwise
+constexpr u32 MIN_PARALLEL_DECODE_BYTES = 256 * 1024;
+
+std::size_t NumDecodeThreads() {
+    // Leave half of the machine to the emulation and renderer threads
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency() / 2);
+}
+
+Common::ThreadWorker& GetDecodeWorkers() {
+    static Common::ThreadWorker workers{NumDecodeThreads(), "Texture decode"};
+    return workers;
+}
+
+} // namespace
+
 u32 MipLevels(u32 width, u32 height, u32 max_level) {
     u32 levels = 1;
     while (width > 8 && height > 8) {
@@ -73,4 +92,51 @@ void DecodeTexture(const SurfaceParams& surface_info, PAddr start_addr, PAddr en
     UNIMPLEMENTED();
 }
 
+void DecodeTextureParallel(const SurfaceParams& surface_info, PAddr start_addr, PAddr end_addr,
+                           std::span<u8> source, std::span<u8> dest, bool convert) {
+    const u32 width = surface_info.width;
+    const u32 size = static_cast<u32>(end_addr - start_addr);
+    const u32 tile_row_size = surface_info.BytesInPixels(width * 8);
+
+    // Only large tiled uploads that cover whole tile rows are worth splitting; everything else
+    // takes the serial path.
+    if (!surface_info.is_tiled || size < MIN_PARALLEL_DECODE_BYTES || tile_row_size == 0 ||
+        size % tile_row_size != 0) {
+        DecodeTexture(surface_info, start_addr, end_addr, source, dest, convert);
+        return;
+    }
+
+    const u32 bytes_per_pixel = convert ? 4 : GetFormatBytesPerPixel(surface_info.pixel_format);
+    const u32 linear_row_size = width * 8 * bytes_per_pixel;
+    const u32 num_rows = size / tile_row_size;
+    const u32 num_strips = std::min(static_cast<u32>(NumDecodeThreads()), num_rows);
+    const u32 rows_per_strip = num_rows / num_strips;
+
+    // Decodes a range of tile rows. The linear buffer is written bottom-up, so the first tile
+    // rows of the tiled data land at the end of the destination; each strip reads and writes a
+    // disjoint range, so no synchronization is needed beyond the join below.
+    const auto decode_rows = [&](u32 first_row, u32 last_row) {
+        SurfaceParams strip_info = surface_info;
+        strip_info.height = (last_row - first_row) * 8;
+        const u32 strip_size = (last_row - first_row) * tile_row_size;
+        const auto strip_source = source.subspan(first_row * tile_row_size, strip_size);
+        const auto strip_dest = dest.subspan((num_rows - last_row) * linear_row_size,
+                                             (last_row - first_row) * linear_row_size);
+        DecodeTexture(strip_info, strip_info.addr, strip_info.addr + strip_size, strip_source,
+                      strip_dest, convert);
+    };
+
+    auto& workers = GetDecodeWorkers();
+    u32 first_row = 0;
+    for (u32 strip = 0; strip + 1 < num_strips; ++strip) {
+        const u32 last_row = first_row + rows_per_strip;
+        workers.QueueWork(
+            [&decode_rows, first_row, last_row] { decode_rows(first_row, last_row); });
+        first_row = last_row;
+    }
+    // Decode the final strip on this thread while the workers run theirs
+    decode_rows(first_row, num_rows);
+    workers.WaitForRequests();
+}
+
 } // namespace VideoCore
@@ -133,6 +133,14 @@ void EncodeTexture(const SurfaceParams& surface_info, PAddr start_addr, PAddr en
 void DecodeTexture(const SurfaceParams& surface_info, PAddr start_addr, PAddr end_addr,
                    std::span<u8> source, std::span<u8> dest, bool convert = false);
 
+/**
+ * Decodes a texture like DecodeTexture, but splits large tile-row aligned tiled uploads into
+ * horizontal strips that are de-swizzled concurrently on a worker pool. Small, linear or
+ * unaligned uploads take the serial path. Blocks until the whole destination is written.
+ */
+void DecodeTextureParallel(const SurfaceParams& surface_info, PAddr start_addr, PAddr end_addr,
+                           std::span<u8> source, std::span<u8> dest, bool convert = false);
+
 } // namespace VideoCore
 
 namespace std {
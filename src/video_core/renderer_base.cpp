@@ -2,8 +2,12 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include "common/logging/log.h"
+#include "common/perf_counters.h"
 #include "common/settings.h"
 #include "core/core.h"
+#include "core/hw/gpu.h"
 #include "core/frontend/emu_window.h"
 #include "core/tracer/recorder.h"
 #include "video_core/debug_utils/debug_utils.h"
@@ -11,24 +15,109 @@
 
 namespace VideoCore {
 
+namespace {
+/// Per-frame weight of the exponential average of the busy fraction of a frame
+constexpr double DynamicResSmoothing = 0.05;
+/// Smoothed busy fraction above which the governor steps the scale down
+constexpr double DynamicResDownThreshold = 0.95;
+/// Headroom the governor requires before stepping the scale up, after accounting for the
+/// estimated cost increase of the higher scale
+constexpr double DynamicResUpThreshold = 0.85;
+/// Frames to wait after lowering the scale before changing it again
+constexpr u32 DynamicResDownCooldown = 60;
+/// Frames to wait after raising the scale before changing it again. Raising is speculative,
+/// so it backs off for much longer to avoid oscillating in scenes right at the limit.
+constexpr u32 DynamicResUpCooldown = 300;
+/// Smoothed GPU load below which an over-deadline frame is treated as CPU-bound, in which
+/// case the governor keeps the scale since lowering it would only cost image quality
+constexpr double DynamicResGpuBoundThreshold = 0.5;
+} // Anonymous namespace
+
 RendererBase::RendererBase(Core::System& system_, Frontend::EmuWindow& window,
                            Frontend::EmuWindow* secondary_window_)
-    : system{system_}, render_window{window}, secondary_window{secondary_window_} {}
+    : system{system_}, render_window{window}, secondary_window{secondary_window_},
+      frame_settings{Settings::GetFrameSettings()} {}
 
 RendererBase::~RendererBase() = default;
 
 u32 RendererBase::GetResolutionScaleFactor() {
-    const auto graphics_api = Settings::values.graphics_api.GetValue();
-    if (graphics_api == Settings::GraphicsAPI::Software) {
+    if (frame_settings->graphics_api == Settings::GraphicsAPI::Software) {
         // Software renderer always render at native resolution
         return 1;
     }
 
-    const u32 scale_factor = Settings::values.resolution_factor.GetValue();
+    const u32 max_scale = GetMaxResolutionScaleFactor();
+    if (frame_settings->dynamic_resolution && dynamic_res_scale != 0) {
+        return std::min(dynamic_res_scale, max_scale);
+    }
+    return max_scale;
+}
+
+u32 RendererBase::GetMaxResolutionScaleFactor() const {
+    const u32 scale_factor = frame_settings->resolution_factor;
     return scale_factor != 0 ? scale_factor
                              : render_window.GetFramebufferLayout().GetScalingRatio();
 }
 
+void RendererBase::UpdateDynamicResolution() {
+    if (!frame_settings->dynamic_resolution ||
+        frame_settings->graphics_api == Settings::GraphicsAPI::Software) {
+        dynamic_res_scale = 0;
+        return;
+    }
+
+    const u32 max_scale = std::max<u32>(GetMaxResolutionScaleFactor(), 1);
+    if (dynamic_res_scale == 0) {
+        // First frame with the governor active, start at the configured scale
+        dynamic_res_scale = max_scale;
+        smoothed_busy_scale = 0;
+        dynamic_res_cooldown = DynamicResDownCooldown;
+    }
+    dynamic_res_scale = std::min(dynamic_res_scale, max_scale);
+
+    const double busy_scale = system.perf_stats->GetLastFrameBusyScale();
+    smoothed_busy_scale += DynamicResSmoothing * (busy_scale - smoothed_busy_scale);
+
+    // Every scale change flushes the surface cache, so only step once the smoothed load has
+    // settled clearly outside the deadband, and then hold the new scale for a while.
+    if (dynamic_res_cooldown > 0) {
+        dynamic_res_cooldown--;
+        return;
+    }
+
+    // Without GPU timings assume the worst and keep the old behaviour of always stepping down
+    const bool gpu_bound = !gpu_time_available || smoothed_gpu_scale > DynamicResGpuBoundThreshold;
+
+    const u32 scale = dynamic_res_scale;
+    if (smoothed_busy_scale > DynamicResDownThreshold && scale > 1 && gpu_bound) {
+        dynamic_res_scale = scale - 1;
+        dynamic_res_cooldown = DynamicResDownCooldown;
+        LOG_INFO(Render, "Lowering dynamic resolution scale to {} (frame load {:.2f})",
+                 dynamic_res_scale, smoothed_busy_scale);
+    } else if (scale < max_scale) {
+        // Estimate the load at the next scale up from the fill-rate growth; this overestimates
+        // CPU-bound scenes, which only makes raising the scale more conservative
+        const double next_scale = static_cast<double>(scale + 1);
+        const double predicted = smoothed_busy_scale * (next_scale * next_scale) /
+                                 static_cast<double>(scale * scale);
+        if (predicted < DynamicResUpThreshold) {
+            dynamic_res_scale = scale + 1;
+            dynamic_res_cooldown = DynamicResUpCooldown;
+            LOG_INFO(Render, "Raising dynamic resolution scale to {} (frame load {:.2f})",
+                     dynamic_res_scale, smoothed_busy_scale);
+        }
+    }
+}
+
+void RendererBase::ReportGpuFrameTime(u64 gpu_time_us) {
+    Common::PerfCounters::Add(Common::PerfCounters::Counter::GpuFrameUs, gpu_time_us);
+
+    constexpr double FrameLengthUs = 1'000'000.0 / GPU::SCREEN_REFRESH_RATE;
+    const double gpu_scale = static_cast<double>(gpu_time_us) / FrameLengthUs;
+    smoothed_gpu_scale += DynamicResSmoothing * (gpu_scale - smoothed_gpu_scale);
+    gpu_time_available = true;
+}
+
 void RendererBase::UpdateCurrentFramebufferLayout(bool is_portrait_mode) {
     const auto update_layout = [is_portrait_mode](Frontend::EmuWindow& window) {
         const Layout::FramebufferLayout& layout = window.GetFramebufferLayout();
@@ -43,8 +132,14 @@ void RendererBase::UpdateCurrentFramebufferLayout(bool is_portrait_mode) {
 void RendererBase::EndFrame() {
     current_frame++;
 
+    // Pick up any settings changes published since the last frame; everything the renderer
+    // reads per-frame comes from this snapshot so changes apply at the frame boundary
+    frame_settings = Settings::GetFrameSettings();
+
     system.perf_stats->EndSystemFrame();
 
+    UpdateDynamicResolution();
+
     render_window.PollEvents();
 
     system.frame_limiter.DoFrameLimiting(system.CoreTiming().GetGlobalTimeUs());
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include "common/common_types.h"
 #include "core/frontend/framebuffer_layout.h"
 #include "video_core/rasterizer_interface.h"
@@ -12,6 +13,10 @@ namespace Frontend {
 class EmuWindow;
 }
 
+namespace Settings {
+struct FrameSettings;
+}
+
 namespace Core {
 class System;
 }
@@ -62,6 +67,9 @@ public:
     /// Returns the resolution scale factor relative to the native 3DS screen resolution
     u32 GetResolutionScaleFactor();
 
+    /// Returns the highest resolution scale factor the current settings allow
+    u32 GetMaxResolutionScaleFactor() const;
+
     /// Updates the framebuffer layout of the contained render window handle.
     void UpdateCurrentFramebufferLayout(bool is_portrait_mode = {});
 
@@ -102,6 +110,15 @@ public:
     void RequestScreenshot(void* data, std::function<void()> callback,
                            const Layout::FramebufferLayout& layout);
 
+protected:
+    /// Reports the GPU execution time of a completed frame, measured by the backend with
+    /// timestamp queries. Feeds the gpu_frame_us perf counter and the resolution governor.
+    void ReportGpuFrameTime(u64 gpu_time_us);
+
+private:
+    /// Adjusts the dynamic resolution scale from the frame-time feedback in Core::PerfStats
+    void UpdateDynamicResolution();
+
 protected:
     Core::System& system;
     RendererSettings settings;
@@ -109,6 +126,16 @@ protected:
     Frontend::EmuWindow* secondary_window; ///< Reference to the secondary render window handle.
     f32 current_fps = 0.0f;                ///< Current framerate, should be set by the renderer
     int current_frame = 0;                 ///< Current frame, should be set by the renderer
+
+private:
+    /// Settings snapshot the frame renders with, refreshed at the end of each frame so live
+    /// settings changes apply at a clean frame boundary
+    std::shared_ptr<const ::Settings::FrameSettings> frame_settings;
+    u32 dynamic_res_scale = 0;       ///< Scale chosen by the governor, 0 until it first runs
+    double smoothed_busy_scale = 0;  ///< Smoothed fraction of the frame spent emulating
+    u32 dynamic_res_cooldown = 0;    ///< Frames to wait before the next scale change
+    double smoothed_gpu_scale = 0;   ///< Smoothed fraction of the frame the GPU spent executing
+    bool gpu_time_available = false; ///< Whether the backend has reported any GPU timings
 };
 
 } // namespace VideoCore
@@ -42,6 +42,9 @@ void FrameDumperOpenGL::PresentLoop() {
     InitializeOpenGLObjects();
 
     const auto& layout = GetLayout();
+    // Recycled between this thread and the backend via the swap in AddVideoFrame, so the
+    // readback loop settles into a steady state with no per-frame allocations.
+    VideoDumper::VideoFrame frame_data;
     while (!stop_requested.exchange(false)) {
         auto frame = mailbox->TryGetPresentFrame(200);
         if (!frame) {
@@ -65,8 +68,8 @@ void FrameDumperOpenGL::PresentLoop() {
         // Bind the previous PBO and read the pixels
         glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[next_pbo].handle);
         GLubyte* pixels = static_cast<GLubyte*>(glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
-        VideoDumper::VideoFrame frame_data{layout.width, layout.height, pixels};
-        video_dumper.AddVideoFrame(std::move(frame_data));
+        frame_data.Assign(layout.width, layout.height, pixels);
+        video_dumper.AddVideoFrame(frame_data);
         glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
         glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
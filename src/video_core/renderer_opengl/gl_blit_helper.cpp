@@ -12,6 +12,7 @@
 
 #include "video_core/host_shaders/format_reinterpreter/d24s8_to_rgba8_frag.h"
 #include "video_core/host_shaders/format_reinterpreter/rgba4_to_rgb5a1_frag.h"
+#include "video_core/host_shaders/format_reinterpreter/rgba8_to_d24s8_frag.h"
 #include "video_core/host_shaders/full_screen_triangle_vert.h"
 #include "video_core/host_shaders/texture_filtering/bicubic_frag.h"
 #include "video_core/host_shaders/texture_filtering/mmpx_frag.h"
@@ -29,11 +30,6 @@ using VideoCore::SurfaceType;
 
 namespace {
 
-struct TempTexture {
-    OGLTexture tex;
-    OGLFramebuffer fbo;
-};
-
 OGLSampler CreateSampler(GLenum filter) {
     OGLSampler sampler;
     sampler.Create();
@@ -79,6 +75,10 @@ BlitHelper::BlitHelper(const Driver& driver_)
         temp_tex.Create();
         use_texture_view = false;
     }
+    // The shader requires stencil export so only compile it when the driver allows it.
+    if (driver.HasArbShaderStencilExport()) {
+        rgba8_to_d24s8 = CreateProgram(HostShaders::RGBA8_TO_D24S8_FRAG);
+    }
 }
 
 BlitHelper::~BlitHelper() = default;
@@ -150,6 +150,42 @@ bool BlitHelper::ConvertRGBA4ToRGB5A1(Surface& source, Surface& dest,
     return true;
 }
 
+bool BlitHelper::ConvertRGBA8ToDS24S8(Surface& source, Surface& dest,
+                                      const VideoCore::TextureBlit& blit) {
+    if (!driver.HasArbShaderStencilExport()) {
+        return false;
+    }
+
+    OpenGLState prev_state = OpenGLState::GetCurState();
+    SCOPE_EXIT({ prev_state.Apply(); });
+
+    state.texture_units[0].texture_2d = source.Handle();
+    state.texture_units[0].sampler = nearest_sampler.handle;
+    state.depth.test_enabled = true;
+    state.depth.test_func = GL_ALWAYS;
+    state.depth.write_mask = GL_TRUE;
+    state.stencil.test_enabled = true;
+    state.stencil.test_func = GL_ALWAYS;
+    state.stencil.write_mask = 0xFF;
+    state.stencil.action_stencil_fail = GL_REPLACE;
+    state.stencil.action_depth_fail = GL_REPLACE;
+    state.stencil.action_depth_pass = GL_REPLACE;
+
+    SetParams(rgba8_to_d24s8, source.RealExtent(), blit.src_rect);
+    DrawDepthStencil(rgba8_to_d24s8, dest.Handle(), draw_fbo.handle, 0, blit.dst_rect);
+
+    // Restore the state shared with the other helpers
+    state.texture_units[0].sampler = linear_sampler.handle;
+    state.depth.test_enabled = false;
+    state.depth.test_func = GL_LESS;
+    state.stencil.test_enabled = false;
+    state.stencil.action_stencil_fail = GL_KEEP;
+    state.stencil.action_depth_fail = GL_KEEP;
+    state.stencil.action_depth_pass = GL_KEEP;
+
+    return true;
+}
+
 bool BlitHelper::Filter(Surface& surface, const VideoCore::TextureBlit& blit) {
     const auto filter = Settings::values.texture_filter.GetValue();
     const bool is_depth =
@@ -198,23 +234,36 @@ void BlitHelper::FilterAnime4K(Surface& surface, const VideoCore::TextureBlit& b
     const u32 src_height = blit.src_rect.GetHeight();
     const auto temp_rect{blit.src_rect * internal_scale_factor};
 
-    const auto setup_temp_tex = [&](GLint internal_format, GLint format, u32 width, u32 height) {
-        TempTexture texture;
+    const auto setup_temp_tex = [&](TempTexture& texture, GLint internal_format, u32 width,
+                                    u32 height) {
+        if (texture.internal_format == internal_format && texture.width == width &&
+            texture.height == height) {
+            return;
+        }
+        texture.tex.Release();
+        texture.fbo.Release();
         texture.fbo.Create();
         texture.tex.Create();
+        texture.internal_format = internal_format;
+        texture.width = width;
+        texture.height = height;
         state.texture_units[1].texture_2d = texture.tex.handle;
         state.draw.draw_framebuffer = texture.fbo.handle;
         state.Apply();
         glActiveTexture(GL_TEXTURE1);
         glBindTexture(GL_TEXTURE_2D, texture.tex.handle);
         glTexStorage2D(GL_TEXTURE_2D, 1, internal_format, width, height);
-        return texture;
     };
 
-    // Create intermediate textures
-    auto SRC = setup_temp_tex(tuple.internal_format, tuple.format, src_width, src_height);
-    auto XY = setup_temp_tex(GL_RG16F, GL_RG, temp_rect.GetWidth(), temp_rect.GetHeight());
-    auto LUMAD = setup_temp_tex(GL_R16F, GL_RED, temp_rect.GetWidth(), temp_rect.GetHeight());
+    // Set up the shared intermediate textures, reusing the previous allocations when the
+    // incoming surface has the same dimensions as the last one that was filtered.
+    setup_temp_tex(anime4k_src, tuple.internal_format, src_width, src_height);
+    setup_temp_tex(anime4k_xy, GL_RG16F, temp_rect.GetWidth(), temp_rect.GetHeight());
+    setup_temp_tex(anime4k_lumad, GL_R16F, temp_rect.GetWidth(), temp_rect.GetHeight());
+
+    auto& SRC = anime4k_src;
+    auto& XY = anime4k_xy;
+    auto& LUMAD = anime4k_lumad;
 
     // Copy to SRC
     glCopyImageSubData(surface.Handle(0), GL_TEXTURE_2D, 0, blit.src_rect.left,
@@ -311,4 +360,21 @@ void BlitHelper::Draw(OGLProgram& program, GLuint dst_tex, GLuint dst_fbo, u32 d
     glDrawArrays(GL_TRIANGLES, 0, 3);
 }
 
+void BlitHelper::DrawDepthStencil(OGLProgram& program, GLuint dst_tex, GLuint dst_fbo,
+                                  u32 dst_level, Common::Rectangle<u32> dst_rect) {
+    state.draw.draw_framebuffer = dst_fbo;
+    state.draw.shader_program = program.handle;
+    state.viewport.x = dst_rect.left;
+    state.viewport.y = dst_rect.bottom;
+    state.viewport.width = dst_rect.GetWidth();
+    state.viewport.height = dst_rect.GetHeight();
+    state.Apply();
+
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D,
+                           dst_tex, dst_level);
+
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
 } // namespace OpenGL
@@ -29,7 +29,20 @@ public:
 
     bool ConvertRGBA4ToRGB5A1(Surface& source, Surface& dest, const VideoCore::TextureBlit& blit);
 
+    bool ConvertRGBA8ToDS24S8(Surface& source, Surface& dest, const VideoCore::TextureBlit& blit);
+
 private:
+    /// Framebuffer-attached intermediate texture shared across filter invocations. Only
+    /// recreated when the required format or dimensions change, since filters run on every
+    /// texture upload and reallocating render targets per pass is expensive.
+    struct TempTexture {
+        OGLTexture tex;
+        OGLFramebuffer fbo;
+        GLint internal_format{};
+        u32 width{};
+        u32 height{};
+    };
+
     void FilterAnime4K(Surface& surface, const VideoCore::TextureBlit& blit);
 
     void FilterBicubic(Surface& surface, const VideoCore::TextureBlit& blit);
@@ -48,6 +61,9 @@ private:
     void Draw(OGLProgram& program, GLuint dst_tex, GLuint dst_fbo, u32 dst_level,
               Common::Rectangle<u32> dst_rect);
 
+    void DrawDepthStencil(OGLProgram& program, GLuint dst_tex, GLuint dst_fbo, u32 dst_level,
+                          Common::Rectangle<u32> dst_rect);
+
 private:
     const Driver& driver;
     OGLVertexArray vao;
@@ -66,10 +82,15 @@ private:
     OGLProgram refine_program;
     OGLProgram d24s8_to_rgba8;
     OGLProgram rgba4_to_rgb5a1;
+    OGLProgram rgba8_to_d24s8;
 
     OGLTexture temp_tex;
     Common::Rectangle<u32> temp_rect{};
     bool use_texture_view{true};
+
+    TempTexture anime4k_src;
+    TempTexture anime4k_xy;
+    TempTexture anime4k_lumad;
 };
 
 } // namespace OpenGL
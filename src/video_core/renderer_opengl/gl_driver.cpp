@@ -168,9 +168,24 @@ void Driver::CheckExtensionSupport() {
     arb_texture_compression_bptc = GLAD_GL_ARB_texture_compression_bptc;
     ext_clip_cull_distance = GLAD_GL_EXT_clip_cull_distance;
     ext_texture_compression_s3tc = GLAD_GL_EXT_texture_compression_s3tc;
+    // The loader does not generate an entry for this extension as it only adds
+    // a GLSL builtin, so query the extension string directly.
+    arb_shader_stencil_export = HasExtension("GL_ARB_shader_stencil_export");
     is_suitable = GLAD_GL_VERSION_4_3 || GLAD_GL_ES_VERSION_3_1;
 }
 
+bool Driver::HasExtension(std::string_view name) const {
+    GLint num_extensions;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
+    for (GLuint index = 0; index < static_cast<GLuint>(num_extensions); ++index) {
+        const auto extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, index));
+        if (name == extension) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void Driver::FindBugs() {
 #ifdef __unix__
     const bool is_linux = true;
@@ -103,10 +103,16 @@ public:
         return ext_clip_cull_distance;
     }
 
+    /// Returns true if the implementation supports ARB_shader_stencil_export
+    bool HasArbShaderStencilExport() const {
+        return arb_shader_stencil_export;
+    }
+
 private:
     void ReportDriverInfo();
     void DeduceVendor();
     void CheckExtensionSupport();
+    bool HasExtension(std::string_view name) const;
     void FindBugs();
 
 private:
@@ -123,6 +129,7 @@ private:
     bool ext_clip_cull_distance{};
     bool ext_texture_compression_s3tc{};
     bool arb_texture_compression_bptc{};
+    bool arb_shader_stencil_export{};
 
     std::string_view gl_version{};
     std::string_view gpu_vendor{};
@@ -176,6 +176,7 @@ RasterizerOpenGL::RasterizerOpenGL(Memory::MemorySystem& memory,
 RasterizerOpenGL::~RasterizerOpenGL() = default;
 
 void RasterizerOpenGL::TickFrame() {
+    draw_state_dirty = true;
     res_cache.TickFrame();
 }
 
@@ -367,6 +368,16 @@ void RasterizerOpenGL::DrawTriangles() {
 bool RasterizerOpenGL::Draw(bool accelerate, bool is_indexed) {
     MICROPROFILE_SCOPE(OpenGL_Drawing);
 
+    // Consecutive draws that only wrote draw parameters since the previous one reuse its
+    // framebuffer, viewport/scissor, texture bindings and uniforms wholesale. UI-heavy scenes
+    // emit hundreds of such draws per frame and the per-draw sync dominates their host cost.
+    if (accelerate && !draw_state_dirty && cached_draw_framebuffer.has_value()) {
+        const bool succeeded = AccelerateDrawBatchInternal(is_indexed);
+        vertex_batch.clear();
+        res_cache.InvalidateFramebuffer(*cached_draw_framebuffer);
+        return succeeded;
+    }
+
     const bool shadow_rendering = regs.framebuffer.IsShadowRendering();
     const bool has_stencil = regs.framebuffer.HasStencil();
 
@@ -441,8 +452,8 @@ bool RasterizerOpenGL::Draw(bool accelerate, bool is_indexed) {
 
     // Sync and bind the shader
     if (shader_dirty) {
-        shader_program_manager->UseFragmentShader(regs, use_custom_normal);
-        shader_dirty = false;
+        shader_program_manager->UseFragmentShader(regs, shader_dirty, use_custom_normal);
+        shader_dirty = 0;
     }
 
     // Sync the LUTs within the texture buffer
@@ -488,6 +499,15 @@ bool RasterizerOpenGL::Draw(bool accelerate, bool is_indexed) {
 
     res_cache.InvalidateFramebuffer(framebuffer);
 
+    // Shadow draws need the memory barrier between draws, and software draws leave the trivial
+    // shader bound, so only plain accelerated draws arm the state-identical fast path above.
+    if (accelerate && succeeded && !shadow_rendering) {
+        cached_draw_framebuffer = framebuffer;
+        draw_state_dirty = false;
+    } else {
+        cached_draw_framebuffer.reset();
+    }
+
     return succeeded;
 }
 
@@ -709,35 +729,43 @@ void RasterizerOpenGL::NotifyFixedFunctionPicaRegisterChanged(u32 id) {
 }
 
 void RasterizerOpenGL::FlushAll() {
+    draw_state_dirty = true;
     res_cache.FlushAll();
 }
 
 void RasterizerOpenGL::FlushRegion(PAddr addr, u32 size) {
+    draw_state_dirty = true;
     res_cache.FlushRegion(addr, size);
 }
 
 void RasterizerOpenGL::InvalidateRegion(PAddr addr, u32 size) {
+    draw_state_dirty = true;
     res_cache.InvalidateRegion(addr, size);
 }
 
 void RasterizerOpenGL::FlushAndInvalidateRegion(PAddr addr, u32 size) {
+    draw_state_dirty = true;
     res_cache.FlushRegion(addr, size);
     res_cache.InvalidateRegion(addr, size);
 }
 
 void RasterizerOpenGL::ClearAll(bool flush) {
+    draw_state_dirty = true;
     res_cache.ClearAll(flush);
 }
 
 bool RasterizerOpenGL::AccelerateDisplayTransfer(const GPU::Regs::DisplayTransferConfig& config) {
+    draw_state_dirty = true;
     return res_cache.AccelerateDisplayTransfer(config);
 }
 
 bool RasterizerOpenGL::AccelerateTextureCopy(const GPU::Regs::DisplayTransferConfig& config) {
+    draw_state_dirty = true;
     return res_cache.AccelerateTextureCopy(config);
 }
 
 bool RasterizerOpenGL::AccelerateFill(const GPU::Regs::MemoryFillConfig& config) {
+    draw_state_dirty = true;
     return res_cache.AccelerateFill(config);
 }
 
@@ -748,6 +776,7 @@ bool RasterizerOpenGL::AccelerateDisplay(const GPU::Regs::FramebufferConfig& con
         return false;
     }
     MICROPROFILE_SCOPE(OpenGL_Display);
+    draw_state_dirty = true;
 
     VideoCore::SurfaceParams src_params;
     src_params.addr = framebuffer_addr;
@@ -836,6 +865,8 @@ void RasterizerOpenGL::SyncLogicOp() {
     state.logic_op = PicaToGL::LogicOp(regs.framebuffer.output_merger.logic_op);
 
     if (GLES) {
+        // The GLES fragment shader emulates logic ops, so its cache key reads these registers
+        shader_dirty |= VideoCore::ShaderDirtyOutput;
         if (!regs.framebuffer.output_merger.alphablend_enable) {
             if (regs.framebuffer.output_merger.logic_op == Pica::FramebufferRegs::LogicOp::NoOp) {
                 // Color output is disabled by logic operation. We use color write mask to skip
@@ -929,12 +960,9 @@ void RasterizerOpenGL::SyncAndUploadLUTsLF() {
     if (uniform_block_data.lighting_lut_dirty_any || invalidate) {
         for (unsigned index = 0; index < uniform_block_data.lighting_lut_dirty.size(); index++) {
             if (uniform_block_data.lighting_lut_dirty[index] || invalidate) {
-                std::array<Common::Vec2f, 256> new_data;
-                const auto& source_lut = Pica::g_state.lighting.luts[index];
-                std::transform(source_lut.begin(), source_lut.end(), new_data.begin(),
-                               [](const auto& entry) {
-                                   return Common::Vec2f{entry.ToFloat(), entry.DiffToFloat()};
-                               });
+                // The converted mirror is kept up to date as entries are written, so the bank
+                // does not have to be reconverted here
+                const auto& new_data = Pica::g_state.lighting.luts_converted[index];
 
                 if (new_data != lighting_lut_data[index] || invalidate) {
                     lighting_lut_data[index] = new_data;
@@ -1090,7 +1118,9 @@ void RasterizerOpenGL::UploadUniforms(bool accelerate_draw) {
     state.draw.uniform_buffer = uniform_buffer.GetHandle();
     state.Apply();
 
-    bool sync_vs = accelerate_draw;
+    // The VS block binding from the previous draw stays valid while no uniform was written,
+    // so unchanged uniforms are not converted or re-uploaded at all.
+    bool sync_vs = accelerate_draw && vs_uniforms_dirty;
     bool sync_fs = uniform_block_data.dirty;
 
     if (!sync_vs && !sync_fs)
@@ -1104,7 +1134,12 @@ void RasterizerOpenGL::UploadUniforms(bool accelerate_draw) {
     std::tie(uniforms, offset, invalidate) =
         uniform_buffer.Map(uniform_size, uniform_buffer_alignment);
 
-    if (sync_vs) {
+    if (invalidate) {
+        // Orphaning the stream buffer discarded the region the VS binding points at
+        vs_uniforms_dirty = true;
+    }
+
+    if (accelerate_draw && vs_uniforms_dirty) {
         Pica::Shader::VSUniformData vs_uniforms;
         vs_uniforms.uniforms.SetFromRegs(Pica::g_state.regs.vs, Pica::g_state.vs);
         std::memcpy(uniforms + used_bytes, &vs_uniforms, sizeof(vs_uniforms));
@@ -1112,6 +1147,7 @@ void RasterizerOpenGL::UploadUniforms(bool accelerate_draw) {
                           uniform_buffer.GetHandle(), offset + used_bytes,
                           sizeof(Pica::Shader::VSUniformData));
         used_bytes += uniform_size_aligned_vs;
+        vs_uniforms_dirty = false;
     }
 
     if (sync_fs || invalidate) {
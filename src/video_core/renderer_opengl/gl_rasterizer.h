@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <optional>
 #include "core/hw/gpu.h"
 #include "video_core/rasterizer_accelerated.h"
 #include "video_core/rasterizer_cache/rasterizer_cache.h"
@@ -156,6 +157,10 @@ private:
     OGLTexture texture_buffer_lut_rg;
     OGLTexture texture_buffer_lut_rgba;
     bool use_custom_normal{};
+
+    /// Framebuffer the last accelerated draw rendered to, reused by state-identical draws
+    /// while draw_state_dirty stays clear
+    std::optional<Framebuffer> cached_draw_framebuffer;
 };
 
 } // namespace OpenGL
@@ -60,10 +60,13 @@ public:
     ControlFlowAnalyzer(const Pica::Shader::ProgramCode& program_code, u32 main_offset)
         : program_code(program_code) {
 
-        // Recursively finds all subroutines.
+        // Recursively finds all subroutines. A Conditional exit is accepted for the main routine:
+        // parallel paths are merged conservatively, so a program whose every runtime path reaches
+        // an END instruction can still be classified as Conditional. Only a program that provably
+        // never ends is rejected, as it would run past the end of program memory on hardware.
         const Subroutine& program_main = AddSubroutine(main_offset, PROGRAM_END);
-        if (program_main.exit_method != ExitMethod::AlwaysEnd)
-            throw DecompileFail("Program does not always end");
+        if (program_main.exit_method == ExitMethod::AlwaysReturn)
+            throw DecompileFail("Program never ends");
     }
 
     std::set<Subroutine> MoveSubroutines() {
@@ -851,7 +854,11 @@ private:
         // Add the main entry point
         shader.AddLine("bool exec_shader() {{");
         ++shader.scope;
-        CallSubroutine(GetSubroutine(main_offset, PROGRAM_END));
+        const Subroutine& program_main = GetSubroutine(main_offset, PROGRAM_END);
+        CallSubroutine(program_main);
+        if (program_main.exit_method != ExitMethod::AlwaysEnd) {
+            shader.AddLine("return false;");
+        }
         --shader.scope;
         shader.AddLine("}}\n");
 
@@ -47,29 +47,36 @@ ShaderDiskCacheRaw::ShaderDiskCacheRaw(u64 unique_identifier, ProgramType progra
     : unique_identifier{unique_identifier}, program_type{program_type}, config{config},
       program_code{std::move(program_code)} {}
 
-bool ShaderDiskCacheRaw::Load(FileUtil::IOFile& file) {
-    if (file.ReadBytes(&unique_identifier, sizeof(u64)) != sizeof(u64) ||
-        file.ReadBytes(&program_type, sizeof(u32)) != sizeof(u32)) {
+bool ShaderDiskCacheRaw::Load(const std::vector<u8>& data, std::size_t& offset) {
+    const auto read = [&data, &offset](void* dest, std::size_t size) {
+        if (size > data.size() - offset) {
+            return false;
+        }
+        std::memcpy(dest, data.data() + offset, size);
+        offset += size;
+        return true;
+    };
+
+    if (!read(&unique_identifier, sizeof(u64)) || !read(&program_type, sizeof(u32))) {
         return false;
     }
 
     u64 reg_array_len{};
-    if (file.ReadBytes(&reg_array_len, sizeof(u64)) != sizeof(u64)) {
+    if (!read(&reg_array_len, sizeof(u64)) || reg_array_len > config.reg_array.size()) {
         return false;
     }
-
-    if (file.ReadArray(config.reg_array.data(), reg_array_len) != reg_array_len) {
+    if (!read(config.reg_array.data(), reg_array_len * sizeof(u32))) {
         return false;
     }
 
     // Read in type specific configuration
     if (program_type == ProgramType::VS) {
         u64 code_len{};
-        if (file.ReadBytes(&code_len, sizeof(u64)) != sizeof(u64)) {
+        if (!read(&code_len, sizeof(u64)) || code_len > (data.size() - offset) / sizeof(u32)) {
             return false;
         }
         program_code.resize(code_len);
-        if (file.ReadArray(program_code.data(), code_len) != code_len) {
+        if (!read(program_code.data(), code_len * sizeof(u32))) {
             return false;
         }
     }
@@ -123,8 +130,28 @@ std::optional<std::vector<ShaderDiskCacheRaw>> ShaderDiskCache::LoadTransferable
         return std::nullopt;
     }
 
+    // Read the whole file up front and parse from memory; going through stdio for every field
+    // of every entry makes the load time grow painfully with the cache size
+    std::vector<u8> data(transferable_file.GetSize());
+    if (transferable_file.ReadBytes(data.data(), data.size()) != data.size()) {
+        LOG_ERROR(Render_OpenGL, "Failed to read transferable cache for title id={} - removing",
+                  GetTitleID());
+        InvalidateAll();
+        return std::nullopt;
+    }
+    std::size_t offset = 0;
+
+    const auto read_object = [&data, &offset](auto& object) {
+        if (sizeof(object) > data.size() - offset) {
+            return false;
+        }
+        std::memcpy(&object, data.data() + offset, sizeof(object));
+        offset += sizeof(object);
+        return true;
+    };
+
     u32 version{};
-    if (transferable_file.ReadBytes(&version, sizeof(version)) != sizeof(version)) {
+    if (!read_object(version)) {
         LOG_ERROR(Render_OpenGL,
                   "Failed to get transferable cache version for title id={} - removing",
                   GetTitleID());
@@ -145,9 +172,9 @@ std::optional<std::vector<ShaderDiskCacheRaw>> ShaderDiskCache::LoadTransferable
 
     // Version is valid, load the shaders
     std::vector<ShaderDiskCacheRaw> raws;
-    while (transferable_file.Tell() < transferable_file.GetSize()) {
+    while (offset < data.size()) {
         TransferableEntryKind kind{};
-        if (transferable_file.ReadBytes(&kind, sizeof(u32)) != sizeof(u32)) {
+        if (!read_object(kind)) {
             LOG_ERROR(Render_OpenGL, "Failed to read transferable file - removing");
             InvalidateAll();
             return std::nullopt;
@@ -156,7 +183,7 @@ std::optional<std::vector<ShaderDiskCacheRaw>> ShaderDiskCache::LoadTransferable
         switch (kind) {
         case TransferableEntryKind::Raw: {
             ShaderDiskCacheRaw entry;
-            if (!entry.Load(transferable_file)) {
+            if (!entry.Load(data, offset)) {
                 LOG_ERROR(Render_OpenGL, "Failed to load transferable raw entry - removing");
                 InvalidateAll();
                 return std::nullopt;
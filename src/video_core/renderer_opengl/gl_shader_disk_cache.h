@@ -49,7 +49,7 @@ public:
     ShaderDiskCacheRaw() = default;
     ~ShaderDiskCacheRaw() = default;
 
-    bool Load(FileUtil::IOFile& file);
+    bool Load(const std::vector<u8>& data, std::size_t& offset);
 
     bool Save(FileUtil::IOFile& file) const;
 
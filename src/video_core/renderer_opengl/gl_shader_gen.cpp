@@ -2,12 +2,15 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstring>
 #include <string_view>
 #include <fmt/format.h>
 #include "common/bit_set.h"
+#include "common/hash.h"
 #include "common/logging/log.h"
 #include "core/core.h"
 #include "video_core/pica_state.h"
+#include "video_core/rasterizer_accelerated.h"
 #include "video_core/renderer_opengl/gl_shader_decompiler.h"
 #include "video_core/renderer_opengl/gl_shader_gen.h"
 #include "video_core/renderer_opengl/gl_shader_util.h"
@@ -61,9 +64,27 @@ out gl_PerVertex {
 
 PicaFSConfig PicaFSConfig::BuildFromRegs(const Pica::Regs& regs, bool use_normal) {
     PicaFSConfig res{};
+    res.Update(regs, VideoCore::ShaderDirtyAll, use_normal);
+    return res;
+}
 
-    auto& state = res.state;
+void PicaFSConfig::Update(const Pica::Regs& regs, u32 segments, bool use_normal) {
+    if (segments & VideoCore::ShaderDirtyOutput) {
+        UpdateOutputSegment(regs);
+    }
+    if (segments & VideoCore::ShaderDirtyTev) {
+        UpdateTevSegment(regs);
+    }
+    if (segments & VideoCore::ShaderDirtyLighting) {
+        UpdateLightingSegment(regs);
+    }
+    if (segments & VideoCore::ShaderDirtyProcTex) {
+        UpdateProcTexSegment(regs);
+    }
+    state.use_custom_normal_map = use_normal;
+}
 
+void PicaFSConfig::UpdateOutputSegment(const Pica::Regs& regs) {
     state.scissor_test_mode = regs.rasterizer.scissor_test.mode;
 
     state.depthmap_enable = regs.rasterizer.depthmap_enable;
@@ -72,10 +93,6 @@ PicaFSConfig PicaFSConfig::BuildFromRegs(const Pica::Regs& regs, bool use_normal
                                 ? regs.framebuffer.output_merger.alpha_test.func.Value()
                                 : FramebufferRegs::CompareFunc::Always;
 
-    state.texture0_type = regs.texturing.texture0.type;
-
-    state.texture2_use_coord1 = regs.texturing.main_config.texture2_use_coord1 != 0;
-
     if (GLES) {
         // With GLES, we need this in the fragment shader to emulate logic operations
         state.alphablend_enable =
@@ -87,6 +104,17 @@ PicaFSConfig PicaFSConfig::BuildFromRegs(const Pica::Regs& regs, bool use_normal
         state.logic_op = {};
     }
 
+    state.shadow_rendering = regs.framebuffer.output_merger.fragment_operation_mode ==
+                             FramebufferRegs::FragmentOperationMode::Shadow;
+
+    state.shadow_texture_orthographic = regs.texturing.shadow.orthographic != 0;
+}
+
+void PicaFSConfig::UpdateTevSegment(const Pica::Regs& regs) {
+    state.texture0_type = regs.texturing.texture0.type;
+
+    state.texture2_use_coord1 = regs.texturing.main_config.texture2_use_coord1 != 0;
+
     // Copy relevant tev stages fields.
     // We don't sync const_color here because of the high variance, it is a
     // shader uniform instead.
@@ -106,8 +134,12 @@ PicaFSConfig PicaFSConfig::BuildFromRegs(const Pica::Regs& regs, bool use_normal
     state.combiner_buffer_input = regs.texturing.tev_combiner_buffer_input.update_mask_rgb.Value() |
                                   regs.texturing.tev_combiner_buffer_input.update_mask_a.Value()
                                       << 4;
+}
 
-    // Fragment lighting
+void PicaFSConfig::UpdateLightingSegment(const Pica::Regs& regs) {
+    // Clear the whole segment first so the light slots beyond src_num hash identically no
+    // matter what configuration was captured before
+    std::memset(&state.lighting, 0, sizeof(state.lighting));
 
     state.lighting.enable = !regs.lighting.disable;
     state.lighting.src_num = regs.lighting.max_light_index + 1;
@@ -177,6 +209,11 @@ PicaFSConfig PicaFSConfig::BuildFromRegs(const Pica::Regs& regs, bool use_normal
     state.lighting.shadow_invert = regs.lighting.config0.shadow_invert != 0;
     state.lighting.shadow_alpha = regs.lighting.config0.shadow_alpha != 0;
     state.lighting.shadow_selector = regs.lighting.config0.shadow_selector;
+}
+
+void PicaFSConfig::UpdateProcTexSegment(const Pica::Regs& regs) {
+    // Clear first so a disabled unit always hashes to the zeroed configuration
+    std::memset(&state.proctex, 0, sizeof(state.proctex));
 
     state.proctex.enable = regs.texturing.main_config.texture3_enable;
     if (state.proctex.enable) {
@@ -198,15 +235,6 @@ PicaFSConfig PicaFSConfig::BuildFromRegs(const Pica::Regs& regs, bool use_normal
         state.proctex.lod_max = regs.texturing.proctex_lut.lod_max;
         state.proctex.lut_filter = regs.texturing.proctex_lut.filter;
     }
-
-    state.shadow_rendering = regs.framebuffer.output_merger.fragment_operation_mode ==
-                             FramebufferRegs::FragmentOperationMode::Shadow;
-
-    state.shadow_texture_orthographic = regs.texturing.shadow.orthographic != 0;
-
-    state.use_custom_normal_map = use_normal;
-
-    return res;
 }
 
 void PicaShaderConfigCommon::Init(const Pica::ShaderRegs& regs, Pica::Shader::ShaderSetup& setup) {
@@ -1555,6 +1583,321 @@ do {
     return {std::move(out)};
 }
 
+ShaderDecompiler::ProgramResult GenerateTrivialFragmentShader(bool separable_shader) {
+    std::string out;
+    if (separable_shader && !GLES) {
+        out += "#extension GL_ARB_separate_shader_objects : enable\n";
+    }
+
+    if (GLES) {
+        out += fragment_shader_precision_OES;
+    }
+
+    out += GetVertexInterfaceDeclaration(false, separable_shader);
+
+    out += R"(
+out vec4 color;
+
+void main() {
+    color = primary_color;
+}
+)";
+
+    return {std::move(out)};
+}
+
+void UberShaderConfigData::SetFromConfig(const PicaFSConfig& config) {
+    const auto& state = config.state;
+
+    for (std::size_t i = 0; i < state.tev_stages.size(); ++i) {
+        const auto stage = static_cast<TexturingRegs::TevStageConfig>(state.tev_stages[i]);
+        tev_color[i] = Common::MakeVec<u32>(static_cast<u32>(stage.color_source1.Value()),
+                                            static_cast<u32>(stage.color_source2.Value()),
+                                            static_cast<u32>(stage.color_source3.Value()),
+                                            static_cast<u32>(stage.color_op.Value()));
+        tev_alpha[i] = Common::MakeVec<u32>(static_cast<u32>(stage.alpha_source1.Value()),
+                                            static_cast<u32>(stage.alpha_source2.Value()),
+                                            static_cast<u32>(stage.alpha_source3.Value()),
+                                            static_cast<u32>(stage.alpha_op.Value()));
+        tev_color_mod[i] = Common::MakeVec<u32>(static_cast<u32>(stage.color_modifier1.Value()),
+                                                static_cast<u32>(stage.color_modifier2.Value()),
+                                                static_cast<u32>(stage.color_modifier3.Value()),
+                                                stage.GetColorMultiplier());
+        tev_alpha_mod[i] = Common::MakeVec<u32>(static_cast<u32>(stage.alpha_modifier1.Value()),
+                                                static_cast<u32>(stage.alpha_modifier2.Value()),
+                                                static_cast<u32>(stage.alpha_modifier3.Value()),
+                                                stage.GetAlphaMultiplier());
+    }
+
+    u32 update_color_mask = 0;
+    u32 update_alpha_mask = 0;
+    for (u32 i = 0; i < static_cast<u32>(state.tev_stages.size()); ++i) {
+        if (config.TevStageUpdatesCombinerBufferColor(i)) {
+            update_color_mask |= 1 << i;
+        }
+        if (config.TevStageUpdatesCombinerBufferAlpha(i)) {
+            update_alpha_mask |= 1 << i;
+        }
+    }
+    combiner_update = Common::MakeVec<u32>(update_color_mask, update_alpha_mask, 0, 0);
+
+    tex_config = Common::MakeVec<u32>(
+        static_cast<u32>(state.texture0_type), state.texture2_use_coord1 ? 1 : 0,
+        static_cast<u32>(state.alpha_test_func), static_cast<u32>(state.scissor_test_mode));
+    pipeline_config = Common::MakeVec<u32>(static_cast<u32>(state.fog_mode),
+                                           state.fog_flip ? 1 : 0,
+                                           static_cast<u32>(state.depthmap_enable), 0);
+}
+
+ShaderDecompiler::ProgramResult GenerateFragmentUbershader(bool separable_shader) {
+    std::string out;
+    if (separable_shader && !GLES) {
+        out += "#extension GL_ARB_separate_shader_objects : enable\n";
+    }
+
+    if (GLES) {
+        out += fragment_shader_precision_OES;
+    }
+
+    out += GetVertexInterfaceDeclaration(false, separable_shader);
+
+    out += R"(
+#ifndef CITRA_GLES
+in vec4 gl_FragCoord;
+#endif // CITRA_GLES
+
+out vec4 color;
+
+uniform sampler2D tex0;
+uniform sampler2D tex1;
+uniform sampler2D tex2;
+uniform samplerCube tex_cube;
+uniform samplerBuffer texture_buffer_lut_lf;
+)";
+
+    out += UniformBlockDef;
+
+    // All constants compared against below are raw PICA register values; keep them in sync with
+    // UberShaderConfigData::SetFromConfig and the enums in the Pica register definitions.
+    out += R"(
+layout (std140) uniform fs_uber_config {
+    uvec4 tev_color[6];
+    uvec4 tev_alpha[6];
+    uvec4 tev_color_mod[6];
+    uvec4 tev_alpha_mod[6];
+    uvec4 combiner_update;
+    uvec4 tex_config;
+    uvec4 pipeline_config;
+};
+
+float byteround(float x) {
+    return round(x * 255.0) * (1.0 / 255.0);
+}
+
+vec3 byteround(vec3 x) {
+    return round(x * 255.0) * (1.0 / 255.0);
+}
+
+vec4 byteround(vec4 x) {
+    return round(x * 255.0) * (1.0 / 255.0);
+}
+
+// PICA's LOD formula for 2D textures, as in the specialized fragment shader
+float getLod(vec2 coord) {
+    vec2 d = max(abs(dFdx(coord)), abs(dFdy(coord)));
+    return log2(max(d.x, d.y));
+}
+
+vec4 rounded_primary_color;
+vec4 combiner_buffer;
+vec4 last_tex_env_out;
+
+vec4 SampleTexUnit0() {
+    switch (tex_config.x) {
+    case 0u: // Texture2D
+        return textureLod(tex0, texcoord0, getLod(texcoord0 * vec2(textureSize(tex0, 0))) +
+                          tex_lod_bias[0]);
+    case 1u: // TextureCube
+        return texture(tex_cube, vec3(texcoord0, texcoord0_w));
+    case 3u: // Projection2D
+        return textureProj(tex0, vec3(texcoord0, texcoord0_w));
+    default: // Disabled; the shadow types are not ubershader compatible
+        return vec4(0.0);
+    }
+}
+
+vec4 SampleTexUnit2() {
+    vec2 coord = (tex_config.y == 1u) ? texcoord1 : texcoord2;
+    return textureLod(tex2, coord, getLod(coord * vec2(textureSize(tex2, 0))) + tex_lod_bias[2]);
+}
+
+vec4 GetTevSource(uint source, int stage_index) {
+    switch (source) {
+    case 0u: // PrimaryColor
+        return rounded_primary_color;
+    case 3u: // Texture0
+        return SampleTexUnit0();
+    case 4u: // Texture1
+        return textureLod(tex1, texcoord1, getLod(texcoord1 * vec2(textureSize(tex1, 0))) +
+                          tex_lod_bias[1]);
+    case 5u: // Texture2
+        return SampleTexUnit2();
+    case 13u: // PreviousBuffer
+        return combiner_buffer;
+    case 14u: // Constant
+        return const_color[stage_index];
+    case 15u: // Previous
+        return last_tex_env_out;
+    default: // The fragment colors are zero with lighting disabled; Texture3 needs proctex
+        return vec4(0.0);
+    }
+}
+
+vec3 GetColorModifier(uint modifier, vec4 source) {
+    switch (modifier) {
+    case 0u: return source.rgb;
+    case 1u: return vec3(1.0) - source.rgb;
+    case 2u: return source.aaa;
+    case 3u: return vec3(1.0) - source.aaa;
+    case 4u: return source.rrr;
+    case 5u: return vec3(1.0) - source.rrr;
+    case 8u: return source.ggg;
+    case 9u: return vec3(1.0) - source.ggg;
+    case 12u: return source.bbb;
+    case 13u: return vec3(1.0) - source.bbb;
+    default: return vec3(0.0);
+    }
+}
+
+float GetAlphaModifier(uint modifier, vec4 source) {
+    switch (modifier) {
+    case 0u: return source.a;
+    case 1u: return 1.0 - source.a;
+    case 2u: return source.r;
+    case 3u: return 1.0 - source.r;
+    case 4u: return source.g;
+    case 5u: return 1.0 - source.g;
+    case 6u: return source.b;
+    case 7u: return 1.0 - source.b;
+    default: return 0.0;
+    }
+}
+
+vec3 CombineColor(uint op, vec3 s1, vec3 s2, vec3 s3) {
+    vec3 result;
+    switch (op) {
+    case 0u: result = s1; break;                                     // Replace
+    case 1u: result = s1 * s2; break;                                // Modulate
+    case 2u: result = s1 + s2; break;                                // Add
+    case 3u: result = s1 + s2 - vec3(0.5); break;                    // AddSigned
+    case 4u: result = s1 * s3 + s2 * (vec3(1.0) - s3); break;        // Lerp
+    case 5u: result = s1 - s2; break;                                // Subtract
+    case 6u:                                                         // Dot3_RGB
+    case 7u:                                                         // Dot3_RGBA
+        result = vec3(dot(s1 - vec3(0.5), s2 - vec3(0.5)) * 4.0); break;
+    case 8u: result = s1 * s2 + s3; break;                           // MultiplyThenAdd
+    case 9u: result = min(s1 + s2, vec3(1.0)) * s3; break;           // AddThenMultiply
+    default: result = vec3(0.0); break;
+    }
+    return clamp(result, vec3(0.0), vec3(1.0));
+}
+
+float CombineAlpha(uint op, float s1, float s2, float s3) {
+    float result;
+    switch (op) {
+    case 0u: result = s1; break;                                     // Replace
+    case 1u: result = s1 * s2; break;                                // Modulate
+    case 2u: result = s1 + s2; break;                                // Add
+    case 3u: result = s1 + s2 - 0.5; break;                          // AddSigned
+    case 4u: result = s1 * s3 + s2 * (1.0 - s3); break;              // Lerp
+    case 5u: result = s1 - s2; break;                                // Subtract
+    case 8u: result = s1 * s2 + s3; break;                           // MultiplyThenAdd
+    case 9u: result = min(s1 + s2, 1.0) * s3; break;                 // AddThenMultiply
+    default: result = 0.0; break;
+    }
+    return clamp(result, 0.0, 1.0);
+}
+
+void main() {
+    // Scissor test: 1 excludes pixels inside the box, 3 excludes pixels outside it
+    bool scissor_inside = gl_FragCoord.x >= float(scissor_x1) &&
+                          gl_FragCoord.y >= float(scissor_y1) &&
+                          gl_FragCoord.x < float(scissor_x2) &&
+                          gl_FragCoord.y < float(scissor_y2);
+    if (tex_config.w == 1u && scissor_inside) discard;
+    if (tex_config.w == 3u && !scissor_inside) discard;
+
+    float z_over_w = 2.0 * gl_FragCoord.z - 1.0;
+    float depth = z_over_w * depth_scale + depth_offset;
+    if (pipeline_config.z == 0u) { // WBuffering
+        depth /= gl_FragCoord.w;
+    }
+
+    rounded_primary_color = byteround(primary_color);
+    combiner_buffer = vec4(0.0);
+    vec4 next_combiner_buffer = tev_combiner_buffer_color;
+    last_tex_env_out = vec4(0.0);
+
+    for (int i = 0; i < 6; ++i) {
+        vec3 c1 = GetColorModifier(tev_color_mod[i].x, GetTevSource(tev_color[i].x, i));
+        vec3 c2 = GetColorModifier(tev_color_mod[i].y, GetTevSource(tev_color[i].y, i));
+        vec3 c3 = GetColorModifier(tev_color_mod[i].z, GetTevSource(tev_color[i].z, i));
+        vec3 color_out = byteround(CombineColor(tev_color[i].w, c1, c2, c3));
+
+        float alpha_out;
+        if (tev_color[i].w == 7u) { // Dot3_RGBA also writes the result to alpha
+            alpha_out = color_out.r;
+        } else {
+            float a1 = GetAlphaModifier(tev_alpha_mod[i].x, GetTevSource(tev_alpha[i].x, i));
+            float a2 = GetAlphaModifier(tev_alpha_mod[i].y, GetTevSource(tev_alpha[i].y, i));
+            float a3 = GetAlphaModifier(tev_alpha_mod[i].z, GetTevSource(tev_alpha[i].z, i));
+            alpha_out = byteround(CombineAlpha(tev_alpha[i].w, a1, a2, a3));
+        }
+
+        last_tex_env_out =
+            vec4(clamp(color_out * float(tev_color_mod[i].w), vec3(0.0), vec3(1.0)),
+                 clamp(alpha_out * float(tev_alpha_mod[i].w), 0.0, 1.0));
+
+        combiner_buffer = next_combiner_buffer;
+        if ((combiner_update.x & (1u << uint(i))) != 0u) {
+            next_combiner_buffer.rgb = last_tex_env_out.rgb;
+        }
+        if ((combiner_update.y & (1u << uint(i))) != 0u) {
+            next_combiner_buffer.a = last_tex_env_out.a;
+        }
+    }
+
+    // Alpha test
+    int alpha_int = int(last_tex_env_out.a * 255.0);
+    switch (tex_config.z) {
+    case 0u: discard; break;                                 // Never
+    case 2u: if (alpha_int != alphatest_ref) discard; break; // Equal
+    case 3u: if (alpha_int == alphatest_ref) discard; break; // NotEqual
+    case 4u: if (alpha_int >= alphatest_ref) discard; break; // LessThan
+    case 5u: if (alpha_int > alphatest_ref) discard; break;  // LessThanOrEqual
+    case 6u: if (alpha_int <= alphatest_ref) discard; break; // GreaterThan
+    case 7u: if (alpha_int < alphatest_ref) discard; break;  // GreaterThanOrEqual
+    default: break;                                          // Always
+    }
+
+    // Fog combiner
+    if (pipeline_config.x == 5u) {
+        float fog_index = (pipeline_config.y == 1u) ? (1.0 - depth) * 128.0 : depth * 128.0;
+        float fog_i = clamp(floor(fog_index), 0.0, 127.0);
+        float fog_f = fog_index - fog_i;
+        vec2 fog_lut_entry = texelFetch(texture_buffer_lut_lf, int(fog_i) + fog_lut_offset).rg;
+        float fog_factor = clamp(fog_lut_entry.r + fog_lut_entry.g * fog_f, 0.0, 1.0);
+        last_tex_env_out.rgb = mix(fog_color.rgb, last_tex_env_out.rgb, fog_factor);
+    }
+
+    gl_FragDepth = depth;
+    color = byteround(last_tex_env_out);
+}
+)";
+
+    return {std::move(out)};
+}
+
 ShaderDecompiler::ProgramResult GenerateTrivialVertexShader(bool separable_shader) {
     std::string out;
     if (separable_shader && !GLES) {
@@ -1626,8 +1969,17 @@ std::optional<ShaderDecompiler::ProgramResult> GenerateVertexShader(
         setup.program_code, setup.swizzle_data, config.state.main_offset, get_input_reg,
         get_output_reg, config.state.sanitize_mul);
 
-    if (!program_source_opt)
+    if (!program_source_opt) {
+        LOG_WARNING(Render_OpenGL,
+                    "Failed to decompile vertex shader {:016X}; falling back to CPU "
+                    "shader execution",
+                    Common::ComputeHash64(setup.program_code.data(),
+                                          setup.program_code.size() * sizeof(u32)));
+        Core::System::GetInstance().TelemetrySession().AddField(
+            Common::Telemetry::FieldType::Session, "VideoCore_Shader_CpuVertexShaderFallback",
+            true);
         return std::nullopt;
+    }
 
     std::string& program_source = program_source_opt->code;
 
@@ -6,6 +6,7 @@
 #include <functional>
 #include <optional>
 #include "common/hash.h"
+#include "common/vector_math.h"
 #include "video_core/regs.h"
 #include "video_core/shader/shader.h"
 
@@ -133,6 +134,14 @@ struct PicaFSConfig : Common::HashableStruct<PicaFSConfigState> {
     /// Construct a PicaFSConfig with the given Pica register configuration.
     static PicaFSConfig BuildFromRegs(const Pica::Regs& regs, bool use_normal = false);
 
+    /**
+     * Re-reads only the dirty state segments from the Pica registers. `segments` is a mask of
+     * VideoCore::ShaderDirtyFlags; segments left out of the mask keep their previously captured
+     * state, so a persistent config can be kept up to date across draws without copying the
+     * whole register state every time part of it changes.
+     */
+    void Update(const Pica::Regs& regs, u32 segments, bool use_normal = false);
+
     bool TevStageUpdatesCombinerBufferColor(unsigned stage_index) const {
         return (stage_index < 4) && (state.combiner_buffer_input & (1 << stage_index));
     }
@@ -140,8 +149,42 @@ struct PicaFSConfig : Common::HashableStruct<PicaFSConfigState> {
     bool TevStageUpdatesCombinerBufferAlpha(unsigned stage_index) const {
         return (stage_index < 4) && ((state.combiner_buffer_input >> 4) & (1 << stage_index));
     }
+
+private:
+    void UpdateOutputSegment(const Pica::Regs& regs);
+    void UpdateTevSegment(const Pica::Regs& regs);
+    void UpdateLightingSegment(const Pica::Regs& regs);
+    void UpdateProcTexSegment(const Pica::Regs& regs);
 };
 
+/**
+ * Uniform structure for the fragment ubershader configuration block. It carries the subset of
+ * PicaFSConfigState the ubershader evaluates at draw time instead of baking into specialized
+ * GLSL, so one program can cover any compatible TEV configuration while the specialized shader
+ * compiles in the background. All register enums are stored as their raw numeric values; the
+ * generated GLSL switches on the same constants.
+ * NOTE: the vec4-at-the-end rule from Pica::Shader::UniformData also applies here.
+ */
+struct UberShaderConfigData {
+    void SetFromConfig(const PicaFSConfig& config);
+
+    // Per TEV stage: the three color/alpha sources and the combiner operation
+    alignas(16) std::array<Common::Vec4u, 6> tev_color;
+    alignas(16) std::array<Common::Vec4u, 6> tev_alpha;
+    // Per TEV stage: the three color/alpha modifiers and the result multiplier
+    alignas(16) std::array<Common::Vec4u, 6> tev_color_mod;
+    alignas(16) std::array<Common::Vec4u, 6> tev_alpha_mod;
+    // x = stage mask updating the combiner buffer color, y = same for alpha
+    alignas(16) Common::Vec4u combiner_update;
+    // x = texture0_type, y = texture2_use_coord1, z = alpha_test_func, w = scissor_test_mode
+    alignas(16) Common::Vec4u tex_config;
+    // x = fog_mode, y = fog_flip, z = depthmap_enable
+    alignas(16) Common::Vec4u pipeline_config;
+};
+
+static_assert(sizeof(UberShaderConfigData) == 432,
+              "The size of the UberShaderConfigData does not match the structure in the shader");
+
 /**
  * This struct contains common information to identify a GL vertex/geometry shader generated from
  * PICA vertex/geometry shader.
@@ -230,6 +273,24 @@ ShaderDecompiler::ProgramResult GenerateFixedGeometryShader(const PicaFixedGSCon
 ShaderDecompiler::ProgramResult GenerateFragmentShader(const PicaFSConfig& config,
                                                        bool separable_shader);
 
+/**
+ * Generates the GLSL fragment shader program source code that outputs the interpolated vertex
+ * color unmodified. Used as a placeholder while the real fragment shader compiles asynchronously.
+ * @param separable_shader generates shader that can be used for separate shader object
+ * @returns String of the shader source code
+ */
+ShaderDecompiler::ProgramResult GenerateTrivialFragmentShader(bool separable_shader);
+
+/**
+ * Generates the GLSL fragment ubershader program source code. The ubershader reads the TEV
+ * configuration from the fs_uber_config uniform block at draw time instead of specializing on a
+ * PicaFSConfig, so it can stand in for any compatible configuration while the specialized shader
+ * compiles asynchronously.
+ * @param separable_shader generates shader that can be used for separate shader object
+ * @returns String of the shader source code
+ */
+ShaderDecompiler::ProgramResult GenerateFragmentUbershader(bool separable_shader);
+
 } // namespace OpenGL
 
 namespace std {
@@ -3,17 +3,23 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <set>
 #include <thread>
 #include <unordered_map>
 #include <variant>
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "core/frontend/emu_window.h"
 #include "video_core/renderer_opengl/gl_driver.h"
 #include "video_core/renderer_opengl/gl_resource_manager.h"
 #include "video_core/renderer_opengl/gl_shader_disk_cache.h"
 #include "video_core/renderer_opengl/gl_shader_manager.h"
 #include "video_core/renderer_opengl/gl_state.h"
+#include "video_core/renderer_opengl/gl_vars.h"
 #include "video_core/shader/shader_uniforms.h"
 #include "video_core/video_core.h"
 
@@ -107,28 +113,30 @@ static void SetShaderUniformBlockBindings(GLuint shader) {
                                  sizeof(Pica::Shader::UniformData));
     SetShaderUniformBlockBinding(shader, "vs_config", Pica::Shader::UniformBindings::VS,
                                  sizeof(Pica::Shader::VSUniformData));
+    SetShaderUniformBlockBinding(shader, "fs_uber_config",
+                                 Pica::Shader::UniformBindings::FSUberConfig,
+                                 sizeof(UberShaderConfigData));
 }
 
 static void SetShaderSamplerBinding(GLuint shader, const char* name,
                                     TextureUnits::TextureUnit binding) {
     GLint uniform_tex = glGetUniformLocation(shader, name);
     if (uniform_tex != -1) {
-        glUniform1i(uniform_tex, binding.id);
+        glProgramUniform1i(shader, uniform_tex, binding.id);
     }
 }
 
 static void SetShaderImageBinding(GLuint shader, const char* name, GLuint binding) {
     GLint uniform_tex = glGetUniformLocation(shader, name);
     if (uniform_tex != -1) {
-        glUniform1i(uniform_tex, static_cast<GLint>(binding));
+        glProgramUniform1i(shader, uniform_tex, static_cast<GLint>(binding));
     }
 }
 
+// The bindings are set with glProgramUniform so that the program doesn't have to be bound first.
+// This keeps the function safe to call from the shared contexts used for asynchronous shader
+// compilation, which don't track their state with OpenGLState.
 static void SetShaderSamplerBindings(GLuint shader) {
-    OpenGLState cur_state = OpenGLState::GetCurState();
-    GLuint old_program = std::exchange(cur_state.draw.shader_program, shader);
-    cur_state.Apply();
-
     // Set the texture samplers to correspond to different texture units
     SetShaderSamplerBinding(shader, "tex0", TextureUnits::PicaTexture(0));
     SetShaderSamplerBinding(shader, "tex1", TextureUnits::PicaTexture(1));
@@ -148,9 +156,6 @@ static void SetShaderSamplerBindings(GLuint shader) {
     SetShaderImageBinding(shader, "shadow_texture_ny", ImageUnits::ShadowTextureNY);
     SetShaderImageBinding(shader, "shadow_texture_pz", ImageUnits::ShadowTexturePZ);
     SetShaderImageBinding(shader, "shadow_texture_nz", ImageUnits::ShadowTextureNZ);
-
-    cur_state.draw.shader_program = old_program;
-    cur_state.Apply();
 }
 
 /**
@@ -167,6 +172,9 @@ public:
         }
     }
 
+    OGLShaderStage(OGLShaderStage&& other) noexcept
+        : shader_or_program{std::move(other.shader_or_program)}, is_done{other.IsDone()} {}
+
     void Create(const char* source, GLenum type) {
         if (shader_or_program.index() == 0) {
             std::get<OGLShader>(shader_or_program).Create(source, type);
@@ -197,8 +205,106 @@ public:
         shader_or_program = std::move(program);
     }
 
+    /// Returns true unless an asynchronous compile of this stage is still pending
+    bool IsDone() const {
+        return is_done.load(std::memory_order_acquire);
+    }
+
+    void MarkPending() {
+        is_done.store(false, std::memory_order_relaxed);
+    }
+
+    void MarkDone() {
+        is_done.store(true, std::memory_order_release);
+    }
+
 private:
     std::variant<OGLShader, OGLProgram> shader_or_program;
+    std::atomic_bool is_done{true};
+};
+
+/**
+ * Compiles shader stages on worker threads whose contexts share objects with the main context.
+ * Stages that are requested again while still pending can be moved to the front of the queue so
+ * that shaders the game is actually waiting on finish first.
+ */
+class AsyncCompiler {
+public:
+    explicit AsyncCompiler(Frontend::EmuWindow& emu_window) {
+        const std::size_t num_workers{std::max(1U, std::thread::hardware_concurrency() / 2)};
+        contexts.resize(num_workers);
+        workers.reserve(num_workers);
+        for (std::size_t i = 0; i < num_workers; ++i) {
+            contexts[i] = emu_window.CreateSharedContext();
+            // Release the context, so it can be immediately used by the spawned thread
+            contexts[i]->DoneCurrent();
+            workers.emplace_back(&AsyncCompiler::WorkerLoop, this, contexts[i].get());
+        }
+    }
+
+    ~AsyncCompiler() {
+        {
+            std::scoped_lock lock{queue_mutex};
+            stop = true;
+        }
+        queue_cv.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    void QueueCompile(OGLShaderStage& stage, std::string code, GLenum type) {
+        {
+            std::scoped_lock lock{queue_mutex};
+            work_queue.push_back(WorkItem{&stage, std::move(code), type});
+        }
+        queue_cv.notify_one();
+    }
+
+    /// Moves the pending compile of the provided stage to the front of the queue
+    void Prioritize(const OGLShaderStage& stage) {
+        std::scoped_lock lock{queue_mutex};
+        const auto it = std::find_if(work_queue.begin(), work_queue.end(), [&stage](auto& item) {
+            return item.stage == &stage;
+        });
+        if (it != work_queue.begin() && it != work_queue.end()) {
+            std::rotate(work_queue.begin(), it, it + 1);
+        }
+    }
+
+private:
+    struct WorkItem {
+        OGLShaderStage* stage;
+        std::string code;
+        GLenum type;
+    };
+
+    void WorkerLoop(Frontend::GraphicsContext* context) {
+        const auto scope = context->Acquire();
+        for (;;) {
+            WorkItem item{};
+            {
+                std::unique_lock lock{queue_mutex};
+                queue_cv.wait(lock, [this] { return stop || !work_queue.empty(); });
+                if (stop) {
+                    return;
+                }
+                item = std::move(work_queue.front());
+                work_queue.pop_front();
+            }
+            item.stage->Create(item.code.c_str(), item.type);
+            // Flush to guarantee the main context can observe the linked program
+            glFlush();
+            item.stage->MarkDone();
+        }
+    }
+
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<WorkItem> work_queue;
+    bool stop = false;
+    std::vector<std::unique_ptr<Frontend::GraphicsContext>> contexts;
+    std::vector<std::thread> workers;
 };
 
 class TrivialVertexShader {
@@ -214,22 +320,81 @@ private:
     OGLShaderStage program;
 };
 
+class TrivialFragmentShader {
+public:
+    explicit TrivialFragmentShader(bool separable) : program(separable) {
+        program.Create(GenerateTrivialFragmentShader(separable).code.c_str(), GL_FRAGMENT_SHADER);
+    }
+    GLuint Get() const {
+        return program.GetHandle();
+    }
+
+private:
+    OGLShaderStage program;
+};
+
+class UberFragmentShader {
+public:
+    explicit UberFragmentShader(bool separable) : program(separable) {
+        program.Create(GenerateFragmentUbershader(separable).code.c_str(), GL_FRAGMENT_SHADER);
+    }
+    GLuint Get() const {
+        return program.GetHandle();
+    }
+
+private:
+    OGLShaderStage program;
+};
+
+/// Returns true if the ubershader can render the given fragment configuration while the
+/// specialized shader compiles. Fragment lighting, procedural textures and the shadow pipeline
+/// are not covered; those configurations fall back to the passthrough placeholder.
+static bool IsUbershaderCompatible(const PicaFSConfigState& state) {
+    if (state.lighting.enable || state.proctex.enable || state.shadow_rendering ||
+        state.use_custom_normal_map) {
+        return false;
+    }
+    if (state.texture0_type == Pica::TexturingRegs::TextureConfig::Shadow2D ||
+        state.texture0_type == Pica::TexturingRegs::TextureConfig::ShadowCube) {
+        return false;
+    }
+    if (state.fog_mode == Pica::TexturingRegs::FogMode::Gas) {
+        return false;
+    }
+    // The GLES logic op emulation specializes on the logic op
+    if (GLES && !state.alphablend_enable &&
+        state.logic_op != Pica::FramebufferRegs::LogicOp::Copy) {
+        return false;
+    }
+    return true;
+}
+
 template <typename KeyConfigType,
           ShaderDecompiler::ProgramResult (*CodeGenerator)(const KeyConfigType&, bool),
           GLenum ShaderType>
 class ShaderCache {
 public:
     explicit ShaderCache(bool separable) : separable(separable) {}
-    std::tuple<GLuint, std::optional<ShaderDecompiler::ProgramResult>> Get(
+
+    void SetAsyncCompiler(AsyncCompiler* compiler) {
+        async_compiler = compiler;
+    }
+
+    std::tuple<OGLShaderStage*, std::optional<ShaderDecompiler::ProgramResult>> Get(
         const KeyConfigType& config) {
         auto [iter, new_shader] = shaders.emplace(config, OGLShaderStage{separable});
         OGLShaderStage& cached_shader = iter->second;
         std::optional<ShaderDecompiler::ProgramResult> result{};
         if (new_shader) {
             result = CodeGenerator(config, separable);
-            cached_shader.Create(result->code.c_str(), ShaderType);
+            if (async_compiler) {
+                cached_shader.MarkPending();
+                async_compiler->QueueCompile(cached_shader, result->code, ShaderType);
+            } else {
+                cached_shader.Create(result->code.c_str(), ShaderType);
+            }
         }
-        return {cached_shader.GetHandle(), std::move(result)};
+        return {&cached_shader, std::move(result)};
     }
 
     void Inject(const KeyConfigType& key, OGLProgram&& program) {
@@ -244,6 +409,7 @@ public:
 
 private:
     bool separable;
+    AsyncCompiler* async_compiler = nullptr;
     std::unordered_map<KeyConfigType, OGLShaderStage> shaders;
 };
 
@@ -259,7 +425,12 @@ template <typename KeyConfigType,
 class ShaderDoubleCache {
 public:
     explicit ShaderDoubleCache(bool separable) : separable(separable) {}
-    std::tuple<GLuint, std::optional<ShaderDecompiler::ProgramResult>> Get(
+
+    void SetAsyncCompiler(AsyncCompiler* compiler) {
+        async_compiler = compiler;
+    }
+
+    std::tuple<OGLShaderStage*, std::optional<ShaderDecompiler::ProgramResult>> Get(
         const KeyConfigType& key, const Pica::Shader::ShaderSetup& setup) {
         std::optional<ShaderDecompiler::ProgramResult> result{};
         auto map_it = shader_map.find(key);
@@ -267,7 +438,7 @@ public:
             auto program_opt = CodeGenerator(setup, key, separable);
             if (!program_opt) {
                 shader_map[key] = nullptr;
-                return {0, std::nullopt};
+                return {nullptr, std::nullopt};
             }
 
             std::string& program = program_opt->code;
@@ -276,17 +447,22 @@ public:
             if (new_shader) {
                 result.emplace();
                 result->code = program;
-                cached_shader.Create(program.c_str(), ShaderType);
+                if (async_compiler) {
+                    cached_shader.MarkPending();
+                    async_compiler->QueueCompile(cached_shader, program, ShaderType);
+                } else {
+                    cached_shader.Create(program.c_str(), ShaderType);
+                }
             }
             shader_map[key] = &cached_shader;
-            return {cached_shader.GetHandle(), std::move(result)};
+            return {&cached_shader, std::move(result)};
         }
 
         if (map_it->second == nullptr) {
-            return {0, std::nullopt};
+            return {nullptr, std::nullopt};
         }
 
-        return {map_it->second->GetHandle(), std::nullopt};
+        return {map_it->second, std::nullopt};
     }
 
     void Inject(const KeyConfigType& key, std::string decomp, OGLProgram&& program) {
@@ -305,6 +481,7 @@ public:
 
 private:
     bool separable;
+    AsyncCompiler* async_compiler = nullptr;
     std::unordered_map<KeyConfigType, OGLShaderStage*> shader_map;
     std::unordered_map<std::string, OGLShaderStage> shader_cache;
 };
@@ -322,11 +499,46 @@ public:
     explicit Impl(bool separable)
         : separable(separable), programmable_vertex_shaders(separable),
           trivial_vertex_shader(separable), fixed_geometry_shaders(separable),
-          fragment_shaders(separable), disk_cache(separable) {
+          fragment_shaders(separable), trivial_fragment_shader(separable),
+          disk_cache(separable) {
         if (separable)
             pipeline.Create();
     }
 
+    void EnableAsyncCompilation(Frontend::EmuWindow& emu_window) {
+        async_compiler = std::make_unique<AsyncCompiler>(emu_window);
+        programmable_vertex_shaders.SetAsyncCompiler(async_compiler.get());
+        fixed_geometry_shaders.SetAsyncCompiler(async_compiler.get());
+        fragment_shaders.SetAsyncCompiler(async_compiler.get());
+
+        // The ubershader stands in for compatible fragment configurations while their
+        // specialized shader compiles, so it is only needed when compiles are asynchronous
+        uber_fragment_shader = std::make_unique<UberFragmentShader>(separable);
+        uber_config_buffer.Create();
+        OpenGLState state = OpenGLState::GetCurState();
+        state.draw.uniform_buffer = uber_config_buffer.handle;
+        state.Apply();
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(UberShaderConfigData), nullptr, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER,
+                         static_cast<GLuint>(Pica::Shader::UniformBindings::FSUberConfig),
+                         uber_config_buffer.handle);
+    }
+
+    /// Binds the ubershader as the current fragment stage and syncs its configuration block
+    void UseUberFragmentShader(const PicaFSConfig& config) {
+        UberShaderConfigData data;
+        data.SetFromConfig(config);
+        const u64 hash = Common::ComputeHash64(&data, sizeof(data));
+        if (hash != uber_config_hash) {
+            uber_config_hash = hash;
+            OpenGLState state = OpenGLState::GetCurState();
+            state.draw.uniform_buffer = uber_config_buffer.handle;
+            state.Apply();
+            glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(data), &data);
+        }
+        current.fs = uber_fragment_shader->Get();
+    }
+
     struct ShaderTuple {
         std::size_t vs_hash = 0;
         std::size_t gs_hash = 0;
@@ -363,27 +575,46 @@ public:
     FixedGeometryShaders fixed_geometry_shaders;
 
     FragmentShaders fragment_shaders;
+    TrivialFragmentShader trivial_fragment_shader;
+    /// Branching fragment shader driven by the fs_uber_config uniform block; stands in for
+    /// compatible configurations while their specialized shader compiles
+    std::unique_ptr<UberFragmentShader> uber_fragment_shader;
+    OGLBuffer uber_config_buffer;
+    u64 uber_config_hash = 0;
+    /// Fragment shader whose compile is pending while the ubershader or the trivial placeholder
+    /// renders instead
+    OGLShaderStage* pending_fs = nullptr;
+    /// Incrementally updated fragment shader lookup key; only the register segments marked
+    /// dirty since the previous lookup are re-read when it is refreshed
+    PicaFSConfig current_fs_config{};
     std::unordered_map<u64, OGLProgram> program_cache;
     OGLPipeline pipeline;
     ShaderDiskCache disk_cache;
+    /// Destroyed first so no worker references a cached shader stage during teardown
+    std::unique_ptr<AsyncCompiler> async_compiler;
 };
 
 ShaderProgramManager::ShaderProgramManager(Frontend::EmuWindow& emu_window_, const Driver& driver_,
                                            bool separable)
     : emu_window{emu_window_}, driver{driver_},
       strict_context_required{emu_window.StrictContextRequired()}, impl{std::make_unique<Impl>(
-                                                                       separable)} {}
+                                                                       separable)} {
+    // Worker threads need contexts that share objects with the main context, which strict
+    // context platforms cannot provide.
+    if (Settings::values.async_shader_compilation.GetValue() && separable &&
+        !strict_context_required) {
+        impl->EnableAsyncCompilation(emu_window);
+    }
+}
 
 ShaderProgramManager::~ShaderProgramManager() = default;
 
 bool ShaderProgramManager::UseProgrammableVertexShader(const Pica::Regs& regs,
                                                        Pica::Shader::ShaderSetup& setup) {
     PicaVSConfig config{regs.vs, setup};
-    auto [handle, result] = impl->programmable_vertex_shaders.Get(config, setup);
-    if (handle == 0)
+    auto [shader, result] = impl->programmable_vertex_shaders.Get(config, setup);
+    if (!shader)
         return false;
-    impl->current.vs = handle;
-    impl->current.vs_hash = config.Hash();
 
     // Save VS to the disk cache if its a new shader
     if (result) {
@@ -397,6 +628,15 @@ bool ShaderProgramManager::UseProgrammableVertexShader(const Pica::Regs& regs,
         disk_cache.SaveRaw(raw);
         disk_cache.SaveDecompiled(unique_identifier, *result, VideoCore::g_hw_shader_accurate_mul);
     }
+
+    if (!shader->IsDone()) {
+        // Fall back to the software vertex pipeline until the worker finishes compiling
+        impl->async_compiler->Prioritize(*shader);
+        return false;
+    }
+
+    impl->current.vs = shader->GetHandle();
+    impl->current.vs_hash = config.Hash();
     return true;
 }
 
@@ -407,8 +647,14 @@ void ShaderProgramManager::UseTrivialVertexShader() {
 
 void ShaderProgramManager::UseFixedGeometryShader(const Pica::Regs& regs) {
     PicaFixedGSConfig gs_config(regs);
-    auto [handle, _] = impl->fixed_geometry_shaders.Get(gs_config);
-    impl->current.gs = handle;
+    auto [shader, _] = impl->fixed_geometry_shaders.Get(gs_config);
+    if (shader->IsDone()) {
+        impl->current.gs = shader->GetHandle();
+    } else {
+        // Omit the geometry stage until the worker finishes compiling
+        impl->async_compiler->Prioritize(*shader);
+        impl->current.gs = 0;
+    }
     impl->current.gs_hash = gs_config.Hash();
 }
 
@@ -417,10 +663,25 @@ void ShaderProgramManager::UseTrivialGeometryShader() {
     impl->current.gs_hash = 0;
 }
 
-void ShaderProgramManager::UseFragmentShader(const Pica::Regs& regs, bool use_normal) {
-    PicaFSConfig config = PicaFSConfig::BuildFromRegs(regs, use_normal);
-    auto [handle, result] = impl->fragment_shaders.Get(config);
-    impl->current.fs = handle;
+void ShaderProgramManager::UseFragmentShader(const Pica::Regs& regs, u32 dirty_segments,
+                                             bool use_normal) {
+    PicaFSConfig& config = impl->current_fs_config;
+    config.Update(regs, dirty_segments, use_normal);
+    auto [shader, result] = impl->fragment_shaders.Get(config);
+    if (shader->IsDone()) {
+        impl->current.fs = shader->GetHandle();
+        impl->pending_fs = nullptr;
+    } else {
+        // Draw with the ubershader (or the passthrough placeholder for configurations it cannot
+        // represent) for now; ApplyTo swaps the specialized program in on a later draw once it
+        // has linked
+        if (impl->uber_fragment_shader && IsUbershaderCompatible(config.state)) {
+            impl->UseUberFragmentShader(config);
+        } else {
+            impl->current.fs = impl->trivial_fragment_shader.Get();
+        }
+        impl->pending_fs = shader;
+    }
     impl->current.fs_hash = config.Hash();
     // Save FS to the disk cache if its a new shader
     if (result) {
@@ -433,6 +694,16 @@ void ShaderProgramManager::UseFragmentShader(const Pica::Regs& regs, bool use_no
 }
 
 void ShaderProgramManager::ApplyTo(OpenGLState& state) {
+    if (impl->pending_fs) {
+        if (impl->pending_fs->IsDone()) {
+            impl->current.fs = impl->pending_fs->GetHandle();
+            impl->pending_fs = nullptr;
+        } else {
+            // The placeholder is still being drawn with, so bump the compile priority
+            impl->async_compiler->Prioritize(*impl->pending_fs);
+        }
+    }
+
     if (impl->separable) {
         if (driver.HasBug(DriverBug::ShaderStageChangeFreeze)) {
             glUseProgramStages(
@@ -490,6 +761,39 @@ void ShaderProgramManager::LoadDiskCache(const std::atomic_bool& stop_loading,
         callback(VideoCore::LoadCallbackStage::Decompile, 0, raws.size());
     }
     std::vector<std::size_t> load_raws_index;
+
+    // Splits the work between worker threads that each own a context shared with the main one,
+    // so program binaries can be loaded and linked in parallel
+    const auto RunOnWorkers = [&](std::size_t amount, const auto& work) {
+        if (!strict_context_required) {
+            const std::size_t num_workers{std::max(1U, std::thread::hardware_concurrency())};
+            const std::size_t bucket_size{amount / num_workers};
+            std::vector<std::unique_ptr<Frontend::GraphicsContext>> contexts(num_workers);
+            std::vector<std::thread> threads(num_workers);
+
+            emu_window.SaveContext();
+            for (std::size_t i = 0; i < num_workers; ++i) {
+                const bool is_last_worker = i + 1 == num_workers;
+                const std::size_t start{bucket_size * i};
+                const std::size_t end{is_last_worker ? amount : start + bucket_size};
+
+                // On some platforms the shared context has to be created from the GUI thread
+                contexts[i] = emu_window.CreateSharedContext();
+                // Release the context, so it can be immediately used by the spawned thread
+                contexts[i]->DoneCurrent();
+                threads[i] = std::thread(work, start, end, contexts[i].get());
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            emu_window.RestoreContext();
+        } else {
+            const auto dummy_context{std::make_unique<Frontend::GraphicsContext>()};
+            work(0, amount, dummy_context.get());
+        }
+    };
+
+    std::size_t loaded_precompiled = 0; // It doesn't have be atomic since it's used behind a mutex
     // Loads both decompiled and precompiled shaders from the cache. If either one is missing for
     const auto LoadPrecompiledShader = [&](std::size_t begin, std::size_t end,
                                            const std::vector<ShaderDiskCacheRaw>& raw_cache,
@@ -509,6 +813,7 @@ void ShaderProgramManager::LoadDiskCache(const std::atomic_bool& stop_loading,
                           "Invalid hash in entry={:016x} (obtained hash={:016x}) - removing "
                           "shader cache",
                           raw.GetUniqueIdentifier(), calculated_hash);
+                std::scoped_lock lock(mutex);
                 disk_cache.InvalidateAll();
                 return;
             }
@@ -558,8 +863,11 @@ void ShaderProgramManager::LoadDiskCache(const std::atomic_bool& stop_loading,
                 std::scoped_lock lock(mutex);
                 load_raws_index.push_back(i);
             }
+
+            std::scoped_lock lock(mutex);
             if (callback) {
-                callback(VideoCore::LoadCallbackStage::Decompile, i, raw_cache.size());
+                callback(VideoCore::LoadCallbackStage::Decompile, ++loaded_precompiled,
+                         raw_cache.size());
             }
         }
     };
@@ -598,7 +906,11 @@ void ShaderProgramManager::LoadDiskCache(const std::atomic_bool& stop_loading,
     };
 
     if (impl->separable) {
-        LoadPrecompiledShader(0, raws.size(), raws, decompiled, dumps);
+        RunOnWorkers(raws.size(), [&](std::size_t begin, std::size_t end,
+                                      Frontend::GraphicsContext* context) {
+            const auto scope = context->Acquire();
+            LoadPrecompiledShader(begin, end, raws, decompiled, dumps);
+        });
     } else {
         LoadPrecompiledProgram(decompiled, dumps);
     }
@@ -628,7 +940,7 @@ void ShaderProgramManager::LoadDiskCache(const std::atomic_bool& stop_loading,
 
     std::size_t built_shaders = 0; // It doesn't have be atomic since it's used behind a mutex
     const auto LoadRawSepareble = [&](std::size_t begin, std::size_t end,
-                                      Frontend::GraphicsContext* context = nullptr) {
+                                      Frontend::GraphicsContext* context) {
         const auto scope = context->Acquire();
         for (std::size_t i = begin; i < end; ++i) {
             if (stop_loading || compilation_failed) {
@@ -642,20 +954,39 @@ void ShaderProgramManager::LoadDiskCache(const std::atomic_bool& stop_loading,
             bool sanitize_mul = false;
             GLuint handle{0};
             std::optional<ShaderDecompiler::ProgramResult> result;
+            bool reused_decompiled = false;
+            // Reuses the decompiled GLSL loaded from the precompiled file so only the program
+            // binary has to be rebuilt, e.g. after a driver update rejected every dump. Entries
+            // with empty code only carry the sanitize_mul setting and cannot be reused.
+            const auto ReuseDecompiled = [&](bool expected_sanitize_mul) {
+                const auto decomp = decompiled.find(unique_identifier);
+                if (decomp != decompiled.end() && !decomp->second.result.code.empty() &&
+                    decomp->second.sanitize_mul == expected_sanitize_mul) {
+                    result = decomp->second.result;
+                    reused_decompiled = true;
+                }
+            };
             // Otherwise decompile and build the shader at boot and save the result to the
             // precompiled file
             if (raw.GetProgramType() == ProgramType::VS) {
                 auto [conf, setup] = BuildVSConfigFromRaw(raw);
-                result = GenerateVertexShader(setup, conf, impl->separable);
+                sanitize_mul = conf.state.sanitize_mul;
+                ReuseDecompiled(sanitize_mul);
+                if (!reused_decompiled) {
+                    result = GenerateVertexShader(setup, conf, impl->separable);
+                }
                 OGLShaderStage stage{impl->separable};
                 stage.Create(result->code.c_str(), GL_VERTEX_SHADER);
                 handle = stage.GetHandle();
-                sanitize_mul = conf.state.sanitize_mul;
                 std::scoped_lock lock(mutex);
                 impl->programmable_vertex_shaders.Inject(conf, result->code, std::move(stage));
             } else if (raw.GetProgramType() == ProgramType::FS) {
                 PicaFSConfig conf = PicaFSConfig::BuildFromRegs(raw.GetRawShaderConfig());
-                result = GenerateFragmentShader(conf, impl->separable);
+                // Fragment shaders are always saved with sanitize_mul disabled
+                ReuseDecompiled(false);
+                if (!reused_decompiled) {
+                    result = GenerateFragmentShader(conf, impl->separable);
+                }
                 OGLShaderStage stage{impl->separable};
                 stage.Create(result->code.c_str(), GL_FRAGMENT_SHADER);
                 handle = stage.GetHandle();
@@ -675,9 +1006,13 @@ void ShaderProgramManager::LoadDiskCache(const std::atomic_bool& stop_loading,
             }
 
             std::scoped_lock lock(mutex);
-            // If this is a new separable shader, add it the precompiled cache
+            // If this is a new separable shader, add it the precompiled cache. A reused
+            // decompilation is already in the virtual precompiled file unless that file was
+            // invalidated above, so only rewrite it in that case.
             if (result) {
-                disk_cache.SaveDecompiled(unique_identifier, *result, sanitize_mul);
+                if (!reused_decompiled || load_all_raws) {
+                    disk_cache.SaveDecompiled(unique_identifier, *result, sanitize_mul);
+                }
                 disk_cache.SaveDump(unique_identifier, handle);
                 precompiled_cache_altered = true;
             }
@@ -688,32 +1023,7 @@ void ShaderProgramManager::LoadDiskCache(const std::atomic_bool& stop_loading,
         }
     };
 
-    if (!strict_context_required) {
-        const std::size_t num_workers{std::max(1U, std::thread::hardware_concurrency())};
-        const std::size_t bucket_size{load_raws_size / num_workers};
-        std::vector<std::unique_ptr<Frontend::GraphicsContext>> contexts(num_workers);
-        std::vector<std::thread> threads(num_workers);
-
-        emu_window.SaveContext();
-        for (std::size_t i = 0; i < num_workers; ++i) {
-            const bool is_last_worker = i + 1 == num_workers;
-            const std::size_t start{bucket_size * i};
-            const std::size_t end{is_last_worker ? load_raws_size : start + bucket_size};
-
-            // On some platforms the shared context has to be created from the GUI thread
-            contexts[i] = emu_window.CreateSharedContext();
-            // Release the context, so it can be immediately used by the spawned thread
-            contexts[i]->DoneCurrent();
-            threads[i] = std::thread(LoadRawSepareble, start, end, contexts[i].get());
-        }
-        for (auto& thread : threads) {
-            thread.join();
-        }
-        emu_window.RestoreContext();
-    } else {
-        const auto dummy_context{std::make_unique<Frontend::GraphicsContext>()};
-        LoadRawSepareble(0, load_raws_size, dummy_context.get());
-    }
+    RunOnWorkers(load_raws_size, LoadRawSepareble);
 
     if (compilation_failed) {
         disk_cache.InvalidateAll();
@@ -41,7 +41,10 @@ public:
 
     void UseTrivialGeometryShader();
 
-    void UseFragmentShader(const Pica::Regs& config, bool use_normal);
+    /// Looks up the fragment shader for the current register state. Only the state segments in
+    /// `dirty_segments` (a mask of VideoCore::ShaderDirtyFlags) are re-read from the registers;
+    /// the rest is reused from the previous lookup.
+    void UseFragmentShader(const Pica::Regs& config, u32 dirty_segments, bool use_normal);
 
     void ApplyTo(OpenGLState& state);
 
@@ -212,41 +212,84 @@ void OpenGLState::Apply() const {
     }
 
     // Textures
-    for (u32 i = 0; i < texture_units.size(); ++i) {
-        if (texture_units[i].texture_2d != cur_state.texture_units[i].texture_2d) {
-            glActiveTexture(TextureUnits::PicaTexture(i).Enum());
-            glBindTexture(GL_TEXTURE_2D, texture_units[i].texture_2d);
+    if (GLAD_GL_ARB_multi_bind) {
+        // Units 0-6 hold the PICA textures, the LUT texture buffers and the cube map in that
+        // order, so changed bindings can be folded into a single multi-bind call. Each texture
+        // is bound to the target it was created with; a zero entry unbinds the unit.
+        const std::array<GLuint, 7> textures = {
+            texture_units[0].texture_2d,          texture_units[1].texture_2d,
+            texture_units[2].texture_2d,          texture_buffer_lut_lf.texture_buffer,
+            texture_buffer_lut_rg.texture_buffer, texture_buffer_lut_rgba.texture_buffer,
+            texture_cube_unit.texture_cube,
+        };
+        const std::array<GLuint, 7> cur_textures = {
+            cur_state.texture_units[0].texture_2d,
+            cur_state.texture_units[1].texture_2d,
+            cur_state.texture_units[2].texture_2d,
+            cur_state.texture_buffer_lut_lf.texture_buffer,
+            cur_state.texture_buffer_lut_rg.texture_buffer,
+            cur_state.texture_buffer_lut_rgba.texture_buffer,
+            cur_state.texture_cube_unit.texture_cube,
+        };
+        if (textures != cur_textures) {
+            glBindTextures(0, static_cast<GLsizei>(textures.size()), textures.data());
         }
-        if (texture_units[i].sampler != cur_state.texture_units[i].sampler) {
-            glBindSampler(i, texture_units[i].sampler);
+
+        const std::array<GLuint, 7> samplers = {
+            texture_units[0].sampler, texture_units[1].sampler, texture_units[2].sampler, 0, 0, 0,
+            texture_cube_unit.sampler,
+        };
+        const std::array<GLuint, 7> cur_samplers = {
+            cur_state.texture_units[0].sampler,
+            cur_state.texture_units[1].sampler,
+            cur_state.texture_units[2].sampler,
+            0,
+            0,
+            0,
+            cur_state.texture_cube_unit.sampler,
+        };
+        if (samplers != cur_samplers) {
+            glBindSamplers(0, static_cast<GLsizei>(samplers.size()), samplers.data());
+        }
+    } else {
+        for (u32 i = 0; i < texture_units.size(); ++i) {
+            if (texture_units[i].texture_2d != cur_state.texture_units[i].texture_2d) {
+                glActiveTexture(TextureUnits::PicaTexture(i).Enum());
+                glBindTexture(GL_TEXTURE_2D, texture_units[i].texture_2d);
+            }
+            if (texture_units[i].sampler != cur_state.texture_units[i].sampler) {
+                glBindSampler(i, texture_units[i].sampler);
+            }
         }
-    }
 
-    if (texture_cube_unit.texture_cube != cur_state.texture_cube_unit.texture_cube) {
-        glActiveTexture(TextureUnits::TextureCube.Enum());
-        glBindTexture(GL_TEXTURE_CUBE_MAP, texture_cube_unit.texture_cube);
-    }
-    if (texture_cube_unit.sampler != cur_state.texture_cube_unit.sampler) {
-        glBindSampler(TextureUnits::TextureCube.id, texture_cube_unit.sampler);
-    }
+        if (texture_cube_unit.texture_cube != cur_state.texture_cube_unit.texture_cube) {
+            glActiveTexture(TextureUnits::TextureCube.Enum());
+            glBindTexture(GL_TEXTURE_CUBE_MAP, texture_cube_unit.texture_cube);
+        }
+        if (texture_cube_unit.sampler != cur_state.texture_cube_unit.sampler) {
+            glBindSampler(TextureUnits::TextureCube.id, texture_cube_unit.sampler);
+        }
 
-    // Texture buffer LUTs
-    if (texture_buffer_lut_lf.texture_buffer != cur_state.texture_buffer_lut_lf.texture_buffer) {
-        glActiveTexture(TextureUnits::TextureBufferLUT_LF.Enum());
-        glBindTexture(GL_TEXTURE_BUFFER, texture_buffer_lut_lf.texture_buffer);
-    }
+        // Texture buffer LUTs
+        if (texture_buffer_lut_lf.texture_buffer !=
+            cur_state.texture_buffer_lut_lf.texture_buffer) {
+            glActiveTexture(TextureUnits::TextureBufferLUT_LF.Enum());
+            glBindTexture(GL_TEXTURE_BUFFER, texture_buffer_lut_lf.texture_buffer);
+        }
 
-    // Texture buffer LUTs
-    if (texture_buffer_lut_rg.texture_buffer != cur_state.texture_buffer_lut_rg.texture_buffer) {
-        glActiveTexture(TextureUnits::TextureBufferLUT_RG.Enum());
-        glBindTexture(GL_TEXTURE_BUFFER, texture_buffer_lut_rg.texture_buffer);
-    }
+        // Texture buffer LUTs
+        if (texture_buffer_lut_rg.texture_buffer !=
+            cur_state.texture_buffer_lut_rg.texture_buffer) {
+            glActiveTexture(TextureUnits::TextureBufferLUT_RG.Enum());
+            glBindTexture(GL_TEXTURE_BUFFER, texture_buffer_lut_rg.texture_buffer);
+        }
 
-    // Texture buffer LUTs
-    if (texture_buffer_lut_rgba.texture_buffer !=
-        cur_state.texture_buffer_lut_rgba.texture_buffer) {
-        glActiveTexture(TextureUnits::TextureBufferLUT_RGBA.Enum());
-        glBindTexture(GL_TEXTURE_BUFFER, texture_buffer_lut_rgba.texture_buffer);
+        // Texture buffer LUTs
+        if (texture_buffer_lut_rgba.texture_buffer !=
+            cur_state.texture_buffer_lut_rgba.texture_buffer) {
+            glActiveTexture(TextureUnits::TextureBufferLUT_RGBA.Enum());
+            glBindTexture(GL_TEXTURE_BUFFER, texture_buffer_lut_rgba.texture_buffer);
+        }
     }
 
     // Shadow Images
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <limits>
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/microprofile.h"
@@ -10,6 +11,8 @@
 
 MICROPROFILE_DEFINE(OpenGL_StreamBuffer, "OpenGL", "Stream Buffer Orphaning",
                     MP_RGB(128, 128, 192));
+MICROPROFILE_DEFINE(OpenGL_StreamBufferWait, "OpenGL", "Stream Buffer Wait",
+                    MP_RGB(192, 128, 128));
 
 namespace OpenGL {
 
@@ -32,12 +35,19 @@ OGLStreamBuffer::OGLStreamBuffer(Driver& driver, GLenum target, GLsizeiptr size,
         glBufferStorage(gl_target, allocate_size, nullptr, flags);
         mapped_ptr = static_cast<u8*>(glMapBufferRange(
             gl_target, 0, buffer_size, flags | (coherent ? 0 : GL_MAP_FLUSH_EXPLICIT_BIT)));
+        region_size = buffer_size / NUM_SYNC_REGIONS;
     } else {
         glBufferData(gl_target, allocate_size, nullptr, GL_STREAM_DRAW);
     }
 }
 
 OGLStreamBuffer::~OGLStreamBuffer() {
+    for (GLsync& fence : fences) {
+        if (fence) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
     if (persistent) {
         glBindBuffer(gl_target, gl_buffer.handle);
         glUnmapBuffer(gl_target);
@@ -66,16 +76,18 @@ std::tuple<u8*, GLintptr, bool> OGLStreamBuffer::Map(GLsizeiptr size, GLintptr a
     if (buffer_pos + size > buffer_size) {
         buffer_pos = 0;
         invalidate = true;
-
-        if (persistent) {
-            glUnmapBuffer(gl_target);
-        }
     }
 
-    if (invalidate || !persistent) {
+    if (persistent) {
+        // Fence the regions fully written since the last allocation; the commands consuming
+        // them have been issued by now. On a wrap this covers the abandoned buffer tail.
+        const std::size_t passed_region = invalidate ? NUM_SYNC_REGIONS : RegionOf(buffer_pos);
+        InsertFences(fence_cursor, passed_region);
+        fence_cursor = invalidate ? 0 : passed_region;
+        WaitFences(buffer_pos, size);
+    } else {
         MICROPROFILE_SCOPE(OpenGL_StreamBuffer);
-        GLbitfield flags = GL_MAP_WRITE_BIT | (persistent ? GL_MAP_PERSISTENT_BIT : 0) |
-                           (coherent ? GL_MAP_COHERENT_BIT : GL_MAP_FLUSH_EXPLICIT_BIT) |
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT |
                            (invalidate ? GL_MAP_INVALIDATE_BUFFER_BIT : GL_MAP_UNSYNCHRONIZED_BIT);
         mapped_ptr = static_cast<u8*>(
             glMapBufferRange(gl_target, buffer_pos, buffer_size - buffer_pos, flags));
@@ -99,4 +111,26 @@ void OGLStreamBuffer::Unmap(GLsizeiptr size) {
     buffer_pos += size;
 }
 
+void OGLStreamBuffer::InsertFences(std::size_t begin_region, std::size_t end_region) {
+    for (std::size_t region = begin_region; region < end_region; region++) {
+        if (fences[region]) {
+            glDeleteSync(fences[region]);
+        }
+        fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+}
+
+void OGLStreamBuffer::WaitFences(GLintptr start, GLsizeiptr size) {
+    const std::size_t end_region = RegionOf(start + size - 1);
+    for (std::size_t region = RegionOf(start); region <= end_region; region++) {
+        if (fences[region]) {
+            MICROPROFILE_SCOPE(OpenGL_StreamBufferWait);
+            glClientWaitSync(fences[region], GL_SYNC_FLUSH_COMMANDS_BIT,
+                             std::numeric_limits<GLuint64>::max());
+            glDeleteSync(fences[region]);
+            fences[region] = nullptr;
+        }
+    }
+}
+
 } // namespace OpenGL
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <tuple>
 #include "video_core/renderer_opengl/gl_resource_manager.h"
 
@@ -32,6 +33,19 @@ public:
 
     void Unmap(GLsizeiptr size);
 
+private:
+    /// Returns the index of the sync region that contains the given buffer offset
+    std::size_t RegionOf(GLintptr pos) const {
+        return static_cast<std::size_t>(pos / region_size);
+    }
+
+    /// Inserts fences for the regions [begin_region, end_region), which have been fully
+    /// written and whose consuming draw commands have already been issued
+    void InsertFences(std::size_t begin_region, std::size_t end_region);
+
+    /// Blocks until any fences guarding the range [start, start + size) have signaled
+    void WaitFences(GLintptr start, GLsizeiptr size);
+
 private:
     OGLBuffer gl_buffer;
     GLenum gl_target;
@@ -44,6 +58,13 @@ private:
     GLintptr mapped_offset = 0;
     GLsizeiptr mapped_size = 0;
     u8* mapped_ptr = nullptr;
+
+    /// The persistently mapped buffer is divided into sync regions each guarded by a fence,
+    /// so reusing a region after a wrap only waits if the GPU is still consuming it.
+    static constexpr std::size_t NUM_SYNC_REGIONS = 16;
+    std::array<GLsync, NUM_SYNC_REGIONS> fences{};
+    GLsizeiptr region_size = 0;
+    std::size_t fence_cursor = 0;
 };
 
 } // namespace OpenGL
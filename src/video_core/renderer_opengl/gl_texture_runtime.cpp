@@ -152,6 +152,10 @@ bool TextureRuntime::NeedsConversion(VideoCore::PixelFormat pixel_format) const
     return driver.IsOpenGLES() && should_convert;
 }
 
+bool TextureRuntime::IsCustomFormatSupported(VideoCore::CustomPixelFormat format) const {
+    return driver.IsCustomFormatSupported(format);
+}
+
 VideoCore::StagingData TextureRuntime::FindStaging(u32 size, bool upload) {
     if (size > staging_buffer.size()) {
         staging_buffer.resize(size);
@@ -252,6 +256,8 @@ bool TextureRuntime::Reinterpret(Surface& source, Surface& dest,
     ASSERT_MSG(src_format != dst_format, "Reinterpretation with the same format is invalid");
     if (src_format == PixelFormat::D24S8 && dst_format == PixelFormat::RGBA8) {
         blit_helper.ConvertDS24S8ToRGBA8(source, dest, blit);
+    } else if (src_format == PixelFormat::RGBA8 && dst_format == PixelFormat::D24S8) {
+        return blit_helper.ConvertRGBA8ToDS24S8(source, dest, blit);
     } else if (src_format == PixelFormat::RGBA4 && dst_format == PixelFormat::RGB5A1) {
         blit_helper.ConvertRGBA4ToRGB5A1(source, dest, blit);
     } else {
@@ -84,6 +84,9 @@ public:
     /// Returns true if the provided pixel format cannot be used natively by the runtime.
     bool NeedsConversion(VideoCore::PixelFormat pixel_format) const;
 
+    /// Returns true if the provided custom pixel format can be sampled natively.
+    bool IsCustomFormatSupported(VideoCore::CustomPixelFormat format) const;
+
     /// Maps an internal staging buffer of the provided size of pixel uploads/downloads
     VideoCore::StagingData FindStaging(u32 size, bool upload);
 
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstring>
 #include <queue>
 #include "common/logging/log.h"
 #include "common/microprofile.h"
@@ -122,6 +123,7 @@ public:
         if (free_queue.empty()) {
             auto frame = present_queue.back();
             present_queue.pop_back();
+            dropped_frames++;
             return frame;
         }
 
@@ -150,6 +152,7 @@ public:
         Frontend::Frame* frame = present_queue.front();
         present_queue.pop_front();
         // remove all old entries from the present queue and move them back to the free_queue
+        dropped_frames += static_cast<u32>(present_queue.size());
         for (auto f : present_queue) {
             free_queue.push(f);
         }
@@ -318,7 +321,10 @@ RendererOpenGL::RendererOpenGL(Core::System& system, Frontend::EmuWindow& window
                                                     *this, driver);
 }
 
-RendererOpenGL::~RendererOpenGL() = default;
+RendererOpenGL::~RendererOpenGL() {
+    // A capture may still be in flight; its requester is waiting on the completion callback
+    FinishScreenshot(true);
+}
 
 void RendererOpenGL::SwapBuffers() {
     // Maintain the rasterizer's state as a priority
@@ -330,12 +336,14 @@ void RendererOpenGL::SwapBuffers() {
 
     const auto& main_layout = render_window.GetFramebufferLayout();
     RenderToMailbox(main_layout, render_window.mailbox, false);
+    DrainDroppedFrames(*render_window.mailbox);
 
 #ifndef ANDROID
     if (Settings::values.layout_option.GetValue() == Settings::LayoutOption::SeparateWindows) {
         ASSERT(secondary_window);
         const auto& secondary_layout = secondary_window->GetFramebufferLayout();
         RenderToMailbox(secondary_layout, secondary_window->mailbox, false);
+        DrainDroppedFrames(*secondary_window->mailbox);
         secondary_window->PollEvents();
     }
 #endif
@@ -347,13 +355,50 @@ void RendererOpenGL::SwapBuffers() {
         }
     }
 
+    TickGpuTimer();
+
     EndFrame();
     prev_state.Apply();
 
     rasterizer->TickFrame();
 }
 
+void RendererOpenGL::TickGpuTimer() {
+    if (gpu_time_queries[0].handle == 0) {
+        return;
+    }
+
+    if (gpu_time_query_active) {
+        glEndQuery(GL_TIME_ELAPSED);
+        gpu_time_issued++;
+    }
+
+    // Harvest completed queries oldest-first. A result is only waited for when its slot is
+    // about to be reused, which with the ring polled every frame practically never happens.
+    while (gpu_time_harvested < gpu_time_issued) {
+        const OGLQuery& query = gpu_time_queries[gpu_time_harvested % NumGpuTimeQueries];
+        if (gpu_time_issued - gpu_time_harvested < NumGpuTimeQueries) {
+            GLuint available = GL_FALSE;
+            glGetQueryObjectuiv(query.handle, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available == GL_FALSE) {
+                break;
+            }
+        }
+        GLuint64 gpu_time_ns = 0;
+        glGetQueryObjectui64v(query.handle, GL_QUERY_RESULT, &gpu_time_ns);
+        ReportGpuFrameTime(gpu_time_ns / 1000);
+        gpu_time_harvested++;
+    }
+
+    glBeginQuery(GL_TIME_ELAPSED, gpu_time_queries[gpu_time_issued % NumGpuTimeQueries].handle);
+    gpu_time_query_active = true;
+}
+
 void RendererOpenGL::RenderScreenshot() {
+    // Finish the previous capture first; wait for it only when a new one is about to reuse the
+    // readback buffer
+    FinishScreenshot(settings.screenshot_requested);
+
     if (settings.screenshot_requested.exchange(false)) {
         // Draw this frame to the screenshot framebuffer
         screenshot_framebuffer.Create();
@@ -373,17 +418,59 @@ void RendererOpenGL::RenderScreenshot() {
 
         DrawScreens(layout, false);
 
+        // Read into a pixel buffer instead of client memory, so the call queues a GPU-side copy
+        // and returns without draining the pipeline; the result is collected in a later frame
+        // once the fence signals
+        screenshot_dest = settings.screenshot_bits;
+        screenshot_callback = std::move(settings.screenshot_complete_callback);
+        screenshot_data_size = layout.width * layout.height * 4;
+
+        screenshot_pbo.Create();
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, screenshot_pbo.handle);
+        glBufferData(GL_PIXEL_PACK_BUFFER, screenshot_data_size, nullptr, GL_STREAM_READ);
         glReadPixels(0, 0, layout.width, layout.height, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV,
-                     settings.screenshot_bits);
+                     nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        screenshot_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 
         screenshot_framebuffer.Release();
         state.draw.read_framebuffer = old_read_fb;
         state.draw.draw_framebuffer = old_draw_fb;
         state.Apply();
         glDeleteRenderbuffers(1, &renderbuffer);
+    }
+}
+
+void RendererOpenGL::FinishScreenshot(bool blocking) {
+    if (screenshot_fence == nullptr) {
+        return;
+    }
 
-        settings.screenshot_complete_callback();
+    const GLuint64 timeout = blocking ? 1'000'000'000 : 0;
+    const GLenum status =
+        glClientWaitSync(screenshot_fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+    if (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED) {
+        if (!blocking) {
+            return;
+        }
+        // Give up waiting and collect whatever the GPU has produced
+        LOG_WARNING(Render_OpenGL, "Timed out waiting for screenshot readback");
+    }
+    glDeleteSync(screenshot_fence);
+    screenshot_fence = nullptr;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, screenshot_pbo.handle);
+    const GLubyte* pixels =
+        static_cast<const GLubyte*>(glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+    if (pixels != nullptr) {
+        std::memcpy(screenshot_dest, pixels, screenshot_data_size);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
     }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    screenshot_pbo.Release();
+
+    screenshot_callback();
+    screenshot_callback = nullptr;
 }
 
 void RendererOpenGL::PrepareRendertarget() {
@@ -423,6 +510,13 @@ void RendererOpenGL::PrepareRendertarget() {
     }
 }
 
+void RendererOpenGL::DrainDroppedFrames(Frontend::TextureMailbox& mailbox) {
+    const u32 dropped = mailbox.dropped_frames.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        system.perf_stats->AddDroppedFrames(dropped);
+    }
+}
+
 void RendererOpenGL::RenderToMailbox(const Layout::FramebufferLayout& layout,
                                      std::unique_ptr<Frontend::TextureMailbox>& mailbox,
                                      bool flipped) {
@@ -562,6 +656,14 @@ void RendererOpenGL::InitOpenGLObjects() {
     filter_sampler.Create();
     ReloadSampler();
 
+    // Timer queries are desktop-only; GLES needs EXT_disjoint_timer_query which the
+    // Android drivers we care about implement too unreliably to trust
+    if (!GLES) {
+        for (auto& query : gpu_time_queries) {
+            query.Create();
+        }
+    }
+
     ReloadShader();
 
     // Generate VBO handle for drawing
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <functional>
 #include "core/hw/gpu.h"
 #include "video_core/renderer_base.h"
 #include "video_core/renderer_opengl/frame_dumper_opengl.h"
@@ -76,8 +77,15 @@ private:
     void ReloadShader();
     void PrepareRendertarget();
     void RenderScreenshot();
+    /// Completes an in-flight asynchronous screenshot readback once its fence has signaled,
+    /// or waits for it when blocking is requested
+    void FinishScreenshot(bool blocking);
     void RenderToMailbox(const Layout::FramebufferLayout& layout,
                          std::unique_ptr<Frontend::TextureMailbox>& mailbox, bool flipped);
+    /// Ends the elapsed-time query covering the frame, harvests completed queries without
+    /// stalling and starts the query for the next frame
+    void TickGpuTimer();
+    void DrainDroppedFrames(Frontend::TextureMailbox& mailbox);
     void ConfigureFramebufferTexture(TextureInfo& texture,
                                      const GPU::Regs::FramebufferConfig& framebuffer);
     void DrawScreens(const Layout::FramebufferLayout& layout, bool flipped);
@@ -111,6 +119,14 @@ private:
     OGLFramebuffer screenshot_framebuffer;
     OGLSampler filter_sampler;
 
+    // In-flight asynchronous screenshot readback. The destination pointer and callback are
+    // captured when the capture is issued, so a subsequent request cannot clobber them.
+    OGLBuffer screenshot_pbo;
+    GLsync screenshot_fence = nullptr;
+    void* screenshot_dest = nullptr;
+    std::function<void()> screenshot_callback;
+    std::size_t screenshot_data_size = 0;
+
     /// Display information for top and bottom screens respectively
     std::array<ScreenInfo, 3> screen_infos;
 
@@ -128,6 +144,14 @@ private:
     GLuint attrib_position;
     GLuint attrib_tex_coord;
 
+    // Ring of GL_TIME_ELAPSED queries measuring the GPU execution time of each frame;
+    // results are read a few frames later so the GPU is never stalled for them
+    static constexpr std::size_t NumGpuTimeQueries = 4;
+    std::array<OGLQuery, NumGpuTimeQueries> gpu_time_queries;
+    u64 gpu_time_issued = 0;    ///< Total frame queries ended so far
+    u64 gpu_time_harvested = 0; ///< Total frame queries whose results were read back
+    bool gpu_time_query_active = false;
+
     FrameDumperOpenGL frame_dumper;
 };
 
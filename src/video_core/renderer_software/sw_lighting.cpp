@@ -9,15 +9,13 @@ namespace Pica {
 
 static float LookupLightingLut(const Pica::State::Lighting& lighting, std::size_t lut_index,
                                u8 index, float delta) {
-    ASSERT_MSG(lut_index < lighting.luts.size(), "Out of range lut");
-    ASSERT_MSG(index < lighting.luts[lut_index].size(), "Out of range index");
+    ASSERT_MSG(lut_index < lighting.luts_converted.size(), "Out of range lut");
+    ASSERT_MSG(index < lighting.luts_converted[lut_index].size(), "Out of range index");
 
-    const auto& lut = lighting.luts[lut_index][index];
-
-    float lut_value = lut.ToFloat();
-    float lut_diff = lut.DiffToFloat();
-
-    return lut_value + lut_diff * delta;
+    // The converted mirror holds (value, difference) as host floats, so no fixed-point
+    // conversion is needed per lookup
+    const auto& lut = lighting.luts_converted[lut_index][index];
+    return lut.x + lut.y * delta;
 }
 
 std::tuple<Common::Vec4<u8>, Common::Vec4<u8>> ComputeFragmentsColors(
@@ -2,15 +2,130 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <atomic>
+#include <thread>
+#include "common/ring_buffer.h"
+#include "common/settings.h"
+#include "common/thread_worker.h"
 #include "video_core/renderer_software/sw_clipper.h"
 #include "video_core/renderer_software/sw_rasterizer.h"
+#include "video_core/shader/shader.h"
 
 namespace VideoCore {
 
+/// Clips and rasterizes assembled triangles on a worker thread, overlapping them with vertex
+/// processing and primitive assembly on the GPU thread. The queue is bounded: the producer spins
+/// when the rasterizer falls behind. The rasterizer reads Pica registers and guest memory, so the
+/// owner must call Drain() before either may change.
+class RasterizerSoftware::AsyncPipeline {
+public:
+    AsyncPipeline() = default;
+
+    ~AsyncPipeline() {
+        Drain();
+    }
+
+    void Push(const Pica::Shader::OutputVertex& v0, const Pica::Shader::OutputVertex& v1,
+              const Pica::Shader::OutputVertex& v2) {
+        const TriangleJob job{v0, v1, v2};
+        while (queue.Push(&job, 1) == 0) {
+            // The rasterizer is more than a full queue behind; wait for it to catch up
+            std::this_thread::yield();
+        }
+        if (!consumer_active.exchange(true, std::memory_order_acq_rel)) {
+            worker.QueueWork([this] { Consume(); });
+        }
+    }
+
+    bool Idle() const {
+        return queue.Size() == 0 && !consumer_active.load(std::memory_order_acquire);
+    }
+
+    void Drain() {
+        // A triangle pushed while the consumer task is retiring re-queues a task (see Consume),
+        // so a non-empty queue always has a task in flight that WaitForRequests can wait on.
+        worker.WaitForRequests();
+        while (!Idle()) {
+            std::this_thread::yield();
+            worker.WaitForRequests();
+        }
+    }
+
+private:
+    struct TriangleJob {
+        Pica::Shader::OutputVertex v0, v1, v2;
+    };
+
+    void Consume() {
+        TriangleJob job;
+        while (true) {
+            while (queue.Pop(&job, 1) == 1) {
+                Pica::Clipper::ProcessTriangle(job.v0, job.v1, job.v2);
+            }
+            consumer_active.store(false, std::memory_order_release);
+            // The producer may have pushed after the final Pop while still observing an active
+            // consumer; reclaim the queue if so, otherwise a new task owns it
+            if (queue.Size() == 0 ||
+                consumer_active.exchange(true, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+    }
+
+    Common::RingBuffer<TriangleJob, 1024> queue;
+    std::atomic_bool consumer_active{false};
+    Common::ThreadWorker worker{1, "SW rasterizer"};
+};
+
+RasterizerSoftware::RasterizerSoftware() {
+    if (Settings::values.async_software_rendering.GetValue()) {
+        async_pipeline = std::make_unique<AsyncPipeline>();
+    }
+}
+
+RasterizerSoftware::~RasterizerSoftware() = default;
+
 void RasterizerSoftware::AddTriangle(const Pica::Shader::OutputVertex& v0,
                                      const Pica::Shader::OutputVertex& v1,
                                      const Pica::Shader::OutputVertex& v2) {
+    if (async_pipeline) {
+        async_pipeline->Push(v0, v1, v2);
+        return;
+    }
     Pica::Clipper::ProcessTriangle(v0, v1, v2);
 }
 
+void RasterizerSoftware::DrainPipeline() {
+    // Every triangle-producing register write is followed by a NotifyPicaRegisterChanged before
+    // the next write can mutate the register state the worker reads, so draining here keeps the
+    // asynchronous path observationally equivalent to the synchronous one.
+    if (async_pipeline && !async_pipeline->Idle()) {
+        async_pipeline->Drain();
+    }
+}
+
+void RasterizerSoftware::NotifyPicaRegisterChanged(u32 id) {
+    DrainPipeline();
+}
+
+void RasterizerSoftware::FlushAll() {
+    DrainPipeline();
+}
+
+void RasterizerSoftware::FlushRegion(PAddr addr, u32 size) {
+    DrainPipeline();
+}
+
+void RasterizerSoftware::InvalidateRegion(PAddr addr, u32 size) {
+    DrainPipeline();
+}
+
+void RasterizerSoftware::FlushAndInvalidateRegion(PAddr addr, u32 size) {
+    DrainPipeline();
+}
+
+void RasterizerSoftware::ClearAll(bool flush) {
+    DrainPipeline();
+}
+
 } // namespace VideoCore
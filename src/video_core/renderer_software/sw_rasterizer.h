@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include "common/common_types.h"
 #include "video_core/rasterizer_interface.h"
 
@@ -14,15 +15,29 @@ struct OutputVertex;
 namespace VideoCore {
 
 class RasterizerSoftware : public RasterizerInterface {
+public:
+    RasterizerSoftware();
+    ~RasterizerSoftware() override;
+
     void AddTriangle(const Pica::Shader::OutputVertex& v0, const Pica::Shader::OutputVertex& v1,
                      const Pica::Shader::OutputVertex& v2) override;
     void DrawTriangles() override {}
-    void NotifyPicaRegisterChanged(u32 id) override {}
-    void FlushAll() override {}
-    void FlushRegion(PAddr addr, u32 size) override {}
-    void InvalidateRegion(PAddr addr, u32 size) override {}
-    void FlushAndInvalidateRegion(PAddr addr, u32 size) override {}
-    void ClearAll(bool flush) override {}
+    void NotifyPicaRegisterChanged(u32 id) override;
+    void FlushAll() override;
+    void FlushRegion(PAddr addr, u32 size) override;
+    void InvalidateRegion(PAddr addr, u32 size) override;
+    void FlushAndInvalidateRegion(PAddr addr, u32 size) override;
+    void ClearAll(bool flush) override;
+
+private:
+    class AsyncPipeline;
+
+    /// Blocks until every queued triangle has been clipped and rasterized. Must be called before
+    /// any Pica register or guest memory the rasterizer reads may change.
+    void DrainPipeline();
+
+    /// Non-null when asynchronous software rendering is enabled
+    std::unique_ptr<AsyncPipeline> async_pipeline;
 };
 
 } // namespace VideoCore
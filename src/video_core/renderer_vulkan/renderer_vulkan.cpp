@@ -96,6 +96,13 @@ RendererVulkan::RendererVulkan(Core::System& system, Frontend::EmuWindow& window
     CompileShaders();
     BuildLayouts();
     BuildPipelines();
+    if (instance.IsTimestampSupported()) {
+        const vk::QueryPoolCreateInfo pool_info = {
+            .queryType = vk::QueryType::eTimestamp,
+            .queryCount = NumGpuTimeSlots * 2,
+        };
+        gpu_time_query_pool = instance.GetDevice().createQueryPool(pool_info);
+    }
     if (secondary_window) {
         second_window = std::make_unique<PresentWindow>(*secondary_window, instance, scheduler);
     }
@@ -106,6 +113,7 @@ RendererVulkan::~RendererVulkan() {
     scheduler.Finish();
     device.waitIdle();
 
+    device.destroyQueryPool(gpu_time_query_pool);
     device.destroyPipelineLayout(present_pipeline_layout);
     device.destroyShaderModule(present_vertex_shader);
     device.destroyDescriptorSetLayout(present_descriptor_layout);
@@ -911,10 +919,57 @@ void RendererVulkan::SwapBuffers() {
         secondary_window->PollEvents();
     }
 #endif
+    TickGpuTimer();
     rasterizer.TickFrame();
     EndFrame();
 }
 
+void RendererVulkan::TickGpuTimer() {
+    if (!gpu_time_query_pool) {
+        return;
+    }
+
+    if (gpu_time_query_active) {
+        const u32 slot = static_cast<u32>(gpu_time_issued % NumGpuTimeSlots);
+        scheduler.Record([pool = gpu_time_query_pool, slot](vk::CommandBuffer cmdbuf) {
+            cmdbuf.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, pool, slot * 2 + 1);
+        });
+        gpu_time_slot_tick[slot] = scheduler.CurrentTick();
+        gpu_time_issued++;
+    }
+
+    // Harvest completed slots oldest-first. A slot is only waited for when it is about to be
+    // reused, which with the ring polled every frame practically never happens.
+    while (gpu_time_harvested < gpu_time_issued) {
+        const u32 slot = static_cast<u32>(gpu_time_harvested % NumGpuTimeSlots);
+        if (!scheduler.IsFree(gpu_time_slot_tick[slot])) {
+            if (gpu_time_issued - gpu_time_harvested < NumGpuTimeSlots) {
+                break;
+            }
+            scheduler.Wait(gpu_time_slot_tick[slot]);
+        }
+        std::array<u64, 2> timestamps{};
+        if (instance.GetDevice().getQueryPoolResults(
+                gpu_time_query_pool, slot * 2, 2, sizeof(timestamps), timestamps.data(),
+                sizeof(u64), vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait) ==
+            vk::Result::eSuccess) {
+            const u64 gpu_time_ns = static_cast<u64>(
+                static_cast<double>(timestamps[1] - timestamps[0]) * instance.GetTimestampPeriod());
+            ReportGpuFrameTime(gpu_time_ns / 1000);
+        }
+        gpu_time_harvested++;
+    }
+
+    // Timestamp writes and query resets are not allowed inside a render pass instance
+    renderpass_cache.EndRendering();
+    const u32 next_slot = static_cast<u32>(gpu_time_issued % NumGpuTimeSlots);
+    scheduler.Record([pool = gpu_time_query_pool, next_slot](vk::CommandBuffer cmdbuf) {
+        cmdbuf.resetQueryPool(pool, next_slot * 2, 2);
+        cmdbuf.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe, pool, next_slot * 2);
+    });
+    gpu_time_query_active = true;
+}
+
 void RendererVulkan::RenderScreenshot() {
     if (!settings.screenshot_requested.exchange(false)) {
         return;
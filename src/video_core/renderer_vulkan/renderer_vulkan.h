@@ -91,6 +91,9 @@ private:
     void RenderScreenshot();
     void RenderToWindow(PresentWindow& window, const Layout::FramebufferLayout& layout,
                         bool flipped);
+    /// Writes the end-of-frame timestamp, harvests completed frame timings without stalling
+    /// and brackets the next frame with a fresh timestamp pair
+    void TickGpuTimer();
 
     void DrawScreens(Frame* frame, const Layout::FramebufferLayout& layout, bool flipped);
     void DrawBottomScreen(const Layout::FramebufferLayout& layout,
@@ -134,6 +137,15 @@ private:
     std::array<vk::DescriptorImageInfo, 3> present_textures{};
     PresentUniformData draw_info{};
     vk::ClearColorValue clear_color{};
+
+    // Ring of timestamp query pairs bracketing the GPU work of each frame; results are
+    // read back once the scheduler reports the slot's recording tick complete
+    static constexpr std::size_t NumGpuTimeSlots = 4;
+    vk::QueryPool gpu_time_query_pool;
+    std::array<u64, NumGpuTimeSlots> gpu_time_slot_tick{};
+    u64 gpu_time_issued = 0;    ///< Total frame timestamp pairs completed so far
+    u64 gpu_time_harvested = 0; ///< Total frame timestamp pairs whose results were read back
+    bool gpu_time_query_active = false;
 };
 
 } // namespace Vulkan
@@ -12,6 +12,7 @@
 #include "video_core/renderer_vulkan/vk_texture_runtime.h"
 
 #include "video_core/host_shaders/format_reinterpreter/vulkan_d24s8_to_rgba8_comp_spv.h"
+#include "video_core/host_shaders/format_reinterpreter/vulkan_rgba8_to_d24s8_frag_spv.h"
 #include "video_core/host_shaders/full_screen_triangle_vert_spv.h"
 #include "video_core/host_shaders/vulkan_blit_depth_stencil_frag_spv.h"
 #include "video_core/host_shaders/vulkan_depth_to_buffer_comp_spv.h"
@@ -98,6 +99,18 @@ const std::array TWO_TEXTURES_UPDATE_TEMPLATES = {
     TEXTURE_TEMPLATE<1, vk::DescriptorType::eCombinedImageSampler>,
 };
 
+constexpr std::array SINGLE_TEXTURE_DESCRIPTOR_SET_LAYOUT_BINDINGS{
+    TEXTURE_DESC_LAYOUT<0, vk::DescriptorType::eCombinedImageSampler,
+                        vk::ShaderStageFlagBits::eFragment>,
+};
+constexpr vk::DescriptorSetLayoutCreateInfo SINGLE_TEXTURE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO{
+    .bindingCount = static_cast<u32>(SINGLE_TEXTURE_DESCRIPTOR_SET_LAYOUT_BINDINGS.size()),
+    .pBindings = SINGLE_TEXTURE_DESCRIPTOR_SET_LAYOUT_BINDINGS.data(),
+};
+const std::array SINGLE_TEXTURE_UPDATE_TEMPLATES = {
+    TEXTURE_TEMPLATE<0, vk::DescriptorType::eCombinedImageSampler>,
+};
+
 inline constexpr vk::PushConstantRange PUSH_CONSTANT_RANGE{
     .stageFlags = vk::ShaderStageFlagBits::eVertex,
     .offset = 0,
@@ -183,6 +196,28 @@ constexpr vk::PipelineDepthStencilStateCreateInfo PIPELINE_DEPTH_STENCIL_STATE_C
     .minDepthBounds = 0.0f,
     .maxDepthBounds = 0.0f,
 };
+constexpr vk::StencilOpState STENCIL_WRITE_STATE{
+    .failOp = vk::StencilOp::eReplace,
+    .passOp = vk::StencilOp::eReplace,
+    .depthFailOp = vk::StencilOp::eReplace,
+    .compareOp = vk::CompareOp::eAlways,
+    .compareMask = 0xFF,
+    .writeMask = 0xFF,
+    .reference = 0xFF,
+};
+// Used when the fragment shader exports the stencil reference; the test must be
+// enabled with a replace op for the exported value to be written.
+constexpr vk::PipelineDepthStencilStateCreateInfo PIPELINE_DEPTH_STENCIL_WRITE_STATE_CREATE_INFO{
+    .depthTestEnable = VK_TRUE,
+    .depthWriteEnable = VK_TRUE,
+    .depthCompareOp = vk::CompareOp::eAlways,
+    .depthBoundsTestEnable = VK_FALSE,
+    .stencilTestEnable = VK_TRUE,
+    .front = STENCIL_WRITE_STATE,
+    .back = STENCIL_WRITE_STATE,
+    .minDepthBounds = 0.0f,
+    .maxDepthBounds = 0.0f,
+};
 
 template <vk::Filter filter>
 inline constexpr vk::SamplerCreateInfo SAMPLER_CREATE_INFO{
@@ -259,6 +294,8 @@ BlitHelper::BlitHelper(const Instance& instance_, Scheduler& scheduler_,
           device.createDescriptorSetLayout(COMPUTE_BUFFER_DESCRIPTOR_SET_LAYOUT_CREATE_INFO)},
       two_textures_descriptor_layout{
           device.createDescriptorSetLayout(TWO_TEXTURES_DESCRIPTOR_SET_LAYOUT_CREATE_INFO)},
+      single_texture_descriptor_layout{
+          device.createDescriptorSetLayout(SINGLE_TEXTURE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO)},
       compute_update_template{device.createDescriptorUpdateTemplate(
           DescriptorUpdateTemplateCreateInfo(COMPUTE_UPDATE_TEMPLATES, compute_descriptor_layout))},
       compute_buffer_update_template{
@@ -267,20 +304,27 @@ BlitHelper::BlitHelper(const Instance& instance_, Scheduler& scheduler_,
       two_textures_update_template{
           device.createDescriptorUpdateTemplate(DescriptorUpdateTemplateCreateInfo(
               TWO_TEXTURES_UPDATE_TEMPLATES, two_textures_descriptor_layout))},
+      single_texture_update_template{
+          device.createDescriptorUpdateTemplate(DescriptorUpdateTemplateCreateInfo(
+              SINGLE_TEXTURE_UPDATE_TEMPLATES, single_texture_descriptor_layout))},
       compute_pipeline_layout{
           device.createPipelineLayout(PipelineLayoutCreateInfo(&compute_descriptor_layout, true))},
       compute_buffer_pipeline_layout{device.createPipelineLayout(
           PipelineLayoutCreateInfo(&compute_buffer_descriptor_layout, true))},
       two_textures_pipeline_layout{
           device.createPipelineLayout(PipelineLayoutCreateInfo(&two_textures_descriptor_layout))},
+      single_texture_pipeline_layout{device.createPipelineLayout(
+          PipelineLayoutCreateInfo(&single_texture_descriptor_layout))},
       full_screen_vert{CompileSPV(FULL_SCREEN_TRIANGLE_VERT_SPV, device)},
       d24s8_to_rgba8_comp{CompileSPV(VULKAN_D24S8_TO_RGBA8_COMP_SPV, device)},
       depth_to_buffer_comp{CompileSPV(VULKAN_DEPTH_TO_BUFFER_COMP_SPV, device)},
       blit_depth_stencil_frag{CompileSPV(VULKAN_BLIT_DEPTH_STENCIL_FRAG_SPV, device)},
+      rgba8_to_d24s8_frag{CompileSPV(VULKAN_RGBA8_TO_D24S8_FRAG_SPV, device)},
       d24s8_to_rgba8_pipeline{MakeComputePipeline(d24s8_to_rgba8_comp, compute_pipeline_layout)},
       depth_to_buffer_pipeline{
           MakeComputePipeline(depth_to_buffer_comp, compute_buffer_pipeline_layout)},
       depth_blit_pipeline{MakeDepthStencilBlitPipeline()},
+      rgba8_to_d24s8_pipeline{MakeColorToDepthStencilPipeline()},
       linear_sampler{device.createSampler(SAMPLER_CREATE_INFO<vk::Filter::eLinear>)},
       nearest_sampler{device.createSampler(SAMPLER_CREATE_INFO<vk::Filter::eNearest>)} {}
 
@@ -288,19 +332,24 @@ BlitHelper::~BlitHelper() {
     device.destroyPipelineLayout(compute_pipeline_layout);
     device.destroyPipelineLayout(compute_buffer_pipeline_layout);
     device.destroyPipelineLayout(two_textures_pipeline_layout);
+    device.destroyPipelineLayout(single_texture_pipeline_layout);
     device.destroyDescriptorUpdateTemplate(compute_update_template);
     device.destroyDescriptorUpdateTemplate(compute_buffer_update_template);
     device.destroyDescriptorUpdateTemplate(two_textures_update_template);
+    device.destroyDescriptorUpdateTemplate(single_texture_update_template);
     device.destroyDescriptorSetLayout(compute_descriptor_layout);
     device.destroyDescriptorSetLayout(two_textures_descriptor_layout);
     device.destroyDescriptorSetLayout(compute_buffer_descriptor_layout);
+    device.destroyDescriptorSetLayout(single_texture_descriptor_layout);
     device.destroyShaderModule(full_screen_vert);
     device.destroyShaderModule(d24s8_to_rgba8_comp);
     device.destroyShaderModule(depth_to_buffer_comp);
     device.destroyShaderModule(blit_depth_stencil_frag);
+    device.destroyShaderModule(rgba8_to_d24s8_frag);
     device.destroyPipeline(depth_to_buffer_pipeline);
     device.destroyPipeline(d24s8_to_rgba8_pipeline);
     device.destroyPipeline(depth_blit_pipeline);
+    device.destroyPipeline(rgba8_to_d24s8_pipeline);
     device.destroySampler(linear_sampler);
     device.destroySampler(nearest_sampler);
 }
@@ -499,6 +548,41 @@ bool BlitHelper::ConvertDS24S8ToRGBA8(Surface& source, Surface& dest,
     return true;
 }
 
+bool BlitHelper::ConvertRGBA8ToDS24S8(Surface& source, Surface& dest,
+                                      const VideoCore::TextureBlit& blit) {
+    if (!instance.IsShaderStencilExportSupported()) {
+        LOG_ERROR(Render_Vulkan, "Unable to convert to depth stencil without stencil export");
+        return false;
+    }
+
+    const vk::Rect2D dst_render_area = {
+        .offset = {0, 0},
+        .extent = {dest.GetScaledWidth(), dest.GetScaledHeight()},
+    };
+
+    const vk::DescriptorImageInfo texture = {
+        .sampler = nearest_sampler,
+        .imageView = source.ImageView(),
+        .imageLayout = vk::ImageLayout::eGeneral,
+    };
+
+    vk::DescriptorSet set = desc_manager.AllocateSet(single_texture_descriptor_layout);
+    device.updateDescriptorSetWithTemplate(set, single_texture_update_template, texture);
+
+    const Framebuffer framebuffer{nullptr, &dest, dst_render_area};
+    renderpass_cache.BeginRendering(framebuffer);
+    scheduler.Record([blit, set, this](vk::CommandBuffer cmdbuf) {
+        const vk::PipelineLayout layout = single_texture_pipeline_layout;
+
+        cmdbuf.bindPipeline(vk::PipelineBindPoint::eGraphics, rgba8_to_d24s8_pipeline);
+        cmdbuf.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, layout, 0, set, {});
+        BindBlitState(cmdbuf, layout, blit);
+        cmdbuf.draw(3, 1, 0, 0);
+    });
+    scheduler.MakeDirty(StateFlags::Pipeline);
+    return true;
+}
+
 bool BlitHelper::DepthToBuffer(Surface& source, vk::Buffer buffer,
                                const VideoCore::BufferTextureCopy& copy) {
     std::array<DescriptorData, 3> textures{};
@@ -653,4 +737,56 @@ vk::Pipeline BlitHelper::MakeDepthStencilBlitPipeline() {
     return VK_NULL_HANDLE;
 }
 
+vk::Pipeline BlitHelper::MakeColorToDepthStencilPipeline() {
+    if (!instance.IsShaderStencilExportSupported()) {
+        return VK_NULL_HANDLE;
+    }
+
+    const std::array stages = MakeStages(full_screen_vert, rgba8_to_d24s8_frag);
+    const VideoCore::PixelFormat depth_stencil = VideoCore::PixelFormat::D24S8;
+    const vk::Format depth_stencil_format = instance.GetTraits(depth_stencil).native;
+    vk::GraphicsPipelineCreateInfo convert_info = {
+        .stageCount = static_cast<u32>(stages.size()),
+        .pStages = stages.data(),
+        .pVertexInputState = &PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+        .pInputAssemblyState = &PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+        .pTessellationState = nullptr,
+        .pViewportState = &PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+        .pRasterizationState = &PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+        .pMultisampleState = &PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+        .pDepthStencilState = &PIPELINE_DEPTH_STENCIL_WRITE_STATE_CREATE_INFO,
+        .pColorBlendState = &PIPELINE_COLOR_BLEND_STATE_EMPTY_CREATE_INFO,
+        .pDynamicState = &PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+        .layout = single_texture_pipeline_layout,
+    };
+
+    if (!instance.IsDynamicRenderingSupported()) {
+        convert_info.renderPass =
+            renderpass_cache.GetRenderpass(VideoCore::PixelFormat::Invalid, depth_stencil, false);
+    }
+
+    vk::StructureChain convert_chain = {
+        convert_info,
+        vk::PipelineRenderingCreateInfoKHR{
+            .colorAttachmentCount = 0,
+            .pColorAttachmentFormats = nullptr,
+            .depthAttachmentFormat = depth_stencil_format,
+            .stencilAttachmentFormat = depth_stencil_format,
+        },
+    };
+
+    if (!instance.IsDynamicRenderingSupported()) {
+        convert_chain.unlink<vk::PipelineRenderingCreateInfoKHR>();
+    }
+
+    if (const auto result = device.createGraphicsPipeline({}, convert_chain.get());
+        result.result == vk::Result::eSuccess) {
+        return result.value;
+    } else {
+        LOG_CRITICAL(Render_Vulkan, "Color to depth stencil pipeline creation failed!");
+        UNREACHABLE();
+    }
+    return VK_NULL_HANDLE;
+}
+
 } // namespace Vulkan
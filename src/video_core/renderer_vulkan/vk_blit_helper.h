@@ -30,6 +30,8 @@ public:
 
     bool ConvertDS24S8ToRGBA8(Surface& source, Surface& dest, const VideoCore::TextureBlit& blit);
 
+    bool ConvertRGBA8ToDS24S8(Surface& source, Surface& dest, const VideoCore::TextureBlit& blit);
+
     bool DepthToBuffer(Surface& source, vk::Buffer buffer,
                        const VideoCore::BufferTextureCopy& copy);
 
@@ -40,6 +42,9 @@ private:
     /// Creates graphics pipelines used for blit
     vk::Pipeline MakeDepthStencilBlitPipeline();
 
+    /// Creates the graphics pipeline that reinterprets a color texture to depth stencil
+    vk::Pipeline MakeColorToDepthStencilPipeline();
+
 private:
     const Instance& instance;
     Scheduler& scheduler;
@@ -52,21 +57,26 @@ private:
     vk::DescriptorSetLayout compute_descriptor_layout;
     vk::DescriptorSetLayout compute_buffer_descriptor_layout;
     vk::DescriptorSetLayout two_textures_descriptor_layout;
+    vk::DescriptorSetLayout single_texture_descriptor_layout;
     vk::DescriptorUpdateTemplate compute_update_template;
     vk::DescriptorUpdateTemplate compute_buffer_update_template;
     vk::DescriptorUpdateTemplate two_textures_update_template;
+    vk::DescriptorUpdateTemplate single_texture_update_template;
     vk::PipelineLayout compute_pipeline_layout;
     vk::PipelineLayout compute_buffer_pipeline_layout;
     vk::PipelineLayout two_textures_pipeline_layout;
+    vk::PipelineLayout single_texture_pipeline_layout;
 
     vk::ShaderModule full_screen_vert;
     vk::ShaderModule d24s8_to_rgba8_comp;
     vk::ShaderModule depth_to_buffer_comp;
     vk::ShaderModule blit_depth_stencil_frag;
+    vk::ShaderModule rgba8_to_d24s8_frag;
 
     vk::Pipeline d24s8_to_rgba8_pipeline;
     vk::Pipeline depth_to_buffer_pipeline;
     vk::Pipeline depth_blit_pipeline;
+    vk::Pipeline rgba8_to_d24s8_pipeline;
     vk::Sampler linear_sampler;
     vk::Sampler nearest_sampler;
 };
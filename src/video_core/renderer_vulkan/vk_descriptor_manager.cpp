@@ -82,6 +82,7 @@ constexpr vk::ShaderStageFlags ToVkStageFlags(vk::DescriptorType type) {
 DescriptorManager::DescriptorManager(const Instance& instance, Scheduler& scheduler)
     : instance{instance}, scheduler{scheduler}, pool_provider{instance,
                                                               scheduler.GetMasterSemaphore()} {
+    use_push_descriptors = instance.IsPushDescriptorsSupported();
     BuildLayouts();
     descriptor_set_dirty.set();
     current_pool = pool_provider.Commit();
@@ -108,11 +109,26 @@ void DescriptorManager::SetBinding(u32 set, u32 binding, DescriptorData data) {
 void DescriptorManager::BindDescriptorSets() {
     MICROPROFILE_SCOPE(Vulkan_DescriptorMgmt);
 
-    // Update any dirty descriptor sets
+    // Update any dirty descriptor sets, reusing a previously written set when the same
+    // combination of resources has been bound before.
     for (u32 i = 0; i < MAX_DESCRIPTOR_SETS; i++) {
-        if (descriptor_set_dirty[i]) {
+        if (use_push_descriptors && i != 0) {
+            // Push descriptor sets are written into the command buffer at bind time below.
+            descriptor_set_dirty[i] = false;
+            continue;
+        }
+        if (!descriptor_set_dirty[i]) {
+            continue;
+        }
+
+        const u64 data_hash = Common::ComputeHash64(
+            update_data[i].data(), RASTERIZER_SETS[i].binding_count * sizeof(DescriptorData));
+        if (const auto it = hashed_sets[i].find(data_hash); it != hashed_sets[i].end()) {
+            descriptor_sets[i] = it->second;
+        } else {
             std::vector<vk::DescriptorSet>& cache = set_cache[i];
             if (cache.empty()) {
+                // Note: this may recycle the pool, clearing hashed_sets behind our back.
                 cache = AllocateSets(descriptor_set_layouts[i], MAX_BATCH_SIZE);
             }
             vk::DescriptorSet set = cache.back();
@@ -121,9 +137,23 @@ void DescriptorManager::BindDescriptorSets() {
             instance.GetDevice().updateDescriptorSetWithTemplate(set, update_templates[i],
                                                                  update_data[i][0]);
 
+            hashed_sets[i].emplace(data_hash, set);
             descriptor_sets[i] = set;
-            descriptor_set_dirty[i] = false;
         }
+        descriptor_set_dirty[i] = false;
+    }
+
+    if (use_push_descriptors) {
+        scheduler.Record([this, offsets = dynamic_offsets, utility_set = descriptor_sets[0],
+                          data = update_data](vk::CommandBuffer cmdbuf) {
+            cmdbuf.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, pipeline_layout, 0,
+                                      utility_set, offsets);
+            for (u32 i = 1; i < MAX_DESCRIPTOR_SETS; i++) {
+                cmdbuf.pushDescriptorSetWithTemplateKHR(update_templates[i], pipeline_layout, i,
+                                                        data[i][0]);
+            }
+        });
+        return;
     }
 
     scheduler.Record(
@@ -137,6 +167,10 @@ void DescriptorManager::BuildLayouts() {
     std::array<vk::DescriptorSetLayoutBinding, MAX_DESCRIPTORS> set_bindings;
     std::array<vk::DescriptorUpdateTemplateEntry, MAX_DESCRIPTORS> update_entries;
 
+    // Push descriptor sets cannot contain dynamic uniform buffers, so the utility set
+    // always goes through the regular allocation path.
+    const auto is_push_set = [this](u32 set) { return use_push_descriptors && set != 0; };
+
     const vk::Device device = instance.GetDevice();
     for (u32 i = 0; i < MAX_DESCRIPTOR_SETS; i++) {
         const auto& set = RASTERIZER_SETS[i];
@@ -148,39 +182,52 @@ void DescriptorManager::BuildLayouts() {
                 .descriptorCount = 1,
                 .stageFlags = ToVkStageFlags(type),
             };
+        }
+
+        const vk::DescriptorSetLayoutCreateInfo layout_info = {
+            .flags = is_push_set(i) ? vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR
+                                    : vk::DescriptorSetLayoutCreateFlags{},
+            .bindingCount = set.binding_count,
+            .pBindings = set_bindings.data(),
+        };
+        descriptor_set_layouts[i] = device.createDescriptorSetLayout(layout_info);
+    }
+
+    const vk::PipelineLayoutCreateInfo layout_info = {
+        .setLayoutCount = MAX_DESCRIPTOR_SETS,
+        .pSetLayouts = descriptor_set_layouts.data(),
+        .pushConstantRangeCount = 0,
+        .pPushConstantRanges = nullptr,
+    };
+    pipeline_layout = device.createPipelineLayout(layout_info);
 
+    // The update templates are created last because push descriptor templates must
+    // reference the pipeline layout they are recorded with.
+    for (u32 i = 0; i < MAX_DESCRIPTOR_SETS; i++) {
+        const auto& set = RASTERIZER_SETS[i];
+        for (u32 j = 0; j < set.binding_count; j++) {
             update_entries[j] = vk::DescriptorUpdateTemplateEntry{
                 .dstBinding = j,
                 .dstArrayElement = 0,
                 .descriptorCount = 1,
-                .descriptorType = type,
+                .descriptorType = set.bindings[j],
                 .offset = j * sizeof(DescriptorData),
                 .stride = 0,
             };
         }
 
-        const vk::DescriptorSetLayoutCreateInfo layout_info = {
-            .bindingCount = set.binding_count,
-            .pBindings = set_bindings.data(),
-        };
-        descriptor_set_layouts[i] = device.createDescriptorSetLayout(layout_info);
-
         const vk::DescriptorUpdateTemplateCreateInfo template_info = {
             .descriptorUpdateEntryCount = set.binding_count,
             .pDescriptorUpdateEntries = update_entries.data(),
-            .templateType = vk::DescriptorUpdateTemplateType::eDescriptorSet,
+            .templateType = is_push_set(i) ? vk::DescriptorUpdateTemplateType::ePushDescriptorsKHR
+                                           : vk::DescriptorUpdateTemplateType::eDescriptorSet,
             .descriptorSetLayout = descriptor_set_layouts[i],
+            .pipelineBindPoint = vk::PipelineBindPoint::eGraphics,
+            .pipelineLayout = pipeline_layout,
+            .set = i,
         };
         update_templates[i] = device.createDescriptorUpdateTemplate(template_info);
     }
-
-    const vk::PipelineLayoutCreateInfo layout_info = {
-        .setLayoutCount = MAX_DESCRIPTOR_SETS,
-        .pSetLayouts = descriptor_set_layouts.data(),
-        .pushConstantRangeCount = 0,
-        .pPushConstantRanges = nullptr,
-    };
-    pipeline_layout = device.createPipelineLayout(layout_info);
 }
 
 std::vector<vk::DescriptorSet> DescriptorManager::AllocateSets(vk::DescriptorSetLayout layout,
@@ -202,6 +249,10 @@ std::vector<vk::DescriptorSet> DescriptorManager::AllocateSets(vk::DescriptorSet
         for (auto& cache : set_cache) {
             cache.clear();
         }
+        // Cached set handles die with the recycled pool.
+        for (auto& hashed : hashed_sets) {
+            hashed.clear();
+        }
         descriptor_set_dirty.set();
     }
 
@@ -6,6 +6,8 @@
 
 #include <bitset>
 #include <compare>
+#include <tsl/robin_map.h>
+#include "common/hash.h"
 #include "video_core/renderer_vulkan/vk_resource_pool.h"
 
 namespace Vulkan {
@@ -78,7 +80,11 @@ private:
     std::array<DescriptorSetData, MAX_DESCRIPTOR_SETS> update_data{};
     std::array<vk::DescriptorSet, MAX_DESCRIPTOR_SETS> descriptor_sets{};
     std::array<std::vector<vk::DescriptorSet>, MAX_DESCRIPTOR_SETS> set_cache;
+    std::array<tsl::robin_map<u64, vk::DescriptorSet, Common::IdentityHash<u64>>,
+               MAX_DESCRIPTOR_SETS>
+        hashed_sets;
     std::bitset<MAX_DESCRIPTOR_SETS> descriptor_set_dirty{};
+    bool use_push_descriptors{};
 };
 
 } // namespace Vulkan
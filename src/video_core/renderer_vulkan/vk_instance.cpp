@@ -641,6 +641,7 @@ bool Instance::CreateDevice() {
     image_format_list = add_extension(VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME);
     pipeline_creation_feedback = add_extension(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
     shader_stencil_export = add_extension(VK_EXT_SHADER_STENCIL_EXPORT_EXTENSION_NAME);
+    push_descriptors = add_extension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
     bool has_timeline_semaphores = add_extension(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
     bool has_portability_subset = add_extension(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME);
     bool has_dynamic_rendering = add_extension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
@@ -674,18 +675,37 @@ bool Instance::CreateDevice() {
         return false;
     }
 
+    // Search for a dedicated transfer queue family, preferring the DMA engine without
+    // compute capability so transfers never contend with the graphics queue.
+    bool transfer_queue_found = false;
+    for (std::size_t i = 0; i < family_properties.size(); i++) {
+        const vk::QueueFlags flags = family_properties[i].queueFlags;
+        if ((flags & vk::QueueFlagBits::eTransfer) && !(flags & vk::QueueFlagBits::eGraphics) &&
+            (!transfer_queue_found || !(flags & vk::QueueFlagBits::eCompute))) {
+            transfer_queue_family_index = static_cast<u32>(i);
+            transfer_queue_found = true;
+        }
+    }
+
     static constexpr float queue_priorities[] = {1.0f};
 
-    const vk::DeviceQueueCreateInfo queue_info = {
-        .queueFamilyIndex = queue_family_index,
-        .queueCount = 1,
-        .pQueuePriorities = queue_priorities,
+    const std::array queue_infos = {
+        vk::DeviceQueueCreateInfo{
+            .queueFamilyIndex = queue_family_index,
+            .queueCount = 1,
+            .pQueuePriorities = queue_priorities,
+        },
+        vk::DeviceQueueCreateInfo{
+            .queueFamilyIndex = transfer_queue_family_index,
+            .queueCount = 1,
+            .pQueuePriorities = queue_priorities,
+        },
     };
 
     vk::StructureChain device_chain = {
         vk::DeviceCreateInfo{
-            .queueCreateInfoCount = 1u,
-            .pQueueCreateInfos = &queue_info,
+            .queueCreateInfoCount = transfer_queue_found ? 2u : 1u,
+            .pQueueCreateInfos = queue_infos.data(),
             .enabledExtensionCount = static_cast<u32>(enabled_extensions.size()),
             .ppEnabledExtensionNames = enabled_extensions.data(),
         },
@@ -790,6 +810,10 @@ bool Instance::CreateDevice() {
 
     graphics_queue = device.getQueue(queue_family_index, 0);
     present_queue = device.getQueue(queue_family_index, 0);
+    has_transfer_queue = transfer_queue_found;
+    if (transfer_queue_found) {
+        transfer_queue = device.getQueue(transfer_queue_family_index, 0);
+    }
 
     CreateAllocator();
     return true;
@@ -91,6 +91,19 @@ public:
         return present_queue;
     }
 
+    u32 GetTransferQueueFamilyIndex() const {
+        return transfer_queue_family_index;
+    }
+
+    vk::Queue GetTransferQueue() const {
+        return transfer_queue;
+    }
+
+    /// Returns true when the device exposes a dedicated transfer queue
+    bool HasTransferQueue() const {
+        return has_transfer_queue;
+    }
+
     /// Returns true if logic operations need shader emulation
     bool NeedsLogicOpEmulation() const {
         return !features.logicOp;
@@ -216,6 +229,16 @@ public:
         return limits.minUniformBufferOffsetAlignment;
     }
 
+    /// Returns true when timestamp queries are supported on all graphics queues
+    bool IsTimestampSupported() const {
+        return limits.timestampComputeAndGraphics;
+    }
+
+    /// Returns the duration of one timestamp query tick in nanoseconds
+    float GetTimestampPeriod() const {
+        return limits.timestampPeriod;
+    }
+
     /// Returns the maximum supported elements in a texel buffer
     u32 MaxTexelBufferElements() const {
         return limits.maxTexelBufferElements;
@@ -280,12 +303,15 @@ private:
     VmaAllocator allocator;
     vk::Queue present_queue;
     vk::Queue graphics_queue;
+    vk::Queue transfer_queue;
     std::vector<vk::PhysicalDevice> physical_devices;
     std::array<FormatTraits, VideoCore::PIXEL_FORMAT_COUNT> format_table;
     std::array<FormatTraits, 10> custom_format_table;
     std::array<FormatTraits, 16> attrib_table;
     std::vector<std::string> available_extensions;
     u32 queue_family_index{0};
+    u32 transfer_queue_family_index{0};
+    bool has_transfer_queue{};
     bool triangle_fan_supported{true};
     bool image_view_reinterpretation{true};
     u32 min_vertex_stride_alignment{1};
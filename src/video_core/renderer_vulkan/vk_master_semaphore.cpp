@@ -19,6 +19,9 @@ MasterSemaphoreTimeline::MasterSemaphoreTimeline(const Instance& instance_) : in
         },
     };
     semaphore = instance.GetDevice().createSemaphoreUnique(semaphore_chain.get());
+    if (instance.HasTransferQueue()) {
+        transfer_semaphore = instance.GetDevice().createSemaphoreUnique(semaphore_chain.get());
+    }
 }
 
 MasterSemaphoreTimeline::~MasterSemaphoreTimeline() = default;
@@ -60,23 +63,41 @@ void MasterSemaphoreTimeline::Wait(u64 tick) {
     Refresh();
 }
 
-void MasterSemaphoreTimeline::SubmitWork(vk::CommandBuffer cmdbuf, vk::Semaphore wait,
-                                         vk::Semaphore signal, u64 signal_value) {
+void MasterSemaphoreTimeline::SubmitWork(vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf,
+                                         vk::Semaphore wait, vk::Semaphore signal,
+                                         u64 signal_value) {
+    upload_cmdbuf.end();
     cmdbuf.end();
 
+    const std::array cmdbufs{upload_cmdbuf, cmdbuf};
+
     const u32 num_signal_semaphores = signal ? 2U : 1U;
     const std::array signal_values{signal_value, u64(0)};
     const std::array signal_semaphores{Handle(), signal};
 
-    const u32 num_wait_semaphores = wait ? 2U : 1U;
-    const std::array wait_values{signal_value - 1, u64(1)};
-    const std::array wait_semaphores{Handle(), wait};
-
-    static constexpr std::array<vk::PipelineStageFlags, 2> wait_stage_masks = {
+    u32 num_wait_semaphores = 1U;
+    std::array<u64, 3> wait_values{signal_value - 1, 0, 0};
+    std::array<vk::Semaphore, 3> wait_semaphores{Handle(), nullptr, nullptr};
+    std::array<vk::PipelineStageFlags, 3> wait_stage_masks{
         vk::PipelineStageFlagBits::eAllCommands,
-        vk::PipelineStageFlagBits::eColorAttachmentOutput,
     };
 
+    // Order this submission after every transfer queue submission issued so far, so
+    // resources written by async transfers are visible to the graphics queue.
+    if (transfer_semaphore) {
+        wait_semaphores[num_wait_semaphores] = *transfer_semaphore;
+        wait_values[num_wait_semaphores] =
+            current_transfer_tick.load(std::memory_order_acquire) - 1;
+        wait_stage_masks[num_wait_semaphores] = vk::PipelineStageFlagBits::eAllCommands;
+        num_wait_semaphores++;
+    }
+    if (wait) {
+        wait_semaphores[num_wait_semaphores] = wait;
+        wait_values[num_wait_semaphores] = 1;
+        wait_stage_masks[num_wait_semaphores] = vk::PipelineStageFlagBits::eColorAttachmentOutput;
+        num_wait_semaphores++;
+    }
+
     const vk::TimelineSemaphoreSubmitInfoKHR timeline_si = {
         .waitSemaphoreValueCount = num_wait_semaphores,
         .pWaitSemaphoreValues = wait_values.data(),
@@ -89,8 +110,8 @@ void MasterSemaphoreTimeline::SubmitWork(vk::CommandBuffer cmdbuf, vk::Semaphore
         .waitSemaphoreCount = num_wait_semaphores,
         .pWaitSemaphores = wait_semaphores.data(),
         .pWaitDstStageMask = wait_stage_masks.data(),
-        .commandBufferCount = 1u,
-        .pCommandBuffers = &cmdbuf,
+        .commandBufferCount = static_cast<u32>(cmdbufs.size()),
+        .pCommandBuffers = cmdbufs.data(),
         .signalSemaphoreCount = num_signal_semaphores,
         .pSignalSemaphores = signal_semaphores.data(),
     };
@@ -103,6 +124,51 @@ void MasterSemaphoreTimeline::SubmitWork(vk::CommandBuffer cmdbuf, vk::Semaphore
     }
 }
 
+u64 MasterSemaphoreTimeline::SubmitTransferWork(vk::CommandBuffer cmdbuf) {
+    cmdbuf.end();
+
+    const u64 signal_value = current_transfer_tick.fetch_add(1, std::memory_order_release);
+    const vk::TimelineSemaphoreSubmitInfoKHR timeline_si = {
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues = &signal_value,
+    };
+
+    const vk::SubmitInfo submit_info = {
+        .pNext = &timeline_si,
+        .commandBufferCount = 1u,
+        .pCommandBuffers = &cmdbuf,
+        .signalSemaphoreCount = 1u,
+        .pSignalSemaphores = &transfer_semaphore.get(),
+    };
+
+    try {
+        instance.GetTransferQueue().submit(submit_info);
+    } catch (vk::DeviceLostError& err) {
+        LOG_CRITICAL(Render_Vulkan, "Device lost during transfer submit: {}", err.what());
+        UNREACHABLE();
+    }
+
+    return signal_value;
+}
+
+void MasterSemaphoreTimeline::RefreshTransfer() {
+    if (!transfer_semaphore) {
+        return;
+    }
+
+    u64 this_tick{};
+    u64 counter{};
+    do {
+        this_tick = transfer_gpu_tick.load(std::memory_order_acquire);
+        counter = instance.GetDevice().getSemaphoreCounterValueKHR(*transfer_semaphore);
+        if (counter < this_tick) {
+            return;
+        }
+    } while (!transfer_gpu_tick.compare_exchange_weak(this_tick, counter,
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed));
+}
+
 constexpr u64 FENCE_RESERVE = 8;
 
 MasterSemaphoreFence::MasterSemaphoreFence(const Instance& instance_) : instance{instance_} {
@@ -127,10 +193,13 @@ void MasterSemaphoreFence::Wait(u64 tick) {
     }
 }
 
-void MasterSemaphoreFence::SubmitWork(vk::CommandBuffer cmdbuf, vk::Semaphore wait,
-                                      vk::Semaphore signal, u64 signal_value) {
+void MasterSemaphoreFence::SubmitWork(vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf,
+                                      vk::Semaphore wait, vk::Semaphore signal, u64 signal_value) {
+    upload_cmdbuf.end();
     cmdbuf.end();
 
+    const std::array cmdbufs{upload_cmdbuf, cmdbuf};
+
     const u32 num_signal_semaphores = signal ? 1U : 0U;
     const u32 num_wait_semaphores = wait ? 1U : 0U;
 
@@ -142,8 +211,8 @@ void MasterSemaphoreFence::SubmitWork(vk::CommandBuffer cmdbuf, vk::Semaphore wa
         .waitSemaphoreCount = num_wait_semaphores,
         .pWaitSemaphores = &wait,
         .pWaitDstStageMask = wait_stage_masks.data(),
-        .commandBufferCount = 1u,
-        .pCommandBuffers = &cmdbuf,
+        .commandBufferCount = static_cast<u32>(cmdbufs.size()),
+        .pCommandBuffers = cmdbufs.data(),
         .signalSemaphoreCount = num_signal_semaphores,
         .pSignalSemaphores = &signal,
     };
@@ -41,13 +41,28 @@ public:
     /// Waits for a tick to be hit on the GPU
     virtual void Wait(u64 tick) = 0;
 
-    /// Submits the provided command buffer for execution
-    virtual void SubmitWork(vk::CommandBuffer cmdbuf, vk::Semaphore wait, vk::Semaphore signal,
-                            u64 signal_value) = 0;
+    /// Submits the provided command buffers for execution, with upload_cmdbuf ordered first
+    virtual void SubmitWork(vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf,
+                            vk::Semaphore wait, vk::Semaphore signal, u64 signal_value) = 0;
+
+    [[nodiscard]] u64 KnownTransferTick() const noexcept {
+        return transfer_gpu_tick.load(std::memory_order_acquire);
+    }
+
+    /// Submits the provided command buffer on the dedicated transfer queue.
+    /// Returns the transfer timeline tick that marks its completion.
+    virtual u64 SubmitTransferWork(vk::CommandBuffer cmdbuf) {
+        return 0;
+    }
+
+    /// Refresh the known transfer queue tick
+    virtual void RefreshTransfer() {}
 
 protected:
-    std::atomic<u64> gpu_tick{0};     ///< Current known GPU tick.
-    std::atomic<u64> current_tick{1}; ///< Current logical tick.
+    std::atomic<u64> gpu_tick{0};              ///< Current known GPU tick.
+    std::atomic<u64> current_tick{1};          ///< Current logical tick.
+    std::atomic<u64> transfer_gpu_tick{0};     ///< Current known transfer queue tick.
+    std::atomic<u64> current_transfer_tick{1}; ///< Current logical transfer tick.
 };
 
 class MasterSemaphoreTimeline : public MasterSemaphore {
@@ -63,12 +78,17 @@ public:
 
     void Wait(u64 tick) override;
 
-    void SubmitWork(vk::CommandBuffer cmdbuf, vk::Semaphore wait, vk::Semaphore signal,
-                    u64 signal_value) override;
+    void SubmitWork(vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf, vk::Semaphore wait,
+                    vk::Semaphore signal, u64 signal_value) override;
+
+    u64 SubmitTransferWork(vk::CommandBuffer cmdbuf) override;
+
+    void RefreshTransfer() override;
 
 private:
     const Instance& instance;
-    vk::UniqueSemaphore semaphore; ///< Timeline semaphore.
+    vk::UniqueSemaphore semaphore;          ///< Timeline semaphore.
+    vk::UniqueSemaphore transfer_semaphore; ///< Timeline semaphore of the transfer queue.
 };
 
 class MasterSemaphoreFence : public MasterSemaphore {
@@ -80,8 +100,8 @@ public:
 
     void Wait(u64 tick) override;
 
-    void SubmitWork(vk::CommandBuffer cmdbuf, vk::Semaphore wait, vk::Semaphore signal,
-                    u64 signal_value) override;
+    void SubmitWork(vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf, vk::Semaphore wait,
+                    vk::Semaphore signal, u64 signal_value) override;
 
 private:
     void WaitThread(std::stop_token token);
@@ -8,6 +8,7 @@
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
+#include "core/core.h"
 #include "video_core/renderer_vulkan/pica_to_vk.h"
 #include "video_core/renderer_vulkan/vk_descriptor_manager.h"
 #include "video_core/renderer_vulkan/vk_instance.h"
@@ -62,6 +63,21 @@ vk::ShaderStageFlagBits MakeShaderStage(std::size_t index) {
     return vk::ShaderStageFlagBits::eVertex;
 }
 
+constexpr u32 PIPELINE_MANIFEST_VERSION = 1;
+
+/**
+ * Header of the per-title pipeline manifest. The manifest records every pipeline the title has
+ * used together with the generated shader code of its stages, so the next boot can rebuild them
+ * in parallel before gameplay starts instead of hitching on first use. The shader code depends
+ * on device capabilities, so the manifest is keyed to the device like the driver cache blob.
+ */
+struct PipelineManifestHeader {
+    u32 version;
+    u32 vendor_id;
+    u32 device_id;
+    u32 num_entries;
+};
+
 u64 PipelineInfo::Hash(const Instance& instance) const {
     u64 info_hash = 0;
     const auto append_hash = [&info_hash](const auto& data) {
@@ -422,6 +438,8 @@ void PipelineCache::LoadDiskCache() {
 
     vk::Device device = instance.GetDevice();
     pipeline_cache = device.createPipelineCache(cache_info);
+
+    PrecompileManifest();
 }
 
 void PipelineCache::SaveDiskCache() {
@@ -429,6 +447,8 @@ void PipelineCache::SaveDiskCache() {
         return;
     }
 
+    SaveManifest();
+
     const std::string cache_file_path = fmt::format("{}{:x}{:x}.bin", GetPipelineCacheDir(),
                                                     instance.GetVendorID(), instance.GetDeviceID());
     FileUtil::IOFile cache_file{cache_file_path, "wb"};
@@ -447,6 +467,234 @@ void PipelineCache::SaveDiskCache() {
     cache_file.Close();
 }
 
+void PipelineCache::RecordPipeline(const PipelineInfo& info) {
+    ManifestEntry& entry = manifest.emplace_back();
+    entry.info = info;
+    entry.shader_hashes = shader_hashes;
+    for (u32 i = 0; i < MAX_SHADER_STAGES; i++) {
+        const Shader* shader = current_shaders[i];
+        ManifestStage& stage = entry.stages[i];
+        if (!shader) {
+            stage.kind = ManifestStage::None;
+        } else if (shader == &trivial_vertex_shader) {
+            stage.kind = ManifestStage::Trivial;
+        } else {
+            stage.kind = shader->is_spirv ? ManifestStage::Spirv : ManifestStage::Glsl;
+            stage.code = shader->program;
+        }
+    }
+}
+
+void PipelineCache::PrecompileManifest() {
+    const std::string manifest_path = GetManifestPath();
+    if (manifest_path.empty()) {
+        return;
+    }
+
+    FileUtil::IOFile manifest_file{manifest_path, "rb"};
+    if (!manifest_file.IsOpen()) {
+        return;
+    }
+
+    const u64 file_size = manifest_file.GetSize();
+    std::vector<u8> data(file_size);
+    if (!manifest_file.ReadBytes(data.data(), file_size)) {
+        LOG_ERROR(Render_Vulkan, "Error during pipeline manifest read");
+        return;
+    }
+    manifest_file.Close();
+
+    PipelineManifestHeader header;
+    if (file_size < sizeof(header)) {
+        LOG_WARNING(Render_Vulkan, "Pipeline manifest provided invalid, ignoring");
+        return;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.version != PIPELINE_MANIFEST_VERSION ||
+        header.vendor_id != instance.GetVendorID() ||
+        header.device_id != instance.GetDeviceID()) {
+        LOG_WARNING(Render_Vulkan, "Pipeline manifest provided invalid, ignoring");
+        return;
+    }
+
+    u64 offset = sizeof(header);
+    const auto read = [&](void* dest, std::size_t size) {
+        if (offset + size > file_size) {
+            return false;
+        }
+        std::memcpy(dest, data.data() + offset, size);
+        offset += size;
+        return true;
+    };
+
+    // The manifest only stores the generated code of each stage, so identical stages referenced
+    // by multiple pipelines are deduplicated here and their modules compiled exactly once.
+    std::unordered_map<std::string, Shader*> stage_cache;
+    const vk::Device device = instance.GetDevice();
+    u32 num_loaded = 0;
+
+    manifest.reserve(manifest.size() + header.num_entries);
+    for (u32 n = 0; n < header.num_entries; n++) {
+        ManifestEntry entry{};
+        bool entry_valid = read(&entry.info, sizeof(entry.info)) &&
+                           read(entry.shader_hashes.data(), sizeof(entry.shader_hashes));
+        for (u32 i = 0; entry_valid && i < MAX_SHADER_STAGES; i++) {
+            u32 code_size = 0;
+            entry_valid = read(&entry.stages[i].kind, sizeof(u8)) &&
+                          entry.stages[i].kind <= ManifestStage::Spirv &&
+                          read(&code_size, sizeof(code_size));
+            if (entry_valid && code_size != 0) {
+                entry.stages[i].code.resize(code_size);
+                entry_valid = read(entry.stages[i].code.data(), code_size);
+            }
+        }
+        if (!entry_valid) {
+            LOG_WARNING(Render_Vulkan, "Pipeline manifest truncated, ignoring remaining entries");
+            break;
+        }
+
+        std::array<Shader*, MAX_SHADER_STAGES> stages{};
+        for (u32 i = 0; i < MAX_SHADER_STAGES; i++) {
+            const ManifestStage& stage = entry.stages[i];
+            switch (stage.kind) {
+            case ManifestStage::None:
+                break;
+            case ManifestStage::Trivial:
+                stages[i] = &trivial_vertex_shader;
+                break;
+            case ManifestStage::Glsl:
+                if (i == ProgramType::VS) {
+                    // Seed the programmable vertex cache so the title's own lookup by generated
+                    // code reuses the precompiled module instead of compiling a duplicate.
+                    auto [iter, new_program] =
+                        programmable_vertex_cache.try_emplace(stage.code, instance);
+                    Shader& shader = iter->second;
+                    if (new_program) {
+                        shader.program = stage.code;
+                        shader_workers.QueueWork([device, &shader] {
+                            shader.module = Compile(shader.program,
+                                                    vk::ShaderStageFlagBits::eVertex, device,
+                                                    ShaderOptimization::Normal);
+                            shader.MarkDone();
+                        });
+                    }
+                    stages[i] = &shader;
+                    break;
+                }
+                [[fallthrough]];
+            case ManifestStage::Spirv: {
+                auto [iter, new_stage] = stage_cache.try_emplace(stage.code);
+                if (new_stage) {
+                    Shader& shader =
+                        *precompiled_shaders.emplace_back(std::make_unique<Shader>(instance));
+                    shader.program = stage.code;
+                    shader.is_spirv = stage.kind == ManifestStage::Spirv;
+                    const vk::ShaderStageFlagBits vk_stage = MakeShaderStage(i);
+                    shader_workers.QueueWork([device, vk_stage, &shader] {
+                        if (shader.is_spirv) {
+                            std::vector<u32> code(shader.program.size() / sizeof(u32));
+                            std::memcpy(code.data(), shader.program.data(),
+                                        code.size() * sizeof(u32));
+                            shader.module = CompileSPV(code, device);
+                        } else {
+                            shader.module = Compile(shader.program, vk_stage, device,
+                                                    ShaderOptimization::Normal);
+                        }
+                        shader.MarkDone();
+                    });
+                    iter->second = &shader;
+                }
+                stages[i] = iter->second;
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        u64 shader_hash = 0;
+        for (u32 i = 0; i < MAX_SHADER_STAGES; i++) {
+            shader_hash = Common::HashCombine(shader_hash, entry.shader_hashes[i]);
+        }
+
+        const u64 pipeline_hash = Common::HashCombine(shader_hash, entry.info.Hash(instance));
+        auto [it, new_pipeline] = graphics_pipelines.try_emplace(pipeline_hash);
+        if (new_pipeline) {
+            it.value() = std::make_unique<GraphicsPipeline>(instance, renderpass_cache, entry.info,
+                                                            pipeline_cache,
+                                                            desc_manager.GetPipelineLayout(),
+                                                            stages, &pipeline_workers);
+            num_loaded++;
+        }
+
+        manifest.push_back(std::move(entry));
+    }
+
+    if (num_loaded == 0) {
+        return;
+    }
+
+    // Block until the workers drain so every recorded pipeline is ready before the first draw.
+    LOG_INFO(Render_Vulkan, "Precompiling {} pipelines from the manifest", num_loaded);
+    shader_workers.WaitForRequests();
+    pipeline_workers.WaitForRequests();
+    LOG_INFO(Render_Vulkan, "Pipeline precompilation finished");
+}
+
+void PipelineCache::SaveManifest() {
+    const std::string manifest_path = GetManifestPath();
+    if (manifest_path.empty() || manifest.empty()) {
+        return;
+    }
+
+    FileUtil::IOFile manifest_file{manifest_path, "wb"};
+    if (!manifest_file.IsOpen()) {
+        LOG_ERROR(Render_Vulkan, "Unable to open pipeline manifest for writing");
+        return;
+    }
+
+    const PipelineManifestHeader header = {
+        .version = PIPELINE_MANIFEST_VERSION,
+        .vendor_id = instance.GetVendorID(),
+        .device_id = instance.GetDeviceID(),
+        .num_entries = static_cast<u32>(manifest.size()),
+    };
+    if (!manifest_file.WriteBytes(&header, sizeof(header))) {
+        LOG_ERROR(Render_Vulkan, "Error during pipeline manifest write");
+        return;
+    }
+
+    for (const ManifestEntry& entry : manifest) {
+        bool entry_valid = manifest_file.WriteBytes(&entry.info, sizeof(entry.info)) &&
+                           manifest_file.WriteBytes(entry.shader_hashes.data(),
+                                                    sizeof(entry.shader_hashes));
+        for (u32 i = 0; entry_valid && i < MAX_SHADER_STAGES; i++) {
+            const ManifestStage& stage = entry.stages[i];
+            const u32 code_size = static_cast<u32>(stage.code.size());
+            entry_valid = manifest_file.WriteBytes(&stage.kind, sizeof(u8)) &&
+                          manifest_file.WriteBytes(&code_size, sizeof(code_size)) &&
+                          (code_size == 0 || manifest_file.WriteBytes(stage.code.data(),
+                                                                      code_size));
+        }
+        if (!entry_valid) {
+            LOG_ERROR(Render_Vulkan, "Error during pipeline manifest write");
+            return;
+        }
+    }
+
+    manifest_file.Close();
+}
+
+std::string PipelineCache::GetManifestPath() const {
+    u64 program_id = 0;
+    if (Core::System::GetInstance().GetAppLoader().ReadProgramId(program_id) !=
+            Loader::ResultStatus::Success ||
+        program_id == 0) {
+        return {};
+    }
+    return fmt::format("{}{:016X}.manifest", GetPipelineCacheDir(), program_id);
+}
+
 bool PipelineCache::BindPipeline(const PipelineInfo& info, bool wait_built) {
     MICROPROFILE_SCOPE(Vulkan_Bind);
 
@@ -463,6 +711,9 @@ bool PipelineCache::BindPipeline(const PipelineInfo& info, bool wait_built) {
         it.value() = std::make_unique<GraphicsPipeline>(
             instance, renderpass_cache, info, pipeline_cache, desc_manager.GetPipelineLayout(),
             current_shaders, &pipeline_workers);
+        if (Settings::values.use_disk_shader_cache) {
+            RecordPipeline(info);
+        }
     }
 
     GraphicsPipeline* const pipeline{it->second.get()};
@@ -566,10 +817,11 @@ bool PipelineCache::UseFixedGeometryShader(const Pica::Regs& regs) {
     auto& shader = it->second;
 
     if (new_shader) {
+        // Generate the code upfront so it can be recorded to the pipeline manifest
+        shader.program = GenerateFixedGeometryShader(gs_config);
         const vk::Device device = instance.GetDevice();
-        shader_workers.QueueWork([gs_config, device, &shader]() {
-            const std::string code = GenerateFixedGeometryShader(gs_config);
-            shader.module = Compile(code, vk::ShaderStageFlagBits::eGeometry, device,
+        shader_workers.QueueWork([device, &shader]() {
+            shader.module = Compile(shader.program, vk::ShaderStageFlagBits::eGeometry, device,
                                     ShaderOptimization::Normal);
             shader.MarkDone();
         });
@@ -597,13 +849,22 @@ void PipelineCache::UseFragmentShader(const Pica::Regs& regs) {
         const vk::Device device = instance.GetDevice();
 
         if (use_spirv && !config.state.shadow_rendering.Value()) {
-            const std::vector code = GenerateFragmentShaderSPV(config);
-            shader.module = CompileSPV(code, device);
-            shader.MarkDone();
+            // Generate the code upfront so it can be recorded to the pipeline manifest, but
+            // hand the module compilation to the workers like the GLSL path does instead of
+            // stalling the rendering thread on the driver.
+            std::vector code = GenerateFragmentShaderSPV(config);
+            shader.program.assign(reinterpret_cast<const char*>(code.data()),
+                                  code.size() * sizeof(u32));
+            shader.is_spirv = true;
+            shader_workers.QueueWork([device, code = std::move(code), &shader]() {
+                shader.module = CompileSPV(code, device);
+                shader.MarkDone();
+            });
         } else {
-            shader_workers.QueueWork([config, device, &shader]() {
-                const std::string code = GenerateFragmentShader(config);
-                shader.module = Compile(code, vk::ShaderStageFlagBits::eFragment, device,
+            // Generate the code upfront so it can be recorded to the pipeline manifest
+            shader.program = GenerateFragmentShader(config);
+            shader_workers.QueueWork([device, &shader]() {
+                shader.module = Compile(shader.program, vk::ShaderStageFlagBits::eFragment, device,
                                         ShaderOptimization::Debug);
                 shader.MarkDone();
             });
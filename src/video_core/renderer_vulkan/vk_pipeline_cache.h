@@ -172,7 +172,8 @@ class PipelineCache {
 
         vk::ShaderModule module;
         vk::Device device;
-        std::string program;
+        std::string program; ///< GLSL source, or raw SPIR-V words when is_spirv is set
+        bool is_spirv = false;
     };
 
     class GraphicsPipeline : public Common::AsyncHandle {
@@ -251,6 +252,32 @@ public:
     void SetBufferOffset(u32 binding, u32 offset);
 
 private:
+    /// Stage payload of a pipeline manifest entry
+    struct ManifestStage {
+        enum Kind : u8 { None = 0, Trivial = 1, Glsl = 2, Spirv = 3 };
+        u8 kind = None;
+        std::string code;
+    };
+
+    /// A single graphics pipeline recorded to the per-title manifest
+    struct ManifestEntry {
+        PipelineInfo info;
+        std::array<u64, MAX_SHADER_STAGES> shader_hashes;
+        std::array<ManifestStage, MAX_SHADER_STAGES> stages;
+    };
+
+    /// Appends a newly created pipeline to the in-memory manifest
+    void RecordPipeline(const PipelineInfo& info);
+
+    /// Builds every pipeline recorded in the per-title manifest before gameplay starts
+    void PrecompileManifest();
+
+    /// Stores the recorded pipeline manifest to disk
+    void SaveManifest();
+
+    /// Returns the path of the per-title pipeline manifest; empty without a title id
+    std::string GetManifestPath() const;
+
     /// Applies dynamic pipeline state to the current command buffer
     void ApplyDynamic(const PipelineInfo& info, bool is_dirty);
 
@@ -294,6 +321,8 @@ private:
     std::unordered_map<PicaFixedGSConfig, Shader> fixed_geometry_shaders;
     std::unordered_map<PicaFSConfig, Shader> fragment_shaders;
     Shader trivial_vertex_shader;
+    std::vector<ManifestEntry> manifest;
+    std::vector<std::unique_ptr<Shader>> precompiled_shaders;
 };
 
 } // namespace Vulkan
@@ -134,6 +134,7 @@ RasterizerVulkan::~RasterizerVulkan() {
 }
 
 void RasterizerVulkan::TickFrame() {
+    draw_state_dirty = true;
     res_cache.TickFrame();
 }
 
@@ -449,6 +450,33 @@ void RasterizerVulkan::DrawTriangles() {
 bool RasterizerVulkan::Draw(bool accelerate, bool is_indexed) {
     MICROPROFILE_SCOPE(Vulkan_Drawing);
 
+    // Fast path for consecutive accelerated draws that only updated draw parameters: the
+    // framebuffer, textures, shaders and uniforms synced by the previous draw are still valid,
+    // so only the render pass and the dynamic state need to be re-established.
+    if (accelerate && !draw_state_dirty && cached_draw_framebuffer.has_value()) {
+        const Framebuffer& framebuffer = *cached_draw_framebuffer;
+        renderpass_cache.BeginRendering(framebuffer);
+        scheduler.Record([viewport = framebuffer.Viewport(),
+                          scissor = framebuffer.RenderArea()](vk::CommandBuffer cmdbuf) {
+            const vk::Viewport vk_viewport = {
+                .x = static_cast<f32>(viewport.x),
+                .y = static_cast<f32>(viewport.y),
+                .width = static_cast<f32>(viewport.width),
+                .height = static_cast<f32>(viewport.height),
+                .minDepth = 0.f,
+                .maxDepth = 1.f,
+            };
+
+            cmdbuf.setViewport(0, vk_viewport);
+            cmdbuf.setScissor(0, scissor);
+        });
+
+        const bool succeeded = AccelerateDrawBatchInternal(is_indexed);
+        vertex_batch.clear();
+        res_cache.InvalidateFramebuffer(framebuffer);
+        return succeeded;
+    }
+
     const bool shadow_rendering = regs.framebuffer.IsShadowRendering();
     const bool has_stencil = regs.framebuffer.HasStencil();
 
@@ -502,7 +530,7 @@ bool RasterizerVulkan::Draw(bool accelerate, bool is_indexed) {
     // Sync and bind the shader
     if (shader_dirty) {
         pipeline_cache.UseFragmentShader(regs);
-        shader_dirty = false;
+        shader_dirty = 0;
     }
 
     // Sync the LUTs within the texture buffer
@@ -549,6 +577,15 @@ bool RasterizerVulkan::Draw(bool accelerate, bool is_indexed) {
     vertex_batch.clear();
 
     res_cache.InvalidateFramebuffer(framebuffer);
+
+    // Shadow draws are excluded from the fast path as they require the storage image barrier
+    // and cache lookup every draw.
+    if (accelerate && succeeded && !shadow_rendering) {
+        cached_draw_framebuffer = framebuffer;
+        draw_state_dirty = false;
+    } else {
+        cached_draw_framebuffer.reset();
+    }
     return succeeded;
 }
 
@@ -735,35 +772,43 @@ void RasterizerVulkan::NotifyFixedFunctionPicaRegisterChanged(u32 id) {
 }
 
 void RasterizerVulkan::FlushAll() {
+    draw_state_dirty = true;
     res_cache.FlushAll();
 }
 
 void RasterizerVulkan::FlushRegion(PAddr addr, u32 size) {
+    draw_state_dirty = true;
     res_cache.FlushRegion(addr, size);
 }
 
 void RasterizerVulkan::InvalidateRegion(PAddr addr, u32 size) {
+    draw_state_dirty = true;
     res_cache.InvalidateRegion(addr, size);
 }
 
 void RasterizerVulkan::FlushAndInvalidateRegion(PAddr addr, u32 size) {
+    draw_state_dirty = true;
     res_cache.FlushRegion(addr, size);
     res_cache.InvalidateRegion(addr, size);
 }
 
 void RasterizerVulkan::ClearAll(bool flush) {
+    draw_state_dirty = true;
     res_cache.ClearAll(flush);
 }
 
 bool RasterizerVulkan::AccelerateDisplayTransfer(const GPU::Regs::DisplayTransferConfig& config) {
+    draw_state_dirty = true;
     return res_cache.AccelerateDisplayTransfer(config);
 }
 
 bool RasterizerVulkan::AccelerateTextureCopy(const GPU::Regs::DisplayTransferConfig& config) {
+    draw_state_dirty = true;
     return res_cache.AccelerateTextureCopy(config);
 }
 
 bool RasterizerVulkan::AccelerateFill(const GPU::Regs::MemoryFillConfig& config) {
+    draw_state_dirty = true;
     return res_cache.AccelerateFill(config);
 }
 
@@ -773,6 +818,7 @@ bool RasterizerVulkan::AccelerateDisplay(const GPU::Regs::FramebufferConfig& con
     if (framebuffer_addr == 0) [[unlikely]] {
         return false;
     }
+    draw_state_dirty = true;
 
     VideoCore::SurfaceParams src_params;
     src_params.addr = framebuffer_addr;
@@ -868,7 +914,7 @@ void RasterizerVulkan::SyncBlendColor() {
 void RasterizerVulkan::SyncLogicOp() {
     if (instance.NeedsLogicOpEmulation()) {
         // We need this in the fragment shader to emulate logic operations
-        shader_dirty = true;
+        shader_dirty |= VideoCore::ShaderDirtyOutput;
     }
 
     pipeline_info.blending.logic_op = regs.framebuffer.output_merger.logic_op;
@@ -956,12 +1002,9 @@ void RasterizerVulkan::SyncAndUploadLUTsLF() {
     if (uniform_block_data.lighting_lut_dirty_any || invalidate) {
         for (unsigned index = 0; index < uniform_block_data.lighting_lut_dirty.size(); index++) {
             if (uniform_block_data.lighting_lut_dirty[index] || invalidate) {
-                std::array<Common::Vec2f, 256> new_data;
-                const auto& source_lut = Pica::g_state.lighting.luts[index];
-                std::transform(source_lut.begin(), source_lut.end(), new_data.begin(),
-                               [](const auto& entry) {
-                                   return Common::Vec2f{entry.ToFloat(), entry.DiffToFloat()};
-                               });
+                // The converted mirror is kept up to date as entries are written, so the bank
+                // does not have to be reconverted here
+                const auto& new_data = Pica::g_state.lighting.luts_converted[index];
 
                 if (new_data != lighting_lut_data[index] || invalidate) {
                     lighting_lut_data[index] = new_data;
@@ -1108,7 +1151,9 @@ void RasterizerVulkan::SyncAndUploadLUTs() {
 }
 
 void RasterizerVulkan::UploadUniforms(bool accelerate_draw) {
-    const bool sync_vs = accelerate_draw;
+    // The VS buffer offset from the previous draw stays valid while no uniform was written,
+    // so unchanged uniforms are not converted or re-uploaded at all.
+    const bool sync_vs = accelerate_draw && vs_uniforms_dirty;
     const bool sync_fs = uniform_block_data.dirty;
 
     if (!sync_vs && !sync_fs) {
@@ -1119,14 +1164,20 @@ void RasterizerVulkan::UploadUniforms(bool accelerate_draw) {
     auto [uniforms, offset, invalidate] =
         uniform_buffer.Map(uniform_size, uniform_buffer_alignment);
 
+    if (invalidate) {
+        // Invalidating the stream buffer discarded the region the VS offset points at
+        vs_uniforms_dirty = true;
+    }
+
     u32 used_bytes = 0;
-    if (sync_vs) {
+    if (accelerate_draw && vs_uniforms_dirty) {
         Pica::Shader::VSUniformData vs_uniforms;
         vs_uniforms.uniforms.SetFromRegs(regs.vs, Pica::g_state.vs);
         std::memcpy(uniforms, &vs_uniforms, sizeof(vs_uniforms));
 
         pipeline_cache.SetBufferOffset(0, offset);
         used_bytes += static_cast<u32>(uniform_size_aligned_vs);
+        vs_uniforms_dirty = false;
     }
 
     if (sync_fs || invalidate) {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <optional>
 #include "core/hw/gpu.h"
 #include "video_core/rasterizer_accelerated.h"
 #include "video_core/renderer_vulkan/vk_pipeline_cache.h"
@@ -170,6 +171,10 @@ private:
     u64 uniform_size_aligned_vs;
     u64 uniform_size_aligned_fs;
     bool async_shaders{false};
+
+    /// Framebuffer the last accelerated draw rendered to, reused by state-identical draws
+    /// while draw_state_dirty stays clear
+    std::optional<Framebuffer> cached_draw_framebuffer;
 };
 
 } // namespace Vulkan
@@ -16,7 +16,34 @@ using VideoCore::SurfaceType;
 
 RenderpassCache::RenderpassCache(const Instance& instance, Scheduler& scheduler)
     : instance{instance}, scheduler{scheduler}, dynamic_rendering{
-                                                    instance.IsDynamicRenderingSupported()} {}
+                                                    instance.IsDynamicRenderingSupported()} {
+    if (dynamic_rendering) {
+        // Renderpass objects are never used with dynamic rendering
+        return;
+    }
+
+    // The format space is tiny and renderpass creation is cheap (unlike pipelines), so every
+    // combination is baked upfront. Draw-path lookups are then pure indexing, with no lock and
+    // no creation check.
+    for (u32 color = 0; color <= MAX_COLOR_FORMATS; color++) {
+        for (u32 depth = 0; depth <= MAX_DEPTH_FORMATS; depth++) {
+            const PixelFormat color_format =
+                color == MAX_COLOR_FORMATS ? PixelFormat::Invalid : static_cast<PixelFormat>(color);
+            const PixelFormat depth_format = depth == MAX_DEPTH_FORMATS
+                                                 ? PixelFormat::Invalid
+                                                 : static_cast<PixelFormat>(depth + 14);
+            const vk::Format color_native = instance.GetTraits(color_format).native;
+            const vk::Format depth_native = instance.GetTraits(depth_format).native;
+            for (u32 is_clear = 0; is_clear < 2; is_clear++) {
+                const vk::AttachmentLoadOp load_op =
+                    is_clear != 0 ? vk::AttachmentLoadOp::eClear : vk::AttachmentLoadOp::eLoad;
+                cached_renderpasses[color][depth][is_clear] =
+                    CreateRenderPass(color_native, depth_native, load_op,
+                                     vk::ImageLayout::eGeneral, vk::ImageLayout::eGeneral);
+            }
+        }
+    }
+}
 
 RenderpassCache::~RenderpassCache() {
     vk::Device device = instance.GetDevice();
@@ -231,9 +258,7 @@ void RenderpassCache::EndRendering() {
 }
 
 vk::RenderPass RenderpassCache::GetRenderpass(VideoCore::PixelFormat color,
-                                              VideoCore::PixelFormat depth, bool is_clear) {
-    std::scoped_lock lock{cache_mutex};
-
+                                              VideoCore::PixelFormat depth, bool is_clear) const {
     const u32 color_index =
         color == VideoCore::PixelFormat::Invalid ? MAX_COLOR_FORMATS : static_cast<u32>(color);
     const u32 depth_index = depth == VideoCore::PixelFormat::Invalid
@@ -243,17 +268,9 @@ vk::RenderPass RenderpassCache::GetRenderpass(VideoCore::PixelFormat color,
     ASSERT_MSG(color_index <= MAX_COLOR_FORMATS && depth_index <= MAX_DEPTH_FORMATS,
                "Invalid color index {} and/or depth_index {}", color_index, depth_index);
 
-    vk::RenderPass& renderpass = cached_renderpasses[color_index][depth_index][is_clear];
-    if (!renderpass) {
-        const vk::Format color_format = instance.GetTraits(color).native;
-        const vk::Format depth_format = instance.GetTraits(depth).native;
-        const vk::AttachmentLoadOp load_op =
-            is_clear ? vk::AttachmentLoadOp::eClear : vk::AttachmentLoadOp::eLoad;
-        renderpass = CreateRenderPass(color_format, depth_format, load_op,
-                                      vk::ImageLayout::eGeneral, vk::ImageLayout::eGeneral);
-    }
-
-    return renderpass;
+    // All combinations are created in the constructor, so this is safe to call concurrently
+    // from the pipeline workers without synchronization.
+    return cached_renderpasses[color_index][depth_index][is_clear];
 }
 
 vk::RenderPass RenderpassCache::CreateRenderPass(vk::Format color, vk::Format depth,
@@ -6,7 +6,6 @@
 
 #include <compare>
 #include <cstring>
-#include <mutex>
 #include <variant>
 #include "common/hash.h"
 #include "video_core/rasterizer_cache/pixel_format.h"
@@ -87,9 +86,10 @@ public:
     /// Creates the renderpass used when rendering to the swapchain
     void CreatePresentRenderpass(vk::Format format);
 
-    /// Returns the renderpass associated with the color-depth format pair
+    /// Returns the renderpass associated with the color-depth format pair. Every combination is
+    /// created upfront, so this is a plain table lookup usable from any thread.
     vk::RenderPass GetRenderpass(VideoCore::PixelFormat color, VideoCore::PixelFormat depth,
-                                 bool is_clear);
+                                 bool is_clear) const;
 
 private:
     /// Begins a new rendering scope using dynamic rendering
@@ -115,7 +115,6 @@ private:
     bool rendering = false;
     bool dynamic_rendering = false;
     u32 cmd_count{};
-    std::mutex cache_mutex;
 };
 
 } // namespace Vulkan
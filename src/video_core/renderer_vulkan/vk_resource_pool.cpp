@@ -14,11 +14,8 @@ ResourcePool::ResourcePool(MasterSemaphore* master_semaphore_, size_t grow_step_
     : master_semaphore{master_semaphore_}, grow_step{grow_step_} {}
 
 std::size_t ResourcePool::CommitResource() {
-    // Refresh semaphore to query updated results
-    master_semaphore->Refresh();
-    const u64 gpu_tick = master_semaphore->KnownGpuTick();
-    const auto search = [this, gpu_tick](std::size_t begin,
-                                         std::size_t end) -> std::optional<std::size_t> {
+    const auto search = [this](std::size_t begin, std::size_t end,
+                               u64 gpu_tick) -> std::optional<std::size_t> {
         for (std::size_t iterator = begin; iterator < end; ++iterator) {
             if (gpu_tick >= ticks[iterator]) {
                 ticks[iterator] = master_semaphore->CurrentTick();
@@ -28,11 +25,23 @@ std::size_t ResourcePool::CommitResource() {
         return std::nullopt;
     };
 
-    // Try to find a free resource from the hinted position to the end.
-    std::optional<std::size_t> found = search(hint_iterator, ticks.size());
+    // Try to find a free resource from the hinted position to the end, then from the
+    // beginning to the hinted position.
+    const auto search_all = [&](u64 gpu_tick) {
+        std::optional<std::size_t> found = search(hint_iterator, ticks.size(), gpu_tick);
+        if (!found) {
+            found = search(0, hint_iterator, gpu_tick);
+        }
+        return found;
+    };
+
+    // The last known GPU tick is tried first, so the common case where a retired resource is
+    // available does not query the semaphore counter from the driver at all.
+    std::optional<std::size_t> found = search_all(master_semaphore->KnownGpuTick());
     if (!found) {
-        // Search from beginning to the hinted position.
-        found = search(0, hint_iterator);
+        // Nothing looked free with the cached tick; refresh it and retry before growing.
+        master_semaphore->Refresh();
+        found = search_all(master_semaphore->KnownGpuTick());
         if (!found) {
             // Both searches failed, the pool is full; handle it.
             const std::size_t free_resource = ManageOverflow();
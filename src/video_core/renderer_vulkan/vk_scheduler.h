@@ -58,11 +58,28 @@ public:
             return;
         }
 
-        if (chunk->Record(command)) {
+        if (chunk->Record<T, false>(command)) {
             return;
         }
         DispatchWork();
-        (void)chunk->Record(command);
+        (void)chunk->Record<T, false>(command);
+    }
+
+    /// Records the command to the upload command buffer, which executes before all commands
+    /// recorded with Record in the same submission. Useful for hoisting transfer operations
+    /// and layout transitions out of the middle of a renderpass.
+    template <typename T>
+    void RecordEarly(T&& command) {
+        if (!use_worker_thread) {
+            command(upload_cmdbuf);
+            return;
+        }
+
+        if (chunk->Record<T, true>(command)) {
+            return;
+        }
+        DispatchWork();
+        (void)chunk->Record<T, true>(command);
     }
 
     /// Marks the provided state as non dirty
@@ -102,7 +119,7 @@ private:
     public:
         virtual ~Command() = default;
 
-        virtual void Execute(vk::CommandBuffer cmdbuf) const = 0;
+        virtual void Execute(vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf) const = 0;
 
         Command* GetNext() const {
             return next;
@@ -116,7 +133,7 @@ private:
         Command* next = nullptr;
     };
 
-    template <typename T>
+    template <typename T, bool is_upload>
     class TypedCommand final : public Command {
     public:
         explicit TypedCommand(T&& command_) : command{std::move(command_)} {}
@@ -125,8 +142,12 @@ private:
         TypedCommand(TypedCommand&&) = delete;
         TypedCommand& operator=(TypedCommand&&) = delete;
 
-        void Execute(vk::CommandBuffer cmdbuf) const override {
-            command(cmdbuf);
+        void Execute(vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf) const override {
+            if constexpr (is_upload) {
+                command(upload_cmdbuf);
+            } else {
+                command(cmdbuf);
+            }
         }
 
     private:
@@ -135,11 +156,11 @@ private:
 
     class CommandChunk final {
     public:
-        void ExecuteAll(vk::CommandBuffer cmdbuf);
+        void ExecuteAll(vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf);
 
-        template <typename T>
+        template <typename T, bool is_upload>
         bool Record(T& command) {
-            using FuncType = TypedCommand<T>;
+            using FuncType = TypedCommand<T, is_upload>;
             static_assert(sizeof(FuncType) < sizeof(data), "Lambda is too large");
 
             recorded_counts++;
@@ -199,6 +220,7 @@ private:
     std::queue<std::unique_ptr<CommandChunk>> work_queue;
     std::vector<std::unique_ptr<CommandChunk>> chunk_reserve;
     vk::CommandBuffer current_cmdbuf;
+    vk::CommandBuffer upload_cmdbuf;
     StateFlags state{};
     std::mutex execution_mutex;
     std::mutex reserve_mutex;
@@ -152,9 +152,17 @@ void StreamBuffer::CreateBuffers(u64 prefered_size) {
     const VkDeviceSize heap_size = memory_properties.memoryHeaps[preferred_heap].size;
     // As per DXVK's example, using `heap_size / 2`
     const VkDeviceSize allocable_size = heap_size / 2;
+    // Upload buffers are also read by the dedicated transfer queue when async transfers
+    // are available, so share them between the two queue families.
+    const std::array queue_families = {instance.GetGraphicsQueueFamilyIndex(),
+                                       instance.GetTransferQueueFamilyIndex()};
+    const bool concurrent = type == BufferType::Upload && instance.HasTransferQueue();
     buffer = device.createBuffer({
         .size = std::min(prefered_size, allocable_size),
         .usage = usage,
+        .sharingMode = concurrent ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
+        .queueFamilyIndexCount = concurrent ? static_cast<u32>(queue_families.size()) : 0u,
+        .pQueueFamilyIndices = concurrent ? queue_families.data() : nullptr,
     });
 
     const auto requirements = device.getBufferMemoryRequirements(buffer);
@@ -3,9 +3,11 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <chrono>
 #include <limits>
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/perf_counters.h"
 #include "common/settings.h"
 #include "video_core/renderer_vulkan/vk_instance.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -82,9 +84,14 @@ void Swapchain::Create(u32 width_, u32 height_, vk::SurfaceKHR surface_) {
 bool Swapchain::AcquireNextImage() {
     MICROPROFILE_SCOPE(Vulkan_Acquire);
     vk::Device device = instance.GetDevice();
+    const auto acquire_start = std::chrono::steady_clock::now();
     vk::Result result =
         device.acquireNextImageKHR(swapchain, std::numeric_limits<u64>::max(),
                                    image_acquired[frame_index], VK_NULL_HANDLE, &image_index);
+    Common::PerfCounters::Add(Common::PerfCounters::Counter::SwapchainAcquireUs,
+                              std::chrono::duration_cast<std::chrono::microseconds>(
+                                  std::chrono::steady_clock::now() - acquire_start)
+                                  .count());
 
     switch (result) {
     case vk::Result::eSuccess:
@@ -167,8 +174,17 @@ void Swapchain::SetPresentMode() {
             return it != modes.end();
         };
 
-        const bool has_mailbox = find_mode(vk::PresentModeKHR::eMailbox);
-        present_mode = has_mailbox ? vk::PresentModeKHR::eMailbox : vk::PresentModeKHR::eImmediate;
+        // Only FIFO is guaranteed by the spec; fall back to it when neither mode that can
+        // present without waiting for vertical blank is available.
+        if (find_mode(vk::PresentModeKHR::eMailbox)) {
+            present_mode = vk::PresentModeKHR::eMailbox;
+        } else if (find_mode(vk::PresentModeKHR::eImmediate)) {
+            present_mode = vk::PresentModeKHR::eImmediate;
+        } else {
+            LOG_WARNING(Render_Vulkan,
+                        "Neither mailbox nor immediate present mode is supported, "
+                        "falling back to FIFO");
+        }
     }
 }
 
@@ -184,8 +200,11 @@ void Swapchain::SetSurfaceProperties() {
                                  std::min(capabilities.maxImageExtent.height, height));
     }
 
-    // Select number of images in swap chain, we prefer one buffer in the background to work on
-    image_count = capabilities.minImageCount + 1;
+    // Select number of images in swap chain, we prefer one buffer in the background to work on.
+    // Mailbox replaces the queued image instead of waiting for it, so ask for an additional
+    // one there to keep an acquirable image available while the driver holds two.
+    const u32 extra_images = present_mode == vk::PresentModeKHR::eMailbox ? 2u : 1u;
+    image_count = capabilities.minImageCount + extra_images;
     if (capabilities.maxImageCount > 0) {
         image_count = std::min(image_count, capabilities.maxImageCount);
     }
@@ -108,7 +108,7 @@ u32 UnpackDepthStencil(const VideoCore::StagingData& data, vk::Format dest) {
 
 Image MakeImage(const Instance& instance, u32 width, u32 height, u32 levels, u32 layers,
                 vk::Format format, vk::ImageUsageFlags usage, vk::ImageCreateFlags flags,
-                bool need_format_list, std::string_view debug_name = {}) {
+                bool need_format_list, std::string_view debug_name = {}, bool concurrent = false) {
     const std::array format_list = {
         vk::Format::eR8G8B8A8Unorm,
         vk::Format::eR32Uint,
@@ -118,6 +118,8 @@ Image MakeImage(const Instance& instance, u32 width, u32 height, u32 levels, u32
         .pViewFormats = format_list.data(),
     };
 
+    const std::array queue_families = {instance.GetGraphicsQueueFamilyIndex(),
+                                       instance.GetTransferQueueFamilyIndex()};
     const vk::ImageCreateInfo image_info = {
         .pNext = need_format_list ? &image_format_list : nullptr,
         .flags = flags,
@@ -128,6 +130,9 @@ Image MakeImage(const Instance& instance, u32 width, u32 height, u32 levels, u32
         .arrayLayers = layers,
         .samples = vk::SampleCountFlagBits::e1,
         .usage = usage,
+        .sharingMode = concurrent ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
+        .queueFamilyIndexCount = concurrent ? static_cast<u32>(queue_families.size()) : 0u,
+        .pQueueFamilyIndices = concurrent ? queue_families.data() : nullptr,
     };
 
     const VmaAllocationCreateInfo alloc_info = {
@@ -198,12 +203,43 @@ TextureRuntime::TextureRuntime(const Instance& instance, Scheduler& scheduler,
       download_buffer{instance, scheduler,
                       vk::BufferUsageFlagBits::eTransferDst |
                           vk::BufferUsageFlagBits::eStorageBuffer,
-                      DOWNLOAD_BUFFER_SIZE, BufferType::Download} {}
+                      DOWNLOAD_BUFFER_SIZE, BufferType::Download} {
+    if (instance.HasTransferQueue() && instance.IsTimelineSemaphoreSupported()) {
+        transfer_pool = instance.GetDevice().createCommandPoolUnique({
+            .flags = vk::CommandPoolCreateFlagBits::eTransient |
+                     vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+            .queueFamilyIndex = instance.GetTransferQueueFamilyIndex(),
+        });
+    }
+}
 
 TextureRuntime::~TextureRuntime() {
     Reset();
 }
 
+u64 TextureRuntime::SubmitTransfer(std::function<void(vk::CommandBuffer)>&& func) {
+    vk::UniqueCommandBuffer cmdbuf;
+    if (!free_transfer_cmdbufs.empty()) {
+        cmdbuf = std::move(free_transfer_cmdbufs.back());
+        free_transfer_cmdbufs.pop_back();
+    } else {
+        auto cmdbufs = instance.GetDevice().allocateCommandBuffersUnique({
+            .commandPool = *transfer_pool,
+            .level = vk::CommandBufferLevel::ePrimary,
+            .commandBufferCount = 1,
+        });
+        cmdbuf = std::move(cmdbufs[0]);
+    }
+
+    cmdbuf->begin({.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+    func(*cmdbuf);
+
+    // SubmitTransferWork ends the command buffer before submission
+    const u64 tick = scheduler.GetMasterSemaphore()->SubmitTransferWork(*cmdbuf);
+    pending_transfers.emplace_back(tick, std::move(cmdbuf));
+    return tick;
+}
+
 VideoCore::StagingData TextureRuntime::FindStaging(u32 size, bool upload) {
     StreamBuffer& buffer = upload ? upload_buffer : download_buffer;
     const auto [data, offset, invalidate] = buffer.Map(size, 16);
@@ -234,6 +270,13 @@ void TextureRuntime::TickFrame() {
             it++;
         }
     }
+
+    semaphore->RefreshTransfer();
+    const u64 transfer_tick = semaphore->KnownTransferTick();
+    while (!pending_transfers.empty() && pending_transfers.front().first <= transfer_tick) {
+        free_transfer_cmdbufs.emplace_back(std::move(pending_transfers.front().second));
+        pending_transfers.pop_front();
+    }
 }
 
 void TextureRuntime::Reset() {
@@ -272,9 +315,22 @@ Allocation TextureRuntime::Allocate(const VideoCore::SurfaceParams& params,
     if (it != destroy_queue.end()) {
         auto alloc{std::move(it->second)};
         destroy_queue.erase(it);
+        if (alloc.needs_init) {
+            // The previous owner was destroyed before its first upload; give the image its
+            // initial layout on the graphics queue like a regular allocation.
+            alloc.needs_init = false;
+            InitImages({alloc.images[0].handle, vk::Image{}, vk::Image{}}, 1, alloc.aspect);
+        }
         return alloc;
     }
 
+    // Texture surfaces are only ever written by uploads, so their first upload can be hoisted
+    // out of the draw stream: onto the dedicated transfer queue when one exists, or into the
+    // scheduler's upload command buffer otherwise. Either way no active renderpass has to be
+    // interrupted for it and the image receives its initial layout during the upload.
+    const bool async_init =
+        params.type == VideoCore::SurfaceType::Texture && params.res_scale == 1 && !material;
+
     u32 num_images = 0;
     std::array<vk::Image, 3> raw_images;
     std::array<Image, 3> images;
@@ -291,7 +347,8 @@ Allocation TextureRuntime::Allocate(const VideoCore::SurfaceParams& params,
     const bool need_format_list = is_mutable && instance.IsImageFormatListSupported();
     const std::string debug_name = params.DebugName(false, is_custom);
     images[0] = MakeImage(instance, params.width, params.height, params.levels, layers, format,
-                          traits.usage, flags, need_format_list, debug_name);
+                          traits.usage, flags, need_format_list, debug_name,
+                          async_init && HasAsyncTransfers());
     image_views[0] =
         MakeImageView(instance.GetDevice(), images[0], type, format, traits.aspect, params.levels);
     raw_images[num_images++] = images[0].handle;
@@ -315,8 +372,22 @@ Allocation TextureRuntime::Allocate(const VideoCore::SurfaceParams& params,
         raw_images[num_images++] = images[2].handle;
     }
 
+    if (async_init) {
+        // The first touch of this image happens outside the draw stream, which also performs
+        // the initial layout transition. See Surface::Upload and FlushInit.
+    } else {
+        InitImages(raw_images, num_images, traits.aspect);
+    }
+
+    Allocation alloc{tag, std::move(images), std::move(image_views), traits.aspect};
+    alloc.needs_init = async_init;
+    return alloc;
+}
+
+void TextureRuntime::InitImages(std::array<vk::Image, 3> raw_images, u32 num_images,
+                                vk::ImageAspectFlags aspect) {
     renderpass_cache.EndRendering();
-    scheduler.Record([raw_images, num_images, aspect = traits.aspect](vk::CommandBuffer cmdbuf) {
+    scheduler.Record([raw_images, num_images, aspect](vk::CommandBuffer cmdbuf) {
         for (u32 i = 0; i < num_images; i++) {
             const vk::ImageMemoryBarrier init_barrier = {
                 .srcAccessMask = vk::AccessFlagBits::eNone,
@@ -340,8 +411,15 @@ Allocation TextureRuntime::Allocate(const VideoCore::SurfaceParams& params,
                                    vk::DependencyFlagBits::eByRegion, {}, {}, init_barrier);
         }
     });
+}
 
-    return Allocation{tag, std::move(images), std::move(image_views), traits.aspect};
+void TextureRuntime::FlushInit(Surface& surface) {
+    Allocation& alloc = surface.alloc;
+    if (!alloc.needs_init) {
+        return;
+    }
+    alloc.needs_init = false;
+    InitImages({alloc.images[0].handle, vk::Image{}, vk::Image{}}, 1, alloc.aspect);
 }
 
 void TextureRuntime::Destroy(Allocation&& alloc) {
@@ -351,11 +429,16 @@ void TextureRuntime::Destroy(Allocation&& alloc) {
 
 bool TextureRuntime::Reinterpret(Surface& source, Surface& dest,
                                  const VideoCore::TextureBlit& blit) {
+    FlushInit(source);
+    FlushInit(dest);
+
     const PixelFormat src_format = source.pixel_format;
     const PixelFormat dst_format = dest.pixel_format;
     ASSERT_MSG(src_format != dst_format, "Reinterpretation with the same format is invalid");
     if (src_format == PixelFormat::D24S8 && dst_format == PixelFormat::RGBA8) {
         blit_helper.ConvertDS24S8ToRGBA8(source, dest, blit);
+    } else if (src_format == PixelFormat::RGBA8 && dst_format == PixelFormat::D24S8) {
+        return blit_helper.ConvertRGBA8ToDS24S8(source, dest, blit);
     } else {
         LOG_WARNING(Render_Vulkan, "Unimplemented reinterpretation {} -> {}",
                     VideoCore::PixelFormatAsString(src_format),
@@ -366,6 +449,7 @@ bool TextureRuntime::Reinterpret(Surface& source, Surface& dest,
 }
 
 bool TextureRuntime::ClearTexture(Surface& surface, const VideoCore::TextureClear& clear) {
+    FlushInit(surface);
     renderpass_cache.EndRendering();
 
     const RecordParams params = {
@@ -530,6 +614,8 @@ void TextureRuntime::ClearTextureWithRenderpass(Surface& surface,
 
 bool TextureRuntime::CopyTextures(Surface& source, Surface& dest,
                                   const VideoCore::TextureCopy& copy) {
+    FlushInit(source);
+    FlushInit(dest);
     renderpass_cache.EndRendering();
 
     const RecordParams params = {
@@ -653,6 +739,9 @@ bool TextureRuntime::CopyTextures(Surface& source, Surface& dest,
 
 bool TextureRuntime::BlitTextures(Surface& source, Surface& dest,
                                   const VideoCore::TextureBlit& blit) {
+    FlushInit(source);
+    FlushInit(dest);
+
     const bool is_depth_stencil = source.type == VideoCore::SurfaceType::DepthStencil;
     const auto& depth_traits = instance.GetTraits(source.pixel_format);
     if (is_depth_stencil && !depth_traits.blit_support) {
@@ -786,6 +875,8 @@ bool TextureRuntime::BlitTextures(Surface& source, Surface& dest,
 }
 
 void TextureRuntime::GenerateMipmaps(Surface& surface) {
+    FlushInit(surface);
+
     if (VideoCore::IsCustomFormatCompressed(surface.custom_format)) {
         LOG_ERROR(Render_Vulkan, "Generating mipmaps for compressed formats unsupported!");
         return;
@@ -818,6 +909,10 @@ bool TextureRuntime::NeedsConversion(VideoCore::PixelFormat format) const {
            traits.aspect != (vk::ImageAspectFlagBits::eDepth | vk::ImageAspectFlagBits::eStencil);
 }
 
+bool TextureRuntime::IsCustomFormatSupported(VideoCore::CustomPixelFormat format) const {
+    return instance.GetTraits(format).transfer_support;
+}
+
 Surface::Surface(TextureRuntime& runtime_, const VideoCore::SurfaceParams& params)
     : VideoCore::SurfaceBase{params}, runtime{&runtime_}, instance{&runtime_.GetInstance()},
       scheduler{&runtime_.GetScheduler()}, is_depth_stencil{type ==
@@ -839,6 +934,16 @@ Surface::~Surface() {
 
 void Surface::Upload(const VideoCore::BufferTextureCopy& upload,
                      const VideoCore::StagingData& staging) {
+    // The first upload of a texture surface is hoisted out of the draw stream, either onto
+    // the dedicated transfer queue or into the scheduler's upload command buffer, so it does
+    // not interrupt an active renderpass. Re-uploads stay in the draw stream since draws
+    // recorded in the current batch may still reference the old contents.
+    if (alloc.needs_init) {
+        alloc.needs_init = false;
+        UploadAsync(upload, staging);
+        return;
+    }
+
     runtime->renderpass_cache.EndRendering();
 
     const RecordParams params = {
@@ -936,6 +1041,108 @@ void Surface::Upload(const VideoCore::BufferTextureCopy& upload,
     }
 }
 
+void Surface::UploadAsync(const VideoCore::BufferTextureCopy& upload,
+                          const VideoCore::StagingData& staging) {
+    const RecordParams params = {
+        .aspect = alloc.aspect,
+        .src_image = Image(0),
+    };
+
+    // On the transfer queue visibility to the graphics queue is covered by the timeline
+    // wait; in the upload command buffer the write barrier itself must make the contents
+    // visible to sampling.
+    const bool use_transfer_queue = runtime->HasAsyncTransfers();
+    const vk::AccessFlags dst_access =
+        use_transfer_queue ? vk::AccessFlagBits::eNone : vk::AccessFlagBits::eShaderRead;
+    const vk::PipelineStageFlags dst_stage = use_transfer_queue
+                                                 ? vk::PipelineStageFlagBits::eBottomOfPipe
+                                                 : vk::PipelineStageFlagBits::eFragmentShader;
+
+    auto copy_func = [buffer = runtime->upload_buffer.Handle(), format = alloc.format, params,
+                      staging, upload, dst_access, dst_stage](vk::CommandBuffer cmdbuf) {
+        u32 num_copies = 1;
+        std::array<vk::BufferImageCopy, 2> buffer_image_copies;
+
+        const auto rect = upload.texture_rect;
+        buffer_image_copies[0] = vk::BufferImageCopy{
+            .bufferOffset = upload.buffer_offset,
+            .bufferRowLength = rect.GetWidth(),
+            .bufferImageHeight = rect.GetHeight(),
+            .imageSubresource{
+                .aspectMask = params.aspect,
+                .mipLevel = upload.texture_level,
+                .baseArrayLayer = 0,
+                .layerCount = 1,
+            },
+            .imageOffset = {static_cast<s32>(rect.left), static_cast<s32>(rect.bottom), 0},
+            .imageExtent = {rect.GetWidth(), rect.GetHeight(), 1},
+        };
+
+        if (params.aspect & vk::ImageAspectFlagBits::eStencil) {
+            buffer_image_copies[0].imageSubresource.aspectMask = vk::ImageAspectFlagBits::eDepth;
+            vk::BufferImageCopy& stencil_copy = buffer_image_copies[1];
+            stencil_copy = buffer_image_copies[0];
+            stencil_copy.bufferOffset += UnpackDepthStencil(staging, format);
+            stencil_copy.imageSubresource.aspectMask = vk::ImageAspectFlagBits::eStencil;
+            num_copies++;
+        }
+
+        // This is the first use of the image, so the whole image transitions away from
+        // the undefined layout here instead of in TextureRuntime::InitImages.
+        const vk::ImageMemoryBarrier init_barrier = {
+            .srcAccessMask = vk::AccessFlagBits::eNone,
+            .dstAccessMask = vk::AccessFlagBits::eTransferWrite,
+            .oldLayout = vk::ImageLayout::eUndefined,
+            .newLayout = vk::ImageLayout::eTransferDstOptimal,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = params.src_image,
+            .subresourceRange{
+                .aspectMask = params.aspect,
+                .baseMipLevel = 0,
+                .levelCount = VK_REMAINING_MIP_LEVELS,
+                .baseArrayLayer = 0,
+                .layerCount = VK_REMAINING_ARRAY_LAYERS,
+            },
+        };
+
+        const vk::ImageMemoryBarrier write_barrier = {
+            .srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+            .dstAccessMask = dst_access,
+            .oldLayout = vk::ImageLayout::eTransferDstOptimal,
+            .newLayout = vk::ImageLayout::eGeneral,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = params.src_image,
+            .subresourceRange{
+                .aspectMask = params.aspect,
+                .baseMipLevel = 0,
+                .levelCount = VK_REMAINING_MIP_LEVELS,
+                .baseArrayLayer = 0,
+                .layerCount = VK_REMAINING_ARRAY_LAYERS,
+            },
+        };
+
+        cmdbuf.pipelineBarrier(vk::PipelineStageFlagBits::eTopOfPipe,
+                               vk::PipelineStageFlagBits::eTransfer,
+                               vk::DependencyFlagBits::eByRegion, {}, {}, init_barrier);
+
+        cmdbuf.copyBufferToImage(buffer, params.src_image, vk::ImageLayout::eTransferDstOptimal,
+                                 num_copies, buffer_image_copies.data());
+
+        cmdbuf.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, dst_stage,
+                               vk::DependencyFlagBits::eByRegion, {}, {}, write_barrier);
+    };
+
+    if (use_transfer_queue) {
+        runtime->SubmitTransfer(std::move(copy_func));
+    } else {
+        scheduler->RecordEarly(std::move(copy_func));
+    }
+
+    runtime->upload_buffer.Commit(staging.size);
+}
+
 void Surface::UploadCustom(const VideoCore::Material* material, u32 level) {
     const u32 width = material->width;
     const u32 height = material->height;
@@ -1033,6 +1240,7 @@ void Surface::Download(const VideoCore::BufferTextureCopy& download,
         runtime->download_buffer.Commit(staging.size);
     });
 
+    runtime->FlushInit(*this);
     runtime->renderpass_cache.EndRendering();
 
     if (is_depth_stencil) {
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <deque>
+#include <functional>
 #include <span>
+#include <vector>
 #include "video_core/rasterizer_cache/framebuffer_base.h"
 #include "video_core/rasterizer_cache/rasterizer_cache_base.h"
 #include "video_core/rasterizer_cache/surface_base.h"
@@ -53,6 +55,7 @@ struct Allocation : public HostTextureTag {
     vk::UniqueImageView storage_view{};
     bool is_framebuffer{};
     bool is_storage{};
+    bool needs_init{};
 
     operator bool() const noexcept {
         return image_views[0].get();
@@ -103,6 +106,21 @@ public:
     /// Returns true if the provided pixel format needs convertion
     [[nodiscard]] bool NeedsConversion(VideoCore::PixelFormat format) const;
 
+    /// Returns true if the provided custom pixel format can be sampled natively
+    [[nodiscard]] bool IsCustomFormatSupported(VideoCore::CustomPixelFormat format) const;
+
+    /// Returns true when uploads can be submitted on the dedicated transfer queue
+    [[nodiscard]] bool HasAsyncTransfers() const noexcept {
+        return static_cast<bool>(transfer_pool);
+    }
+
+    /// Records and submits the provided function on the dedicated transfer queue.
+    /// Returns the transfer timeline tick that marks its completion.
+    u64 SubmitTransfer(std::function<void(vk::CommandBuffer)>&& func);
+
+    /// Transitions a surface initialized on the transfer queue for graphics queue use
+    void FlushInit(Surface& surface);
+
     /// Returns a reference to the renderpass cache
     [[nodiscard]] RenderpassCache& GetRenderpassCache() {
         return renderpass_cache;
@@ -115,6 +133,10 @@ private:
     /// Takes back ownership of the allocation for recycling
     void Destroy(Allocation&& alloc);
 
+    /// Records the initial layout transition of freshly created images on the graphics queue
+    void InitImages(std::array<vk::Image, 3> raw_images, u32 num_images,
+                    vk::ImageAspectFlags aspect);
+
     /// Returns an allocation possibly resusing an existing one
     Allocation Allocate(const VideoCore::SurfaceParams& params,
                         const VideoCore::Material* material = nullptr);
@@ -137,6 +159,9 @@ private:
     StreamBuffer upload_buffer;
     StreamBuffer download_buffer;
     std::deque<std::pair<u64, Allocation>> destroy_queue;
+    vk::UniqueCommandPool transfer_pool;
+    std::deque<std::pair<u64, vk::UniqueCommandBuffer>> pending_transfers;
+    std::vector<vk::UniqueCommandBuffer> free_transfer_cmdbufs;
 };
 
 class Surface : public VideoCore::SurfaceBase {
@@ -197,6 +222,11 @@ public:
     vk::PipelineStageFlags PipelineStageFlags() const noexcept;
 
 private:
+    /// Uploads pixel data outside the draw command stream, performing the initial
+    /// layout transition of the image in the process
+    void UploadAsync(const VideoCore::BufferTextureCopy& upload,
+                     const VideoCore::StagingData& staging);
+
     /// Performs blit between the scaled/unscaled images
     void BlitScale(const VideoCore::TextureBlit& blit, bool up_scale);
 
@@ -13,7 +13,12 @@
 #include "video_core/regs_shader.h"
 #include "video_core/shader/shader.h"
 #include "video_core/shader/shader_interpreter.h"
+// Architectures with a native code generator define CITRA_SHADER_JIT and alias JitEngine to
+// their backend; everything else falls back to the interpreter. An AArch64 backend implementing
+// the same Compile_* opcode set is still pending an in-tree A64 assembler dependency, so ARM
+// hosts currently take the interpreter path.
 #if CITRA_ARCH(x86_64)
+#define CITRA_SHADER_JIT
 #include "video_core/shader/shader_jit_x64.h"
 #endif // CITRA_ARCH(x86_64)
 #include "video_core/video_core.h"
@@ -135,29 +140,32 @@ void GSUnitState::ConfigOutput(const ShaderRegs& config) {
 
 MICROPROFILE_DEFINE(GPU_Shader, "GPU", "Shader", MP_RGB(50, 50, 240));
 
+#ifdef CITRA_SHADER_JIT
 #if CITRA_ARCH(x86_64)
-static std::unique_ptr<JitX64Engine> jit_engine;
+using JitEngine = JitX64Engine;
 #endif // CITRA_ARCH(x86_64)
+static std::unique_ptr<JitEngine> jit_engine;
+#endif // CITRA_SHADER_JIT
 static InterpreterEngine interpreter_engine;
 
 ShaderEngine* GetEngine() {
-#if CITRA_ARCH(x86_64)
+#ifdef CITRA_SHADER_JIT
     // TODO(yuriks): Re-initialize on each change rather than being persistent
     if (VideoCore::g_shader_jit_enabled) {
         if (jit_engine == nullptr) {
-            jit_engine = std::make_unique<JitX64Engine>();
+            jit_engine = std::make_unique<JitEngine>();
         }
         return jit_engine.get();
     }
-#endif // CITRA_ARCH(x86_64)
+#endif // CITRA_SHADER_JIT
 
     return &interpreter_engine;
 }
 
 void Shutdown() {
-#if CITRA_ARCH(x86_64)
+#ifdef CITRA_SHADER_JIT
     jit_engine = nullptr;
-#endif // CITRA_ARCH(x86_64)
+#endif // CITRA_SHADER_JIT
 }
 
 } // namespace Pica::Shader
@@ -277,7 +277,8 @@ struct ShaderSetup {
     /// Data private to ShaderEngines
     struct EngineData {
         unsigned int entry_point;
-        /// Used by the JIT, points to a compiled shader object.
+        /// Points to an engine-owned object for this program: a compiled shader for the JIT, a
+        /// decoded program for the interpreter.
         const void* cached_shader = nullptr;
     } engine_data;
 
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <memory>
 #include <numeric>
 #include <boost/container/static_vector.hpp>
 #include <nihstro/shader_bytecode.h>
@@ -18,6 +19,7 @@
 #include "video_core/shader/shader.h"
 #include "video_core/shader/shader_interpreter.h"
 
+using nihstro::DestRegister;
 using nihstro::Instruction;
 using nihstro::OpCode;
 using nihstro::RegisterType;
@@ -35,9 +37,118 @@ struct CallStackElement {
     u32 loop_address;   // The address where we'll return to after each loop iteration
 };
 
+/// Indicates which register file a decoded destination operand writes to
+enum class DestRegisterKind : u8 {
+    Output,
+    Temporary,
+    None,
+};
+
+/// One shader instruction with the fields the execution loop needs pre-unpacked, so running it is
+/// plain loads instead of repeated Instruction/SwizzlePattern bitfield extraction per invocation
+struct DecodedInstruction {
+    Instruction instr; // Raw instruction; the flow control handlers read their fields directly
+    OpCode::Type type;
+    OpCode::Id opcode; // Effective opcode
+    SourceRegister src1_reg;
+    SourceRegister src2_reg;
+    SourceRegister src3_reg; // Only valid for MAD/MADI
+    std::array<u8, 4> src1_selector;
+    std::array<u8, 4> src2_selector;
+    std::array<u8, 4> src3_selector;
+    bool negate_src1;
+    bool negate_src2;
+    bool negate_src3;
+    bool is_inverted;
+    u8 address_register_index;
+    u8 dest_mask; // Bit i set if destination component i is written
+    DestRegisterKind dest_kind;
+    u8 dest_index;
+};
+
+/// A shader program decoded ahead of execution, cached per program/swizzle data hash
+struct DecodedProgram {
+    std::array<DecodedInstruction, MAX_PROGRAM_CODE_LENGTH> instructions;
+};
+
+static std::unique_ptr<DecodedProgram> DecodeProgram(const ShaderSetup& setup) {
+    auto program = std::make_unique<DecodedProgram>();
+
+    for (std::size_t offset = 0; offset < MAX_PROGRAM_CODE_LENGTH; ++offset) {
+        DecodedInstruction& dec = program->instructions[offset];
+        dec.instr = {setup.program_code[offset]};
+
+        const auto opcode_info = dec.instr.opcode.Value().GetInfo();
+        dec.type = opcode_info.type;
+        dec.opcode = dec.instr.opcode.Value().EffectiveOpCode();
+
+        unsigned operand_desc_id;
+        DestRegister dest;
+        if (dec.type == OpCode::Type::MultiplyAdd) {
+            operand_desc_id = dec.instr.mad.operand_desc_id;
+            dec.is_inverted = dec.opcode == OpCode::Id::MADI;
+            dec.address_register_index = static_cast<u8>(dec.instr.mad.address_register_index);
+            dec.src1_reg = dec.instr.mad.GetSrc1(dec.is_inverted);
+            dec.src2_reg = dec.instr.mad.GetSrc2(dec.is_inverted);
+            dec.src3_reg = dec.instr.mad.GetSrc3(dec.is_inverted);
+            dest = dec.instr.mad.dest.Value();
+        } else {
+            operand_desc_id = dec.instr.common.operand_desc_id;
+            dec.is_inverted = 0 != (opcode_info.subtype & OpCode::Info::SrcInversed);
+            dec.address_register_index = static_cast<u8>(dec.instr.common.address_register_index);
+            dec.src1_reg = dec.instr.common.GetSrc1(dec.is_inverted);
+            dec.src2_reg = dec.instr.common.GetSrc2(dec.is_inverted);
+            dec.src3_reg = dec.src1_reg;
+            dest = dec.instr.common.dest.Value();
+        }
+
+        const SwizzlePattern swizzle = {setup.swizzle_data[operand_desc_id]};
+        dec.src1_selector = {
+            static_cast<u8>(swizzle.src1_selector_0.Value()),
+            static_cast<u8>(swizzle.src1_selector_1.Value()),
+            static_cast<u8>(swizzle.src1_selector_2.Value()),
+            static_cast<u8>(swizzle.src1_selector_3.Value()),
+        };
+        dec.src2_selector = {
+            static_cast<u8>(swizzle.src2_selector_0.Value()),
+            static_cast<u8>(swizzle.src2_selector_1.Value()),
+            static_cast<u8>(swizzle.src2_selector_2.Value()),
+            static_cast<u8>(swizzle.src2_selector_3.Value()),
+        };
+        dec.src3_selector = {
+            static_cast<u8>(swizzle.src3_selector_0.Value()),
+            static_cast<u8>(swizzle.src3_selector_1.Value()),
+            static_cast<u8>(swizzle.src3_selector_2.Value()),
+            static_cast<u8>(swizzle.src3_selector_3.Value()),
+        };
+        dec.negate_src1 = swizzle.negate_src1 != 0;
+        dec.negate_src2 = swizzle.negate_src2 != 0;
+        dec.negate_src3 = swizzle.negate_src3 != 0;
+
+        dec.dest_mask = 0;
+        for (int i = 0; i < 4; ++i) {
+            if (swizzle.DestComponentEnabled(i))
+                dec.dest_mask |= 1 << i;
+        }
+
+        if (dest < 0x10) {
+            dec.dest_kind = DestRegisterKind::Output;
+            dec.dest_index = static_cast<u8>(dest.GetIndex());
+        } else if (dest < 0x20) {
+            dec.dest_kind = DestRegisterKind::Temporary;
+            dec.dest_index = static_cast<u8>(dest.GetIndex());
+        } else {
+            dec.dest_kind = DestRegisterKind::None;
+            dec.dest_index = 0;
+        }
+    }
+
+    return program;
+}
+
 template <bool Debug>
-static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData<Debug>& debug_data,
-                           unsigned offset) {
+static void RunInterpreter(const ShaderSetup& setup, const DecodedProgram& program,
+                           UnitState& state, DebugData<Debug>& debug_data, unsigned offset) {
     // TODO: Is there a maximal size for this?
     boost::container::static_vector<CallStackElement, 16> call_stack;
     u32 program_counter = offset;
@@ -76,8 +187,6 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
     };
 
     const auto& uniforms = setup.uniforms;
-    const auto& swizzle_data = setup.swizzle_data;
-    const auto& program_code = setup.program_code;
 
     // Placeholder for invalid inputs
     static float24 dummy_vec4_float24[4];
@@ -102,8 +211,8 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
             }
         }
 
-        const Instruction instr = {program_code[program_counter]};
-        const SwizzlePattern swizzle = {swizzle_data[instr.common.operand_desc_id]};
+        const DecodedInstruction& dec = program.instructions[program_counter];
+        const Instruction instr = dec.instr;
 
         Record<DebugDataRecord::CUR_INSTR>(debug_data, iteration, program_counter);
         if (iteration > 0)
@@ -127,66 +236,59 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
             }
         };
 
-        switch (instr.opcode.Value().GetInfo().type) {
+        switch (dec.type) {
         case OpCode::Type::Arithmetic: {
-            const bool is_inverted =
-                (0 != (instr.opcode.Value().GetInfo().subtype & OpCode::Info::SrcInversed));
-
             const int address_offset =
-                (instr.common.address_register_index == 0)
+                (dec.address_register_index == 0)
                     ? 0
-                    : state.address_registers[instr.common.address_register_index - 1];
-
-            const float24* src1_ = LookupSourceRegister(instr.common.GetSrc1(is_inverted) +
-                                                        (is_inverted ? 0 : address_offset));
-            const float24* src2_ = LookupSourceRegister(instr.common.GetSrc2(is_inverted) +
-                                                        (is_inverted ? address_offset : 0));
+                    : state.address_registers[dec.address_register_index - 1];
 
-            const bool negate_src1 = ((bool)swizzle.negate_src1 != false);
-            const bool negate_src2 = ((bool)swizzle.negate_src2 != false);
+            const float24* src1_ =
+                LookupSourceRegister(dec.src1_reg + (dec.is_inverted ? 0 : address_offset));
+            const float24* src2_ =
+                LookupSourceRegister(dec.src2_reg + (dec.is_inverted ? address_offset : 0));
 
             float24 src1[4] = {
-                src1_[(int)swizzle.src1_selector_0.Value()],
-                src1_[(int)swizzle.src1_selector_1.Value()],
-                src1_[(int)swizzle.src1_selector_2.Value()],
-                src1_[(int)swizzle.src1_selector_3.Value()],
+                src1_[dec.src1_selector[0]],
+                src1_[dec.src1_selector[1]],
+                src1_[dec.src1_selector[2]],
+                src1_[dec.src1_selector[3]],
             };
-            if (negate_src1) {
+            if (dec.negate_src1) {
                 src1[0] = -src1[0];
                 src1[1] = -src1[1];
                 src1[2] = -src1[2];
                 src1[3] = -src1[3];
             }
             float24 src2[4] = {
-                src2_[(int)swizzle.src2_selector_0.Value()],
-                src2_[(int)swizzle.src2_selector_1.Value()],
-                src2_[(int)swizzle.src2_selector_2.Value()],
-                src2_[(int)swizzle.src2_selector_3.Value()],
+                src2_[dec.src2_selector[0]],
+                src2_[dec.src2_selector[1]],
+                src2_[dec.src2_selector[2]],
+                src2_[dec.src2_selector[3]],
             };
-            if (negate_src2) {
+            if (dec.negate_src2) {
                 src2[0] = -src2[0];
                 src2[1] = -src2[1];
                 src2[2] = -src2[2];
                 src2[3] = -src2[3];
             }
 
-            float24* dest =
-                (instr.common.dest.Value() < 0x10)
-                    ? &state.registers.output[instr.common.dest.Value().GetIndex()][0]
-                : (instr.common.dest.Value() < 0x20)
-                    ? &state.registers.temporary[instr.common.dest.Value().GetIndex()][0]
-                    : dummy_vec4_float24;
+            float24* dest = (dec.dest_kind == DestRegisterKind::Output)
+                                ? &state.registers.output[dec.dest_index][0]
+                            : (dec.dest_kind == DestRegisterKind::Temporary)
+                                ? &state.registers.temporary[dec.dest_index][0]
+                                : dummy_vec4_float24;
 
             debug_data.max_opdesc_id =
                 std::max<u32>(debug_data.max_opdesc_id, 1 + instr.common.operand_desc_id);
 
-            switch (instr.opcode.Value().EffectiveOpCode()) {
+            switch (dec.opcode) {
             case OpCode::Id::ADD: {
                 Record<DebugDataRecord::SRC1>(debug_data, iteration, src1);
                 Record<DebugDataRecord::SRC2>(debug_data, iteration, src2);
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = src1[i] + src2[i];
@@ -200,7 +302,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 Record<DebugDataRecord::SRC2>(debug_data, iteration, src2);
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = src1[i] * src2[i];
@@ -213,7 +315,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 Record<DebugDataRecord::SRC1>(debug_data, iteration, src1);
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = float24::FromFloat32(std::floor(src1[i].ToFloat32()));
@@ -226,7 +328,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 Record<DebugDataRecord::SRC2>(debug_data, iteration, src2);
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     // NOTE: Exact form required to match NaN semantics to hardware:
@@ -242,7 +344,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 Record<DebugDataRecord::SRC2>(debug_data, iteration, src2);
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     // NOTE: Exact form required to match NaN semantics to hardware:
@@ -261,16 +363,15 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 Record<DebugDataRecord::SRC2>(debug_data, iteration, src2);
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
 
-                OpCode::Id opcode = instr.opcode.Value().EffectiveOpCode();
-                if (opcode == OpCode::Id::DPH || opcode == OpCode::Id::DPHI)
+                if (dec.opcode == OpCode::Id::DPH || dec.opcode == OpCode::Id::DPHI)
                     src1[3] = float24::FromFloat32(1.0f);
 
-                int num_components = (opcode == OpCode::Id::DP3) ? 3 : 4;
+                int num_components = (dec.opcode == OpCode::Id::DP3) ? 3 : 4;
                 float24 dot = std::inner_product(src1, src1 + num_components, src2,
                                                  float24::FromFloat32(0.f));
 
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = dot;
@@ -285,7 +386,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 float24 rcp_res = float24::FromFloat32(1.0f / src1[0].ToFloat32());
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = rcp_res;
@@ -300,7 +401,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 float24 rsq_res = float24::FromFloat32(1.0f / std::sqrt(src1[0].ToFloat32()));
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = rsq_res;
@@ -312,7 +413,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
             case OpCode::Id::MOVA: {
                 Record<DebugDataRecord::SRC1>(debug_data, iteration, src1);
                 for (int i = 0; i < 2; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     // TODO: Figure out how the rounding is done on hardware
@@ -327,7 +428,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 Record<DebugDataRecord::SRC1>(debug_data, iteration, src1);
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = src1[i];
@@ -342,7 +443,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 Record<DebugDataRecord::SRC2>(debug_data, iteration, src2);
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = (src1[i] >= src2[i]) ? float24::FromFloat32(1.0f)
@@ -357,7 +458,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 Record<DebugDataRecord::SRC2>(debug_data, iteration, src2);
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = (src1[i] < src2[i]) ? float24::FromFloat32(1.0f)
@@ -415,7 +516,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 // EX2 only takes first component exp2 and writes it to all dest components
                 float24 ex2_res = float24::FromFloat32(std::exp2(src1[0].ToFloat32()));
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = ex2_res;
@@ -432,7 +533,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
                 // LG2 only takes the first component log2 and writes it to all dest components
                 float24 lg2_res = float24::FromFloat32(std::log2(src1[0].ToFloat32()));
                 for (int i = 0; i < 4; ++i) {
-                    if (!swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = lg2_res;
@@ -454,78 +555,67 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
         }
 
         case OpCode::Type::MultiplyAdd: {
-            if ((instr.opcode.Value().EffectiveOpCode() == OpCode::Id::MAD) ||
-                (instr.opcode.Value().EffectiveOpCode() == OpCode::Id::MADI)) {
-                const SwizzlePattern& mad_swizzle = *reinterpret_cast<const SwizzlePattern*>(
-                    &swizzle_data[instr.mad.operand_desc_id]);
-
-                bool is_inverted = (instr.opcode.Value().EffectiveOpCode() == OpCode::Id::MADI);
-
+            if ((dec.opcode == OpCode::Id::MAD) || (dec.opcode == OpCode::Id::MADI)) {
                 const int address_offset =
-                    (instr.mad.address_register_index == 0)
+                    (dec.address_register_index == 0)
                         ? 0
-                        : state.address_registers[instr.mad.address_register_index - 1];
-
-                const float24* src1_ = LookupSourceRegister(instr.mad.GetSrc1(is_inverted));
-                const float24* src2_ = LookupSourceRegister(instr.mad.GetSrc2(is_inverted) +
-                                                            (!is_inverted * address_offset));
-                const float24* src3_ = LookupSourceRegister(instr.mad.GetSrc3(is_inverted) +
-                                                            (is_inverted * address_offset));
+                        : state.address_registers[dec.address_register_index - 1];
 
-                const bool negate_src1 = ((bool)mad_swizzle.negate_src1 != false);
-                const bool negate_src2 = ((bool)mad_swizzle.negate_src2 != false);
-                const bool negate_src3 = ((bool)mad_swizzle.negate_src3 != false);
+                const float24* src1_ = LookupSourceRegister(dec.src1_reg);
+                const float24* src2_ =
+                    LookupSourceRegister(dec.src2_reg + (!dec.is_inverted * address_offset));
+                const float24* src3_ =
+                    LookupSourceRegister(dec.src3_reg + (dec.is_inverted * address_offset));
 
                 float24 src1[4] = {
-                    src1_[(int)mad_swizzle.src1_selector_0.Value()],
-                    src1_[(int)mad_swizzle.src1_selector_1.Value()],
-                    src1_[(int)mad_swizzle.src1_selector_2.Value()],
-                    src1_[(int)mad_swizzle.src1_selector_3.Value()],
+                    src1_[dec.src1_selector[0]],
+                    src1_[dec.src1_selector[1]],
+                    src1_[dec.src1_selector[2]],
+                    src1_[dec.src1_selector[3]],
                 };
-                if (negate_src1) {
+                if (dec.negate_src1) {
                     src1[0] = -src1[0];
                     src1[1] = -src1[1];
                     src1[2] = -src1[2];
                     src1[3] = -src1[3];
                 }
                 float24 src2[4] = {
-                    src2_[(int)mad_swizzle.src2_selector_0.Value()],
-                    src2_[(int)mad_swizzle.src2_selector_1.Value()],
-                    src2_[(int)mad_swizzle.src2_selector_2.Value()],
-                    src2_[(int)mad_swizzle.src2_selector_3.Value()],
+                    src2_[dec.src2_selector[0]],
+                    src2_[dec.src2_selector[1]],
+                    src2_[dec.src2_selector[2]],
+                    src2_[dec.src2_selector[3]],
                 };
-                if (negate_src2) {
+                if (dec.negate_src2) {
                     src2[0] = -src2[0];
                     src2[1] = -src2[1];
                     src2[2] = -src2[2];
                     src2[3] = -src2[3];
                 }
                 float24 src3[4] = {
-                    src3_[(int)mad_swizzle.src3_selector_0.Value()],
-                    src3_[(int)mad_swizzle.src3_selector_1.Value()],
-                    src3_[(int)mad_swizzle.src3_selector_2.Value()],
-                    src3_[(int)mad_swizzle.src3_selector_3.Value()],
+                    src3_[dec.src3_selector[0]],
+                    src3_[dec.src3_selector[1]],
+                    src3_[dec.src3_selector[2]],
+                    src3_[dec.src3_selector[3]],
                 };
-                if (negate_src3) {
+                if (dec.negate_src3) {
                     src3[0] = -src3[0];
                     src3[1] = -src3[1];
                     src3[2] = -src3[2];
                     src3[3] = -src3[3];
                 }
 
-                float24* dest =
-                    (instr.mad.dest.Value() < 0x10)
-                        ? &state.registers.output[instr.mad.dest.Value().GetIndex()][0]
-                    : (instr.mad.dest.Value() < 0x20)
-                        ? &state.registers.temporary[instr.mad.dest.Value().GetIndex()][0]
-                        : dummy_vec4_float24;
+                float24* dest = (dec.dest_kind == DestRegisterKind::Output)
+                                    ? &state.registers.output[dec.dest_index][0]
+                                : (dec.dest_kind == DestRegisterKind::Temporary)
+                                    ? &state.registers.temporary[dec.dest_index][0]
+                                    : dummy_vec4_float24;
 
                 Record<DebugDataRecord::SRC1>(debug_data, iteration, src1);
                 Record<DebugDataRecord::SRC2>(debug_data, iteration, src2);
                 Record<DebugDataRecord::SRC3>(debug_data, iteration, src3);
                 Record<DebugDataRecord::DEST_IN>(debug_data, iteration, dest);
                 for (int i = 0; i < 4; ++i) {
-                    if (!mad_swizzle.DestComponentEnabled(i))
+                    if ((dec.dest_mask & (1 << i)) == 0)
                         continue;
 
                     dest[i] = src1[i] * src2[i] + src3[i];
@@ -541,7 +631,7 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
 
         default: {
             // Handle each instruction on its own
-            switch (instr.opcode.Value()) {
+            switch (dec.opcode) {
             case OpCode::Id::END:
                 exit_loop = true;
                 break;
@@ -668,16 +758,25 @@ static void RunInterpreter(const ShaderSetup& setup, UnitState& state, DebugData
 void InterpreterEngine::SetupBatch(ShaderSetup& setup, unsigned int entry_point) {
     ASSERT(entry_point < MAX_PROGRAM_CODE_LENGTH);
     setup.engine_data.entry_point = entry_point;
+
+    const u64 cache_key = setup.GetProgramCodeHash() ^ setup.GetSwizzleDataHash();
+    auto iter = cache.find(cache_key);
+    if (iter == cache.end()) {
+        iter = cache.emplace_hint(iter, cache_key, DecodeProgram(setup));
+    }
+    setup.engine_data.cached_shader = iter->second.get();
 }
 
 MICROPROFILE_DECLARE(GPU_Shader);
 
 void InterpreterEngine::Run(const ShaderSetup& setup, UnitState& state) const {
+    ASSERT(setup.engine_data.cached_shader != nullptr);
 
     MICROPROFILE_SCOPE(GPU_Shader);
 
+    const auto* program = static_cast<const DecodedProgram*>(setup.engine_data.cached_shader);
     DebugData<false> dummy_debug_data;
-    RunInterpreter(setup, state, dummy_debug_data, setup.engine_data.entry_point);
+    RunInterpreter(setup, *program, state, dummy_debug_data, setup.engine_data.entry_point);
 }
 
 DebugData<true> InterpreterEngine::ProduceDebugInfo(const ShaderSetup& setup,
@@ -686,10 +785,14 @@ DebugData<true> InterpreterEngine::ProduceDebugInfo(const ShaderSetup& setup,
     UnitState state;
     DebugData<true> debug_data;
 
+    // Decode locally instead of going through the cache: setup is const here and this path is
+    // only exercised by the shader debugger
+    const auto program = DecodeProgram(setup);
+
     // Setup input register table
     state.registers.input.fill(Common::Vec4<float24>::AssignToAll(float24::Zero()));
     state.LoadInput(config, input);
-    RunInterpreter(setup, state, debug_data, setup.engine_data.entry_point);
+    RunInterpreter(setup, *program, state, debug_data, setup.engine_data.entry_point);
     return debug_data;
 }
 
@@ -4,11 +4,15 @@
 
 #pragma once
 
+#include <memory>
+#include <unordered_map>
 #include "video_core/shader/debug_data.h"
 #include "video_core/shader/shader.h"
 
 namespace Pica::Shader {
 
+struct DecodedProgram;
+
 class InterpreterEngine final : public ShaderEngine {
 public:
     void SetupBatch(ShaderSetup& setup, unsigned int entry_point) override;
@@ -23,6 +27,9 @@ public:
      */
     DebugData<true> ProduceDebugInfo(const ShaderSetup& setup, const AttributeBuffer& input,
                                      const ShaderRegs& config) const;
+
+private:
+    std::unordered_map<u64, std::unique_ptr<DecodedProgram>> cache;
 };
 
 } // namespace Pica::Shader
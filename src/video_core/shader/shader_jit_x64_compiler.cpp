@@ -311,6 +311,16 @@ void JitShader::Compile_SanitizedMul(Xmm src1, Xmm src2, Xmm scratch) {
     // where neither source was, this NaN was generated by a 0 * inf multiplication, and so the
     // result should be transformed to 0 to match PICA fp rules.
 
+    if (Common::GetCPUCaps().avx) {
+        // The non-destructive three-operand forms spare the explicit copies of both sources
+        vcmpordps(scratch, src1, src2);
+        vmulps(src1, src1, src2);
+        vcmpunordps(src2, src1, src1);
+        vxorps(scratch, scratch, src2);
+        vandps(src1, src1, scratch);
+        return;
+    }
+
     // Set scratch to mask of (src1 != NaN and src2 != NaN)
     movaps(scratch, src1);
     cmpordps(scratch, src2);
@@ -379,11 +389,16 @@ void JitShader::Compile_DP3(Instruction instr) {
 
     Compile_SanitizedMul(SRC1, SRC2, SCRATCH);
 
-    movaps(SRC2, SRC1);
-    shufps(SRC2, SRC2, _MM_SHUFFLE(1, 1, 1, 1));
+    if (Common::GetCPUCaps().avx) {
+        vshufps(SRC2, SRC1, SRC1, _MM_SHUFFLE(1, 1, 1, 1));
+        vshufps(SRC3, SRC1, SRC1, _MM_SHUFFLE(2, 2, 2, 2));
+    } else {
+        movaps(SRC2, SRC1);
+        shufps(SRC2, SRC2, _MM_SHUFFLE(1, 1, 1, 1));
 
-    movaps(SRC3, SRC1);
-    shufps(SRC3, SRC3, _MM_SHUFFLE(2, 2, 2, 2));
+        movaps(SRC3, SRC1);
+        shufps(SRC3, SRC3, _MM_SHUFFLE(2, 2, 2, 2));
+    }
 
     shufps(SRC1, SRC1, _MM_SHUFFLE(0, 0, 0, 0));
     addps(SRC1, SRC2);
@@ -665,8 +680,12 @@ void JitShader::Compile_CMP(Instruction instr) {
         Xmm rhs_y = invert_op_y ? SRC1 : SRC2;
 
         // Compare X-component
-        movaps(SCRATCH, lhs_x);
-        cmpss(SCRATCH, rhs_x, cmp[op_x]);
+        if (Common::GetCPUCaps().avx) {
+            vcmpss(SCRATCH, lhs_x, rhs_x, cmp[op_x]);
+        } else {
+            movaps(SCRATCH, lhs_x);
+            cmpss(SCRATCH, rhs_x, cmp[op_x]);
+        }
 
         // Compare Y-component
         cmpps(lhs_y, rhs_y, cmp[op_y]);
@@ -124,4 +124,53 @@ Common::Vec3<u8> SampleETC1Subtile(u64 value, unsigned int x, unsigned int y) {
     return tile.GetRGB(x, y);
 }
 
+void DecodeETC1Subtile(u64 value, std::span<Common::Vec3<u8>, 16> out) {
+    const ETC1Tile tile{value};
+
+    // Derive the base color of each 2x4 subblock once
+    std::array<Common::Vec3<int>, 2> base;
+    if (tile.differential_mode) {
+        base[0].r() = static_cast<int>(tile.differential.r);
+        base[0].g() = static_cast<int>(tile.differential.g);
+        base[0].b() = static_cast<int>(tile.differential.b);
+        base[1].r() = base[0].r() + static_cast<int>(tile.differential.dr);
+        base[1].g() = base[0].g() + static_cast<int>(tile.differential.dg);
+        base[1].b() = base[0].b() + static_cast<int>(tile.differential.db);
+        for (auto& color : base) {
+            color.r() = Common::Color::Convert5To8(color.r());
+            color.g() = Common::Color::Convert5To8(color.g());
+            color.b() = Common::Color::Convert5To8(color.b());
+        }
+    } else {
+        base[0].r() = Common::Color::Convert4To8(static_cast<u8>(tile.separate.r1));
+        base[0].g() = Common::Color::Convert4To8(static_cast<u8>(tile.separate.g1));
+        base[0].b() = Common::Color::Convert4To8(static_cast<u8>(tile.separate.b1));
+        base[1].r() = Common::Color::Convert4To8(static_cast<u8>(tile.separate.r2));
+        base[1].g() = Common::Color::Convert4To8(static_cast<u8>(tile.separate.g2));
+        base[1].b() = Common::Color::Convert4To8(static_cast<u8>(tile.separate.b2));
+    }
+
+    const std::array<std::array<u8, 2>, 2> modifiers = {
+        etc1_modifier_table[tile.table_index_1],
+        etc1_modifier_table[tile.table_index_2],
+    };
+
+    for (unsigned texel = 0; texel < 16; texel++) {
+        const unsigned x = texel / 4;
+        const unsigned y = texel % 4;
+        // The subblock is selected by the x coordinate after the optional flip
+        const std::size_t subblock = (tile.flip ? y : x) >= 2 ? 1 : 0;
+
+        int modifier = modifiers[subblock][tile.GetTableSubIndex(texel)];
+        if (tile.GetNegationFlag(texel)) {
+            modifier = -modifier;
+        }
+
+        out[texel] = Common::Vec3<int>{std::clamp(base[subblock].r() + modifier, 0, 255),
+                                       std::clamp(base[subblock].g() + modifier, 0, 255),
+                                       std::clamp(base[subblock].b() + modifier, 0, 255)}
+                         .Cast<u8>();
+    }
+}
+
 } // namespace Pica::Texture
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <span>
 #include "common/common_types.h"
 #include "common/vector_math.h"
 
@@ -11,4 +12,8 @@ namespace Pica::Texture {
 
 Common::Vec3<u8> SampleETC1Subtile(u64 value, unsigned int x, unsigned int y);
 
+/// Decodes all 16 texels of a 4x4 ETC1 subtile at once, indexed by 4 * x + y. Much faster than
+/// sampling texel-by-texel since the base colors and modifier tables are only derived once.
+void DecodeETC1Subtile(u64 value, std::span<Common::Vec3<u8>, 16> out);
+
 } // namespace Pica::Texture
@@ -4,15 +4,34 @@
 
 #pragma once
 
+#include <array>
 #include "common/common_types.h"
 
 namespace VideoCore {
 
+/**
+ * Morton order offsets for a full 8x8 tile, indexed by y * 8 + x. Computed at compile time by
+ * interleaving the low three bits of each coordinate: x supplies the even bits, y the odd ones.
+ * Walking a tile row reads eight consecutive entries.
+ */
+constexpr std::array<u8, 64> MORTON_LUT = [] {
+    std::array<u8, 64> lut{};
+    for (u32 y = 0; y < 8; y++) {
+        for (u32 x = 0; x < 8; x++) {
+            u32 offset = 0;
+            for (u32 bit = 0; bit < 3; bit++) {
+                offset |= ((x >> bit) & 1) << (2 * bit);
+                offset |= ((y >> bit) & 1) << (2 * bit + 1);
+            }
+            lut[y * 8 + x] = static_cast<u8>(offset);
+        }
+    }
+    return lut;
+}();
+
 // 8x8 Z-Order coordinate from 2D coordinates
 static constexpr u32 MortonInterleave(u32 x, u32 y) {
-    constexpr u32 xlut[] = {0x00, 0x01, 0x04, 0x05, 0x10, 0x11, 0x14, 0x15};
-    constexpr u32 ylut[] = {0x00, 0x02, 0x08, 0x0a, 0x20, 0x22, 0x28, 0x2a};
-    return xlut[x % 8] + ylut[y % 8];
+    return MORTON_LUT[(y % 8) * 8 + (x % 8)];
 }
 
 /**
@@ -16,6 +16,61 @@
 
 namespace Pica {
 
+namespace {
+
+/// Fetch kernel for one attribute layout. The format and element count are baked in as template
+/// parameters so each instantiation compiles down to a short fixed-trip-count conversion loop the
+/// compiler can unroll and vectorize, instead of dispatching a switch per component at load time.
+template <typename T, unsigned num_elements>
+void FetchAttribute(const u8* src, Shader::AttributeBuffer& input, int attribute) {
+    const T* srcdata = reinterpret_cast<const T*>(src);
+    for (unsigned comp = 0; comp < num_elements; ++comp) {
+        input.attr[attribute][comp] = float24::FromFloat32(static_cast<float>(srcdata[comp]));
+    }
+
+    // Default attribute values set if array elements have < 4 components. This is *not* carried
+    // over from the default attribute settings even if they're enabled for this attribute.
+    for (unsigned comp = num_elements; comp < 4; ++comp) {
+        input.attr[attribute][comp] =
+            comp == 3 ? float24::FromFloat32(1.0f) : float24::FromFloat32(0.0f);
+    }
+}
+
+template <typename T>
+VertexLoader::AttributeFetcher GetFormatFetcher(unsigned num_elements) {
+    switch (num_elements) {
+    case 1:
+        return FetchAttribute<T, 1>;
+    case 2:
+        return FetchAttribute<T, 2>;
+    case 3:
+        return FetchAttribute<T, 3>;
+    case 4:
+        return FetchAttribute<T, 4>;
+    default:
+        UNREACHABLE();
+        return nullptr;
+    }
+}
+
+VertexLoader::AttributeFetcher GetAttributeFetcher(PipelineRegs::VertexAttributeFormat format,
+                                                   unsigned num_elements) {
+    switch (format) {
+    case PipelineRegs::VertexAttributeFormat::BYTE:
+        return GetFormatFetcher<s8>(num_elements);
+    case PipelineRegs::VertexAttributeFormat::UBYTE:
+        return GetFormatFetcher<u8>(num_elements);
+    case PipelineRegs::VertexAttributeFormat::SHORT:
+        return GetFormatFetcher<s16>(num_elements);
+    case PipelineRegs::VertexAttributeFormat::FLOAT:
+        return GetFormatFetcher<float>(num_elements);
+    }
+    UNREACHABLE();
+    return nullptr;
+}
+
+} // Anonymous namespace
+
 void VertexLoader::Setup(const PipelineRegs& regs) {
     ASSERT_MSG(!is_setup, "VertexLoader is not intended to be setup more than once.");
 
@@ -54,6 +109,11 @@ void VertexLoader::Setup(const PipelineRegs& regs) {
                     attribute_config.GetFormat(attribute_index);
                 vertex_attribute_elements[attribute_index] =
                     attribute_config.GetNumElements(attribute_index);
+                if (vertex_attribute_elements[attribute_index] != 0) {
+                    vertex_attribute_fetchers[attribute_index] =
+                        GetAttributeFetcher(vertex_attribute_formats[attribute_index],
+                                            vertex_attribute_elements[attribute_index]);
+                }
                 offset += attribute_config.GetStride(attribute_index);
             } else if (attribute_index < 16) {
                 // Attribute ids 12, 13, 14 and 15 signify 4, 8, 12 and 16-byte paddings,
@@ -93,48 +153,8 @@ void VertexLoader::LoadVertex(u32 base_address, int index, int vertex,
                              : 1));
             }
 
-            switch (vertex_attribute_formats[i]) {
-            case PipelineRegs::VertexAttributeFormat::BYTE: {
-                const s8* srcdata = reinterpret_cast<const s8*>(
-                    VideoCore::g_memory->GetPhysicalPointer(source_addr));
-                for (unsigned int comp = 0; comp < vertex_attribute_elements[i]; ++comp) {
-                    input.attr[i][comp] = float24::FromFloat32(srcdata[comp]);
-                }
-                break;
-            }
-            case PipelineRegs::VertexAttributeFormat::UBYTE: {
-                const u8* srcdata = reinterpret_cast<const u8*>(
-                    VideoCore::g_memory->GetPhysicalPointer(source_addr));
-                for (unsigned int comp = 0; comp < vertex_attribute_elements[i]; ++comp) {
-                    input.attr[i][comp] = float24::FromFloat32(srcdata[comp]);
-                }
-                break;
-            }
-            case PipelineRegs::VertexAttributeFormat::SHORT: {
-                const s16* srcdata = reinterpret_cast<const s16*>(
-                    VideoCore::g_memory->GetPhysicalPointer(source_addr));
-                for (unsigned int comp = 0; comp < vertex_attribute_elements[i]; ++comp) {
-                    input.attr[i][comp] = float24::FromFloat32(srcdata[comp]);
-                }
-                break;
-            }
-            case PipelineRegs::VertexAttributeFormat::FLOAT: {
-                const float* srcdata = reinterpret_cast<const float*>(
-                    VideoCore::g_memory->GetPhysicalPointer(source_addr));
-                for (unsigned int comp = 0; comp < vertex_attribute_elements[i]; ++comp) {
-                    input.attr[i][comp] = float24::FromFloat32(srcdata[comp]);
-                }
-                break;
-            }
-            }
-
-            // Default attribute values set if array elements have < 4 components. This
-            // is *not* carried over from the default attribute settings even if they're
-            // enabled for this attribute.
-            for (unsigned int comp = vertex_attribute_elements[i]; comp < 4; ++comp) {
-                input.attr[i][comp] =
-                    comp == 3 ? float24::FromFloat32(1.0f) : float24::FromFloat32(0.0f);
-            }
+            vertex_attribute_fetchers[i](VideoCore::g_memory->GetPhysicalPointer(source_addr),
+                                         input, i);
 
             LOG_TRACE(HW_GPU,
                       "Loaded {} components of attribute {:x} for vertex {:x} (index {:x}) from "
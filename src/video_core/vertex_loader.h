@@ -29,12 +29,17 @@ public:
         return num_total_attributes;
     }
 
+    /// Expands one attribute from its raw in-memory layout into four float24 components.
+    /// Specialized per format and element count so the per-vertex loop is branch-free.
+    using AttributeFetcher = void (*)(const u8* src, Shader::AttributeBuffer& input, int attribute);
+
 private:
     std::array<u32, 16> vertex_attribute_sources;
     std::array<u32, 16> vertex_attribute_strides{};
     std::array<PipelineRegs::VertexAttributeFormat, 16> vertex_attribute_formats;
     std::array<u32, 16> vertex_attribute_elements{};
     std::array<bool, 16> vertex_attribute_is_default;
+    std::array<AttributeFetcher, 16> vertex_attribute_fetchers{};
     int num_total_attributes = 0;
     bool is_setup = false;
 };
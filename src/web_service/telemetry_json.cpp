@@ -2,8 +2,13 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <fmt/format.h>
 #include <json.hpp>
 #include "common/detached_tasks.h"
+#include "common/file_util.h"
 #include "common/web_result.h"
 #include "web_service/telemetry_json.h"
 #include "web_service/web_backend.h"
@@ -12,6 +17,13 @@ namespace WebService {
 
 namespace Telemetry = Common::Telemetry;
 
+/// Maximum number of payloads kept in the on-disk queue; the oldest beyond this are dropped
+constexpr std::size_t MaxQueuedTelemetry = 16;
+
+static std::string TelemetryQueueDir() {
+    return FileUtil::GetUserPath(FileUtil::UserPath::ConfigDir) + "telemetry/";
+}
+
 struct TelemetryJson::Impl {
     Impl(std::string host, std::string username, std::string token)
         : host{std::move(host)}, username{std::move(username)}, token{std::move(token)} {}
@@ -108,9 +120,58 @@ void TelemetryJson::Complete() {
     impl->SerializeSection(Telemetry::FieldType::UserSystem, "UserSystem");
 
     auto content = impl->TopSection().dump();
+
+    // Spool the payload to disk first, so a submission cut short by the frontend's shutdown
+    // deadline is retried by PostQueuedTelemetry on the next session
+    const auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+                               std::chrono::system_clock::now().time_since_epoch())
+                               .count();
+    const std::string spool_dir = TelemetryQueueDir();
+    FileUtil::CreateFullPath(spool_dir);
+    const std::string spool_path = fmt::format("{}{}.json", spool_dir, timestamp);
+    FileUtil::WriteStringToFile(true, spool_path, content);
+
     // Send the telemetry async but don't handle the errors since they were written to the log
-    Common::DetachedTasks::AddTask([host{impl->host}, content]() {
-        Client{host, "", ""}.PostJson("/telemetry", content, true);
+    Common::DetachedTasks::AddTask([host{impl->host}, content, spool_path]() {
+        const auto result = Client{host, "", ""}.PostJson("/telemetry", content, true);
+        if (result.result_code == Common::WebResult::Code::Success) {
+            FileUtil::Delete(spool_path);
+        }
+    });
+}
+
+void PostQueuedTelemetry(const std::string& host) {
+    std::vector<std::string> pending;
+    FileUtil::ForeachDirectoryEntry(
+        nullptr, TelemetryQueueDir(),
+        [&pending](u64*, const std::string& directory, const std::string& virtual_name) {
+            pending.push_back(directory + virtual_name);
+            return true;
+        });
+    if (pending.empty()) {
+        return;
+    }
+    // The file names are millisecond timestamps, so this sorts oldest first
+    std::sort(pending.begin(), pending.end());
+    while (pending.size() > MaxQueuedTelemetry) {
+        FileUtil::Delete(pending.front());
+        pending.erase(pending.begin());
+    }
+
+    Common::DetachedTasks::AddTask([host, pending{std::move(pending)}]() {
+        for (const auto& path : pending) {
+            std::string content;
+            if (FileUtil::ReadFileToString(true, path, content) == 0) {
+                FileUtil::Delete(path);
+                continue;
+            }
+            const auto result = Client{host, "", ""}.PostJson("/telemetry", content, true);
+            if (result.result_code != Common::WebResult::Code::Success) {
+                // Leave the remainder of the queue for the next session
+                break;
+            }
+            FileUtil::Delete(path);
+        }
     });
 }
 
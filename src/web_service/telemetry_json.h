@@ -43,4 +43,11 @@ private:
     std::unique_ptr<Impl> impl;
 };
 
+/**
+ * Asynchronously resubmits telemetry payloads a previous session spooled to disk but could not
+ * deliver before shutdown. The on-disk queue is bounded; the oldest payloads beyond the cap are
+ * dropped.
+ */
+void PostQueuedTelemetry(const std::string& host);
+
 } // namespace WebService